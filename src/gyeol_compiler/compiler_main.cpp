@@ -1,13 +1,25 @@
+#include "gyeol_aot_tools.h"
+#include "gyeol_chunk_tools.h"
+#include "gyeol_comp_analyzer.h"
+#include "gyeol_compact_tools.h"
 #include "gyeol_graph_tools.h"
 #include "gyeol_json_export.h"
 #include "gyeol_json_ir_reader.h"
 #include "gyeol_json_ir_tooling.h"
+#include "gyeol_layout_tools.h"
 #include "gyeol_parser.h"
+#include "gyeol_pool_tools.h"
+#include "gyeol_profile_tools.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <string>
+#include <thread>
 #include <vector>
 
 using json = nlohmann::json;
@@ -41,7 +53,33 @@ bool writeTextFile(const std::string& path, const std::string& text) {
     return ofs.good();
 }
 
-bool parseGyeolStory(const std::string& path, Gyeol::Parser& outParser) {
+bool writeBinaryFile(const std::string& path, const std::vector<uint8_t>& data) {
+    std::ofstream ofs(path, std::ios::binary);
+    if (!ofs.is_open()) return false;
+    ofs.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return ofs.good();
+}
+
+// --profile로 받은 플레이 프로파일(gyeol-play-profile)을 모두 합친다
+bool loadPlayProfiles(const std::vector<std::string>& paths, Gyeol::ProfileTools::PlayProfile& profile) {
+    for (const auto& path : paths) {
+        json doc;
+        std::string error;
+        if (!Gyeol::JsonIrTooling::loadJsonFile(path, doc, &error) ||
+            !Gyeol::ProfileTools::mergePlayProfile(doc, profile, &error)) {
+            std::cerr << "error: " << path << ": " << error << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// jobs 0 = 하드웨어 스레드 수만큼 import된 파일을 병렬 파싱
+// cacheDir가 있으면 내용이 같은 파일의 파싱 결과(fragment)를 재사용
+bool parseGyeolStory(const std::string& path, Gyeol::Parser& outParser, unsigned jobs = 0,
+                     const std::string& cacheDir = "") {
+    outParser.setImportThreads(jobs > 0 ? jobs : std::max(1u, std::thread::hardware_concurrency()));
+    outParser.setFragmentCache(cacheDir, VERSION);
     if (outParser.parse(path)) return true;
     for (const auto& err : outParser.getErrors()) {
         std::cerr << "error: " << err << std::endl;
@@ -49,6 +87,13 @@ bool parseGyeolStory(const std::string& path, Gyeol::Parser& outParser) {
     return false;
 }
 
+bool readBinaryFile(const std::string& path, std::vector<uint8_t>& out) {
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs.is_open()) return false;
+    out.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    return !ifs.bad();
+}
+
 bool loadStoryFromJsonIr(const std::string& path, StoryT& outStory) {
     std::string error;
     if (!Gyeol::JsonIrReader::fromFile(path, outStory, &error)) {
@@ -97,7 +142,7 @@ void printUsage() {
         << "Gyeol Compiler v" << VERSION << "\n"
         << "Public (.gyeol authoring):\n"
         << "  GyeolCompiler --validate <story.gyeol>\n"
-        << "  GyeolCompiler --export-json-ir <story.gyeol> -o <story.json>\n"
+        << "  GyeolCompiler --export-json-ir <story.gyeol> -o <story.json> [--jobs N] [--cache-dir <dir>]\n"
         << "\n"
         << "Advanced/hidden:\n"
         << "  --validate-json-ir / --lint-json-ir / --format-json-ir\n"
@@ -105,6 +150,9 @@ void printUsage() {
         << "  --export-strings-po-from-json-ir / --export-locale-template\n"
         << "  --po-to-locale-json / --validate-locale-json / --build-locale-catalog\n"
         << "  --po-to-json (legacy locale v1)\n"
+        << "  --export-chunks <story.gyeol> -o <dir> [--profile <play.json>]... (lazy chunk loading)\n"
+        << "  --build-gyb <story.json> -o <story.gyb> [-O0|-O1|-O2 [--unobserved-visits]] [--compress-pool [--pool-dictionary <bytes>] [--pool-block <bytes>]] [--compact-instructions] [--layout source|bfs|dfs] [--layout-profile <profile.json>] [--profile <play.json>]...\n"
+        << "  --emit-cpp <story.gyb|story.json> -o <story_aot.cpp> [--name <symbol>] (AOT C++ for Runner::setAotProgram)\n"
         << "\n";
 }
 
@@ -143,14 +191,26 @@ int main(int argc, char* argv[]) {
 
     if (std::strcmp(argv[1], "--export-json-ir") == 0) {
         if (argc < 5) {
-            std::cerr << "error: usage --export-json-ir <story.gyeol> -o <story.json>" << std::endl;
+            std::cerr << "error: usage --export-json-ir <story.gyeol> -o <story.json> [--jobs N] [--cache-dir <dir>]"
+                      << std::endl;
             return 1;
         }
         std::string inputPath = argv[2];
         std::string outputPath;
+        unsigned jobs = 0;
+        std::string cacheDir;
         for (int i = 3; i < argc; ++i) {
             if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
                 outputPath = argv[++i];
+            } else if (std::strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+                const int value = std::atoi(argv[++i]);
+                if (value <= 0) {
+                    std::cerr << "error: --jobs must be a positive integer" << std::endl;
+                    return 1;
+                }
+                jobs = static_cast<unsigned>(value);
+            } else if (std::strcmp(argv[i], "--cache-dir") == 0 && i + 1 < argc) {
+                cacheDir = argv[++i];
             } else {
                 std::cerr << "error: unknown option '" << argv[i] << "'" << std::endl;
                 return 1;
@@ -162,7 +222,7 @@ int main(int argc, char* argv[]) {
         }
 
         Gyeol::Parser parser;
-        if (!parseGyeolStory(inputPath, parser)) return 1;
+        if (!parseGyeolStory(inputPath, parser, jobs, cacheDir)) return 1;
         if (!writeTextFile(outputPath, Gyeol::JsonExport::toJsonString(parser.getStory()))) {
             std::cerr << "error: failed to write JSON IR output: " << outputPath << std::endl;
             return 1;
@@ -553,17 +613,23 @@ int main(int argc, char* argv[]) {
 
     if (std::strcmp(argv[1], "--build-locale-catalog") == 0) {
         if (argc < 6) {
-            std::cerr << "error: usage --build-locale-catalog <localeA.json> <localeB.json> ... -o <catalog.json> [--default-locale <code>]" << std::endl;
+            std::cerr << "error: usage --build-locale-catalog <localeA.json> <localeB.json> ... -o <catalog.json|catalog.gylc> [--default-locale <code>] [--binary --story <story.json>]" << std::endl;
             return 1;
         }
         std::vector<std::string> localePaths;
         std::string outputPath;
         std::string defaultLocale;
+        std::string storyPath;
+        bool binary = false;
         for (int i = 2; i < argc; ++i) {
             if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
                 outputPath = argv[++i];
             } else if (std::strcmp(argv[i], "--default-locale") == 0 && i + 1 < argc) {
                 defaultLocale = argv[++i];
+            } else if (std::strcmp(argv[i], "--story") == 0 && i + 1 < argc) {
+                storyPath = argv[++i];
+            } else if (std::strcmp(argv[i], "--binary") == 0) {
+                binary = true;
             } else if (argv[i][0] == '-') {
                 std::cerr << "error: unknown option '" << argv[i] << "'" << std::endl;
                 return 1;
@@ -576,7 +642,18 @@ int main(int argc, char* argv[]) {
             return 1;
         }
         std::string error;
-        if (!Gyeol::LocaleTools::buildLocaleCatalog(localePaths, outputPath, defaultLocale, &error)) {
+        if (binary) {
+            if (storyPath.empty()) {
+                std::cerr << "error: --binary requires --story <story.json>." << std::endl;
+                return 1;
+            }
+            StoryT story;
+            if (!loadStoryFromJsonIr(storyPath, story)) return 1;
+            if (!Gyeol::LocaleTools::buildLocaleCatalogBinary(localePaths, story, outputPath, defaultLocale, &error)) {
+                std::cerr << "error: " << error << std::endl;
+                return 1;
+            }
+        } else if (!Gyeol::LocaleTools::buildLocaleCatalog(localePaths, outputPath, defaultLocale, &error)) {
             std::cerr << "error: " << error << std::endl;
             return 1;
         }
@@ -584,6 +661,227 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
+    if (std::strcmp(argv[1], "--export-chunks") == 0) {
+        if (argc < 5) {
+            std::cerr << "error: usage --export-chunks <story.gyeol> -o <dir> [--profile <play.json>]..." << std::endl;
+            return 1;
+        }
+        std::string inputPath = argv[2];
+        std::string outputDir;
+        std::vector<std::string> profilePaths;
+        for (int i = 3; i < argc; ++i) {
+            if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+                outputDir = argv[++i];
+            } else if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+                profilePaths.push_back(argv[++i]);
+            } else {
+                std::cerr << "error: unknown option '" << argv[i] << "'" << std::endl;
+                return 1;
+            }
+        }
+        if (outputDir.empty()) {
+            std::cerr << "error: missing -o <dir>" << std::endl;
+            return 1;
+        }
+
+        // 프로파일이 있으면 hot 노드가 든 모듈은 루트 청크에 합치고 cold 모듈만 지연 로딩
+        Gyeol::ProfileTools::PlayProfile profile;
+        if (!loadPlayProfiles(profilePaths, profile)) return 1;
+        const auto rootNodes = Gyeol::ProfileTools::hotNodes(profile);
+
+        Gyeol::Parser parser;
+        if (!parseGyeolStory(inputPath, parser)) return 1;
+        std::string error;
+        if (!Gyeol::ChunkTools::writeStoryChunks(parser.getStory(), parser.getNodeSourceFiles(), outputDir, &error,
+                                                 rootNodes)) {
+            std::cerr << "error: " << error << std::endl;
+            return 1;
+        }
+        std::cout << "Exported story chunks: " << inputPath << " -> " << outputDir << std::endl;
+        return 0;
+    }
+
+    if (std::strcmp(argv[1], "--build-gyb") == 0) {
+        if (argc < 5) {
+            std::cerr << "error: usage --build-gyb <story.json> -o <story.gyb> [-O0|-O1|-O2 [--unobserved-visits]] [--compress-pool [--pool-dictionary <bytes>] [--pool-block <bytes>]] [--compact-instructions] [--layout source|bfs|dfs] [--layout-profile <profile.json>] [--profile <play.json>]..." << std::endl;
+            return 1;
+        }
+        std::string inputPath = argv[2];
+        std::string outputPath;
+        bool compressPool = false;
+        bool compactInstructions = false;
+        bool layoutNodes = false;
+        std::string layoutProfilePath;
+        std::vector<std::string> profilePaths;
+        Gyeol::LayoutTools::LayoutOptions layoutOptions;
+        int optimizeLevel = 0;
+        bool unobservedVisits = false;
+        Gyeol::PoolTools::PoolCompressionOptions poolOptions;
+        for (int i = 3; i < argc; ++i) {
+            if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+                outputPath = argv[++i];
+            } else if (std::strcmp(argv[i], "-O0") == 0 || std::strcmp(argv[i], "-O1") == 0 ||
+                       std::strcmp(argv[i], "-O2") == 0) {
+                optimizeLevel = argv[i][2] - '0';
+            } else if (std::strcmp(argv[i], "--unobserved-visits") == 0) {
+                unobservedVisits = true;
+            } else if (std::strcmp(argv[i], "--compress-pool") == 0) {
+                compressPool = true;
+            } else if (std::strcmp(argv[i], "--compact-instructions") == 0) {
+                compactInstructions = true;
+            } else if (std::strcmp(argv[i], "--layout") == 0 && i + 1 < argc) {
+                const std::string order = argv[++i];
+                if (order == "source") {
+                    layoutOptions.order = Gyeol::LayoutTools::NodeOrder::SOURCE;
+                } else if (order == "bfs") {
+                    layoutOptions.order = Gyeol::LayoutTools::NodeOrder::BFS;
+                } else if (order == "dfs") {
+                    layoutOptions.order = Gyeol::LayoutTools::NodeOrder::DFS;
+                } else {
+                    std::cerr << "error: --layout must be source, bfs or dfs" << std::endl;
+                    return 1;
+                }
+                layoutNodes = true;
+            } else if (std::strcmp(argv[i], "--layout-profile") == 0 && i + 1 < argc) {
+                layoutProfilePath = argv[++i];
+                layoutNodes = true;
+            } else if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+                profilePaths.push_back(argv[++i]);
+                layoutNodes = true;
+            } else if (std::strcmp(argv[i], "--pool-dictionary") == 0 && i + 1 < argc) {
+                poolOptions.dictionaryBytes = static_cast<size_t>(std::strtoul(argv[++i], nullptr, 10));
+            } else if (std::strcmp(argv[i], "--pool-block") == 0 && i + 1 < argc) {
+                poolOptions.blockBytes = static_cast<size_t>(std::strtoul(argv[++i], nullptr, 10));
+            } else {
+                std::cerr << "error: unknown option '" << argv[i] << "'" << std::endl;
+                return 1;
+            }
+        }
+        if (outputPath.empty()) {
+            std::cerr << "error: missing -o <story.gyb>" << std::endl;
+            return 1;
+        }
+
+        // 최적화/배치/풀 압축/명령 압축은 전체 StoryT가 필요하다. 아니면 노드를 읽는 대로 버퍼에 쓰는 스트리밍 경로
+        std::vector<uint8_t> buffer;
+        std::string error;
+        if (!layoutProfilePath.empty()) {
+            json profile;
+            if (!Gyeol::JsonIrTooling::loadJsonFile(layoutProfilePath, profile, &error) ||
+                !Gyeol::LayoutTools::loadNodeWeights(profile, layoutOptions.nodeWeights, &error)) {
+                std::cerr << "error: " << error << std::endl;
+                return 1;
+            }
+        }
+        // 플레이 프로파일: hot 노드 먼저 배치, hot call 대상 인라인(-O2), hot 대사 보간 템플릿 표시
+        Gyeol::ProfileTools::PlayProfile playProfile;
+        if (!loadPlayProfiles(profilePaths, playProfile)) return 1;
+        if (!profilePaths.empty()) {
+            for (const auto& [name, visits] : Gyeol::ProfileTools::nodeWeights(playProfile)) {
+                layoutOptions.nodeWeights[name] += visits;
+            }
+        }
+        if (compressPool || compactInstructions || layoutNodes || optimizeLevel > 0) {
+            StoryT story;
+            if (!loadStoryFromJsonIr(inputPath, story)) return 1;
+            if (optimizeLevel > 0) {
+                Gyeol::CompilerAnalyzer analyzer;
+                analyzer.setHotCallTargets(Gyeol::ProfileTools::hotCallTargets(playProfile));
+                analyzer.setVisitCountsUnobserved(unobservedVisits);
+                Gyeol::AnalysisReport report;
+                analyzer.optimize(story, optimizeLevel, &report);
+                const auto& opt = report.optimizations;
+                std::cout << "Optimized (-O" << optimizeLevel << "): "
+                          << opt.foldedExpressions << " folded, "
+                          << opt.propagatedConstants << " propagated, "
+                          << opt.foldedConditions << " conditions, "
+                          << opt.threadedJumps << " threaded jumps, "
+                          << opt.inlinedCalls << " inlined calls, "
+                          << opt.removedDeadInstructions << " dead instructions, "
+                          << opt.removedDeadStores << " dead stores, "
+                          << opt.removedUnreachableNodes << " unreachable nodes" << std::endl;
+            }
+            if (!profilePaths.empty()) {
+                const size_t hotTemplates = Gyeol::ProfileTools::markHotTemplates(story, playProfile);
+                std::cout << "Profile (" << playProfile.sessions << " sessions): "
+                          << hotTemplates << " hot templates" << std::endl;
+            }
+            // 배치는 pool 순서를 바꾸므로 압축보다 먼저
+            if (layoutNodes && !Gyeol::LayoutTools::layoutStory(story, layoutOptions, &error)) {
+                std::cerr << "error: " << error << std::endl;
+                return 1;
+            }
+            if (compressPool && !Gyeol::PoolTools::compressStringPool(story, poolOptions, &error)) {
+                std::cerr << "error: " << error << std::endl;
+                return 1;
+            }
+            if (compactInstructions) {
+                const size_t compacted = Gyeol::CompactTools::compactInstructions(story);
+                std::cout << "Compacted " << compacted << " instructions" << std::endl;
+            }
+            buffer = Gyeol::JsonIrReader::compileToBuffer(story);
+        } else if (!Gyeol::JsonIrReader::compileFileToBuffer(inputPath, buffer, &error)) {
+            std::cerr << "error: " << error << std::endl;
+            return 1;
+        }
+        if (!writeBinaryFile(outputPath, buffer)) {
+            std::cerr << "error: failed to write story buffer: " << outputPath << std::endl;
+            return 1;
+        }
+        std::cout << "Built story buffer: " << inputPath << " -> " << outputPath
+                  << " (" << buffer.size() << " bytes)" << std::endl;
+        return 0;
+    }
+
+    if (std::strcmp(argv[1], "--emit-cpp") == 0) {
+        if (argc < 5) {
+            std::cerr << "error: usage --emit-cpp <story.gyb|story.json> -o <story_aot.cpp> [--name <symbol>]" << std::endl;
+            return 1;
+        }
+        std::string inputPath = argv[2];
+        std::string outputPath;
+        std::string symbolName = "story";
+        for (int i = 3; i < argc; ++i) {
+            if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+                outputPath = argv[++i];
+            } else if (std::strcmp(argv[i], "--name") == 0 && i + 1 < argc) {
+                symbolName = argv[++i];
+            } else {
+                std::cerr << "error: unknown option '" << argv[i] << "'" << std::endl;
+                return 1;
+            }
+        }
+        if (outputPath.empty()) {
+            std::cerr << "error: missing -o <story_aot.cpp>" << std::endl;
+            return 1;
+        }
+
+        // 생성 코드는 이 바이트와 같은 .gyb를 start()할 때만 켜진다.
+        // JSON IR 입력은 fromFile + compileToBuffer (게임이 JSON IR을 직접 컴파일할 때와 같은 바이트)
+        std::vector<uint8_t> buffer;
+        if (std::filesystem::path(inputPath).extension() == ".json") {
+            StoryT story;
+            if (!loadStoryFromJsonIr(inputPath, story)) return 1;
+            buffer = Gyeol::JsonIrReader::compileToBuffer(story);
+        } else if (!readBinaryFile(inputPath, buffer)) {
+            std::cerr << "error: failed to read story buffer: " << inputPath << std::endl;
+            return 1;
+        }
+        std::string source;
+        std::string error;
+        if (!Gyeol::AotTools::emitCpp(buffer, symbolName, source, &error)) {
+            std::cerr << "error: " << error << std::endl;
+            return 1;
+        }
+        if (!writeTextFile(outputPath, source)) {
+            std::cerr << "error: failed to write C++ source: " << outputPath << std::endl;
+            return 1;
+        }
+        std::cout << "Emitted AOT C++: " << inputPath << " -> " << outputPath
+                  << " (gyeolAot_" << symbolName << ")" << std::endl;
+        return 0;
+    }
+
     printUsage();
     return 1;
 }
@@ -0,0 +1,438 @@
+#include "gyeol_aot_tools.h"
+#include "gyeol_aot.h"
+#include "gyeol_compact_tools.h"
+#include "gyeol_expr_tools.h"
+#include "gyeol_generated.h"
+
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <unordered_map>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol::AotTools {
+
+namespace {
+
+bool setError(std::string* errorOut, const std::string& message) {
+    if (errorOut) *errorOut = message;
+    return false;
+}
+
+bool isIdentifier(const std::string& s) {
+    if (s.empty() || (s[0] >= '0' && s[0] <= '9')) return false;
+    for (char c : s) {
+        const bool ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        if (!ok) return false;
+    }
+    return true;
+}
+
+// C++ 문자열 리터럴. 비ASCII/제어 문자는 3자리 8진 escape.
+std::string quoted(const std::string& s) {
+    std::string out = "\"";
+    for (unsigned char c : s) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += static_cast<char>(c);
+        } else if (c < 0x20 || c >= 0x7F) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\%03o", c);
+            out += buf;
+        } else {
+            out += static_cast<char>(c);
+        }
+    }
+    return out + "\"";
+}
+
+// 길이를 함께 넘겨 NUL이 든 문자열도 그대로 만든다
+std::string cppString(const std::string& s) {
+    return "std::string(" + quoted(s) + ", " + std::to_string(s.size()) + ")";
+}
+
+// 주석에 넣을 노드 이름 (출력 가능한 ASCII만)
+std::string commentText(const std::string& s) {
+    std::string out;
+    for (unsigned char c : s) out += (c >= 0x20 && c < 0x7F) ? static_cast<char>(c) : '?';
+    return out;
+}
+
+std::string intLiteral(int32_t v) {
+    if (v == INT32_MIN) return "(-2147483647 - 1)";
+    return std::to_string(v);
+}
+
+// 식 값: code가 Variant 식인지 bool 식인지
+struct Operand {
+    std::string code;
+    bool isBool = false;
+};
+
+class Emitter {
+public:
+    explicit Emitter(const StoryT& story) : story_(story) {
+        for (size_t i = 0; i < story.nodes.size(); ++i) {
+            if (story.nodes[i]) nodeIndex_.emplace(story.nodes[i]->name, static_cast<int32_t>(i));
+        }
+    }
+
+    std::string emit(const std::string& symbolName, uint64_t hash, uint64_t size) {
+        std::ostringstream functions;
+        for (size_t i = 0; i < story_.nodes.size(); ++i) emitNode(i, functions);
+
+        std::ostringstream out;
+        out << "// GyeolCompiler --emit-cpp 생성 파일. 직접 고치지 말고 .gyb에서 다시 생성한다.\n"
+            << "// 원본 .gyb: " << size << " bytes, " << story_.nodes.size() << " nodes, "
+            << nativeCount_ << " native / " << delegatedCount_ << " delegated instructions\n"
+            << "#include \"gyeol_aot.h\"\n\n"
+            << "#include <string>\n"
+            << "#include <vector>\n\n"
+            << "namespace {\n\n"
+            << "using Gyeol::AotContext;\n"
+            << "using Gyeol::StepResult;\n"
+            << "using Gyeol::Variant;\n\n";
+        for (const auto& [symbol, text] : nameDecls_) {
+            out << "const std::string " << symbol << " = " << cppString(text) << ";\n";
+        }
+        for (const auto& [symbol, init] : valueDecls_) {
+            out << "const Variant " << symbol << " = " << init << ";\n";
+        }
+        if (!nameDecls_.empty() || !valueDecls_.empty()) out << "\n";
+        out << functions.str();
+
+        const size_t count = story_.nodes.size();
+        if (count > 0) {
+            out << "const char* const kNodeNames[] = {\n";
+            for (const auto& node : story_.nodes) {
+                out << "    " << quoted(node ? node->name : std::string()) << ",\n";
+            }
+            out << "};\n\n";
+            out << "const Gyeol::AotNodeFn kNodes[] = {\n";
+            for (size_t i = 0; i < count; ++i) out << "    node" << i << ",\n";
+            out << "};\n\n";
+        }
+        out << "const Gyeol::AotProgram kProgram = {\n"
+            << "    " << hash << "ull,\n"
+            << "    " << size << "ull,\n"
+            << "    " << count << ",\n"
+            << "    " << (count > 0 ? "kNodeNames" : "nullptr") << ",\n"
+            << "    " << (count > 0 ? "kNodes" : "nullptr") << ",\n"
+            << "};\n\n"
+            << "} // namespace\n\n"
+            << "const Gyeol::AotProgram* gyeolAot_" << symbolName << "() {\n"
+            << "    return &kProgram;\n"
+            << "}\n";
+        return out.str();
+    }
+
+private:
+    const StoryT& story_;
+    std::unordered_map<std::string, int32_t> nodeIndex_; // 같은 이름이면 첫 노드 (런타임과 같음)
+    std::map<std::string, std::string> nameSymbols_;     // 문자열 → 심볼
+    std::map<std::string, std::string> valueSymbols_;    // 초기화 식 → 심볼
+    std::vector<std::pair<std::string, std::string>> nameDecls_;
+    std::vector<std::pair<std::string, std::string>> valueDecls_;
+    size_t nativeCount_ = 0;
+    size_t delegatedCount_ = 0;
+
+    const std::string& poolText(int32_t id) const {
+        static const std::string kEmpty;
+        if (id < 0 || static_cast<size_t>(id) >= story_.string_pool.size()) return kEmpty;
+        return story_.string_pool[static_cast<size_t>(id)];
+    }
+
+    // 변수/노드 이름은 파일 범위 std::string 하나로 모은다 (매 실행 문자열 생성 없음)
+    std::string nameSymbol(int32_t id) {
+        const std::string& text = poolText(id);
+        auto it = nameSymbols_.find(text);
+        if (it != nameSymbols_.end()) return it->second;
+        std::string symbol = "kName" + std::to_string(nameDecls_.size());
+        nameSymbols_.emplace(text, symbol);
+        nameDecls_.emplace_back(symbol, text);
+        return symbol;
+    }
+
+    std::string valueSymbol(const std::string& init) {
+        auto it = valueSymbols_.find(init);
+        if (it != valueSymbols_.end()) return it->second;
+        std::string symbol = "kValue" + std::to_string(valueDecls_.size());
+        valueSymbols_.emplace(init, symbol);
+        valueDecls_.emplace_back(symbol, init);
+        return symbol;
+    }
+
+    // 런타임 readValueData와 같은 값
+    bool literal(const ValueDataUnion& value, std::string& out) {
+        switch (value.type) {
+            case ValueData::BoolValue:
+                out = std::string("Variant::Bool(") + (value.AsBoolValue()->val ? "true" : "false") + ")";
+                return true;
+            case ValueData::IntValue:
+                out = "Variant::Int(" + intLiteral(value.AsIntValue()->val) + ")";
+                return true;
+            case ValueData::FloatValue: {
+                const float f = value.AsFloatValue()->val;
+                if (!std::isfinite(f)) return false;
+                char buf[32];
+                std::snprintf(buf, sizeof(buf), "%.9g", static_cast<double>(f));
+                std::string text = buf;
+                if (text.find_first_of(".e") == std::string::npos) text += ".0";
+                out = "Variant::Float(" + text + "f)";
+                return true;
+            }
+            case ValueData::StringRef:
+                out = valueSymbol("Variant::String(" + cppString(poolText(value.AsStringRef()->index)) + ")");
+                return true;
+            case ValueData::ListValue: {
+                std::string init = "Variant::List(std::vector<std::string>{";
+                bool first = true;
+                for (int32_t id : value.AsListValue()->items) {
+                    if (id < 0 || static_cast<size_t>(id) >= story_.string_pool.size()) continue;
+                    if (!first) init += ", ";
+                    init += cppString(poolText(id));
+                    first = false;
+                }
+                out = valueSymbol(init + "})");
+                return true;
+            }
+            default:
+                out = "Variant::Int(0)";
+                return true;
+        }
+    }
+
+    static std::string asVariant(const Operand& op) {
+        return op.isBool ? "Variant::Bool(" + op.code + ")" : op.code;
+    }
+
+    static std::string asBool(const Operand& op) {
+        return op.isBool ? op.code : "Gyeol::Aot::truthy(" + op.code + ")";
+    }
+
+    // RPN을 중첩 C++ 식으로 바꾼다. 스택이 모자라는 식은 false (인터프리터에 위임)
+    bool expression(const ExpressionT* source, Operand& out) {
+        if (!source || source->tokens.empty()) {
+            out = {"Variant::Int(0)", false};
+            return true;
+        }
+        ExpressionT expr(*source);
+        ExprTools::removeShortCircuitSkips(expr);
+
+        std::vector<Operand> stack;
+        auto binary = [&](const char* fn, bool isBool) {
+            if (stack.size() < 2) return false;
+            Operand rhs = std::move(stack.back()); stack.pop_back();
+            Operand lhs = std::move(stack.back()); stack.pop_back();
+            stack.push_back({std::string("Gyeol::Aot::") + fn + "(" + asVariant(lhs) + ", " + asVariant(rhs) + ")", isBool});
+            return true;
+        };
+        auto logical = [&](const char* op) {
+            if (stack.size() < 2) return false;
+            Operand rhs = std::move(stack.back()); stack.pop_back();
+            Operand lhs = std::move(stack.back()); stack.pop_back();
+            stack.push_back({"(" + asBool(lhs) + " " + op + " " + asBool(rhs) + ")", true});
+            return true;
+        };
+
+        for (const auto& token : expr.tokens) {
+            if (!token) return false;
+            bool ok = true;
+            switch (token->op) {
+                case ExprOp::PushLiteral: {
+                    std::string code;
+                    if (!literal(token->literal_value, code)) return false;
+                    stack.push_back({code, false});
+                    break;
+                }
+                case ExprOp::PushVar:
+                    stack.push_back({"ctx.get(" + nameSymbol(token->var_name_id) + ")", false});
+                    break;
+                case ExprOp::Add: ok = binary("add", false); break;
+                case ExprOp::Sub: ok = binary("sub", false); break;
+                case ExprOp::Mul: ok = binary("mul", false); break;
+                case ExprOp::Div: ok = binary("div", false); break;
+                case ExprOp::Mod: ok = binary("mod", false); break;
+                case ExprOp::Negate:
+                    if (stack.empty()) return false;
+                    stack.back() = {"Gyeol::Aot::neg(" + asVariant(stack.back()) + ")", false};
+                    break;
+                case ExprOp::CmpEq: ok = binary("eq", true); break;
+                case ExprOp::CmpNe: ok = binary("ne", true); break;
+                case ExprOp::CmpGt: ok = binary("gt", true); break;
+                case ExprOp::CmpLt: ok = binary("lt", true); break;
+                case ExprOp::CmpGe: ok = binary("ge", true); break;
+                case ExprOp::CmpLe: ok = binary("le", true); break;
+                case ExprOp::And: ok = logical("&&"); break;
+                case ExprOp::Or: ok = logical("||"); break;
+                case ExprOp::Not:
+                    if (stack.empty()) return false;
+                    stack.back() = {"!" + asBool(stack.back()), true};
+                    break;
+                case ExprOp::PushVisitCount:
+                    stack.push_back({"Variant::Int(ctx.visitCount(" + nameSymbol(token->var_name_id) + "))", false});
+                    break;
+                case ExprOp::PushVisited:
+                    stack.push_back({"(ctx.visitCount(" + nameSymbol(token->var_name_id) + ") > 0)", true});
+                    break;
+                case ExprOp::ListContains: ok = binary("contains", true); break;
+                case ExprOp::ListLength:
+                    stack.push_back({"Variant::Int(ctx.listLength(" + nameSymbol(token->var_name_id) + "))", false});
+                    break;
+                default:
+                    return false;
+            }
+            if (!ok) return false;
+        }
+        out = std::move(stack.back());
+        return true;
+    }
+
+    // 이 스토리 안의 대상 노드 인덱스. 대상 없음(-1)은 -1, 찾지 못하면 false (청크 밖 등 → 위임)
+    bool target(int32_t nameId, int32_t& outIndex) const {
+        outIndex = -1;
+        if (nameId < 0) return true;
+        auto it = nodeIndex_.find(poolText(nameId));
+        if (it == nodeIndex_.end()) return false;
+        outIndex = it->second;
+        return true;
+    }
+
+    // 네이티브로 만들 수 있으면 case 본문을 body에 쓰고 true. terminal = 본문이 항상 return으로 끝남
+    bool nativeInstruction(const InstructionT& instr, std::string& body, bool& terminal) {
+        const std::string ind = "        ";
+        switch (instr.data.type) {
+            case OpData::SetVar: {
+                auto* setVar = instr.data.AsSetVar();
+                if (setVar->assign_op != AssignOp::Assign) return false;
+                std::string value;
+                if (setVar->expr) {
+                    Operand op;
+                    if (!expression(setVar->expr.get(), op)) return false;
+                    value = asVariant(op);
+                } else if (!literal(setVar->value, value)) {
+                    return false;
+                }
+                body = ind + "ctx.assign(" + nameSymbol(setVar->var_name_id) + ", " + value + ");\n";
+                return true;
+            }
+            case OpData::Condition: {
+                auto* cond = instr.data.AsCondition();
+                int32_t onTrue = -1;
+                int32_t onFalse = -1;
+                if (!target(cond->true_jump_node_id, onTrue) || !target(cond->false_jump_node_id, onFalse)) return false;
+                std::string test;
+                if (cond->cond_expr) {
+                    Operand op;
+                    if (!expression(cond->cond_expr.get(), op)) return false;
+                    test = asBool(op);
+                } else {
+                    std::string lhs = "ctx.get(" + nameSymbol(cond->var_name_id) + ")";
+                    std::string rhs = "Variant::Int(0)";
+                    Operand op;
+                    if (cond->lhs_expr) {
+                        if (!expression(cond->lhs_expr.get(), op)) return false;
+                        lhs = asVariant(op);
+                    }
+                    if (cond->rhs_expr) {
+                        if (!expression(cond->rhs_expr.get(), op)) return false;
+                        rhs = asVariant(op);
+                    } else if (cond->compare_value.type != ValueData::NONE && !literal(cond->compare_value, rhs)) {
+                        return false;
+                    }
+                    static const char* const kCompare[] = {"eq", "ne", "gt", "lt", "ge", "le"};
+                    const auto opIndex = static_cast<size_t>(cond->op);
+                    if (opIndex >= 6) return false;
+                    test = std::string("Gyeol::Aot::") + kCompare[opIndex] + "(" + lhs + ", " + rhs + ")";
+                }
+                body = ind + "ctx.countCondition();\n";
+                if (onTrue >= 0 && onFalse >= 0) {
+                    body += ind + "ctx.jump(" + test + " ? " + std::to_string(onTrue) + " : " +
+                            std::to_string(onFalse) + ");\n" + ind + "return false;\n";
+                    terminal = true;
+                } else if (onTrue >= 0) {
+                    body += ind + "if (" + test + ") {\n" + ind + "    ctx.jump(" + std::to_string(onTrue) +
+                            ");\n" + ind + "    return false;\n" + ind + "}\n";
+                } else if (onFalse >= 0) {
+                    body += ind + "if (!(" + test + ")) {\n" + ind + "    ctx.jump(" + std::to_string(onFalse) +
+                            ");\n" + ind + "    return false;\n" + ind + "}\n";
+                }
+                return true;
+            }
+            case OpData::Jump: {
+                auto* jump = instr.data.AsJump();
+                int32_t index = -1;
+                if (jump->is_call || !target(jump->target_node_name_id, index) || index < 0) return false;
+                body = ind + "ctx.countJump();\n" + ind + "ctx.jump(" + std::to_string(index) + ");\n" +
+                       ind + "return false;\n";
+                terminal = true;
+                return true;
+            }
+            case OpData::Yield:
+                body = ind + "result.type = Gyeol::StepType::YIELD;\n" + ind + "return true;\n";
+                terminal = true;
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void emitNode(size_t index, std::ostringstream& out) {
+        const auto& node = story_.nodes[index];
+        out << "// " << commentText(node ? node->name : std::string()) << "\n"
+            << "bool node" << index << "(AotContext& ctx, StepResult& result) {\n";
+        std::ostringstream cases;
+        const size_t count = node ? node->lines.size() : 0;
+        for (size_t pc = 0; pc < count; ++pc) {
+            const std::string next = std::to_string(pc + 1);
+            cases << "    case " << pc << ":\n"
+                  << "        if (!ctx.begin(" << next << ", result)) return true;\n";
+            std::string body;
+            bool terminal = false;
+            if (node->lines[pc] && nativeInstruction(*node->lines[pc], body, terminal)) {
+                ++nativeCount_;
+                cases << body;
+            } else {
+                ++delegatedCount_;
+                cases << "        if (ctx.execute(result)) return true;\n"
+                      << "        if (!ctx.at(" << index << ", " << next << ")) return false;\n";
+            }
+            if (!terminal) cases << "        [[fallthrough]];\n";
+        }
+        if (count == 0) out << "    static_cast<void>(result);\n";
+        out << "    switch (ctx.pc()) {\n"
+            << cases.str()
+            << "    default:\n"
+            << "        break;\n"
+            << "    }\n"
+            << "    return false;\n"
+            << "}\n\n";
+    }
+};
+
+} // namespace
+
+bool emitCpp(const std::vector<uint8_t>& gyb,
+             const std::string& symbolName,
+             std::string& outSource,
+             std::string* errorOut) {
+    if (!isIdentifier(symbolName)) {
+        return setError(errorOut, "AOT symbol name must be a C++ identifier: " + symbolName);
+    }
+    flatbuffers::Verifier verifier(gyb.data(), gyb.size());
+    if (gyb.empty() || !VerifyStoryBuffer(verifier)) {
+        return setError(errorOut, "invalid story buffer (.gyb)");
+    }
+    std::unique_ptr<StoryT> story(GetStory(gyb.data())->UnPack());
+    // 압축 레코드는 테이블 명령으로 펼친다 (pc는 같음)
+    CompactTools::expandInstructions(*story);
+
+    Emitter emitter(*story);
+    outSource = emitter.emit(symbolName, aotStoryHash(gyb.data(), gyb.size()), gyb.size());
+    return true;
+}
+
+} // namespace Gyeol::AotTools
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Gyeol::AotTools {
+
+// .gyb 버퍼를 AOT C++ 소스로 바꾼다 (gyeol_aot.h의 AotProgram).
+// 노드마다 함수 하나: pc별 case가 있는 상태 기계.
+//   네이티브: 대입(=) SetVar, 대상이 이 스토리 안에 있는 Condition/Jump, Yield, 식 전체
+//   위임: 나머지 명령(Line, Choice, call, Random, Command, Wait, Return, +=/-= 등)은 인터프리터 핸들러
+// 생성 파일은 `const Gyeol::AotProgram* gyeolAot_<symbolName>()` 하나를 내보낸다.
+// 버퍼 해시/크기가 박혀 있어 다른 .gyb로 start()하면 Runner는 인터프리터로 동작한다.
+bool emitCpp(const std::vector<uint8_t>& gyb,
+             const std::string& symbolName,
+             std::string& outSource,
+             std::string* errorOut = nullptr);
+
+} // namespace Gyeol::AotTools
@@ -0,0 +1,228 @@
+#include "gyeol_chunk_tools.h"
+#include "gyeol_pool_tools.h"
+#include "gyeol_story_linker.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol::ChunkTools {
+
+namespace {
+
+bool setError(std::string* errorOut, const std::string& message) {
+    if (errorOut) *errorOut = message;
+    return false;
+}
+
+std::string poolStr(const StoryT& story, int32_t id) {
+    if (id < 0 || id >= static_cast<int32_t>(story.string_pool.size())) return "";
+    return story.string_pool[static_cast<size_t>(id)];
+}
+
+std::string chapterTag(const StoryT& story, const NodeT& node) {
+    for (const auto& tag : node.tags) {
+        if (tag && poolStr(story, tag->key_id) == "chapter") return poolStr(story, tag->value_id);
+    }
+    return "";
+}
+
+// 청크 하나의 string_pool/line_ids를 새로 만들면서 String Pool 참조를 옮긴다.
+class PoolRemapper {
+public:
+    PoolRemapper(const StoryT& source, StoryT& target) : source_(source), target_(target) {}
+
+    void operator()(int32_t& value, PoolTools::PoolRefKind) {
+        if (value < 0 || value >= static_cast<int32_t>(source_.string_pool.size())) return;
+        auto it = map_.find(value);
+        if (it == map_.end()) {
+            const int32_t next = static_cast<int32_t>(target_.string_pool.size());
+            target_.string_pool.push_back(source_.string_pool[static_cast<size_t>(value)]);
+            target_.line_ids.push_back(static_cast<size_t>(value) < source_.line_ids.size()
+                ? source_.line_ids[static_cast<size_t>(value)] : "");
+            it = map_.emplace(value, next).first;
+        }
+        value = it->second;
+    }
+
+private:
+    const StoryT& source_;
+    StoryT& target_;
+    std::unordered_map<int32_t, int32_t> map_;
+};
+
+std::string chunkFileStem(const std::string& name, std::unordered_set<std::string>& used) {
+    std::string stem;
+    for (char ch : name) {
+        const bool safe = (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') ||
+                          (ch >= '0' && ch <= '9') || ch == '_' || ch == '-';
+        stem.push_back(safe ? ch : '_');
+    }
+    if (stem.empty()) stem = "chunk";
+    std::string unique = stem;
+    for (int n = 2; !used.insert(unique).second; ++n) {
+        unique = stem + "_" + std::to_string(n);
+    }
+    return unique;
+}
+
+bool writeBuffer(const std::string& path, const uint8_t* data, size_t size) {
+    std::ofstream ofs(path, std::ios::binary);
+    if (!ofs.is_open()) return false;
+    ofs.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+    return ofs.good();
+}
+
+} // namespace
+
+std::vector<ChunkPlanEntry> planChunks(const StoryT& story,
+                                       const std::vector<std::string>& nodeSourceFiles,
+                                       const std::unordered_set<std::string>& rootNodes) {
+    std::vector<ChunkPlanEntry> plan;
+    std::unordered_map<std::string, size_t> byName;
+    for (size_t i = 0; i < story.nodes.size(); ++i) {
+        const auto& node = story.nodes[i];
+        if (!node) continue;
+        std::string module = chapterTag(story, *node);
+        if (module.empty() && i < nodeSourceFiles.size()) {
+            module = std::filesystem::path(nodeSourceFiles[i]).stem().string();
+        }
+        if (module.empty()) module = "main";
+
+        auto it = byName.find(module);
+        if (it == byName.end()) {
+            it = byName.emplace(module, plan.size()).first;
+            plan.push_back({module, {}});
+        }
+        plan[it->second].nodes.push_back(node->name);
+    }
+
+    // 시작 노드가 든 청크를 루트(0번)로
+    bool rootFound = false;
+    for (size_t c = 1; c < plan.size() && !rootFound; ++c) {
+        for (const auto& name : plan[c].nodes) {
+            if (name == story.start_node_name) {
+                std::swap(plan[0], plan[c]);
+                rootFound = true;
+                break;
+            }
+        }
+    }
+    if (rootNodes.empty() || plan.empty()) return plan;
+
+    // rootNodes가 든 모듈을 루트에 합친다 (모듈 순서 유지)
+    std::vector<ChunkPlanEntry> merged;
+    merged.push_back(std::move(plan[0]));
+    for (size_t c = 1; c < plan.size(); ++c) {
+        const bool hot = std::any_of(plan[c].nodes.begin(), plan[c].nodes.end(),
+                                     [&](const std::string& name) { return rootNodes.count(name) > 0; });
+        if (hot) {
+            merged[0].nodes.insert(merged[0].nodes.end(), plan[c].nodes.begin(), plan[c].nodes.end());
+        } else {
+            merged.push_back(std::move(plan[c]));
+        }
+    }
+    return merged;
+}
+
+bool buildChunkStory(const StoryT& story,
+                     const std::vector<std::string>& nodeNames,
+                     bool isRoot,
+                     StoryT& outChunk,
+                     std::string* errorOut) {
+    if (nodeNames.empty()) return setError(errorOut, "Story chunk has no nodes.");
+
+    StoryT chunk;
+    chunk.version = story.version;
+    PoolRemapper remapper(story, chunk);
+    const PoolTools::PoolRefVisitor remap = std::ref(remapper);
+
+    std::unordered_set<std::string> wanted(nodeNames.begin(), nodeNames.end());
+    for (const auto& node : story.nodes) {
+        if (!node || !wanted.count(node->name)) continue;
+        auto copy = std::make_unique<NodeT>(*node);
+        PoolTools::visitNodePoolRefs(*copy, remap);
+        chunk.nodes.push_back(std::move(copy));
+    }
+    if (chunk.nodes.size() != wanted.size()) {
+        return setError(errorOut, "Story chunk references unknown nodes.");
+    }
+
+    if (isRoot) {
+        chunk.start_node_name = story.start_node_name;
+        for (const auto& gv : story.global_vars) {
+            if (!gv) continue;
+            auto copy = std::make_unique<SetVarT>(*gv);
+            PoolTools::visitSetVarPoolRefs(*copy, remap);
+            chunk.global_vars.push_back(std::move(copy));
+        }
+        for (const auto& ch : story.characters) {
+            if (!ch) continue;
+            auto copy = std::make_unique<CharacterDefT>(*ch);
+            PoolTools::visitCharacterPoolRefs(*copy, remap);
+            chunk.characters.push_back(std::move(copy));
+        }
+    } else {
+        // Runner::start 검증용 (청크 모드에서는 사용하지 않음)
+        chunk.start_node_name = chunk.nodes.front()->name;
+    }
+
+    outChunk = std::move(chunk);
+    return true;
+}
+
+bool writeStoryChunks(const StoryT& story,
+                      const std::vector<std::string>& nodeSourceFiles,
+                      const std::string& outputDir,
+                      std::string* errorOut,
+                      const std::unordered_set<std::string>& rootNodes) {
+    auto plan = planChunks(story, nodeSourceFiles, rootNodes);
+    if (plan.empty()) return setError(errorOut, "Story has no nodes to split.");
+
+    std::error_code ec;
+    std::filesystem::create_directories(outputDir, ec);
+    if (ec) return setError(errorOut, "Failed to create output directory: " + outputDir);
+
+    StoryChunkIndexT index;
+    index.version = 1;
+    index.start_node_name = story.start_node_name;
+
+    std::unordered_set<std::string> usedStems;
+    for (size_t c = 0; c < plan.size(); ++c) {
+        StoryT chunk;
+        if (!buildChunkStory(story, plan[c].nodes, c == 0, chunk, errorOut)) return false;
+
+        // 청크 안 대상만 인덱스로 링크된다 (다른 청크의 노드는 런타임이 이름으로 찾음)
+        StoryLinker::linkStory(chunk);
+        flatbuffers::FlatBufferBuilder builder;
+        builder.Finish(Story::Pack(builder, &chunk));
+
+        const std::string fileName = chunkFileStem(plan[c].name, usedStems) + ".gyb";
+        const std::string path = (std::filesystem::path(outputDir) / fileName).string();
+        if (!writeBuffer(path, builder.GetBufferPointer(), builder.GetSize())) {
+            return setError(errorOut, "Failed to write story chunk: " + path);
+        }
+
+        auto entry = std::make_unique<StoryChunkEntryT>();
+        entry->name = plan[c].name;
+        entry->path = fileName;
+        entry->size = static_cast<uint32_t>(builder.GetSize());
+        entry->node_names = plan[c].nodes;
+        index.chunks.push_back(std::move(entry));
+    }
+
+    flatbuffers::FlatBufferBuilder builder;
+    builder.Finish(StoryChunkIndex::Pack(builder, &index), "GYCI");
+    const std::string indexPath = (std::filesystem::path(outputDir) / "index.gyci").string();
+    if (!writeBuffer(indexPath, builder.GetBufferPointer(), builder.GetSize())) {
+        return setError(errorOut, "Failed to write story chunk index: " + indexPath);
+    }
+    return true;
+}
+
+} // namespace Gyeol::ChunkTools
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "gyeol_generated.h"
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace Gyeol::ChunkTools {
+
+struct ChunkPlanEntry {
+    std::string name;               // 모듈 이름 (#chapter 태그 값 또는 소스 파일 이름)
+    std::vector<std::string> nodes; // 이 청크에 들어갈 노드 이름 (원래 순서)
+};
+
+// 노드를 모듈 단위로 묶는다. #chapter=<이름> 노드 태그가 있으면 그 값, 없으면
+// 노드가 정의된 소스 파일 이름(확장자 제외)을 쓴다. 시작 노드가 든 청크가 0번(루트)이다.
+// rootNodes(프로파일상 hot 노드 등)가 하나라도 든 모듈은 루트 청크에 합쳐 처음부터 올리고,
+// 나머지(cold) 모듈만 따로 지연 로딩한다.
+std::vector<ChunkPlanEntry> planChunks(const ICPDev::Gyeol::Schema::StoryT& story,
+                                       const std::vector<std::string>& nodeSourceFiles,
+                                       const std::unordered_set<std::string>& rootNodes = {});
+
+// 지정한 노드만 담은 청크 Story를 만든다. string_pool/line_ids는 청크가 쓰는 문자열만 남긴다.
+// 루트 청크만 global_vars/characters/start_node_name을 가진다.
+bool buildChunkStory(const ICPDev::Gyeol::Schema::StoryT& story,
+                     const std::vector<std::string>& nodeNames,
+                     bool isRoot,
+                     ICPDev::Gyeol::Schema::StoryT& outChunk,
+                     std::string* errorOut = nullptr);
+
+// outputDir/index.gyci + outputDir/<chunk>.gyb 들을 쓴다. rootNodes는 planChunks와 같다.
+bool writeStoryChunks(const ICPDev::Gyeol::Schema::StoryT& story,
+                      const std::vector<std::string>& nodeSourceFiles,
+                      const std::string& outputDir,
+                      std::string* errorOut = nullptr,
+                      const std::unordered_set<std::string>& rootNodes = {});
+
+} // namespace Gyeol::ChunkTools
@@ -1,13 +1,372 @@
 #include "gyeol_comp_analyzer.h"
+#include "gyeol_expr_tools.h"
 #include <queue>
 #include <regex>
 #include <algorithm>
 #include <sstream>
+#include <cstdint>
+#include <unordered_map>
 
 using namespace ICPDev::Gyeol::Schema;
 
 namespace Gyeol {
 
+namespace {
+
+// =================================================================
+// 컴파일 타임 상수 평가 — 런타임(Runner::evaluateExpression)과 같은 규칙.
+// 런타임 결과가 정의되지 않는 조합(문자열 산술, BOOL/FLOAT 비교 등)은 접지 않는다.
+// =================================================================
+struct ConstValue {
+    enum Type { BOOL, INT, FLOAT, STRING } type = INT;
+    bool b = false;
+    int32_t i = 0;
+    float f = 0.0f;
+    int32_t stringId = -1; // STRING: string_pool 인덱스
+};
+
+using KnownVars = std::unordered_map<std::string, ConstValue>;
+
+bool readConstLiteral(const ValueDataUnion& value, const StoryT& story, ConstValue& out) {
+    out = ConstValue();
+    switch (value.type) {
+        case ValueData::NONE:
+            return true; // 런타임은 Int(0)
+        case ValueData::IntValue:
+            out.i = value.AsIntValue()->val;
+            return true;
+        case ValueData::FloatValue:
+            out.type = ConstValue::FLOAT;
+            out.f = value.AsFloatValue()->val;
+            return true;
+        case ValueData::BoolValue:
+            out.type = ConstValue::BOOL;
+            out.b = value.AsBoolValue()->val;
+            return true;
+        case ValueData::StringRef: {
+            const int32_t idx = value.AsStringRef()->index;
+            if (idx < 0 || idx >= static_cast<int32_t>(story.string_pool.size())) return false;
+            out.type = ConstValue::STRING;
+            out.stringId = idx;
+            return true;
+        }
+        default:
+            return false; // ListValue
+    }
+}
+
+ValueDataUnion toValueData(const ConstValue& v) {
+    ValueDataUnion out;
+    switch (v.type) {
+        case ConstValue::BOOL: { BoolValueT t; t.val = v.b; out.Set(t); break; }
+        case ConstValue::INT: { IntValueT t; t.val = v.i; out.Set(t); break; }
+        case ConstValue::FLOAT: { FloatValueT t; t.val = v.f; out.Set(t); break; }
+        case ConstValue::STRING: { StringRefT t; t.index = v.stringId; out.Set(t); break; }
+    }
+    return out;
+}
+
+std::unique_ptr<ExprTokenT> makeLiteralToken(const ConstValue& v) {
+    auto token = std::make_unique<ExprTokenT>();
+    token->op = ExprOp::PushLiteral;
+    token->literal_value = toValueData(v);
+    return token;
+}
+
+const std::string& constText(const ConstValue& v, const StoryT& story) {
+    static const std::string empty;
+    return v.type == ConstValue::STRING ? story.string_pool[v.stringId] : empty;
+}
+
+bool constToBool(const ConstValue& v, const StoryT& story) {
+    switch (v.type) {
+        case ConstValue::BOOL: return v.b;
+        case ConstValue::INT: return v.i != 0;
+        case ConstValue::FLOAT: return v.f != 0.0f;
+        case ConstValue::STRING: return !constText(v, story).empty();
+    }
+    return false;
+}
+
+bool isNumeric(const ConstValue& v) { return v.type != ConstValue::STRING; }
+
+// compareVariants와 같은 규칙
+bool constCompare(const ConstValue& lhs, Operator op, const ConstValue& rhs, const StoryT& story, bool& out) {
+    if (lhs.type == ConstValue::BOOL || rhs.type == ConstValue::BOOL) {
+        // 상대가 FLOAT/STRING이면 런타임이 다른 union 멤버를 읽는다 — 접지 않음
+        auto asBool = [](const ConstValue& v, bool& b) {
+            if (v.type == ConstValue::BOOL) { b = v.b; return true; }
+            if (v.type == ConstValue::INT) { b = v.i != 0; return true; }
+            return false;
+        };
+        bool a = false, b = false;
+        if (!asBool(lhs, a) || !asBool(rhs, b)) return false;
+        out = op == Operator::Equal ? a == b : op == Operator::NotEqual ? a != b : false;
+        return true;
+    }
+    if (lhs.type == ConstValue::STRING || rhs.type == ConstValue::STRING) {
+        const std::string& a = constText(lhs, story);
+        const std::string& b = constText(rhs, story);
+        out = op == Operator::Equal ? a == b : op == Operator::NotEqual ? a != b : false;
+        return true;
+    }
+    if (lhs.type == ConstValue::FLOAT || rhs.type == ConstValue::FLOAT) {
+        const float a = lhs.type == ConstValue::FLOAT ? lhs.f : static_cast<float>(lhs.i);
+        const float b = rhs.type == ConstValue::FLOAT ? rhs.f : static_cast<float>(rhs.i);
+        switch (op) {
+            case Operator::Equal: out = a == b; break;
+            case Operator::NotEqual: out = a != b; break;
+            case Operator::Greater: out = a > b; break;
+            case Operator::Less: out = a < b; break;
+            case Operator::GreaterOrEqual: out = a >= b; break;
+            case Operator::LessOrEqual: out = a <= b; break;
+        }
+        return true;
+    }
+    const int32_t a = lhs.i;
+    const int32_t b = rhs.i;
+    switch (op) {
+        case Operator::Equal: out = a == b; break;
+        case Operator::NotEqual: out = a != b; break;
+        case Operator::Greater: out = a > b; break;
+        case Operator::Less: out = a < b; break;
+        case Operator::GreaterOrEqual: out = a >= b; break;
+        case Operator::LessOrEqual: out = a <= b; break;
+    }
+    return true;
+}
+
+bool floatFitsInt(float v) {
+    return v >= -2147483648.0f && v < 2147483648.0f; // NaN도 false
+}
+
+// applyBinaryOp와 같은 규칙 (정수는 2의 보수 wrap)
+bool constArith(const ConstValue& lhs, ExprOp op, const ConstValue& rhs, ConstValue& out) {
+    if (!isNumeric(lhs) || !isNumeric(rhs)) return false;
+    out = ConstValue();
+    if (lhs.type == ConstValue::FLOAT || rhs.type == ConstValue::FLOAT) {
+        auto asFloat = [](const ConstValue& v) {
+            return v.type == ConstValue::FLOAT ? v.f :
+                   v.type == ConstValue::BOOL ? (v.b ? 1.0f : 0.0f) : static_cast<float>(v.i);
+        };
+        const float a = asFloat(lhs);
+        const float b = asFloat(rhs);
+        out.type = ConstValue::FLOAT;
+        switch (op) {
+            case ExprOp::Add: out.f = a + b; return true;
+            case ExprOp::Sub: out.f = a - b; return true;
+            case ExprOp::Mul: out.f = a * b; return true;
+            case ExprOp::Div: out.f = (b != 0.0f) ? a / b : 0.0f; return true;
+            case ExprOp::Mod: {
+                if (!floatFitsInt(a) || !floatFitsInt(b)) return false;
+                const int32_t ai = static_cast<int32_t>(a);
+                const int32_t bi = static_cast<int32_t>(b);
+                if (ai == INT32_MIN && bi == -1) return false;
+                out.type = ConstValue::INT;
+                out.i = (bi != 0) ? ai % bi : 0;
+                return true;
+            }
+            default: return false;
+        }
+    }
+    const int32_t a = lhs.type == ConstValue::BOOL ? (lhs.b ? 1 : 0) : lhs.i;
+    const int32_t b = rhs.type == ConstValue::BOOL ? (rhs.b ? 1 : 0) : rhs.i;
+    const uint32_t ua = static_cast<uint32_t>(a);
+    const uint32_t ub = static_cast<uint32_t>(b);
+    switch (op) {
+        case ExprOp::Add: out.i = static_cast<int32_t>(ua + ub); return true;
+        case ExprOp::Sub: out.i = static_cast<int32_t>(ua - ub); return true;
+        case ExprOp::Mul: out.i = static_cast<int32_t>(ua * ub); return true;
+        case ExprOp::Div:
+        case ExprOp::Mod:
+            if (a == INT32_MIN && b == -1) return false;
+            out.i = (b == 0) ? 0 : (op == ExprOp::Div ? a / b : a % b);
+            return true;
+        default: return false;
+    }
+}
+
+Operator comparisonOperator(ExprOp op) {
+    switch (op) {
+        case ExprOp::CmpNe: return Operator::NotEqual;
+        case ExprOp::CmpGt: return Operator::Greater;
+        case ExprOp::CmpLt: return Operator::Less;
+        case ExprOp::CmpGe: return Operator::GreaterOrEqual;
+        case ExprOp::CmpLe: return Operator::LessOrEqual;
+        default: return Operator::Equal;
+    }
+}
+
+struct FoldResult {
+    bool changed = false;      // 토큰을 다시 썼는지
+    bool isConstant = false;   // 식 전체가 상수인지
+    ConstValue value;
+    int substituted = 0;       // 상수로 바꾼 변수 참조 수
+};
+
+// RPN 식에서 상수 부분식을 접는다. known이 있으면 그 변수 참조를 상수로 바꾼다.
+// 스택이 맞지 않는 식은 건드리지 않는다 (런타임의 underflow 처리 그대로).
+FoldResult foldExpression(ExpressionT& expr, const StoryT& story, const KnownVars* known) {
+    FoldResult result;
+    if (expr.tokens.empty()) return result;
+
+    struct Entry {
+        bool isConstant = false;
+        ConstValue value;
+        std::vector<std::unique_ptr<ExprTokenT>> tokens; // 상수가 아닐 때의 원래 토큰열
+    };
+    auto materialize = [](Entry& e, std::vector<std::unique_ptr<ExprTokenT>>& out) {
+        if (e.isConstant) {
+            out.push_back(makeLiteralToken(e.value));
+        } else {
+            for (auto& t : e.tokens) out.push_back(std::move(t));
+        }
+    };
+
+    std::vector<Entry> stack;
+    int foldedOps = 0;
+    int substituted = 0;
+    for (const auto& token : expr.tokens) {
+        Entry entry;
+        switch (token->op) {
+            case ExprOp::PushLiteral:
+                entry.isConstant = readConstLiteral(token->literal_value, story, entry.value);
+                break;
+            case ExprOp::PushVar:
+                if (known && token->var_name_id >= 0 &&
+                    token->var_name_id < static_cast<int32_t>(story.string_pool.size())) {
+                    auto it = known->find(story.string_pool[token->var_name_id]);
+                    if (it != known->end()) {
+                        entry.isConstant = true;
+                        entry.value = it->second;
+                        substituted++;
+                    }
+                }
+                break;
+            case ExprOp::Negate:
+            case ExprOp::Not: {
+                if (stack.empty()) return FoldResult();
+                Entry operand = std::move(stack.back());
+                stack.pop_back();
+                if (operand.isConstant) {
+                    if (token->op == ExprOp::Not) {
+                        entry.isConstant = true;
+                        entry.value.type = ConstValue::BOOL;
+                        entry.value.b = !constToBool(operand.value, story);
+                    } else if (operand.value.type == ConstValue::FLOAT) {
+                        entry.isConstant = true;
+                        entry.value.type = ConstValue::FLOAT;
+                        entry.value.f = -operand.value.f;
+                    } else if (operand.value.type != ConstValue::STRING) {
+                        const int32_t v = operand.value.type == ConstValue::BOOL ? (operand.value.b ? 1 : 0)
+                                                                                  : operand.value.i;
+                        entry.isConstant = true;
+                        entry.value.i = static_cast<int32_t>(0u - static_cast<uint32_t>(v));
+                    }
+                }
+                if (entry.isConstant) {
+                    foldedOps++;
+                    stack.push_back(std::move(entry));
+                    continue;
+                }
+                materialize(operand, entry.tokens);
+                break;
+            }
+            case ExprOp::Add: case ExprOp::Sub: case ExprOp::Mul: case ExprOp::Div: case ExprOp::Mod:
+            case ExprOp::CmpEq: case ExprOp::CmpNe: case ExprOp::CmpGt:
+            case ExprOp::CmpLt: case ExprOp::CmpGe: case ExprOp::CmpLe:
+            case ExprOp::And: case ExprOp::Or: case ExprOp::ListContains: {
+                if (stack.size() < 2) return FoldResult();
+                Entry rhs = std::move(stack.back());
+                stack.pop_back();
+                Entry lhs = std::move(stack.back());
+                stack.pop_back();
+                if (lhs.isConstant && rhs.isConstant) {
+                    const ExprOp op = token->op;
+                    if (op == ExprOp::And || op == ExprOp::Or) {
+                        const bool a = constToBool(lhs.value, story);
+                        const bool b = constToBool(rhs.value, story);
+                        entry.isConstant = true;
+                        entry.value.type = ConstValue::BOOL;
+                        entry.value.b = op == ExprOp::And ? (a && b) : (a || b);
+                    } else if (op >= ExprOp::CmpEq && op <= ExprOp::CmpLe) {
+                        bool cmp = false;
+                        if (constCompare(lhs.value, comparisonOperator(op), rhs.value, story, cmp)) {
+                            entry.isConstant = true;
+                            entry.value.type = ConstValue::BOOL;
+                            entry.value.b = cmp;
+                        }
+                    } else if (op != ExprOp::ListContains) {
+                        entry.isConstant = constArith(lhs.value, op, rhs.value, entry.value);
+                    }
+                }
+                if (entry.isConstant) {
+                    foldedOps++;
+                    stack.push_back(std::move(entry));
+                    continue;
+                }
+                materialize(lhs, entry.tokens);
+                materialize(rhs, entry.tokens);
+                break;
+            }
+            default: // PushVisitCount/PushVisited/ListLength
+                break;
+        }
+        entry.tokens.push_back(std::make_unique<ExprTokenT>(*token));
+        if (entry.isConstant) entry.tokens.clear(); // 리터럴: 값으로 다시 만든다
+        stack.push_back(std::move(entry));
+    }
+    if (stack.size() != 1) return FoldResult();
+
+    result.substituted = substituted;
+    result.isConstant = stack.back().isConstant;
+    result.value = stack.back().value;
+    if (foldedOps > 0 || substituted > 0) {
+        std::vector<std::unique_ptr<ExprTokenT>> tokens;
+        materialize(stack.back(), tokens);
+        expr.tokens = std::move(tokens);
+        result.changed = true;
+    }
+    return result;
+}
+
+// Condition이 항상 같은 쪽으로 가는지 (evaluateCondition과 같은 규칙)
+bool constCondition(const ConditionT& cond, const StoryT& story, bool& out) {
+    if (cond.cond_expr) {
+        ExpressionT copy(*cond.cond_expr);
+        auto folded = foldExpression(copy, story, nullptr);
+        if (!folded.isConstant) return false;
+        out = constToBool(folded.value, story);
+        return true;
+    }
+    if (!cond.lhs_expr) return false; // 변수 직접 참조
+    ExpressionT lhsCopy(*cond.lhs_expr);
+    auto lhs = foldExpression(lhsCopy, story, nullptr);
+    if (!lhs.isConstant) return false;
+    ConstValue rhs;
+    if (cond.rhs_expr) {
+        ExpressionT rhsCopy(*cond.rhs_expr);
+        auto folded = foldExpression(rhsCopy, story, nullptr);
+        if (!folded.isConstant) return false;
+        rhs = folded.value;
+    } else if (!readConstLiteral(cond.compare_value, story, rhs)) {
+        return false;
+    }
+    return constCompare(lhs.value, cond.op, rhs, story, out);
+}
+
+void collectExprReads(const ExpressionT* expr, const StoryT& story, std::unordered_set<std::string>& out) {
+    if (!expr) return;
+    for (const auto& token : expr->tokens) {
+        if ((token->op == ExprOp::PushVar || token->op == ExprOp::ListLength) &&
+            token->var_name_id >= 0 && token->var_name_id < static_cast<int32_t>(story.string_pool.size())) {
+            out.insert(story.string_pool[token->var_name_id]);
+        }
+    }
+}
+
+} // namespace
+
 // =================================================================
 // 도달 가능 노드 (BFS)
 // =================================================================
@@ -312,99 +671,189 @@ std::vector<std::pair<std::string, uint32_t>> CompilerAnalyzer::findDeadInstruct
 }
 
 // =================================================================
-// 상수 폴딩
+// 상수 폴딩 (int/float/bool/string, 모든 Expression 위치)
 // =================================================================
+namespace {
+
+// 명령어 하나가 가진 Expression을 모두 방문한다
+template <typename Fn>
+void forEachInstructionExpr(InstructionT& instr, Fn&& fn) {
+    switch (instr.data.type) {
+        case OpData::SetVar:
+            fn(instr.data.AsSetVar()->expr);
+            break;
+        case OpData::Condition: {
+            auto* cond = instr.data.AsCondition();
+            fn(cond->lhs_expr);
+            fn(cond->rhs_expr);
+            fn(cond->cond_expr);
+            break;
+        }
+        case OpData::Return:
+            fn(instr.data.AsReturn()->expr);
+            break;
+        case OpData::Jump:
+            for (auto& arg : instr.data.AsJump()->arg_exprs) fn(arg);
+            break;
+        case OpData::CallWithReturn:
+            for (auto& arg : instr.data.AsCallWithReturn()->arg_exprs) fn(arg);
+            break;
+        default:
+            break;
+    }
+}
+
+// 전역 변수와 모든 명령어의 Expression을 방문한다
+template <typename Fn>
+void forEachStoryExpr(StoryT& story, Fn&& fn) {
+    for (auto& gv : story.global_vars) {
+        if (gv) fn(gv->expr);
+    }
+    for (auto& node : story.nodes) {
+        for (auto& instr : node->lines) forEachInstructionExpr(*instr, fn);
+    }
+}
+
+// 식 전체가 상수가 된 SetVar/Return은 Expression 대신 value로 저장한다
+template <typename T>
+void storeConstantValue(T& target, const ConstValue& value) {
+    target.expr.reset();
+    target.value = toValueData(value);
+}
+
+} // namespace
+
+int CompilerAnalyzer::foldSetVar(SetVarT& sv, const StoryT& story) {
+    if (!sv.expr) return 0;
+    auto folded = foldExpression(*sv.expr, story, nullptr);
+    if (folded.isConstant) {
+        storeConstantValue(sv, folded.value);
+        return 1;
+    }
+    return folded.changed ? 1 : 0;
+}
+
 int CompilerAnalyzer::foldConstants(StoryT& story) {
     int count = 0;
 
+    for (auto& gv : story.global_vars) {
+        count += foldSetVar(*gv, story);
+    }
+
     for (auto& node : story.nodes) {
         for (auto& instr : node->lines) {
-            if (instr->data.type != OpData::SetVar) continue;
-            auto* sv = instr->data.AsSetVar();
-            if (!sv->expr) continue;
-
-            // Expression이 PushLiteral + 연산자로만 구성되어 있는지 확인
-            bool allLiterals = true;
-            for (const auto& token : sv->expr->tokens) {
-                if (token->op == ExprOp::PushVar ||
-                    token->op == ExprOp::PushVisitCount ||
-                    token->op == ExprOp::PushVisited ||
-                    token->op == ExprOp::ListContains ||
-                    token->op == ExprOp::ListLength) {
-                    allLiterals = false;
-                    break;
+            if (instr->data.type == OpData::SetVar) {
+                count += foldSetVar(*instr->data.AsSetVar(), story);
+                continue;
+            }
+            if (instr->data.type == OpData::Return) {
+                auto* ret = instr->data.AsReturn();
+                if (!ret->expr) continue;
+                auto folded = foldExpression(*ret->expr, story, nullptr);
+                if (folded.isConstant) {
+                    storeConstantValue(*ret, folded.value);
+                    count++;
+                } else if (folded.changed) {
+                    count++;
                 }
+                continue;
             }
-            if (!allLiterals || sv->expr->tokens.empty()) continue;
+            forEachInstructionExpr(*instr, [&](std::unique_ptr<ExpressionT>& expr) {
+                if (expr && foldExpression(*expr, story, nullptr).changed) count++;
+            });
+        }
+    }
 
-            // 간단한 RPN 스택 머신으로 상수 평가
-            std::vector<int32_t> stack;
-            bool canFold = true;
+    return count;
+}
 
-            for (const auto& token : sv->expr->tokens) {
-                switch (token->op) {
-                    case ExprOp::PushLiteral: {
-                        if (token->literal_value.type == ValueData::IntValue) {
-                            stack.push_back(token->literal_value.AsIntValue()->val);
-                        } else {
-                            canFold = false; // float/bool/string 폴딩은 미지원
-                        }
-                        break;
+// =================================================================
+// 상수 전파 (노드 안의 직선 구간)
+// 노드 진입, 호스트로 돌아가는 명령어(Line/Choice/Command/Wait/Yield),
+// 다른 노드로 가는 명령어 뒤에서는 아는 값을 모두 버린다.
+// =================================================================
+int CompilerAnalyzer::propagateConstants(StoryT& story) {
+    int count = 0;
+
+    for (auto& node : story.nodes) {
+        KnownVars known;
+        for (auto& instr : node->lines) {
+            forEachInstructionExpr(*instr, [&](std::unique_ptr<ExpressionT>& expr) {
+                if (expr && !known.empty()) count += foldExpression(*expr, story, &known).substituted;
+            });
+
+            if (instr->data.type == OpData::Condition) {
+                // 변수 직접 비교형: 값을 알면 리터럴 lhs로 바꾼다
+                auto* cond = instr->data.AsCondition();
+                if (!cond->cond_expr && !cond->lhs_expr && cond->var_name_id >= 0 &&
+                    cond->var_name_id < static_cast<int32_t>(story.string_pool.size())) {
+                    auto it = known.find(story.string_pool[cond->var_name_id]);
+                    if (it != known.end()) {
+                        cond->lhs_expr = std::make_unique<ExpressionT>();
+                        cond->lhs_expr->tokens.push_back(makeLiteralToken(it->second));
+                        count++;
                     }
-                    case ExprOp::Add:
-                        if (stack.size() >= 2) {
-                            auto b = stack.back(); stack.pop_back();
-                            auto a = stack.back(); stack.pop_back();
-                            stack.push_back(a + b);
-                        } else { canFold = false; }
-                        break;
-                    case ExprOp::Sub:
-                        if (stack.size() >= 2) {
-                            auto b = stack.back(); stack.pop_back();
-                            auto a = stack.back(); stack.pop_back();
-                            stack.push_back(a - b);
-                        } else { canFold = false; }
-                        break;
-                    case ExprOp::Mul:
-                        if (stack.size() >= 2) {
-                            auto b = stack.back(); stack.pop_back();
-                            auto a = stack.back(); stack.pop_back();
-                            stack.push_back(a * b);
-                        } else { canFold = false; }
-                        break;
-                    case ExprOp::Div:
-                        if (stack.size() >= 2 && stack.back() != 0) {
-                            auto b = stack.back(); stack.pop_back();
-                            auto a = stack.back(); stack.pop_back();
-                            stack.push_back(a / b);
-                        } else { canFold = false; }
-                        break;
-                    case ExprOp::Mod:
-                        if (stack.size() >= 2 && stack.back() != 0) {
-                            auto b = stack.back(); stack.pop_back();
-                            auto a = stack.back(); stack.pop_back();
-                            stack.push_back(a % b);
-                        } else { canFold = false; }
-                        break;
-                    case ExprOp::Negate:
-                        if (!stack.empty()) {
-                            stack.back() = -stack.back();
-                        } else { canFold = false; }
-                        break;
-                    default:
-                        canFold = false;
-                        break;
                 }
-                if (!canFold) break;
+                continue; // 분기하지 않으면 같은 상태로 다음 줄에 온다
             }
 
-            if (canFold && stack.size() == 1) {
-                // Expression을 리터럴 값으로 대체
-                sv->expr.reset();
-                sv->value.Set(IntValueT());
-                sv->value.AsIntValue()->val = stack[0];
-                count++;
+            if (instr->data.type != OpData::SetVar) {
+                known.clear();
+                continue;
+            }
+
+            auto* sv = instr->data.AsSetVar();
+            if (sv->var_name_id < 0 || sv->var_name_id >= static_cast<int32_t>(story.string_pool.size())) {
+                known.clear();
+                continue;
+            }
+            const std::string& name = story.string_pool[sv->var_name_id];
+            known.erase(name);
+            if (sv->assign_op != AssignOp::Assign) continue;
+
+            ConstValue value;
+            if (sv->expr) {
+                ExpressionT copy(*sv->expr);
+                auto folded = foldExpression(copy, story, nullptr);
+                if (!folded.isConstant) continue;
+                value = folded.value;
+            } else if (!readConstLiteral(sv->value, story, value)) {
+                continue;
+            }
+            known[name] = value;
+        }
+    }
+
+    return count;
+}
+
+// =================================================================
+// 상수 Condition → Jump (분기하지 않는 쪽이 -1이면 명령어 삭제)
+// =================================================================
+int CompilerAnalyzer::foldConditions(StoryT& story) {
+    int count = 0;
+
+    for (auto& node : story.nodes) {
+        auto it = node->lines.begin();
+        while (it != node->lines.end()) {
+            bool taken = false;
+            if ((*it)->data.type != OpData::Condition ||
+                !constCondition(*(*it)->data.AsCondition(), story, taken)) {
+                ++it;
+                continue;
+            }
+            auto* cond = (*it)->data.AsCondition();
+            const int32_t target = taken ? cond->true_jump_node_id : cond->false_jump_node_id;
+            count++;
+            if (target < 0) {
+                it = node->lines.erase(it);
+                continue;
             }
+            JumpT jump;
+            jump.target_node_name_id = target;
+            jump.is_call = false;
+            (*it)->data.Set(std::move(jump));
+            ++it;
         }
     }
 
@@ -443,6 +892,356 @@ int CompilerAnalyzer::removeDeadInstructions(StoryT& story) {
     return count;
 }
 
+// =================================================================
+// 점프 스레딩 / 작은 call 인라인
+// 방문 횟수를 식(visit_count/visited)으로 읽는 노드는 건너뛰거나 펼치지 않는다.
+// 둘 다 한 step() 안에서 지나가는 노드만 없애므로 호스트가 보는 흐름은 같다.
+// =================================================================
+namespace {
+
+constexpr size_t kInlineMaxInstructions = 8;
+constexpr size_t kHotInlineMaxInstructions = 32; // setHotCallTargets()에 든 대상
+
+std::unordered_map<std::string, size_t> indexNodes(const StoryT& story) {
+    std::unordered_map<std::string, size_t> index;
+    for (size_t i = 0; i < story.nodes.size(); ++i) {
+        index.emplace(story.nodes[i]->name, i);
+    }
+    return index;
+}
+
+// visit_count()/visited()가 가리키는 노드 이름
+std::unordered_set<std::string> collectVisitObservedNodes(StoryT& story) {
+    std::unordered_set<std::string> observed;
+    auto scan = [&](const std::unique_ptr<ExpressionT>& expr) {
+        if (!expr) return;
+        for (const auto& token : expr->tokens) {
+            if ((token->op == ExprOp::PushVisitCount || token->op == ExprOp::PushVisited) &&
+                token->var_name_id >= 0 && token->var_name_id < static_cast<int32_t>(story.string_pool.size())) {
+                observed.insert(story.string_pool[token->var_name_id]);
+            }
+        }
+    };
+    for (auto& gv : story.global_vars) scan(gv->expr);
+    for (auto& node : story.nodes) {
+        for (auto& instr : node->lines) forEachInstructionExpr(*instr, scan);
+    }
+    return observed;
+}
+
+// 스택이 모자라지 않고 값 하나를 남기는 식인지 (다른 식 안에 그대로 끼워 넣을 수 있는지)
+bool isCompleteExpression(const ExpressionT& expr) {
+    int depth = 0;
+    for (const auto& token : expr.tokens) {
+        switch (token->op) {
+            case ExprOp::PushLiteral: case ExprOp::PushVar: case ExprOp::PushVisitCount:
+            case ExprOp::PushVisited: case ExprOp::ListLength:
+                depth++;
+                break;
+            case ExprOp::Negate: case ExprOp::Not:
+                if (depth < 1) return false;
+                break;
+            default:
+                if (depth < 2) return false;
+                depth--;
+                break;
+        }
+    }
+    return depth == 1;
+}
+
+using ParamArgs = std::unordered_map<std::string, const ExpressionT*>; // nullptr: 인자 부족 → Int(0)
+
+// 매개변수 참조를 호출 인자 식으로 바꾼다
+void substituteParams(ExpressionT& expr, const StoryT& story, const ParamArgs& params) {
+    std::vector<std::unique_ptr<ExprTokenT>> tokens;
+    for (auto& token : expr.tokens) {
+        if (token->op == ExprOp::PushVar && token->var_name_id >= 0 &&
+            token->var_name_id < static_cast<int32_t>(story.string_pool.size())) {
+            auto it = params.find(story.string_pool[token->var_name_id]);
+            if (it != params.end()) {
+                if (it->second) {
+                    for (const auto& argToken : it->second->tokens) {
+                        tokens.push_back(std::make_unique<ExprTokenT>(*argToken));
+                    }
+                } else {
+                    tokens.push_back(makeLiteralToken(ConstValue()));
+                }
+                continue;
+            }
+        }
+        tokens.push_back(std::move(token));
+    }
+    expr.tokens = std::move(tokens);
+}
+
+// callee가 SetVar들 + (마지막) Return으로만 되어 있으면 호출 자리에 들어갈 명령어를 만든다.
+// 매개변수에 쓰지 않고, 인자가 읽는 변수를 본문이 바꾸지 않을 때만 섀도잉 없이 같은 결과가 된다.
+bool expandInlineBody(const NodeT& callee,
+                      const std::vector<std::unique_ptr<ExpressionT>>& args,
+                      int32_t returnVarId, const StoryT& story, size_t maxInstructions,
+                      std::vector<std::unique_ptr<InstructionT>>& out) {
+    if (callee.lines.size() > maxInstructions) return false;
+    const auto poolSize = static_cast<int32_t>(story.string_pool.size());
+
+    ParamArgs params;
+    std::unordered_set<std::string> argReads;
+    for (size_t p = 0; p < callee.param_ids.size(); ++p) {
+        const int32_t id = callee.param_ids[p];
+        if (id < 0 || id >= poolSize) return false;
+        const ExpressionT* arg = p < args.size() ? args[p].get() : nullptr;
+        if (arg && !isCompleteExpression(*arg)) return false;
+        if (!params.emplace(story.string_pool[id], arg).second) return false;
+        collectExprReads(arg, story, argReads);
+    }
+
+    auto readsParamList = [&](const ExpressionT* expr) {
+        if (!expr) return false;
+        for (const auto& token : expr->tokens) {
+            if (token->op == ExprOp::ListLength && token->var_name_id >= 0 && token->var_name_id < poolSize &&
+                params.count(story.string_pool[token->var_name_id])) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::unordered_set<std::string> written;
+    for (size_t k = 0; k < callee.lines.size(); ++k) {
+        const auto& instr = callee.lines[k];
+        if (instr->data.type == OpData::SetVar) {
+            const auto* sv = instr->data.AsSetVar();
+            if (sv->var_name_id < 0 || sv->var_name_id >= poolSize) return false;
+            const std::string& name = story.string_pool[sv->var_name_id];
+            if (params.count(name) || readsParamList(sv->expr.get())) return false;
+            written.insert(name);
+        } else if (instr->data.type == OpData::Return) {
+            if (k + 1 != callee.lines.size() || readsParamList(instr->data.AsReturn()->expr.get())) return false;
+        } else {
+            return false;
+        }
+    }
+    for (const auto& name : argReads) {
+        if (written.count(name)) return false;
+    }
+
+    for (const auto& instr : callee.lines) {
+        if (instr->data.type == OpData::SetVar) {
+            auto copy = std::make_unique<InstructionT>(*instr);
+            auto* sv = copy->data.AsSetVar();
+            if (sv->expr) substituteParams(*sv->expr, story, params);
+            out.push_back(std::move(copy));
+            continue;
+        }
+        // Return: 반환값이 있고 받을 변수가 있을 때만 대입으로 남는다
+        const auto* ret = instr->data.AsReturn();
+        if (returnVarId < 0) continue;
+        SetVarT assign;
+        assign.var_name_id = returnVarId;
+        assign.assign_op = AssignOp::Assign;
+        if (ret->expr) {
+            assign.expr = std::make_unique<ExpressionT>(*ret->expr);
+            substituteParams(*assign.expr, story, params);
+        } else if (ret->value.type != ValueData::NONE) {
+            assign.value = ret->value;
+        } else {
+            continue; // bare return: 반환 변수는 그대로
+        }
+        auto assignInstr = std::make_unique<InstructionT>();
+        assignInstr->data.Set(std::move(assign));
+        out.push_back(std::move(assignInstr));
+    }
+    return true;
+}
+
+} // namespace
+
+int CompilerAnalyzer::threadJumps(StoryT& story) {
+    // 건너뛰거나 펼친 노드는 방문 증가가 사라진다
+    if (!visitCountsUnobserved_) return 0;
+    const auto nodeIndex = indexNodes(story);
+    const auto observed = collectVisitObservedNodes(story);
+    const auto poolSize = static_cast<int32_t>(story.string_pool.size());
+
+    auto findNode = [&](int32_t id) -> const NodeT* {
+        if (id < 0 || id >= poolSize) return nullptr;
+        auto it = nodeIndex.find(story.string_pool[id]);
+        return it == nodeIndex.end() ? nullptr : story.nodes[it->second].get();
+    };
+
+    // Jump 하나뿐인 노드를 따라가 최종 대상을 찾는다.
+    // call은 대상 노드의 매개변수를 바인딩하므로 매개변수 없는 노드만 지나간다.
+    auto resolve = [&](int32_t id, bool isCall) {
+        int32_t current = id;
+        std::unordered_set<int32_t> seen{id};
+        for (;;) {
+            const NodeT* node = findNode(current);
+            if (!node || (isCall && !node->param_ids.empty()) || observed.count(node->name) ||
+                node->lines.size() != 1 || node->lines[0]->data.type != OpData::Jump) {
+                break;
+            }
+            const auto* jump = node->lines[0]->data.AsJump();
+            if (jump->is_call) break;
+            const NodeT* next = findNode(jump->target_node_name_id);
+            if (!next || (isCall && !next->param_ids.empty())) break;
+            if (!seen.insert(jump->target_node_name_id).second) return id; // 순환은 그대로 둔다
+            current = jump->target_node_name_id;
+        }
+        return current;
+    };
+
+    int count = 0;
+    auto retarget = [&](int32_t& target, bool isCall) {
+        const int32_t resolved = resolve(target, isCall);
+        if (resolved != target) {
+            target = resolved;
+            count++;
+        }
+    };
+
+    for (auto& node : story.nodes) {
+        for (auto& instr : node->lines) {
+            switch (instr->data.type) {
+                case OpData::Jump: {
+                    auto* jump = instr->data.AsJump();
+                    retarget(jump->target_node_name_id, jump->is_call);
+                    break;
+                }
+                // Choice 대상은 건드리지 않는다: choose()는 대상 노드에 멈추므로
+                // 호스트가 getCurrentNodeName()/save로 그 노드를 볼 수 있다
+                case OpData::Condition: {
+                    auto* cond = instr->data.AsCondition();
+                    if (cond->true_jump_node_id >= 0) retarget(cond->true_jump_node_id, false);
+                    if (cond->false_jump_node_id >= 0) retarget(cond->false_jump_node_id, false);
+                    break;
+                }
+                case OpData::Random:
+                    for (auto& branch : instr->data.AsRandom()->branches) {
+                        retarget(branch->target_node_name_id, false);
+                    }
+                    break;
+                case OpData::CallWithReturn:
+                    retarget(instr->data.AsCallWithReturn()->target_node_name_id, true);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    return count;
+}
+
+int CompilerAnalyzer::inlineCalls(StoryT& story) {
+    // 건너뛰거나 펼친 노드는 방문 증가가 사라진다
+    if (!visitCountsUnobserved_) return 0;
+    const auto nodeIndex = indexNodes(story);
+    const auto observed = collectVisitObservedNodes(story);
+    const auto poolSize = static_cast<int32_t>(story.string_pool.size());
+    int count = 0;
+
+    for (auto& node : story.nodes) {
+        size_t i = 0;
+        while (i < node->lines.size()) {
+            const auto& instr = node->lines[i];
+            int32_t targetId = -1;
+            int32_t returnVarId = -1;
+            const std::vector<std::unique_ptr<ExpressionT>>* args = nullptr;
+            if (instr->data.type == OpData::Jump && instr->data.AsJump()->is_call) {
+                targetId = instr->data.AsJump()->target_node_name_id;
+                args = &instr->data.AsJump()->arg_exprs;
+            } else if (instr->data.type == OpData::CallWithReturn) {
+                auto* cwr = instr->data.AsCallWithReturn();
+                targetId = cwr->target_node_name_id;
+                returnVarId = cwr->return_var_name_id;
+                args = &cwr->arg_exprs;
+            }
+            if (!args || targetId < 0 || targetId >= poolSize) {
+                ++i;
+                continue;
+            }
+
+            auto it = nodeIndex.find(story.string_pool[targetId]);
+            std::vector<std::unique_ptr<InstructionT>> body;
+            if (it == nodeIndex.end() || story.nodes[it->second].get() == node.get() ||
+                observed.count(story.nodes[it->second]->name) ||
+                !expandInlineBody(*story.nodes[it->second], *args, returnVarId, story,
+                                  hotCallTargets_.count(it->first) ? kHotInlineMaxInstructions : kInlineMaxInstructions,
+                                  body)) {
+                ++i;
+                continue;
+            }
+
+            const size_t inserted = body.size();
+            node->lines.erase(node->lines.begin() + static_cast<std::ptrdiff_t>(i));
+            node->lines.insert(node->lines.begin() + static_cast<std::ptrdiff_t>(i),
+                               std::make_move_iterator(body.begin()), std::make_move_iterator(body.end()));
+            i += inserted;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// =================================================================
+// 데드 스토어 제거
+// 같은 직선 구간에서 읽히기 전에 다시 Assign되는 SetVar를 지운다.
+// SetVar가 아닌 명령어(호스트 반환, 분기, 보간 Line 등)는 구간을 끊는다.
+// =================================================================
+int CompilerAnalyzer::eliminateDeadStores(StoryT& story) {
+    int count = 0;
+
+    for (auto& node : story.nodes) {
+        std::unordered_set<std::string> overwritten; // 뒤에서 읽히기 전에 덮어쓰는 변수
+        for (size_t i = node->lines.size(); i-- > 0;) {
+            auto& instr = node->lines[i];
+            if (instr->data.type != OpData::SetVar) {
+                overwritten.clear();
+                continue;
+            }
+            auto* sv = instr->data.AsSetVar();
+            if (sv->var_name_id < 0 || sv->var_name_id >= static_cast<int32_t>(story.string_pool.size())) {
+                overwritten.clear();
+                continue;
+            }
+            const std::string& name = story.string_pool[sv->var_name_id];
+            if (sv->assign_op == AssignOp::Assign && overwritten.count(name)) {
+                node->lines.erase(node->lines.begin() + static_cast<std::ptrdiff_t>(i));
+                count++;
+                continue;
+            }
+
+            std::unordered_set<std::string> reads;
+            collectExprReads(sv->expr.get(), story, reads);
+            if (sv->assign_op == AssignOp::Assign) {
+                overwritten.insert(name);
+            } else {
+                reads.insert(name); // Append/Remove는 기존 값을 읽는다
+            }
+            for (const auto& r : reads) overwritten.erase(r);
+        }
+    }
+
+    return count;
+}
+
+// =================================================================
+// 도달 불가 노드 제거 (시작 노드는 항상 남긴다)
+// =================================================================
+int CompilerAnalyzer::removeUnreachableNodes(StoryT& story) {
+    auto reachable = findReachableNodes(story);
+    const size_t before = story.nodes.size();
+    story.nodes.erase(
+        std::remove_if(story.nodes.begin(), story.nodes.end(),
+                       [&](const std::unique_ptr<NodeT>& node) {
+                           return node->name != story.start_node_name &&
+                                  reachable.find(node->name) == reachable.end();
+                       }),
+        story.nodes.end());
+    return static_cast<int>(before - story.nodes.size());
+}
+
 // =================================================================
 // 분석
 // =================================================================
@@ -531,17 +1330,65 @@ AnalysisReport CompilerAnalyzer::analyze(const StoryT& story) {
         }
     }
 
+    // 보이는 결과 사이 명령 수 (프레임 끊김 후보)
+    const auto silentCosts = analyzeSilentCost(story);
+    for (const auto& cost : silentCosts) {
+        if (!cost.unbounded) report.maxSilentInstructions = std::max(report.maxSilentInstructions, cost.maxInstructions);
+    }
+    report.silentHotspots = selectSilentHotspots(silentCosts, silentCostThreshold_);
+    for (const auto& hotspot : report.silentHotspots) {
+        std::string path;
+        for (const auto& name : hotspot.path) path += (path.empty() ? "" : " -> ") + name;
+        AnalysisIssue issue;
+        issue.level = AnalysisIssue::WARNING;
+        issue.nodeName = hotspot.nodeName;
+        if (hotspot.unbounded) {
+            issue.kind = AnalysisIssue::SILENT_LOOP;
+            issue.detail = "'" + hotspot.nodeName + "' can loop without a line/choice/command/wait/yield (" +
+                           path + "); insert a yield in the loop";
+        } else {
+            issue.kind = AnalysisIssue::LONG_SILENT_PATH;
+            issue.detail = "up to " + std::to_string(hotspot.maxInstructions) + " instructions without a host-visible result from '" +
+                           hotspot.nodeName + "' at PC " + std::to_string(hotspot.pc) + " (" + path + ")";
+        }
+        report.issues.push_back(issue);
+    }
+
     return report;
 }
 
 // =================================================================
 // 최적화 적용
 // =================================================================
-int CompilerAnalyzer::optimize(StoryT& story) {
-    int total = 0;
-    total += foldConstants(story);
-    total += removeDeadInstructions(story);
-    return total;
+int CompilerAnalyzer::optimize(StoryT& story, int level, AnalysisReport* report) {
+    OptimizationStats stats;
+    // 패스들은 평범한 RPN만 다루므로 단락 평가 skip은 빼 두었다가 끝에 다시 계산한다
+    forEachStoryExpr(story, [](std::unique_ptr<ExpressionT>& expr) {
+        if (expr) ExprTools::removeShortCircuitSkips(*expr);
+    });
+    if (level >= 2) {
+        stats.inlinedCalls = inlineCalls(story);
+        stats.propagatedConstants = propagateConstants(story);
+    }
+    if (level >= 1) {
+        stats.foldedExpressions = foldConstants(story);
+    }
+    if (level >= 2) {
+        stats.foldedConditions = foldConditions(story);
+        stats.threadedJumps = threadJumps(story);
+    }
+    if (level >= 1) {
+        stats.removedDeadInstructions = removeDeadInstructions(story);
+    }
+    if (level >= 2) {
+        stats.removedDeadStores = eliminateDeadStores(story);
+        stats.removedUnreachableNodes = removeUnreachableNodes(story);
+    }
+    forEachStoryExpr(story, [](std::unique_ptr<ExpressionT>& expr) {
+        if (expr) ExprTools::addShortCircuitSkips(*expr);
+    });
+    if (report) report->optimizations = stats;
+    return stats.total();
 }
 
 // =================================================================
@@ -557,6 +1404,7 @@ void CompilerAnalyzer::printReport(const AnalysisReport& report, std::ostream& o
     out << "  String pool: " << report.stringPoolSize << " entries\n";
     out << "  Global variables: " << report.globalVarCount << "\n";
     out << "  Characters: " << report.characterCount << "\n";
+    out << "  Max silent instructions: " << report.maxSilentInstructions << "\n";
     out << "\n";
 
     int warnings = 0, infos = 0;
@@ -585,6 +1433,20 @@ void CompilerAnalyzer::printReport(const AnalysisReport& report, std::ostream& o
         out << "\n";
     }
 
+    const auto& opt = report.optimizations;
+    if (opt.total() > 0) {
+        out << "[Optimizations Applied]\n";
+        out << "  Folded expressions: " << opt.foldedExpressions << "\n";
+        out << "  Propagated constants: " << opt.propagatedConstants << "\n";
+        out << "  Folded conditions: " << opt.foldedConditions << "\n";
+        out << "  Threaded jumps: " << opt.threadedJumps << "\n";
+        out << "  Inlined calls: " << opt.inlinedCalls << "\n";
+        out << "  Removed dead instructions: " << opt.removedDeadInstructions << "\n";
+        out << "  Removed dead stores: " << opt.removedDeadStores << "\n";
+        out << "  Removed unreachable nodes: " << opt.removedUnreachableNodes << "\n";
+        out << "\n";
+    }
+
     if (warnings == 0 && infos == 0) {
         out << "No issues found.\n";
     }
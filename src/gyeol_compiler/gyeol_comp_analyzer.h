@@ -1,9 +1,11 @@
 #pragma once
 #include "gyeol_generated.h"
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <unordered_set>
 #include <ostream>
+#include <utility>
 
 namespace Gyeol {
 
@@ -13,7 +15,9 @@ struct AnalysisIssue {
         UNREACHABLE_NODE,
         UNUSED_VARIABLE,
         DEAD_INSTRUCTION,
-        CONSTANT_FOLDABLE
+        CONSTANT_FOLDABLE,
+        SILENT_LOOP,       // 호스트에 보이는 결과 없이 돌 수 있는 순환
+        LONG_SILENT_PATH   // 보이는 결과 사이 명령 수 상한이 임계값 초과
     };
     Level level;
     Kind kind;
@@ -21,6 +25,34 @@ struct AnalysisIssue {
     std::string detail;
 };
 
+// optimize()가 패스별로 적용한 변경 수
+struct OptimizationStats {
+    int foldedExpressions = 0;        // 접힌 Expression (-O1)
+    int propagatedConstants = 0;      // 상수로 바뀐 변수 참조 (-O2)
+    int foldedConditions = 0;         // Jump로 바뀌거나 삭제된 상수 Condition (-O2)
+    int threadedJumps = 0;            // Jump만 있는 노드를 건너뛰도록 바꾼 분기 (-O2)
+    int inlinedCalls = 0;             // 호출 자리에 펼친 작은 call (-O2, hot 대상은 더 긴 본문까지)
+    int removedDeadInstructions = 0;  // jump/return 뒤 명령어 (-O1)
+    int removedDeadStores = 0;        // 읽히기 전에 덮어쓰인 SetVar (-O2)
+    int removedUnreachableNodes = 0;  // 시작 노드에서 닿지 않는 노드 (-O2)
+
+    int total() const {
+        return foldedExpressions + propagatedConstants + foldedConditions + threadedJumps +
+               inlinedCalls + removedDeadInstructions + removedDeadStores + removedUnreachableNodes;
+    }
+};
+
+// 호스트에 보이는 결과(LINE/CHOICES/COMMAND/WAIT/YIELD, 스토리 끝) 사이에 실행되는 명령 수.
+// 구간은 노드 시작이나 보이는 결과 직후(pc)에서 시작한다.
+struct SilentPathCost {
+    std::string nodeName;
+    uint32_t pc = 0;
+    uint64_t maxInstructions = 0;  // 상한 (unbounded면 0)
+    bool unbounded = false;        // 보이는 결과 없는 순환에 들어갈 수 있음
+    bool inCycle = false;          // 시작점 자체가 그 순환 안에 있음
+    std::vector<std::string> path; // 가장 긴(또는 순환하는) 경로가 지나는 노드
+};
+
 struct AnalysisReport {
     // 메트릭
     int totalNodes = 0;
@@ -29,8 +61,13 @@ struct AnalysisReport {
     int stringPoolSize = 0;
     int globalVarCount = 0;
     int characterCount = 0;
+    uint64_t maxSilentInstructions = 0; // 유한한 구간 중 가장 큰 상한
     // 이슈
     std::vector<AnalysisIssue> issues;
+    // 임계값을 넘거나 순환하는 구간 (순환 먼저, 그다음 상한이 큰 순서)
+    std::vector<SilentPathCost> silentHotspots;
+    // optimize(story, level, &report)가 채운다
+    OptimizationStats optimizations;
 };
 
 class CompilerAnalyzer {
@@ -39,7 +76,25 @@ public:
     AnalysisReport analyze(const ICPDev::Gyeol::Schema::StoryT& story);
 
     // 최적화 적용 (-O 플래그), 반환값: 적용된 최적화 수
-    int optimize(ICPDev::Gyeol::Schema::StoryT& story);
+    // level 0: 없음, 1: 상수 폴딩 + 데드 인스트럭션,
+    // 2: + call 인라인, 상수 전파, 상수 Condition, 점프 스레딩, 데드 스토어, 도달 불가 노드
+    int optimize(ICPDev::Gyeol::Schema::StoryT& story, int level = 1,
+                 AnalysisReport* report = nullptr);
+
+    // 보이는 결과 사이 명령 수 분석. 모든 구간 시작점의 비용을 노드/pc 순서로 반환한다.
+    static std::vector<SilentPathCost> analyzeSilentCost(const ICPDev::Gyeol::Schema::StoryT& story);
+    // 보고할 구간만 고른다: 순환은 순환마다 하나, 유한한 구간은 노드마다 가장 큰 것 중 threshold 초과
+    static std::vector<SilentPathCost> selectSilentHotspots(const std::vector<SilentPathCost>& costs,
+                                                            uint64_t threshold);
+    // analyze()가 hotspot으로 보고할 상한 (기본 kDefaultSilentCostThreshold)
+    void setSilentCostThreshold(uint64_t threshold) { silentCostThreshold_ = threshold; }
+    static constexpr uint64_t kDefaultSilentCostThreshold = 256;
+
+    // 프로파일상 자주 호출되는 call 대상 (-O2 인라인이 더 긴 본문도 펼친다)
+    void setHotCallTargets(std::unordered_set<std::string> targets) { hotCallTargets_ = std::move(targets); }
+    // 호스트가 getVisitCount/hasVisited로 방문 수를 읽지 않는다고 선언한다 (기본 false).
+    // false면 모든 노드의 방문 수를 보이는 결과로 보고 -O2 점프 스레딩/call 인라인을 하지 않는다.
+    void setVisitCountsUnobserved(bool unobserved) { visitCountsUnobserved_ = unobserved; }
 
     // 리포트 출력
     static void printReport(const AnalysisReport& report, std::ostream& out);
@@ -66,7 +121,19 @@ private:
 
     // 최적화 패스
     int foldConstants(ICPDev::Gyeol::Schema::StoryT& story);
+    int foldSetVar(ICPDev::Gyeol::Schema::SetVarT& sv,
+                   const ICPDev::Gyeol::Schema::StoryT& story);
+    int propagateConstants(ICPDev::Gyeol::Schema::StoryT& story);
+    int foldConditions(ICPDev::Gyeol::Schema::StoryT& story);
+    int threadJumps(ICPDev::Gyeol::Schema::StoryT& story);
+    int inlineCalls(ICPDev::Gyeol::Schema::StoryT& story);
     int removeDeadInstructions(ICPDev::Gyeol::Schema::StoryT& story);
+    int eliminateDeadStores(ICPDev::Gyeol::Schema::StoryT& story);
+    int removeUnreachableNodes(ICPDev::Gyeol::Schema::StoryT& story);
+
+    std::unordered_set<std::string> hotCallTargets_;
+    uint64_t silentCostThreshold_ = kDefaultSilentCostThreshold;
+    bool visitCountsUnobserved_ = false;
 };
 
 } // namespace Gyeol
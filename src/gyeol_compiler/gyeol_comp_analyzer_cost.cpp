@@ -0,0 +1,299 @@
+#include "gyeol_comp_analyzer.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol {
+
+namespace {
+
+constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+constexpr size_t kMaxPathNodes = 16;
+
+uint64_t addCost(uint64_t a, uint64_t b) {
+    const uint64_t cap = std::numeric_limits<uint64_t>::max();
+    return a > cap - b ? cap : a + b;
+}
+
+// 실행 위치 (노드, pc) 그래프. pc == 명령 수는 노드 끝.
+// 간선은 보이는 결과 없이 이어지는 다음 위치만 잇는다.
+struct CostGraph {
+    std::vector<uint32_t> nodeBase;   // 노드 n의 pc 0 위치 번호
+    std::vector<uint32_t> pointNode;
+    std::vector<uint32_t> pointPc;
+    std::vector<std::vector<uint32_t>> succ;
+    std::vector<bool> call;           // call: 비용 = 1 + 피호출 노드 + 복귀 후 (succ[0], succ[1])
+    std::vector<uint8_t> self;        // 위치 자체 비용 (노드 끝 0, 명령 1)
+    std::vector<uint32_t> segmentStarts;
+};
+
+CostGraph buildCostGraph(const StoryT& story) {
+    CostGraph g;
+    std::unordered_map<std::string, uint32_t> byName;
+    uint32_t points = 0;
+    for (size_t n = 0; n < story.nodes.size(); ++n) {
+        g.nodeBase.push_back(points);
+        const size_t count = story.nodes[n] ? story.nodes[n]->lines.size() : 0;
+        points += static_cast<uint32_t>(count + 1);
+        if (story.nodes[n]) byName.emplace(story.nodes[n]->name, static_cast<uint32_t>(n));
+    }
+    g.pointNode.resize(points);
+    g.pointPc.resize(points);
+    g.succ.resize(points);
+    g.call.assign(points, false);
+    g.self.assign(points, 1);
+
+    // 이름으로 찾은 대상 노드의 pc 0 (같은 이름이면 첫 노드, 없으면 kNone)
+    auto entry = [&](int32_t nameId) -> uint32_t {
+        if (nameId < 0 || static_cast<size_t>(nameId) >= story.string_pool.size()) return kNone;
+        auto it = byName.find(story.string_pool[static_cast<size_t>(nameId)]);
+        return it != byName.end() ? g.nodeBase[it->second] : kNone;
+    };
+
+    for (size_t n = 0; n < story.nodes.size(); ++n) {
+        const auto& node = story.nodes[n];
+        const uint32_t base = g.nodeBase[n];
+        const uint32_t count = node ? static_cast<uint32_t>(node->lines.size()) : 0;
+        g.segmentStarts.push_back(base);
+        for (uint32_t pc = 0; pc <= count; ++pc) {
+            const uint32_t p = base + pc;
+            g.pointNode[p] = static_cast<uint32_t>(n);
+            g.pointPc[p] = pc;
+            if (pc == count) {
+                g.self[p] = 0; // 노드 끝: 호출자로 복귀하거나 스토리 끝 (호출자 쪽에서 이어서 계산)
+                continue;
+            }
+            const auto& instr = node->lines[pc];
+            auto& out = g.succ[p];
+            const uint32_t next = p + 1;
+            auto addTarget = [&](int32_t nameId) {
+                if (nameId < 0) {
+                    out.push_back(next);
+                } else if (const uint32_t target = entry(nameId); target != kNone) {
+                    out.push_back(target);
+                } // 스토리에 없는 대상은 런타임이 청크 전환/종료로 처리한다
+            };
+            if (!instr) {
+                out.push_back(next);
+                continue;
+            }
+            switch (instr->data.type) {
+                case OpData::Line:
+                case OpData::Command:
+                case OpData::Wait:
+                case OpData::Yield:
+                    if (pc + 1 < count) g.segmentStarts.push_back(next);
+                    break;
+                case OpData::Choice:  // 조건으로 모두 걸러져도 CHOICES 결과를 낸다
+                case OpData::Return:  // 복귀 후는 호출자 쪽에서 이어서 계산
+                    break;
+                case OpData::Jump: {
+                    auto* jump = instr->data.AsJump();
+                    const uint32_t target = entry(jump->target_node_name_id);
+                    if (jump->is_call) {
+                        if (target != kNone) {
+                            out.push_back(target);
+                            g.call[p] = true;
+                            g.segmentStarts.push_back(next);
+                        }
+                        out.push_back(next);
+                    } else if (target != kNone) {
+                        out.push_back(target);
+                    }
+                    break;
+                }
+                case OpData::CallWithReturn: {
+                    const uint32_t target = entry(instr->data.AsCallWithReturn()->target_node_name_id);
+                    if (target != kNone) {
+                        out.push_back(target);
+                        g.call[p] = true;
+                        g.segmentStarts.push_back(next);
+                    }
+                    out.push_back(next);
+                    break;
+                }
+                case OpData::Condition: {
+                    auto* cond = instr->data.AsCondition();
+                    addTarget(cond->true_jump_node_id);
+                    addTarget(cond->false_jump_node_id);
+                    break;
+                }
+                case OpData::Random: {
+                    bool anyWeight = false;
+                    for (const auto& branch : instr->data.AsRandom()->branches) {
+                        if (!branch || branch->weight <= 0) continue;
+                        anyWeight = true;
+                        addTarget(branch->target_node_name_id);
+                    }
+                    if (!anyWeight) out.push_back(next);
+                    break;
+                }
+                default:
+                    out.push_back(next);
+                    break;
+            }
+            std::sort(out.begin() + (g.call[p] ? 2 : 0), out.end());
+            out.erase(std::unique(out.begin() + (g.call[p] ? 2 : 0), out.end()), out.end());
+        }
+    }
+    std::sort(g.segmentStarts.begin(), g.segmentStarts.end());
+    g.segmentStarts.erase(std::unique(g.segmentStarts.begin(), g.segmentStarts.end()), g.segmentStarts.end());
+    return g;
+}
+
+// 강한 연결 요소 (반복 Tarjan). 요소는 도달하는 요소보다 나중에 나온다 (싱크 먼저).
+std::vector<std::vector<uint32_t>> stronglyConnected(const CostGraph& g) {
+    const uint32_t count = static_cast<uint32_t>(g.succ.size());
+    std::vector<uint32_t> index(count, kNone);
+    std::vector<uint32_t> low(count, 0);
+    std::vector<bool> onStack(count, false);
+    std::vector<uint32_t> stack;
+    std::vector<std::pair<uint32_t, size_t>> work; // (위치, 다음에 볼 간선)
+    std::vector<std::vector<uint32_t>> components;
+    uint32_t nextIndex = 0;
+
+    for (uint32_t root = 0; root < count; ++root) {
+        if (index[root] != kNone) continue;
+        work.emplace_back(root, 0);
+        while (!work.empty()) {
+            auto& [v, edge] = work.back();
+            if (edge == 0 && index[v] == kNone) {
+                index[v] = low[v] = nextIndex++;
+                stack.push_back(v);
+                onStack[v] = true;
+            }
+            if (edge < g.succ[v].size()) {
+                const uint32_t w = g.succ[v][edge++];
+                if (index[w] == kNone) {
+                    work.emplace_back(w, 0);
+                } else if (onStack[w]) {
+                    low[v] = std::min(low[v], index[w]);
+                }
+                continue;
+            }
+            const uint32_t done = v;
+            work.pop_back();
+            if (!work.empty()) low[work.back().first] = std::min(low[work.back().first], low[done]);
+            if (low[done] == index[done]) {
+                std::vector<uint32_t> component;
+                uint32_t w;
+                do {
+                    w = stack.back();
+                    stack.pop_back();
+                    onStack[w] = false;
+                    component.push_back(w);
+                } while (w != done);
+                components.push_back(std::move(component));
+            }
+        }
+    }
+    return components;
+}
+
+} // namespace
+
+std::vector<SilentPathCost> CompilerAnalyzer::analyzeSilentCost(const StoryT& story) {
+    const CostGraph g = buildCostGraph(story);
+    const size_t count = g.succ.size();
+    std::vector<uint64_t> cost(count, 0);
+    std::vector<bool> unbounded(count, false);
+    std::vector<bool> cyclic(count, false);
+    std::vector<uint32_t> best(count, kNone); // 경로 복원용 다음 위치
+
+    for (const auto& component : stronglyConnected(g)) {
+        const uint32_t v = component.front();
+        const bool selfLoop = std::find(g.succ[v].begin(), g.succ[v].end(), v) != g.succ[v].end();
+        if (component.size() > 1 || selfLoop) {
+            for (uint32_t p : component) unbounded[p] = cyclic[p] = true;
+            // 경로는 순환 안의 다음 위치를 따라간다
+            for (uint32_t p : component) {
+                for (uint32_t w : g.succ[p]) {
+                    if (!unbounded[w]) continue;
+                    best[p] = w;
+                    if (std::find(component.begin(), component.end(), w) != component.end()) break;
+                }
+            }
+            continue;
+        }
+        // 싱크 먼저 나오므로 후속 위치는 모두 계산되어 있다
+        uint64_t rest = 0;
+        for (size_t k = 0; k < g.succ[v].size(); ++k) {
+            const uint32_t w = g.succ[v][k];
+            if (unbounded[w]) {
+                unbounded[v] = true;
+                best[v] = w;
+                break;
+            }
+            if (g.call[v]) {
+                rest = addCost(rest, cost[w]);
+                if (best[v] == kNone || cost[w] > cost[best[v]]) best[v] = w;
+            } else if (best[v] == kNone || cost[w] > rest) {
+                rest = cost[w];
+                best[v] = w;
+            }
+        }
+        if (!unbounded[v]) cost[v] = addCost(g.self[v], rest);
+    }
+
+    std::vector<SilentPathCost> out;
+    out.reserve(g.segmentStarts.size());
+    std::vector<bool> seen(count, false);
+    for (uint32_t start : g.segmentStarts) {
+        SilentPathCost entry;
+        const auto& node = story.nodes[g.pointNode[start]];
+        entry.nodeName = node ? node->name : std::string();
+        entry.pc = g.pointPc[start];
+        entry.unbounded = unbounded[start];
+        entry.inCycle = cyclic[start];
+        entry.maxInstructions = unbounded[start] ? 0 : cost[start];
+        std::vector<uint32_t> visited;
+        for (uint32_t p = start; p != kNone && !seen[p]; p = best[p]) {
+            seen[p] = true;
+            visited.push_back(p);
+            const auto& at = story.nodes[g.pointNode[p]];
+            const std::string name = at ? at->name : std::string();
+            if (entry.path.empty() || entry.path.back() != name) {
+                if (entry.path.size() == kMaxPathNodes) break;
+                entry.path.push_back(name);
+            }
+        }
+        for (uint32_t p : visited) seen[p] = false;
+        out.push_back(std::move(entry));
+    }
+    return out;
+}
+
+std::vector<SilentPathCost> CompilerAnalyzer::selectSilentHotspots(const std::vector<SilentPathCost>& costs,
+                                                                   uint64_t threshold) {
+    std::vector<SilentPathCost> loops;
+    std::vector<SilentPathCost> longest;
+    std::unordered_set<std::string> loopNodes;
+    std::unordered_map<std::string, size_t> byNode; // 노드 → longest 인덱스
+    for (const auto& c : costs) {
+        if (c.unbounded) {
+            // 순환 안의 시작점만, 이미 보고한 순환의 노드면 건너뛴다
+            if (!c.inCycle || loopNodes.count(c.nodeName)) continue;
+            loopNodes.insert(c.path.begin(), c.path.end());
+            loops.push_back(c);
+        } else if (c.maxInstructions > threshold) {
+            auto it = byNode.find(c.nodeName);
+            if (it == byNode.end()) {
+                byNode.emplace(c.nodeName, longest.size());
+                longest.push_back(c);
+            } else if (c.maxInstructions > longest[it->second].maxInstructions) {
+                longest[it->second] = c;
+            }
+        }
+    }
+    std::stable_sort(longest.begin(), longest.end(), [](const SilentPathCost& a, const SilentPathCost& b) {
+        return a.maxInstructions > b.maxInstructions;
+    });
+    loops.insert(loops.end(), longest.begin(), longest.end());
+    return loops;
+}
+
+} // namespace Gyeol
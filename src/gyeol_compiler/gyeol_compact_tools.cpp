@@ -0,0 +1,176 @@
+#include "gyeol_compact_tools.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol::CompactTools {
+
+namespace {
+
+// 고정 크기 레코드로 옮길 수 있으면 true (rec에 결과)
+bool toCompact(const InstructionT& instr, CompactInstr& rec) {
+    switch (instr.data.type) {
+        case OpData::Line: {
+            auto* line = instr.data.AsLine();
+            if (!line->tags.empty()) return false;
+            rec = CompactInstr(CompactOp::Line, line->hot_template ? 1 : 0,
+                               line->character_id, line->text_id, line->voice_asset_id);
+            return true;
+        }
+        case OpData::Jump: {
+            auto* jump = instr.data.AsJump();
+            if (jump->is_call || !jump->arg_exprs.empty()) return false;
+            rec = CompactInstr(CompactOp::Jump, 0, jump->target_node_name_id, jump->target_node_index, 0);
+            return true;
+        }
+        case OpData::Wait:
+            rec = CompactInstr(CompactOp::Wait, 0, instr.data.AsWait()->tag_id, 0, 0);
+            return true;
+        case OpData::Yield:
+            rec = CompactInstr(CompactOp::Yield, 0, 0, 0, 0);
+            return true;
+        case OpData::SetVar: {
+            auto* setVar = instr.data.AsSetVar();
+            if (setVar->expr || setVar->assign_op != AssignOp::Assign) return false;
+            int32_t bits = 0;
+            switch (setVar->value.type) {
+                case ValueData::IntValue: bits = setVar->value.AsIntValue()->val; break;
+                case ValueData::BoolValue: bits = setVar->value.AsBoolValue()->val ? 1 : 0; break;
+                case ValueData::FloatValue: {
+                    const float f = setVar->value.AsFloatValue()->val;
+                    std::memcpy(&bits, &f, sizeof(bits));
+                    break;
+                }
+                default:
+                    return false;
+            }
+            rec = CompactInstr(CompactOp::SetVar, static_cast<uint8_t>(setVar->value.type),
+                               setVar->var_name_id, bits, 0);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+std::unique_ptr<InstructionT> toTable(const CompactInstr& rec) {
+    auto instr = std::make_unique<InstructionT>();
+    switch (rec.op()) {
+        case CompactOp::Line: {
+            LineT line;
+            line.character_id = rec.a();
+            line.text_id = rec.b();
+            line.voice_asset_id = rec.c();
+            line.hot_template = (rec.kind() & 1) != 0;
+            instr->data.Set(std::move(line));
+            break;
+        }
+        case CompactOp::Jump: {
+            JumpT jump;
+            jump.target_node_name_id = rec.a();
+            jump.target_node_index = rec.b();
+            instr->data.Set(std::move(jump));
+            break;
+        }
+        case CompactOp::Wait: {
+            WaitT wait;
+            wait.tag_id = rec.a();
+            instr->data.Set(std::move(wait));
+            break;
+        }
+        case CompactOp::Yield:
+            instr->data.Set(YieldT());
+            break;
+        case CompactOp::SetVar: {
+            SetVarT setVar;
+            setVar.var_name_id = rec.a();
+            switch (static_cast<ValueData>(rec.kind())) {
+                case ValueData::BoolValue: {
+                    BoolValueT v;
+                    v.val = rec.b() != 0;
+                    setVar.value.Set(std::move(v));
+                    break;
+                }
+                case ValueData::FloatValue: {
+                    FloatValueT v;
+                    const int32_t bits = rec.b();
+                    std::memcpy(&v.val, &bits, sizeof(bits));
+                    setVar.value.Set(std::move(v));
+                    break;
+                }
+                default: {
+                    IntValueT v;
+                    v.val = rec.b();
+                    setVar.value.Set(std::move(v));
+                    break;
+                }
+            }
+            instr->data.Set(std::move(setVar));
+            break;
+        }
+        default:
+            break;
+    }
+    return instr;
+}
+
+// 노드 하나를 직렬화한 크기 (크기 비교용)
+size_t packedSize(const NodeT& node) {
+    flatbuffers::FlatBufferBuilder builder;
+    builder.Finish(CreateNode(builder, &node));
+    return builder.GetSize();
+}
+
+} // namespace
+
+size_t compactInstructions(StoryT& story) {
+    size_t compacted = 0;
+    for (auto& node : story.nodes) {
+        if (!node || !node->ops.empty()) continue;
+
+        std::vector<CompactInstr> ops(node->lines.size());
+        size_t nodeCompacted = 0;
+        for (size_t i = 0; i < node->lines.size(); ++i) {
+            if (node->lines[i] && toCompact(*node->lines[i], ops[i])) nodeCompacted++;
+        }
+        if (nodeCompacted == 0) continue;
+
+        NodeT candidate(*node);
+        candidate.lines.clear();
+        for (size_t i = 0; i < node->lines.size(); ++i) {
+            if (ops[i].op() != CompactOp::Table) continue;
+            ops[i] = CompactInstr(CompactOp::Table, 0, static_cast<int32_t>(candidate.lines.size()), 0, 0);
+            candidate.lines.push_back(node->lines[i] ? std::make_unique<InstructionT>(*node->lines[i]) : nullptr);
+        }
+        candidate.ops = std::move(ops);
+
+        // Table 레코드도 16바이트라 테이블 명령이 많은 노드는 오히려 커진다: 작아질 때만 바꾼다
+        if (packedSize(candidate) >= packedSize(*node)) continue;
+        node->lines = std::move(candidate.lines);
+        node->ops = std::move(candidate.ops);
+        compacted += nodeCompacted;
+    }
+    return compacted;
+}
+
+void expandInstructions(StoryT& story) {
+    for (auto& node : story.nodes) {
+        if (!node || node->ops.empty()) continue;
+        std::vector<std::unique_ptr<InstructionT>> lines;
+        lines.reserve(node->ops.size());
+        for (const auto& rec : node->ops) {
+            if (rec.op() != CompactOp::Table) {
+                lines.push_back(toTable(rec));
+            } else if (rec.a() >= 0 && static_cast<size_t>(rec.a()) < node->lines.size()) {
+                lines.push_back(std::move(node->lines[static_cast<size_t>(rec.a())]));
+            }
+        }
+        node->lines = std::move(lines);
+        node->ops.clear();
+    }
+}
+
+} // namespace Gyeol::CompactTools
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "gyeol_generated.h"
+#include <cstddef>
+
+namespace Gyeol::CompactTools {
+
+// 고정 크기로 표현되는 명령을 Node.ops의 16바이트 압축 레코드로 옮긴다.
+//   태그 없는 Line, 인자 없는 Jump, Wait, Yield, 리터럴(Int/Float/Bool) 대입 SetVar
+// 나머지 명령은 lines에 남고 CompactOp::Table 레코드가 가리킨다 (pc는 그대로).
+// 직렬화 크기가 줄어드는 노드만 바꾸고(이미 압축된 노드는 그대로) 압축한 명령 수를 반환한다.
+// .gyb를 쓰기 직전 마지막 단계로 호출한다 (최적화/풀 압축/링크는 테이블 형식 기준).
+size_t compactInstructions(ICPDev::Gyeol::Schema::StoryT& story);
+
+// 압축 레코드를 테이블 명령으로 되돌린다 (UnPack한 압축 .gyb를 다른 도구에 넘길 때).
+void expandInstructions(ICPDev::Gyeol::Schema::StoryT& story);
+
+} // namespace Gyeol::CompactTools
@@ -0,0 +1,88 @@
+#include "gyeol_expr_tools.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol::ExprTools {
+
+namespace {
+
+// 토큰 하나가 스택에서 꺼내는 값 개수 (-1이면 알 수 없는 연산)
+int popCount(ExprOp op) {
+    switch (op) {
+        case ExprOp::PushLiteral: case ExprOp::PushVar: case ExprOp::PushVisitCount:
+        case ExprOp::PushVisited: case ExprOp::ListLength:
+            return 0;
+        case ExprOp::Negate: case ExprOp::Not:
+            return 1;
+        case ExprOp::Add: case ExprOp::Sub: case ExprOp::Mul: case ExprOp::Div: case ExprOp::Mod:
+        case ExprOp::CmpEq: case ExprOp::CmpNe: case ExprOp::CmpGt: case ExprOp::CmpLt:
+        case ExprOp::CmpGe: case ExprOp::CmpLe:
+        case ExprOp::And: case ExprOp::Or: case ExprOp::ListContains:
+            return 2;
+        default:
+            return -1;
+    }
+}
+
+} // namespace
+
+int addShortCircuitSkips(ExpressionT& expr) {
+    // 1차: 모양만 검사해서 중간에 포기해도 식이 망가지지 않게 한다
+    size_t depth = 0;
+    bool hasLogical = false;
+    for (const auto& tok : expr.tokens) {
+        if (!tok) return 0;
+        const int pops = popCount(tok->op);
+        if (pops < 0 || depth < static_cast<size_t>(pops)) return 0;
+        depth = depth - pops + 1;
+        hasLogical = hasLogical || tok->op == ExprOp::And || tok->op == ExprOp::Or;
+    }
+    if (depth != 1 || !hasLogical) return 0;
+
+    // 2차: 피연산자마다 토큰 구간을 쌓아 가며 다시 배치
+    using Span = std::vector<std::unique_ptr<ExprTokenT>>;
+    std::vector<Span> stack;
+    int inserted = 0;
+    for (auto& tok : expr.tokens) {
+        const int pops = popCount(tok->op);
+        if (pops == 0) {
+            stack.emplace_back();
+            stack.back().push_back(std::move(tok));
+            continue;
+        }
+        if (pops == 1) {
+            stack.back().push_back(std::move(tok));
+            continue;
+        }
+        Span rhs = std::move(stack.back());
+        stack.pop_back();
+        Span& lhs = stack.back();
+        if (tok->op == ExprOp::And || tok->op == ExprOp::Or) {
+            auto skip = std::make_unique<ExprTokenT>();
+            skip->op = tok->op == ExprOp::And ? ExprOp::SkipIfFalse : ExprOp::SkipIfTrue;
+            skip->skip = static_cast<int32_t>(rhs.size() + 1);
+            lhs.push_back(std::move(skip));
+            ++inserted;
+        }
+        std::move(rhs.begin(), rhs.end(), std::back_inserter(lhs));
+        lhs.push_back(std::move(tok));
+    }
+    expr.tokens = std::move(stack.back());
+    return inserted;
+}
+
+int removeShortCircuitSkips(ExpressionT& expr) {
+    const size_t before = expr.tokens.size();
+    expr.tokens.erase(std::remove_if(expr.tokens.begin(), expr.tokens.end(),
+                                     [](const std::unique_ptr<ExprTokenT>& tok) {
+                                         return tok && isSkipOp(tok->op);
+                                     }),
+                      expr.tokens.end());
+    return static_cast<int>(before - expr.tokens.size());
+}
+
+} // namespace Gyeol::ExprTools
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "gyeol_generated.h"
+
+namespace Gyeol::ExprTools {
+
+// And/Or의 왼쪽 피연산자 뒤에 SkipIfFalse/SkipIfTrue를 넣어 단락 평가하게 한다.
+//   A B And  →  A SkipIfFalse(len(B)+1) B And
+//   A B Or   →  A SkipIfTrue(len(B)+1)  B Or
+// RPN이 올바르지 않거나 이미 skip 연산이 있으면 식을 바꾸지 않는다. 넣은 개수를 반환한다.
+int addShortCircuitSkips(ICPDev::Gyeol::Schema::ExpressionT& expr);
+
+// SkipIfFalse/SkipIfTrue를 모두 지워 평범한 RPN으로 되돌린다. 지운 개수를 반환한다.
+int removeShortCircuitSkips(ICPDev::Gyeol::Schema::ExpressionT& expr);
+
+inline bool isSkipOp(ICPDev::Gyeol::Schema::ExprOp op) {
+    return op == ICPDev::Gyeol::Schema::ExprOp::SkipIfFalse ||
+           op == ICPDev::Gyeol::Schema::ExprOp::SkipIfTrue;
+}
+
+} // namespace Gyeol::ExprTools
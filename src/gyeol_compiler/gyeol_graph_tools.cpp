@@ -1,5 +1,6 @@
 #include "gyeol_graph_tools.h"
 #include "gyeol_parser.h"
+#include "gyeol_expr_tools.h"
 
 #include <flatbuffers/flatbuffers.h>
 
@@ -535,6 +536,7 @@ std::unique_ptr<ExpressionT> remapExpression(const ExpressionT* srcExpr, const S
         if (!token) continue;
         auto t = std::make_unique<ExprTokenT>();
         t->op = token->op;
+        t->skip = token->skip;
         t->literal_value = remapValueData(token->literal_value, srcStory, dstStory);
         if (token->var_name_id >= 0) {
             t->var_name_id = findOrAddString(dstStory, poolStr(srcStory, token->var_name_id));
@@ -1489,7 +1491,8 @@ bool renderExpression(const ExpressionT* expr, const StoryT& story, std::string&
 
     std::vector<std::string> stack;
     for (const auto& tok : expr->tokens) {
-        if (!tok) continue;
+        // 단락 평가용 skip 토큰은 값을 만들지 않으므로 스크립트에 나타나지 않는다
+        if (!tok || ExprTools::isSkipOp(tok->op)) continue;
         switch (tok->op) {
         case ExprOp::PushLiteral: {
             std::string literal;
@@ -1,4 +1,5 @@
 #include "gyeol_json_export.h"
+#include "gyeol_expr_tools.h"
 
 using json = nlohmann::json;
 using namespace ICPDev::Gyeol::Schema;
@@ -78,9 +79,10 @@ json JsonExport::serializeExpression(const ExpressionT* expr,
                                      const std::vector<std::string>& pool) {
     if (!expr) return nullptr;
 
+    // skip 토큰은 JSON IR 리더가 다시 계산하므로 내보내지 않는다
     json tokens = json::array();
     for (const auto& token : expr->tokens) {
-        if (token) {
+        if (token && !ExprTools::isSkipOp(token->op)) {
             tokens.push_back(serializeExprToken(*token, pool));
         }
     }
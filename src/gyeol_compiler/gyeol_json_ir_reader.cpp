@@ -1,4 +1,7 @@
 #include "gyeol_json_ir_reader.h"
+#include "gyeol_story_emitter.h"
+#include "gyeol_expr_tools.h"
+#include "gyeol_story_linker.h"
 
 #include <flatbuffers/flatbuffers.h>
 
@@ -157,6 +160,8 @@ bool parseExpression(const json& spec,
         if (!parseEnumByName(opText, EnumValuesExprOp(), EnumNameExprOp, token->op)) {
             return setError(errorOut, "Unknown ExprOp: " + opText);
         }
+        // 단락 평가 skip은 아래에서 다시 계산한다 (입력에 있으면 버림)
+        if (ExprTools::isSkipOp(token->op)) continue;
 
         token->var_name_id = -1;
         if (tok.contains("var_name")) {
@@ -174,6 +179,7 @@ bool parseExpression(const json& spec,
 
         expr->tokens.push_back(std::move(token));
     }
+    ExprTools::addShortCircuitSkips(*expr);
 
     outExpr = std::move(expr);
     return true;
@@ -586,9 +592,8 @@ bool parseSetVar(const json& spec,
     return true;
 }
 
-} // namespace
-
-bool JsonIrReader::fromJson(const json& doc, StoryT& outStory, std::string* errorOut) {
+// emitter가 있으면 노드를 읽는 대로 내보내고 버린다 (outStory.nodes는 비어 있게 된다)
+bool readStory(const json& doc, StoryT& outStory, StoryEmitter* emitter, std::string* errorOut) {
     outStory = StoryT{};
 
     if (!doc.is_object()) {
@@ -652,18 +657,16 @@ bool JsonIrReader::fromJson(const json& doc, StoryT& outStory, std::string* erro
         }
     }
 
+    bool foundStartNode = false;
     for (const auto& nodeSpec : doc["nodes"]) {
         std::unique_ptr<NodeT> node;
         if (!parseNode(nodeSpec, ctx, node, errorOut)) return false;
-        outStory.nodes.push_back(std::move(node));
-    }
-
-    bool foundStartNode = false;
-    for (const auto& node : outStory.nodes) {
-        if (node && node->name == outStory.start_node_name) {
-            foundStartNode = true;
-            break;
+        if (node->name == outStory.start_node_name) foundStartNode = true;
+        if (emitter) {
+            emitter->emitNode(*node);
+            continue;
         }
+        outStory.nodes.push_back(std::move(node));
     }
     if (!foundStartNode) {
         return setError(errorOut, "start_node_name does not exist in nodes.");
@@ -676,6 +679,25 @@ bool JsonIrReader::fromJson(const json& doc, StoryT& outStory, std::string* erro
     return true;
 }
 
+bool readJsonFile(const std::string& path, json& doc, std::string* errorOut) {
+    std::ifstream ifs(path);
+    if (!ifs.is_open()) {
+        return setError(errorOut, "Failed to open JSON IR file: " + path);
+    }
+    try {
+        ifs >> doc;
+    } catch (const std::exception& e) {
+        return setError(errorOut, std::string("Invalid JSON IR file: ") + e.what());
+    }
+    return true;
+}
+
+} // namespace
+
+bool JsonIrReader::fromJson(const json& doc, StoryT& outStory, std::string* errorOut) {
+    return readStory(doc, outStory, nullptr, errorOut);
+}
+
 bool JsonIrReader::fromJsonString(const std::string& jsonText, StoryT& outStory, std::string* errorOut) {
     json doc;
     try {
@@ -687,23 +709,33 @@ bool JsonIrReader::fromJsonString(const std::string& jsonText, StoryT& outStory,
 }
 
 bool JsonIrReader::fromFile(const std::string& path, StoryT& outStory, std::string* errorOut) {
-    std::ifstream ifs(path);
-    if (!ifs.is_open()) {
-        return setError(errorOut, "Failed to open JSON IR file: " + path);
-    }
-
     json doc;
-    try {
-        ifs >> doc;
-    } catch (const std::exception& e) {
-        return setError(errorOut, std::string("Invalid JSON IR file: ") + e.what());
-    }
+    if (!readJsonFile(path, doc, errorOut)) return false;
     return fromJson(doc, outStory, errorOut);
 }
 
+bool JsonIrReader::compileJsonToBuffer(const json& doc, std::vector<uint8_t>& outBuffer, std::string* errorOut) {
+    outBuffer.clear();
+    StoryT header;
+    StoryEmitter emitter;
+    if (!readStory(doc, header, &emitter, errorOut)) return false;
+    outBuffer = emitter.finish(header);
+    return true;
+}
+
+bool JsonIrReader::compileFileToBuffer(const std::string& path, std::vector<uint8_t>& outBuffer,
+                                       std::string* errorOut) {
+    outBuffer.clear();
+    json doc;
+    if (!readJsonFile(path, doc, errorOut)) return false;
+    return compileJsonToBuffer(doc, outBuffer, errorOut);
+}
+
 std::vector<uint8_t> JsonIrReader::compileToBuffer(const StoryT& story) {
     flatbuffers::FlatBufferBuilder builder;
     auto* mutableStory = const_cast<StoryT*>(&story);
+    // 노드 인덱스/이름 표는 nodes에서 나오는 파생 값이라 쓰기 직전에 다시 계산한다
+    StoryLinker::linkStory(*mutableStory);
     const auto rootOffset = Story::Pack(builder, mutableStory);
     builder.Finish(rootOffset);
     return std::vector<uint8_t>(builder.GetBufferPointer(),
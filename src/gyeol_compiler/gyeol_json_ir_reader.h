@@ -22,6 +22,15 @@ public:
                          std::string* errorOut = nullptr);
 
     static std::vector<uint8_t> compileToBuffer(const ICPDev::Gyeol::Schema::StoryT& story);
+
+    // StoryT를 만들지 않고 노드를 읽는 대로 .gyb 버퍼에 쓴다 (fromJson + compileToBuffer와 같은 내용).
+    static bool compileJsonToBuffer(const nlohmann::json& doc,
+                                    std::vector<uint8_t>& outBuffer,
+                                    std::string* errorOut = nullptr);
+
+    static bool compileFileToBuffer(const std::string& path,
+                                    std::vector<uint8_t>& outBuffer,
+                                    std::string* errorOut = nullptr);
 };
 
 } // namespace Gyeol
@@ -1,5 +1,6 @@
 #include "gyeol_json_ir_tooling.h"
 
+#include "gyeol_comp_analyzer.h"
 #include "gyeol_graph_tools.h"
 #include "gyeol_json_export.h"
 #include "gyeol_json_ir_reader.h"
@@ -492,6 +493,36 @@ bool JsonIrTooling::lintStory(const StoryT& story,
         }
     }
 
+    // 보이는 결과(대사/선택지/명령/대기/yield) 없이 오래 실행되는 구간
+    const auto hotspots = CompilerAnalyzer::selectSilentHotspots(
+        CompilerAnalyzer::analyzeSilentCost(story), CompilerAnalyzer::kDefaultSilentCostThreshold);
+    for (const auto& hotspot : hotspots) {
+        std::string path;
+        for (const auto& name : hotspot.path) path += (path.empty() ? "" : " -> ") + name;
+        if (hotspot.unbounded) {
+            addDiagnostic(
+                outDiagnostics,
+                "IR_SILENT_LOOP",
+                "warning",
+                storyPath,
+                hotspot.nodeName,
+                static_cast<int>(hotspot.pc),
+                "보이는 결과 없이 반복될 수 있는 경로가 있습니다: " + path,
+                "반복 경로 안에 yield를 넣어 한 step이 오래 걸리지 않게 하세요.");
+        } else {
+            addDiagnostic(
+                outDiagnostics,
+                "IR_SILENT_PATH_LONG",
+                "warning",
+                storyPath,
+                hotspot.nodeName,
+                static_cast<int>(hotspot.pc),
+                "보이는 결과 없이 최대 " + std::to_string(hotspot.maxInstructions) +
+                    "개 명령을 실행합니다: " + path,
+                "경로 중간에 yield를 넣어 실행을 여러 step으로 나누세요.");
+        }
+    }
+
     return true;
 }
 
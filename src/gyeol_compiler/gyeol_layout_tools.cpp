@@ -0,0 +1,207 @@
+#include "gyeol_layout_tools.h"
+#include "gyeol_pool_tools.h"
+#include "gyeol_story_linker.h"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <string_view>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol::LayoutTools {
+
+namespace {
+
+bool setError(std::string* errorOut, const std::string& message) {
+    if (errorOut) *errorOut = message;
+    return false;
+}
+
+// 노드별 분기 대상 (명령 순서, 중복 포함)
+std::vector<std::vector<size_t>> buildSuccessors(const StoryT& story) {
+    std::unordered_map<std::string_view, size_t> byName;
+    for (size_t i = 0; i < story.nodes.size(); ++i) {
+        if (story.nodes[i]) byName.emplace(story.nodes[i]->name, i);
+    }
+    const int32_t poolSize = static_cast<int32_t>(story.string_pool.size());
+    std::vector<std::vector<size_t>> successors(story.nodes.size());
+    for (size_t i = 0; i < story.nodes.size(); ++i) {
+        const auto& node = story.nodes[i];
+        if (!node) continue;
+        auto add = [&](int32_t nameId) {
+            if (nameId < 0 || nameId >= poolSize) return;
+            auto it = byName.find(story.string_pool[nameId]);
+            if (it != byName.end()) successors[i].push_back(it->second);
+        };
+        auto addInstr = [&](const InstructionT* instr) {
+            if (!instr) return;
+            StoryLinker::forEachTargetField(*instr, [&](int32_t nameId, const int32_t&) { add(nameId); });
+        };
+        if (node->ops.empty()) {
+            for (const auto& instr : node->lines) addInstr(instr.get());
+            continue;
+        }
+        for (const auto& rec : node->ops) {
+            if (rec.op() == CompactOp::Jump) {
+                add(rec.a());
+            } else if (rec.op() == CompactOp::Table && rec.a() >= 0 &&
+                       static_cast<size_t>(rec.a()) < node->lines.size()) {
+                addInstr(node->lines[static_cast<size_t>(rec.a())].get());
+            }
+        }
+    }
+    return successors;
+}
+
+size_t findStartNode(const StoryT& story) {
+    for (size_t i = 0; i < story.nodes.size(); ++i) {
+        if (story.nodes[i] && story.nodes[i]->name == story.start_node_name) return i;
+    }
+    return 0;
+}
+
+// 첫 참조 순으로 string_pool/line_ids를 다시 놓고 모든 참조 id를 고친다
+void orderPoolByFirstUse(StoryT& story) {
+    const size_t poolSize = story.string_pool.size();
+    std::vector<int32_t> newIndex(poolSize, -1);
+    std::vector<size_t> order;
+    order.reserve(poolSize);
+    // 같은 참조를 두 번 방문해도 안전하도록 순서 수집과 id 변경을 나눈다
+    PoolTools::visitStoryPoolRefs(story, [&](int32_t& id, PoolTools::PoolRefKind) {
+        if (id < 0 || static_cast<size_t>(id) >= poolSize || newIndex[id] >= 0) return;
+        newIndex[id] = static_cast<int32_t>(order.size());
+        order.push_back(static_cast<size_t>(id));
+    });
+    for (size_t i = 0; i < poolSize; ++i) {
+        if (newIndex[i] >= 0) continue;
+        newIndex[i] = static_cast<int32_t>(order.size());
+        order.push_back(i);
+    }
+    PoolTools::visitStoryPoolRefs(story, [&](int32_t& id, PoolTools::PoolRefKind) {
+        if (id >= 0 && static_cast<size_t>(id) < poolSize) id = newIndex[id];
+    });
+
+    const bool parallelIds = story.line_ids.size() == poolSize;
+    std::vector<std::string> pool(poolSize);
+    std::vector<std::string> lineIds(parallelIds ? poolSize : 0);
+    for (size_t i = 0; i < poolSize; ++i) {
+        pool[i] = std::move(story.string_pool[order[i]]);
+        if (parallelIds) lineIds[i] = std::move(story.line_ids[order[i]]);
+    }
+    story.string_pool = std::move(pool);
+    if (parallelIds) story.line_ids = std::move(lineIds);
+}
+
+} // namespace
+
+std::vector<size_t> computeNodeOrder(const StoryT& story, const LayoutOptions& options) {
+    const size_t count = story.nodes.size();
+    std::vector<size_t> order;
+    order.reserve(count);
+    std::vector<bool> placed(count, false);
+    auto place = [&](size_t i) {
+        if (placed[i]) return;
+        placed[i] = true;
+        order.push_back(i);
+    };
+    if (count == 0) return order;
+
+    std::vector<size_t> traversal;
+    if (options.order == NodeOrder::SOURCE) {
+        for (size_t i = 0; i < count; ++i) traversal.push_back(i);
+    } else {
+        const auto successors = buildSuccessors(story);
+        std::vector<bool> seen(count, false);
+        const size_t start = findStartNode(story);
+        if (options.order == NodeOrder::BFS) {
+            std::deque<size_t> queue{start};
+            seen[start] = true;
+            while (!queue.empty()) {
+                const size_t n = queue.front();
+                queue.pop_front();
+                traversal.push_back(n);
+                for (size_t next : successors[n]) {
+                    if (!seen[next]) {
+                        seen[next] = true;
+                        queue.push_back(next);
+                    }
+                }
+            }
+        } else {
+            // 전위 순회: 첫 분기 대상을 끝까지 따라간 뒤 다음 대상
+            std::vector<size_t> stack{start};
+            while (!stack.empty()) {
+                const size_t n = stack.back();
+                stack.pop_back();
+                if (seen[n]) continue;
+                seen[n] = true;
+                traversal.push_back(n);
+                for (auto it = successors[n].rbegin(); it != successors[n].rend(); ++it) {
+                    if (!seen[*it]) stack.push_back(*it);
+                }
+            }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (!seen[i]) traversal.push_back(i);
+        }
+    }
+
+    if (!options.nodeWeights.empty()) {
+        std::vector<std::pair<uint64_t, size_t>> hot; // (가중치, traversal 위치)
+        for (size_t pos = 0; pos < traversal.size(); ++pos) {
+            const auto& node = story.nodes[traversal[pos]];
+            if (!node) continue;
+            auto it = options.nodeWeights.find(node->name);
+            if (it != options.nodeWeights.end() && it->second > 0) hot.emplace_back(it->second, pos);
+        }
+        std::stable_sort(hot.begin(), hot.end(), [](const auto& a, const auto& b) {
+            return a.first > b.first;
+        });
+        for (const auto& [weight, pos] : hot) place(traversal[pos]);
+    }
+    for (size_t n : traversal) place(n);
+    return order;
+}
+
+bool layoutStory(StoryT& story, const LayoutOptions& options, std::string* errorOut) {
+    if (story.compressed_pool && options.poolByFirstUse) {
+        return setError(errorOut, "string pool is already compressed; lay out the story before compressing");
+    }
+
+    const auto order = computeNodeOrder(story, options);
+    std::vector<std::unique_ptr<NodeT>> nodes;
+    nodes.reserve(order.size());
+    for (size_t i : order) nodes.push_back(std::move(story.nodes[i]));
+    story.nodes = std::move(nodes);
+
+    if (options.poolByFirstUse) orderPoolByFirstUse(story);
+    StoryLinker::linkStory(story);
+    return true;
+}
+
+bool loadNodeWeights(const nlohmann::json& profile,
+                     std::unordered_map<std::string, uint64_t>& outWeights,
+                     std::string* errorOut) {
+    if (!profile.is_object() || profile.value("format", "") != "gyeol-runtime-profile") {
+        return setError(errorOut, "profile format must be 'gyeol-runtime-profile'");
+    }
+    const auto nodes = profile.find("nodes");
+    if (nodes == profile.end() || !nodes->is_array()) {
+        return setError(errorOut, "profile.nodes must be an array");
+    }
+    outWeights.clear();
+    for (const auto& entry : *nodes) {
+        if (!entry.is_object() || !entry.contains("node") || !entry["node"].is_string()) {
+            return setError(errorOut, "profile node entry must have a string 'node'");
+        }
+        const auto visits = entry.find("visits");
+        if (visits == entry.end() || !visits->is_number_integer() || visits->get<int64_t>() < 0) {
+            return setError(errorOut, "profile node entry must have a non-negative 'visits': " + entry["node"].get<std::string>());
+        }
+        outWeights[entry["node"].get<std::string>()] += visits->get<uint64_t>();
+    }
+    return true;
+}
+
+} // namespace Gyeol::LayoutTools
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "gyeol_generated.h"
+#include <nlohmann/json.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Gyeol::LayoutTools {
+
+// 노드 배치 순서: SOURCE = 원래 순서, BFS/DFS = 시작 노드에서 분기 대상을 따라간 순서
+enum class NodeOrder { SOURCE, BFS, DFS };
+
+struct LayoutOptions {
+    NodeOrder order = NodeOrder::BFS;
+    // 노드 이름 → 가중치(프로파일 방문 수 등). 가중치가 0보다 큰 노드를 큰 순서로 앞에 두고
+    // 나머지는 order 순서로 잇는다.
+    std::unordered_map<std::string, uint64_t> nodeWeights;
+    bool poolByFirstUse = true; // string_pool(+line_ids)을 새 노드 순서의 첫 참조 순으로 정렬
+};
+
+// 새 노드 순서 (원래 nodes 인덱스 목록). 시작 노드에서 닿지 않는 노드는 원래 순서로 뒤에 붙는다.
+std::vector<size_t> computeNodeOrder(const ICPDev::Gyeol::Schema::StoryT& story, const LayoutOptions& options);
+
+// 노드와 String Pool 순서를 바꾼다. 실행 결과는 같고 노드 인덱스/pool id만 달라진다.
+// 이미 압축된 pool(compressed_pool)은 순서를 바꿀 수 없어 실패한다 (압축 전에 호출).
+// 노드 인덱스 링크와 이름 표도 새 순서로 다시 계산한다.
+bool layoutStory(ICPDev::Gyeol::Schema::StoryT& story,
+                 const LayoutOptions& options = {},
+                 std::string* errorOut = nullptr);
+
+// 프로파일 JSON(GyeolRuntimePerfCLI profile, format "gyeol-runtime-profile")의 nodes[].visits를
+// 노드 가중치로 읽는다.
+bool loadNodeWeights(const nlohmann::json& profile,
+                     std::unordered_map<std::string, uint64_t>& outWeights,
+                     std::string* errorOut = nullptr);
+
+} // namespace Gyeol::LayoutTools
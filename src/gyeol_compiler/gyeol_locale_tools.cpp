@@ -1,8 +1,10 @@
 #include "gyeol_parser.h"
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <unordered_set>
 #include <unordered_map>
 
@@ -643,6 +645,124 @@ bool buildLocaleCatalog(const std::vector<std::string>& localePaths,
     return true;
 }
 
+bool buildLocaleCatalogBinary(const std::vector<std::string>& localePaths,
+                              const StoryT& story,
+                              const std::string& outputPath,
+                              const std::string& defaultLocale,
+                              std::string* errorOut) {
+    if (localePaths.empty()) {
+        if (errorOut) *errorOut = "buildLocaleCatalogBinary requires at least one locale JSON path.";
+        return false;
+    }
+
+    std::unordered_map<std::string, int32_t> lineIdToPoolIndex;
+    for (size_t i = 0; i < story.line_ids.size(); ++i) {
+        if (!story.line_ids[i].empty()) {
+            lineIdToPoolIndex[story.line_ids[i]] = static_cast<int32_t>(i);
+        }
+    }
+
+    std::map<std::string, ParsedLocaleDoc> docs;
+    std::string resolvedDefault = defaultLocale;
+    for (const auto& localePath : localePaths) {
+        ParsedLocaleDoc localeDoc;
+        if (!parseLocaleFile(localePath, localeDoc, errorOut)) return false;
+        if (localeDoc.locale.empty()) {
+            if (errorOut) *errorOut = "Locale code is empty in file: " + localePath;
+            return false;
+        }
+        if (resolvedDefault.empty()) resolvedDefault = localeDoc.locale;
+        docs[localeDoc.locale] = std::move(localeDoc);
+    }
+
+    auto baseLocaleCode = [](const std::string& code) -> std::string {
+        size_t sep = code.find_first_of("-_");
+        if (sep == std::string::npos) return code;
+        if (sep == 0) return "";
+        return code.substr(0, sep);
+    };
+
+    CompiledLocaleCatalogT catalog;
+    catalog.version = 1;
+    catalog.default_locale = resolvedDefault;
+    catalog.string_pool_size = static_cast<uint32_t>(story.string_pool.size());
+
+    // 번역 문자열 중복 제거 (fallback으로 공유되는 문자열은 한 번만 저장)
+    std::unordered_map<std::string, int32_t> textIndex;
+    auto internText = [&](const std::string& text) -> int32_t {
+        auto it = textIndex.find(text);
+        if (it != textIndex.end()) return it->second;
+        const int32_t idx = static_cast<int32_t>(catalog.texts.size());
+        catalog.texts.push_back(text);
+        textIndex.emplace(text, idx);
+        return idx;
+    };
+
+    for (const auto& docEntry : docs) {
+        const std::string& code = docEntry.first;
+        auto locale = std::make_unique<CompiledLocaleT>();
+        locale->locale = code;
+
+        // 런타임 체인(requested → base → default) 중 카탈로그에 있는 것만 남긴다
+        std::vector<std::string> chain{code};
+        const std::string base = baseLocaleCode(code);
+        if (!base.empty() && docs.count(base) > 0 &&
+            std::find(chain.begin(), chain.end(), base) == chain.end()) {
+            chain.push_back(base);
+        }
+        if (docs.count(resolvedDefault) > 0 &&
+            std::find(chain.begin(), chain.end(), resolvedDefault) == chain.end()) {
+            chain.push_back(resolvedDefault);
+        }
+        locale->fallback_chain = chain;
+
+        locale->line_text_ids.assign(story.string_pool.size(), -1);
+        std::map<std::string, std::map<std::string, std::string>> characters;
+        for (const auto& chainCode : chain) {
+            const ParsedLocaleDoc& doc = docs[chainCode];
+            for (const auto& kv : doc.lineEntries) {
+                if (kv.second.empty()) continue;
+                auto it = lineIdToPoolIndex.find(kv.first);
+                if (it == lineIdToPoolIndex.end()) continue;
+                auto& slot = locale->line_text_ids[static_cast<size_t>(it->second)];
+                if (slot < 0) slot = internText(kv.second);
+            }
+            for (const auto& charEntry : doc.characterEntries) {
+                auto& dst = characters[charEntry.first];
+                for (const auto& propEntry : charEntry.second) {
+                    dst.emplace(propEntry.first, propEntry.second);
+                }
+            }
+        }
+
+        for (const auto& charEntry : characters) {
+            auto character = std::make_unique<CompiledLocaleCharacterT>();
+            character->character_id = charEntry.first;
+            for (const auto& propEntry : charEntry.second) {
+                auto prop = std::make_unique<CompiledLocalePropertyT>();
+                prop->key = propEntry.first;
+                prop->value = propEntry.second;
+                character->properties.push_back(std::move(prop));
+            }
+            locale->characters.push_back(std::move(character));
+        }
+
+        catalog.locales.push_back(std::move(locale));
+    }
+
+    flatbuffers::FlatBufferBuilder builder;
+    builder.Finish(CompiledLocaleCatalog::Pack(builder, &catalog), "GYLC");
+
+    std::ofstream ofs(outputPath, std::ios::binary);
+    if (!ofs.is_open()) {
+        if (errorOut) *errorOut = "Failed to write locale catalog: " + outputPath;
+        return false;
+    }
+    ofs.write(reinterpret_cast<const char*>(builder.GetBufferPointer()),
+              static_cast<std::streamsize>(builder.GetSize()));
+    return ofs.good();
+}
+
 } // namespace LocaleTools
 
 } // namespace Gyeol
@@ -1,7 +1,9 @@
 #include "gyeol_parser.h"
+#include "gyeol_story_emitter.h"
+#include "gyeol_expr_tools.h"
+#include "gyeol_story_linker.h"
 #include <fstream>
 #include <iostream>
-#include <sstream>
 #include <algorithm>
 #include <cstdlib>
 #include <cctype>
@@ -15,7 +17,7 @@ namespace Gyeol {
 
 namespace {
 
-bool isIdentifierToken(const std::string& token) {
+bool isIdentifierToken(std::string_view token) {
     if (token.empty()) return false;
     const unsigned char first = static_cast<unsigned char>(token[0]);
     if (!(std::isalpha(first) || token[0] == '_')) return false;
@@ -26,11 +28,65 @@ bool isIdentifierToken(const std::string& token) {
     return true;
 }
 
-bool parseStrictIntToken(const std::string& token, int32_t& outValue) {
+// 노드의 이동 대상 참조(jump/choice/condition/random/call)를 명령 순서대로 방문한다
+template <typename Fn>
+void forEachJumpTarget(const NodeT& node, Fn&& fn) {
+    for (size_t ii = 0; ii < node.lines.size(); ++ii) {
+        const auto& instr = node.lines[ii];
+        switch (instr->data.type) {
+            case OpData::Jump:
+                fn(ii, instr->data.AsJump()->target_node_name_id, "jump");
+                break;
+            case OpData::Choice:
+                fn(ii, instr->data.AsChoice()->target_node_name_id, "choice");
+                break;
+            case OpData::Condition: {
+                const auto* cond = instr->data.AsCondition();
+                if (cond->true_jump_node_id >= 0) fn(ii, cond->true_jump_node_id, "condition true");
+                if (cond->false_jump_node_id >= 0) fn(ii, cond->false_jump_node_id, "condition false");
+                break;
+            }
+            case OpData::Random:
+                for (const auto& branch : instr->data.AsRandom()->branches) {
+                    fn(ii, branch->target_node_name_id, "random");
+                }
+                break;
+            case OpData::CallWithReturn:
+                fn(ii, instr->data.AsCallWithReturn()->target_node_name_id, "call");
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+// strtol/strtof는 NUL 종료 문자열이 필요하다: 짧은 토큰은 스택 버퍼로 복사 (힙 할당 없음)
+class TokenCStr {
+public:
+    explicit TokenCStr(std::string_view token) {
+        if (token.size() < sizeof(small_)) {
+            token.copy(small_, token.size());
+            small_[token.size()] = '\0';
+            ptr_ = small_;
+        } else {
+            large_.assign(token.data(), token.size());
+            ptr_ = large_.c_str();
+        }
+    }
+    const char* c_str() const { return ptr_; }
+
+private:
+    char small_[64];
+    std::string large_;
+    const char* ptr_ = nullptr;
+};
+
+bool parseStrictIntToken(std::string_view token, int32_t& outValue) {
     if (token.empty()) return false;
+    TokenCStr cstr(token);
     char* end = nullptr;
-    long value = std::strtol(token.c_str(), &end, 10);
-    if (end == token.c_str() || *end != '\0') return false;
+    long value = std::strtol(cstr.c_str(), &end, 10);
+    if (end == cstr.c_str() || *end != '\0') return false;
     if (value < std::numeric_limits<int32_t>::min() ||
         value > std::numeric_limits<int32_t>::max()) {
         return false;
@@ -39,42 +95,70 @@ bool parseStrictIntToken(const std::string& token, int32_t& outValue) {
     return true;
 }
 
-bool parseStrictFloatToken(const std::string& token, float& outValue) {
+bool parseStrictFloatToken(std::string_view token, float& outValue) {
     if (token.empty()) return false;
-    if (token.find('.') == std::string::npos) return false;
-    if (token.find_first_of("eE") != std::string::npos) return false;
+    if (token.find('.') == std::string_view::npos) return false;
+    if (token.find_first_of("eE") != std::string_view::npos) return false;
 
+    TokenCStr cstr(token);
     char* end = nullptr;
-    float value = std::strtof(token.c_str(), &end);
-    if (end == token.c_str() || *end != '\0') return false;
+    float value = std::strtof(cstr.c_str(), &end);
+    if (end == cstr.c_str() || *end != '\0') return false;
     outValue = value;
     return true;
 }
 
+// 키워드 + 단어 경계 ("jump" / "jump x", "jumpx"는 아님)
+bool startsWithKeyword(std::string_view text, std::string_view keyword) {
+    return text.size() >= keyword.size() &&
+           text.compare(0, keyword.size(), keyword) == 0 &&
+           (text.size() == keyword.size() || text[keyword.size()] == ' ');
+}
+
 } // namespace
 
 // --- String Pool ---
-int32_t Parser::addString(const std::string& str) {
+int32_t Parser::addString(std::string_view str) {
     return addStringWithId(str, "");
 }
 
-int32_t Parser::addStringWithId(const std::string& str, const std::string& lineId) {
+int32_t Parser::addStringWithId(std::string_view str, const std::string& lineId) {
     auto it = stringMap_.find(str);
     if (it != stringMap_.end()) {
         // 기존 lineId가 비어있고 새 lineId가 있으면 업데이트
         if (!lineId.empty() && lineIds_[it->second].empty()) {
             lineIds_[it->second] = lineId;
+            if (fragmentMode_) poolEvents_.push_back({it->second, true});
         }
         return it->second;
     }
+    return appendString(std::string(str), lineId);
+}
+
+int32_t Parser::appendString(std::string&& str, std::string lineId) {
     int32_t idx = static_cast<int32_t>(story_.string_pool.size());
-    story_.string_pool.push_back(str);
-    lineIds_.push_back(lineId);
-    stringMap_[str] = idx;
+    const size_t capacity = story_.string_pool.capacity();
+    story_.string_pool.push_back(std::move(str));
+    if (fragmentMode_) poolEvents_.push_back({idx, !lineId.empty()});
+    lineIds_.push_back(std::move(lineId));
+    if (story_.string_pool.capacity() != capacity) {
+        rebuildStringMap(); // 원소가 옮겨졌으니 (SSO 포함) view 키를 다시 잡는다
+    } else {
+        stringMap_.emplace(story_.string_pool.back(), idx);
+    }
     return idx;
 }
 
-std::string Parser::hashText(const std::string& text) {
+void Parser::rebuildStringMap() {
+    stringMap_.clear();
+    stringMap_.reserve(story_.string_pool.capacity());
+    // fragment의 로컬 id 0은 자리 표시용이라 검색 대상이 아니다
+    for (size_t i = fragmentMode_ ? 1 : 0; i < story_.string_pool.size(); ++i) {
+        stringMap_.emplace(story_.string_pool[i], static_cast<int32_t>(i));
+    }
+}
+
+std::string Parser::hashText(std::string_view text) {
     uint32_t hash = 2166136261u; // FNV-1a
     for (unsigned char c : text) {
         hash ^= c;
@@ -104,12 +188,12 @@ void Parser::addWarning(int lineNum, const std::string& msg) {
 }
 
 // --- 캐릭터 정의 블록 ---
-bool Parser::parseCharacterLine(const std::string& content, int lineNum) {
+bool Parser::parseCharacterLine(std::string_view content, int lineNum) {
     // content: "character hero:"
     size_t pos = 9; // skip "character"
     skipSpaces(content, pos);
 
-    std::string charId = parseWord(content, pos);
+    std::string charId(parseWord(content, pos));
     if (charId.empty()) {
         addError(lineNum, "character requires a name");
         return false;
@@ -146,7 +230,7 @@ bool Parser::parseCharacterLine(const std::string& content, int lineNum) {
     return true;
 }
 
-bool Parser::parseCharacterProperty(const std::string& content, int lineNum) {
+bool Parser::parseCharacterProperty(std::string_view content, int lineNum) {
     if (!currentCharacter_) {
         addError(lineNum, "character property outside character block");
         return false;
@@ -154,7 +238,7 @@ bool Parser::parseCharacterProperty(const std::string& content, int lineNum) {
 
     // content: "key: \"value\"" or "key: value"
     size_t pos = 0;
-    std::string key = parseWord(content, pos);
+    std::string_view key = parseWord(content, pos);
     if (key.empty()) {
         addError(lineNum, "expected property name in character block");
         return false;
@@ -162,11 +246,11 @@ bool Parser::parseCharacterProperty(const std::string& content, int lineNum) {
 
     // key 끝의 ':' 처리
     if (!key.empty() && key.back() == ':') {
-        key.pop_back();
+        key.remove_suffix(1);
     } else {
         skipSpaces(content, pos);
         if (pos >= content.size() || content[pos] != ':') {
-            addError(lineNum, "expected ':' after property name '" + key + "'");
+            addError(lineNum, "expected ':' after property name '" + std::string(key) + "'");
             return false;
         }
         pos++; // skip ':'
@@ -204,14 +288,18 @@ void Parser::validateCharacters() {
     // 캐릭터 정의가 없으면 검증 스킵 (하위 호환)
     if (definedCharacters_.empty()) return;
 
-    for (const auto& charName : usedCharacters_) {
+    // string pool 순서(첫 사용 순)로 경고 — 병렬 import 파싱과 직렬 파싱의 출력이 같도록
+    std::vector<int32_t> used(usedCharacters_.begin(), usedCharacters_.end());
+    std::sort(used.begin(), used.end());
+    for (int32_t charId : used) {
+        const std::string& charName = story_.string_pool[charId];
         if (definedCharacters_.find(charName) == definedCharacters_.end()) {
             addWarning(0, "undefined character '" + charName + "' (not declared with 'character')");
         }
     }
 }
 
-size_t Parser::countIndent(const std::string& line) {
+size_t Parser::countIndent(std::string_view line) {
     size_t count = 0;
     for (char c : line) {
         if (c == ' ') count++;
@@ -221,23 +309,34 @@ size_t Parser::countIndent(const std::string& line) {
     return count;
 }
 
-std::string Parser::trim(const std::string& str) {
+std::string_view Parser::trim(std::string_view str) {
     size_t start = str.find_first_not_of(" \t\r\n");
-    if (start == std::string::npos) return "";
+    if (start == std::string_view::npos) return {};
     size_t end = str.find_last_not_of(" \t\r\n");
     return str.substr(start, end - start + 1);
 }
 
-void Parser::skipSpaces(const std::string& text, size_t& pos) {
+void Parser::skipSpaces(std::string_view text, size_t& pos) {
     while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t')) {
         pos++;
     }
 }
 
-std::string Parser::parseQuotedString(const std::string& text, size_t& pos) {
+std::string Parser::parseQuotedString(std::string_view text, size_t& pos) {
     if (pos >= text.size() || text[pos] != '"') return "";
     pos++; // skip opening quote
-    std::string result;
+
+    // 이스케이프가 없으면 한 번에 복사 (대부분의 대사)
+    size_t end = pos;
+    while (end < text.size() && text[end] != '"' && text[end] != '\\') end++;
+    if (end >= text.size() || text[end] == '"') {
+        std::string result(text.substr(pos, end - pos));
+        pos = end < text.size() ? end + 1 : end;
+        return result;
+    }
+
+    std::string result(text.substr(pos, end - pos));
+    pos = end;
     while (pos < text.size() && text[pos] != '"') {
         if (text[pos] == '\\' && pos + 1 < text.size()) {
             pos++;
@@ -257,19 +356,18 @@ std::string Parser::parseQuotedString(const std::string& text, size_t& pos) {
     return result;
 }
 
-std::string Parser::parseWord(const std::string& text, size_t& pos) {
+std::string_view Parser::parseWord(std::string_view text, size_t& pos) {
     skipSpaces(text, pos);
-    std::string result;
+    const size_t start = pos;
     while (pos < text.size() && text[pos] != ' ' && text[pos] != '\t'
            && text[pos] != '\r' && text[pos] != '\n') {
-        result += text[pos];
         pos++;
     }
-    return result;
+    return text.substr(start, pos - start);
 }
 
 // --- 값(Value) 파싱 ---
-bool Parser::parseValue(const std::string& text, size_t& pos,
+bool Parser::parseValue(std::string_view text, size_t& pos,
                          ValueDataUnion& outValue) {
     skipSpaces(text, pos);
     if (pos >= text.size()) return false;
@@ -285,7 +383,7 @@ bool Parser::parseValue(const std::string& text, size_t& pos,
                 std::string item = parseQuotedString(text, pos);
                 lv->items.push_back(addString(item));
             } else {
-                std::string item = parseWord(text, pos);
+                std::string_view item = parseWord(text, pos);
                 if (!item.empty()) lv->items.push_back(addString(item));
             }
             skipSpaces(text, pos);
@@ -306,7 +404,8 @@ bool Parser::parseValue(const std::string& text, size_t& pos,
         return true;
     }
 
-    std::string word = parseWord(text, pos);
+    std::string_view word = parseWord(text, pos);
+    TokenCStr wordCStr(word);
     if (word.empty()) return false;
 
     // bool
@@ -326,8 +425,8 @@ bool Parser::parseValue(const std::string& text, size_t& pos,
     // float (소수점 포함)
     if (word.find('.') != std::string::npos) {
         char* end = nullptr;
-        float f = std::strtof(word.c_str(), &end);
-        if (end != word.c_str()) {
+        float f = std::strtof(wordCStr.c_str(), &end);
+        if (end != wordCStr.c_str()) {
             auto val = std::make_unique<FloatValueT>();
             val->val = f;
             outValue.Set(*val);
@@ -337,8 +436,8 @@ bool Parser::parseValue(const std::string& text, size_t& pos,
 
     // int
     char* end = nullptr;
-    long i = std::strtol(word.c_str(), &end, 10);
-    if (end != word.c_str() && *end == '\0') {
+    long i = std::strtol(wordCStr.c_str(), &end, 10);
+    if (end != wordCStr.c_str() && *end == '\0') {
         auto val = std::make_unique<IntValueT>();
         val->val = static_cast<int32_t>(i);
         outValue.Set(*val);
@@ -349,7 +448,7 @@ bool Parser::parseValue(const std::string& text, size_t& pos,
 }
 
 // --- 표현식 파싱 (Shunting-yard → RPN) ---
-bool Parser::parseExpression(const std::string& text, size_t& pos,
+bool Parser::parseExpression(std::string_view text, size_t& pos,
                               std::unique_ptr<ExpressionT>& outExpr,
                               ValueDataUnion& outSimpleValue,
                               bool& isSimpleLiteral) {
@@ -385,7 +484,7 @@ bool Parser::parseExpression(const std::string& text, size_t& pos,
                     std::string item = parseQuotedString(text, pos);
                     lv->items.push_back(addString(item));
                 } else {
-                    std::string item = parseWord(text, pos);
+                    std::string_view item = parseWord(text, pos);
                     if (!item.empty()) lv->items.push_back(addString(item));
                 }
                 skipSpaces(text, pos);
@@ -476,15 +575,15 @@ bool Parser::parseExpression(const std::string& text, size_t& pos,
                     break;
                 }
             }
-            std::string numStr = text.substr(start, pos - start);
+            std::string_view numStr = text.substr(start, pos - start);
             Token t; t.type = TokType::LITERAL;
             if (hasDot) {
                 auto val = std::make_unique<FloatValueT>();
-                val->val = std::strtof(numStr.c_str(), nullptr);
+                val->val = std::strtof(TokenCStr(numStr).c_str(), nullptr);
                 t.literal.Set(*val);
             } else {
                 auto val = std::make_unique<IntValueT>();
-                val->val = static_cast<int32_t>(std::strtol(numStr.c_str(), nullptr, 10));
+                val->val = static_cast<int32_t>(std::strtol(TokenCStr(numStr).c_str(), nullptr, 10));
                 t.literal.Set(*val);
             }
             tokens.push_back(std::move(t));
@@ -499,7 +598,7 @@ bool Parser::parseExpression(const std::string& text, size_t& pos,
                    (std::isalnum(static_cast<unsigned char>(text[pos])) || text[pos] == '_')) {
                 pos++;
             }
-            std::string word = text.substr(start, pos - start);
+            std::string_view word = text.substr(start, pos - start);
 
             // visit_count()/visited()/len() 함수 호출 감지
             if ((word == "visit_count" || word == "visited" || word == "len") &&
@@ -654,7 +753,7 @@ bool Parser::parseExpression(const std::string& text, size_t& pos,
 }
 
 // --- label ---
-bool Parser::parseLabelLine(const std::string& content, int lineNum) {
+bool Parser::parseLabelLine(std::string_view content, int lineNum) {
     // "label name:" 또는 "label name(params):"
     size_t pos = 5; // skip "label"
     skipSpaces(content, pos);
@@ -665,11 +764,11 @@ bool Parser::parseLabelLine(const std::string& content, int lineNum) {
            && content[pos] != '(' && content[pos] != ':' && content[pos] != '#') {
         pos++;
     }
-    std::string name = content.substr(nameStart, pos - nameStart);
+    std::string_view name = content.substr(nameStart, pos - nameStart);
 
     // 콜론 제거 (name 끝에 붙은 경우)
     if (!name.empty() && name.back() == ':') {
-        name.pop_back();
+        name.remove_suffix(1);
     }
 
     if (name.empty()) {
@@ -697,7 +796,7 @@ bool Parser::parseLabelLine(const std::string& content, int lineNum) {
                && content[pos] != '#' && content[pos] != ':' && content[pos] != '=') {
             pos++;
         }
-        std::string key = content.substr(keyStart, pos - keyStart);
+        std::string_view key = content.substr(keyStart, pos - keyStart);
         std::string value;
         if (key.empty()) {
             addError(lineNum, "node tag key is empty");
@@ -737,11 +836,9 @@ bool Parser::parseLabelLine(const std::string& content, int lineNum) {
     seenFirstLabel_ = true;
 
     // 중복 label 이름 검사
-    for (const auto& existingNode : story_.nodes) {
-        if (existingNode->name == name) {
-            addError(lineNum, "duplicate label name: " + name);
-            return false;
-        }
+    if (nodeNames_.count(name)) {
+        addError(lineNum, "duplicate label name: " + std::string(name));
+        return false;
     }
 
     auto node = std::make_unique<NodeT>();
@@ -760,8 +857,13 @@ bool Parser::parseLabelLine(const std::string& content, int lineNum) {
         node->tags.push_back(std::move(t));
     }
 
+    // 스트리밍 출력: 새 label이 시작되면 앞 노드는 더 바뀌지 않는다
+    if (emitter_) emitFinishedNodes();
+
     story_.nodes.push_back(std::move(node));
+    nodeSourceFiles_.push_back(filename_);
     currentNode_ = story_.nodes.back().get();
+    nodeNames_.insert(currentNode_->name);
     currentNodeName_ = name;
     inMenu_ = false;
 
@@ -775,7 +877,7 @@ bool Parser::parseLabelLine(const std::string& content, int lineNum) {
 }
 
 // --- 대사 ---
-bool Parser::parseDialogueLine(const std::string& content, int lineNum) {
+bool Parser::parseDialogueLine(std::string_view content, int lineNum) {
     if (!currentNode_) {
         addError(lineNum, "dialogue outside of label");
         return false;
@@ -795,9 +897,9 @@ bool Parser::parseDialogueLine(const std::string& content, int lineNum) {
         line->text_id = addStringWithId(text, lid);
     } else {
         // 캐릭터 대사: character "대사"
-        std::string character = parseWord(content, pos);
+        std::string_view character = parseWord(content, pos);
         line->character_id = addString(character);
-        usedCharacters_.insert(character);
+        usedCharacters_.insert(line->character_id);
 
         skipSpaces(content, pos);
         if (pos >= content.size() || content[pos] != '"') {
@@ -821,7 +923,7 @@ bool Parser::parseDialogueLine(const std::string& content, int lineNum) {
                content[pos] != '#' && content[pos] != '=' && content[pos] != ':') {
             pos++;
         }
-        std::string key = content.substr(keyStart, pos - keyStart);
+        std::string_view key = content.substr(keyStart, pos - keyStart);
         if (key.empty()) {
             addError(lineNum, "dialogue tag key is empty");
             return false;
@@ -862,7 +964,7 @@ bool Parser::parseDialogueLine(const std::string& content, int lineNum) {
 }
 
 // --- menu 선택지 ---
-bool Parser::parseMenuChoiceLine(const std::string& content, int lineNum) {
+bool Parser::parseMenuChoiceLine(std::string_view content, int lineNum) {
     if (!currentNode_) {
         addError(lineNum, "choice outside of label");
         return false;
@@ -886,7 +988,7 @@ bool Parser::parseMenuChoiceLine(const std::string& content, int lineNum) {
     }
     pos += 2; // skip ->
 
-    std::string target = parseWord(content, pos);
+    std::string_view target = parseWord(content, pos);
     if (target.empty()) {
         addError(lineNum, "expected target node name after '->'");
         return false;
@@ -906,7 +1008,7 @@ bool Parser::parseMenuChoiceLine(const std::string& content, int lineNum) {
     if (pos < content.size()) {
         if (content[pos] == '#') {
             pos++; // skip '#'
-            std::string modifier = parseWord(content, pos);
+            std::string_view modifier = parseWord(content, pos);
             if (modifier == "once") {
                 choice->choice_modifier = ICPDev::Gyeol::Schema::ChoiceModifier::Once;
             } else if (modifier == "sticky") {
@@ -914,14 +1016,14 @@ bool Parser::parseMenuChoiceLine(const std::string& content, int lineNum) {
             } else if (modifier == "fallback") {
                 choice->choice_modifier = ICPDev::Gyeol::Schema::ChoiceModifier::Fallback;
             } else {
-                addError(lineNum, "unknown choice modifier: #" + modifier);
+                addError(lineNum, "unknown choice modifier: #" + std::string(modifier));
                 return false;
             }
             skipSpaces(content, pos);
         } else {
-            std::string keyword = parseWord(content, pos);
+            std::string_view keyword = parseWord(content, pos);
             if (keyword == "if") {
-                std::string varName = parseWord(content, pos);
+                std::string_view varName = parseWord(content, pos);
                 if (varName.empty()) {
                     addError(lineNum, "expected condition variable after 'if'");
                     return false;
@@ -929,7 +1031,7 @@ bool Parser::parseMenuChoiceLine(const std::string& content, int lineNum) {
                 choice->condition_var_id = addString(varName);
                 skipSpaces(content, pos);
             } else {
-                addError(lineNum, "unexpected token after choice target: " + keyword);
+                addError(lineNum, "unexpected token after choice target: " + std::string(keyword));
                 return false;
             }
         }
@@ -937,7 +1039,7 @@ bool Parser::parseMenuChoiceLine(const std::string& content, int lineNum) {
 
     if (pos < content.size() && content[pos] == '#') {
         pos++; // skip '#'
-        std::string modifier = parseWord(content, pos);
+        std::string_view modifier = parseWord(content, pos);
         if (modifier == "once") {
             choice->choice_modifier = ICPDev::Gyeol::Schema::ChoiceModifier::Once;
         } else if (modifier == "sticky") {
@@ -945,14 +1047,14 @@ bool Parser::parseMenuChoiceLine(const std::string& content, int lineNum) {
         } else if (modifier == "fallback") {
             choice->choice_modifier = ICPDev::Gyeol::Schema::ChoiceModifier::Fallback;
         } else {
-            addError(lineNum, "unknown choice modifier: #" + modifier);
+            addError(lineNum, "unknown choice modifier: #" + std::string(modifier));
             return false;
         }
         skipSpaces(content, pos);
     }
 
     if (pos < content.size()) {
-        addError(lineNum, "unexpected token after choice modifier/condition: " + trim(content.substr(pos)));
+        addError(lineNum, "unexpected token after choice modifier/condition: " + std::string(trim(content.substr(pos))));
         return false;
     }
 
@@ -969,7 +1071,7 @@ bool Parser::parseMenuChoiceLine(const std::string& content, int lineNum) {
 }
 
 // --- jump / call ---
-bool Parser::parseJumpLine(const std::string& content, int lineNum, bool isCall) {
+bool Parser::parseJumpLine(std::string_view content, int lineNum, bool isCall) {
     if (!currentNode_) {
         addError(lineNum, "jump/call outside of label");
         return false;
@@ -984,7 +1086,7 @@ bool Parser::parseJumpLine(const std::string& content, int lineNum, bool isCall)
            && content[pos] != '(') {
         pos++;
     }
-    std::string target = content.substr(nameStart, pos - nameStart);
+    std::string_view target = content.substr(nameStart, pos - nameStart);
 
     if (target.empty()) {
         addError(lineNum, "expected target node name");
@@ -1024,14 +1126,14 @@ bool Parser::parseJumpLine(const std::string& content, int lineNum, bool isCall)
 }
 
 // --- $ 변수 = 값 (label 내부) ---
-bool Parser::parseSetVarLine(const std::string& content, int lineNum) {
+bool Parser::parseSetVarLine(std::string_view content, int lineNum) {
     if (!currentNode_) {
         addError(lineNum, "variable set outside of label");
         return false;
     }
 
     size_t pos = 1; // skip "$"
-    std::string varName = parseWord(content, pos);
+    std::string_view varName = parseWord(content, pos);
     if (varName.empty()) {
         addError(lineNum, "expected variable name after '$'");
         return false;
@@ -1067,7 +1169,7 @@ bool Parser::parseSetVarLine(const std::string& content, int lineNum) {
                && content[pos] != '(') {
             pos++;
         }
-        std::string target = content.substr(nameStart, pos - nameStart);
+        std::string_view target = content.substr(nameStart, pos - nameStart);
 
         if (target.empty()) {
             addError(lineNum, "expected target node name after 'call'");
@@ -1119,9 +1221,9 @@ bool Parser::parseSetVarLine(const std::string& content, int lineNum) {
 }
 
 // --- $ 변수 = 값 (global, label 앞) ---
-bool Parser::parseGlobalVarLine(const std::string& content, int lineNum) {
+bool Parser::parseGlobalVarLine(std::string_view content, int lineNum) {
     size_t pos = 1; // skip "$"
-    std::string varName = parseWord(content, pos);
+    std::string_view varName = parseWord(content, pos);
     if (varName.empty()) {
         addError(lineNum, "expected variable name after '$'");
         return false;
@@ -1147,7 +1249,7 @@ bool Parser::parseGlobalVarLine(const std::string& content, int lineNum) {
 }
 
 // --- 비교 연산자 파싱 헬퍼 ---
-static bool parseComparisonOp(const std::string& text, size_t& pos, Operator& op) {
+static bool parseComparisonOp(std::string_view text, size_t& pos, Operator& op) {
     while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t')) pos++;
     if (pos >= text.size()) return false;
 
@@ -1174,7 +1276,7 @@ static bool parseComparisonOp(const std::string& text, size_t& pos, Operator& op
 }
 
 // --- 조건 표현식 파서 (산술 + 비교 + 논리 → 단일 RPN) ---
-bool Parser::parseFullConditionExpr(const std::string& text, size_t& pos,
+bool Parser::parseFullConditionExpr(std::string_view text, size_t& pos,
                                      std::unique_ptr<ExpressionT>& outExpr,
                                      bool& hasLogicalOps) {
     hasLogicalOps = false;
@@ -1210,7 +1312,7 @@ bool Parser::parseFullConditionExpr(const std::string& text, size_t& pos,
                     std::string item = parseQuotedString(text, pos);
                     lv->items.push_back(addString(item));
                 } else {
-                    std::string item = parseWord(text, pos);
+                    std::string_view item = parseWord(text, pos);
                     if (!item.empty()) lv->items.push_back(addString(item));
                 }
                 skipSpaces(text, pos);
@@ -1328,15 +1430,15 @@ bool Parser::parseFullConditionExpr(const std::string& text, size_t& pos,
                     break;
                 }
             }
-            std::string numStr = text.substr(start, pos - start);
+            std::string_view numStr = text.substr(start, pos - start);
             Token t; t.type = TokType::LITERAL;
             if (hasDot) {
                 auto val = std::make_unique<FloatValueT>();
-                val->val = std::strtof(numStr.c_str(), nullptr);
+                val->val = std::strtof(TokenCStr(numStr).c_str(), nullptr);
                 t.literal.Set(*val);
             } else {
                 auto val = std::make_unique<IntValueT>();
-                val->val = static_cast<int32_t>(std::strtol(numStr.c_str(), nullptr, 10));
+                val->val = static_cast<int32_t>(std::strtol(TokenCStr(numStr).c_str(), nullptr, 10));
                 t.literal.Set(*val);
             }
             tokens.push_back(std::move(t));
@@ -1351,7 +1453,7 @@ bool Parser::parseFullConditionExpr(const std::string& text, size_t& pos,
                    (std::isalnum(static_cast<unsigned char>(text[pos])) || text[pos] == '_')) {
                 pos++;
             }
-            std::string word = text.substr(start, pos - start);
+            std::string_view word = text.substr(start, pos - start);
 
             // 논리 연산자 키워드
             if (word == "and" && !expectOperand) {
@@ -1539,12 +1641,16 @@ bool Parser::parseFullConditionExpr(const std::string& text, size_t& pos,
         expr->tokens.push_back(std::move(et));
     }
 
+    // and/or는 왼쪽 값만으로 결과가 정해지면 오른쪽을 건너뛴다
+    // (lhs/op/rhs 분해는 논리 연산이 없는 식만 하므로 skip 토큰과 만나지 않는다)
+    ExprTools::addShortCircuitSkips(*expr);
+
     outExpr = std::move(expr);
     return true;
 }
 
 // --- if 표현식 op 표현식 -> 참 else 거짓 ---
-bool Parser::parseConditionLine(const std::string& content, int lineNum) {
+bool Parser::parseConditionLine(std::string_view content, int lineNum) {
     if (!currentNode_) {
         addError(lineNum, "condition outside of label");
         return false;
@@ -1658,16 +1764,16 @@ bool Parser::parseConditionLine(const std::string& content, int lineNum) {
     }
     pos += 2;
 
-    std::string trueTarget = parseWord(content, pos);
+    std::string_view trueTarget = parseWord(content, pos);
     cond->true_jump_node_id = addString(trueTarget);
 
     // else false_node (선택적)
     cond->false_jump_node_id = -1;
     skipSpaces(content, pos);
     if (pos < content.size()) {
-        std::string elseKw = parseWord(content, pos);
+        std::string_view elseKw = parseWord(content, pos);
         if (elseKw == "else") {
-            std::string falseTarget = parseWord(content, pos);
+            std::string_view falseTarget = parseWord(content, pos);
             if (!falseTarget.empty()) {
                 cond->false_jump_node_id = addString(falseTarget);
             }
@@ -1687,7 +1793,7 @@ bool Parser::parseConditionLine(const std::string& content, int lineNum) {
 }
 
 // --- elif 조건식 -> 참 ---
-bool Parser::parseElifLine(const std::string& content, int lineNum) {
+bool Parser::parseElifLine(std::string_view content, int lineNum) {
     if (!currentNode_) {
         addError(lineNum, "elif outside of label");
         return false;
@@ -1798,7 +1904,7 @@ bool Parser::parseElifLine(const std::string& content, int lineNum) {
     }
     pos += 2;
 
-    std::string trueTarget = parseWord(content, pos);
+    std::string_view trueTarget = parseWord(content, pos);
     if (trueTarget.empty()) {
         addError(lineNum, "expected target node name after '->'");
         return false;
@@ -1818,7 +1924,7 @@ bool Parser::parseElifLine(const std::string& content, int lineNum) {
 }
 
 // --- else -> 타겟 ---
-bool Parser::parseElseLine(const std::string& content, int lineNum) {
+bool Parser::parseElseLine(std::string_view content, int lineNum) {
     if (!currentNode_) {
         addError(lineNum, "else outside of label");
         return false;
@@ -1846,7 +1952,7 @@ bool Parser::parseElseLine(const std::string& content, int lineNum) {
     }
     pos += 2;
 
-    std::string target = parseWord(content, pos);
+    std::string_view target = parseWord(content, pos);
     if (target.empty()) {
         addError(lineNum, "expected target node name after 'else ->'");
         return false;
@@ -1869,7 +1975,7 @@ bool Parser::parseElseLine(const std::string& content, int lineNum) {
 }
 
 // --- random: 블록 내 분기 라인 ---
-bool Parser::parseRandomBranchLine(const std::string& content, int lineNum) {
+bool Parser::parseRandomBranchLine(std::string_view content, int lineNum) {
     if (!currentNode_) {
         addError(lineNum, "random branch outside of label");
         return false;
@@ -1884,10 +1990,11 @@ bool Parser::parseRandomBranchLine(const std::string& content, int lineNum) {
     if (pos < content.size() && content[pos] != '-') {
         // 가중치 숫자 파싱
         size_t start = pos;
-        std::string weightStr = parseWord(content, pos);
+        std::string_view weightStr = parseWord(content, pos);
+        TokenCStr weightCStr(weightStr);
         char* end = nullptr;
-        long w = std::strtol(weightStr.c_str(), &end, 10);
-        if (end == weightStr.c_str() || *end != '\0' || w < 0) {
+        long w = std::strtol(weightCStr.c_str(), &end, 10);
+        if (end == weightCStr.c_str() || *end != '\0' || w < 0) {
             addError(lineNum, "expected weight (non-negative integer) or '->' in random branch");
             return false;
         }
@@ -1902,7 +2009,7 @@ bool Parser::parseRandomBranchLine(const std::string& content, int lineNum) {
     }
     pos += 2;
 
-    std::string target = parseWord(content, pos);
+    std::string_view target = parseWord(content, pos);
     if (target.empty()) {
         addError(lineNum, "expected target node name after '->'");
         return false;
@@ -1938,14 +2045,14 @@ void Parser::flushRandomBlock(int lineNum) {
 }
 
 // --- @ 명령 파라미터... ---
-bool Parser::parseCommandLine(const std::string& content, int lineNum) {
+bool Parser::parseCommandLine(std::string_view content, int lineNum) {
     if (!currentNode_) {
         addError(lineNum, "command outside of label");
         return false;
     }
 
     size_t pos = 1; // skip "@"
-    std::string cmdType = parseWord(content, pos);
+    std::string_view cmdType = parseWord(content, pos);
     if (cmdType.empty()) {
         addError(lineNum, "expected command type after '@'");
         return false;
@@ -1965,7 +2072,7 @@ bool Parser::parseCommandLine(const std::string& content, int lineNum) {
             arg->kind = CommandArgKind::String;
             arg->string_id = addString(param);
         } else {
-            std::string token = parseWord(content, pos);
+            std::string_view token = parseWord(content, pos);
             if (token.empty()) break;
             if (token.find('=') != std::string::npos) {
                 addError(lineNum, "command argument must not use key=value syntax");
@@ -1988,7 +2095,7 @@ bool Parser::parseCommandLine(const std::string& content, int lineNum) {
                 arg->string_id = addString(token);
             } else {
                 addError(lineNum,
-                    "invalid command argument '" + token +
+                    "invalid command argument '" + std::string(token) +
                     "' (allowed: quoted string, int, float, bool, identifier)");
                 return false;
             }
@@ -2003,7 +2110,7 @@ bool Parser::parseCommandLine(const std::string& content, int lineNum) {
 }
 
 // --- wait / wait "tag" ---
-bool Parser::parseWaitLine(const std::string& content, int lineNum) {
+bool Parser::parseWaitLine(std::string_view content, int lineNum) {
     if (!currentNode_) {
         addError(lineNum, "wait outside of label");
         return false;
@@ -2036,7 +2143,7 @@ bool Parser::parseWaitLine(const std::string& content, int lineNum) {
 }
 
 // --- yield ---
-bool Parser::parseYieldLine(const std::string& content, int lineNum) {
+bool Parser::parseYieldLine(std::string_view content, int lineNum) {
     if (!currentNode_) {
         addError(lineNum, "yield outside of label");
         return false;
@@ -2057,7 +2164,7 @@ bool Parser::parseYieldLine(const std::string& content, int lineNum) {
 }
 
 // --- return [expr] ---
-bool Parser::parseReturnLine(const std::string& content, int lineNum) {
+bool Parser::parseReturnLine(std::string_view content, int lineNum) {
     if (!currentNode_) {
         addError(lineNum, "return outside of label");
         return false;
@@ -2089,7 +2196,7 @@ bool Parser::parseReturnLine(const std::string& content, int lineNum) {
 }
 
 // --- 매개변수 리스트 파싱 (label 선언용) ---
-bool Parser::parseParamList(const std::string& content, size_t& pos,
+bool Parser::parseParamList(std::string_view content, size_t& pos,
                             std::vector<std::string>& outParamNames, int lineNum) {
     skipSpaces(content, pos);
     if (pos >= content.size() || content[pos] != '(') return true; // 괄호 없음 = 매개변수 없음
@@ -2121,7 +2228,7 @@ bool Parser::parseParamList(const std::string& content, size_t& pos,
                (std::isalnum(static_cast<unsigned char>(content[pos])) || content[pos] == '_')) {
             pos++;
         }
-        std::string paramName = content.substr(nameStart, pos - nameStart);
+        std::string paramName(content.substr(nameStart, pos - nameStart));
         if (paramName.empty()) {
             addError(lineNum, "expected parameter name");
             return false;
@@ -2148,7 +2255,7 @@ bool Parser::parseParamList(const std::string& content, size_t& pos,
 }
 
 // --- 인자 리스트 파싱 (call 호출용) ---
-bool Parser::parseArgList(const std::string& content, size_t& pos,
+bool Parser::parseArgList(std::string_view content, size_t& pos,
                           std::vector<std::unique_ptr<ExpressionT>>& outArgExprs,
                           int lineNum) {
     skipSpaces(content, pos);
@@ -2199,10 +2306,10 @@ bool Parser::parseArgList(const std::string& content, size_t& pos,
         }
 
         // 인자 문자열 추출
-        std::string argStr = content.substr(argStart, argEnd - argStart);
+        std::string_view argStr = content.substr(argStart, argEnd - argStart);
         // 뒤 공백 제거
         while (!argStr.empty() && (argStr.back() == ' ' || argStr.back() == '\t'))
-            argStr.pop_back();
+            argStr.remove_suffix(1);
 
         if (argStr.empty()) {
             addError(lineNum, "empty argument in argument list");
@@ -2216,7 +2323,7 @@ bool Parser::parseArgList(const std::string& content, size_t& pos,
         bool isSimple = false;
 
         if (!parseExpression(argStr, exprPos, expr, simpleValue, isSimple)) {
-            addError(lineNum, "invalid expression in argument: " + argStr);
+            addError(lineNum, "invalid expression in argument: " + std::string(argStr));
             return false;
         }
 
@@ -2244,13 +2351,14 @@ bool Parser::parseArgList(const std::string& content, size_t& pos,
 }
 
 // =================================================================
-// 메인 파서
+// 파싱 상태 초기화 (parse/parseString/fragment 공용)
 // =================================================================
-bool Parser::parse(const std::string& filepath) {
-    filename_ = filepath;
+void Parser::resetState(const std::string& filename) {
+    filename_ = filename;
     story_ = StoryT();
     story_.version = "0.1.0";
     stringMap_.clear();
+    nodeNames_.clear();
     lineIds_.clear();
     currentNodeName_.clear();
     currentNode_ = nullptr;
@@ -2265,277 +2373,97 @@ bool Parser::parse(const std::string& filepath) {
     instrLineMap_.clear();
     pendingRandomBranches_.clear();
     importedFiles_.clear();
+    nodeSourceFiles_.clear();
     isMainFile_ = true;
     startNodeSet_ = false;
     currentCharacterId_.clear();
     currentCharacter_.reset();
     definedCharacters_.clear();
     usedCharacters_.clear();
+    importStats_ = ImportParseStats();
+    importMarkers_.clear();
+    poolEvents_.clear();
+    fragmentIssue_.clear();
+    pendingImportBoundary_ = false;
+    pendingJumpTargets_.clear();
+    emittedNodes_ = 0;
+}
+
+// =================================================================
+// 메인 파서
+// =================================================================
+bool Parser::parse(const std::string& filepath) {
+    resetState(filepath);
 
     // 절대 경로 등록 (순환 import 감지용)
     auto absPath = std::filesystem::absolute(filepath);
     importedFiles_.insert(absPath.string());
 
-    // 메인 파일 파싱
-    parseFile(filepath);
-
-    // 마지막 캐릭터 블록 완성
-    flushCharacterBlock();
-
-    // "No labels found" 체크 (전체 병합 결과)
-    if (!hasErrors() && story_.nodes.empty()) {
-        std::string msg = "No labels found in " + filepath;
-        if (error_.empty()) error_ = msg;
-        errors_.push_back(msg);
-    }
-
-    // Jump target 검증 패스 (모든 파일의 노드 대상)
-    if (!hasErrors()) {
-        validateJumpTargets();
-    }
-
-    // 캐릭터 참조 검증 (경고)
-    if (!hasErrors()) {
-        validateCharacters();
+    // 메인 파일 파싱 (fragment 병합(병렬/캐시)이 결과를 보장하지 못하면 직렬로 다시 파싱)
+    if (!parseByFragments(filepath)) {
+        parseFile(filepath);
     }
 
-    story_.line_ids = lineIds_;
-    return !hasErrors();
+    return finishParse(filepath);
 }
 
 // =================================================================
-// 문자열에서 직접 파싱 (WASM 등 파일 시스템 없는 환경용)
+// 스트리밍 파싱: 노드를 완성되는 대로 .gyb 버퍼에 쓰고 해제
 // =================================================================
-bool Parser::parseString(const std::string& source, const std::string& filename) {
-    filename_ = filename;
-    story_ = StoryT();
-    story_.version = "0.1.0";
-    stringMap_.clear();
-    lineIds_.clear();
-    currentNodeName_.clear();
-    currentNode_ = nullptr;
-    inMenu_ = false;
-    inRandom_ = false;
-    inCharacterBlock_ = false;
-    seenFirstLabel_ = false;
-    prevLineType_ = PrevLineType::NONE;
-    error_.clear();
-    errors_.clear();
-    warnings_.clear();
-    instrLineMap_.clear();
-    pendingRandomBranches_.clear();
-    importedFiles_.clear();
-    isMainFile_ = true;
-    startNodeSet_ = false;
-    currentCharacterId_.clear();
-    currentCharacter_.reset();
-    definedCharacters_.clear();
-    usedCharacters_.clear();
-
-    // 문자열 스트림으로 파싱
-    std::istringstream iss(source);
-    std::string rawLine;
-    int lineNum = 0;
-
-    while (std::getline(iss, rawLine)) {
-        lineNum++;
-
-        // BOM 제거 (UTF-8 BOM)
-        if (lineNum == 1 && rawLine.size() >= 3 &&
-            rawLine[0] == '\xEF' && rawLine[1] == '\xBB' && rawLine[2] == '\xBF') {
-            rawLine = rawLine.substr(3);
-        }
-
-        // CR 제거
-        if (!rawLine.empty() && rawLine.back() == '\r') {
-            rawLine.pop_back();
-        }
-
-        // 빈 줄
-        std::string trimmed = trim(rawLine);
-        if (trimmed.empty()) continue;
-
-        // 주석
-        if (trimmed[0] == '#') continue;
-
-        size_t indent = countIndent(rawLine);
-
-        // --- 들여쓰기 레벨 0: label 또는 global var ---
-        if (indent == 0) {
-            // import는 문자열 파싱에서 지원하지 않음
-            if (trimmed.size() >= 6 && trimmed.substr(0, 6) == "import" &&
-                (trimmed.size() == 6 || trimmed[6] == ' ')) {
-                addError(lineNum, "import is not supported in parseString mode");
-                continue;
-            }
+bool Parser::parseToBuffer(const std::string& filepath, std::vector<uint8_t>& outBuffer) {
+    outBuffer.clear();
+    resetState(filepath);
 
-            // character definition
-            if (!seenFirstLabel_ && trimmed.size() >= 9 &&
-                trimmed.substr(0, 9) == "character" &&
-                (trimmed.size() == 9 || trimmed[9] == ' ')) {
-                parseCharacterLine(trimmed, lineNum);
-                continue;
-            }
-
-            if (trimmed.substr(0, 5) == "label") {
-                flushCharacterBlock();
-                if (inRandom_) { flushRandomBlock(lineNum); inRandom_ = false; }
-                inMenu_ = false;
-                prevLineType_ = PrevLineType::NONE;
-                if (!parseLabelLine(trimmed, lineNum)) continue;
-                continue;
-            }
-
-            // global variable
-            if (!seenFirstLabel_ && trimmed[0] == '$') {
-                flushCharacterBlock();
-                parseGlobalVarLine(trimmed, lineNum);
-                continue;
-            }
-
-            addError(lineNum, "unexpected content at column 0 (expected 'label', 'character', or global '$')");
-            continue;
-        }
-
-        // --- 들여쓰기 레벨 4+: label 내부 또는 character 속성 ---
-        if (indent >= 4 && indent < 8) {
-            if (inCharacterBlock_) {
-                parseCharacterProperty(trimmed, lineNum);
-                continue;
-            }
-
-            if (inRandom_) { flushRandomBlock(lineNum); }
-            inRandom_ = false;
-            inMenu_ = false;
-
-            if (trimmed == "menu:") {
-                inMenu_ = true;
-                prevLineType_ = PrevLineType::NONE;
-                continue;
-            }
-
-            if (trimmed == "random:") {
-                inRandom_ = true;
-                prevLineType_ = PrevLineType::NONE;
-                continue;
-            }
-
-            // jump
-            if (trimmed.substr(0, 4) == "jump" && (trimmed.size() == 4 || trimmed[4] == ' ')) {
-                parseJumpLine(trimmed, lineNum, false);
-                prevLineType_ = PrevLineType::NONE;
-                continue;
-            }
-
-            // call
-            if (trimmed.substr(0, 4) == "call" && (trimmed.size() == 4 || trimmed[4] == ' ')) {
-                parseJumpLine(trimmed, lineNum, true);
-                prevLineType_ = PrevLineType::NONE;
-                continue;
-            }
-
-            // return
-            if (trimmed.size() >= 6 && trimmed.substr(0, 6) == "return" &&
-                (trimmed.size() == 6 || trimmed[6] == ' ')) {
-                parseReturnLine(trimmed, lineNum);
-                prevLineType_ = PrevLineType::NONE;
-                continue;
-            }
-
-            // wait / wait "tag"
-            if (trimmed.size() >= 4 && trimmed.substr(0, 4) == "wait" &&
-                (trimmed.size() == 4 || trimmed[4] == ' ')) {
-                parseWaitLine(trimmed, lineNum);
-                prevLineType_ = PrevLineType::NONE;
-                continue;
-            }
-
-            // yield
-            if (trimmed.size() >= 5 && trimmed.substr(0, 5) == "yield" &&
-                (trimmed.size() == 5 || trimmed[5] == ' ')) {
-                parseYieldLine(trimmed, lineNum);
-                prevLineType_ = PrevLineType::NONE;
-                continue;
-            }
-
-            // $ 변수
-            if (trimmed[0] == '$') {
-                parseSetVarLine(trimmed, lineNum);
-                prevLineType_ = PrevLineType::NONE;
-                continue;
-            }
-
-            // if
-            if (trimmed.substr(0, 2) == "if" && (trimmed.size() == 2 || trimmed[2] == ' ')) {
-                parseConditionLine(trimmed, lineNum);
-                prevLineType_ = PrevLineType::IF;
-                continue;
-            }
-
-            // elif
-            if (trimmed.size() >= 4 && trimmed.substr(0, 4) == "elif" && (trimmed.size() == 4 || trimmed[4] == ' ')) {
-                if (prevLineType_ == PrevLineType::IF || prevLineType_ == PrevLineType::ELIF) {
-                    parseElifLine(trimmed, lineNum);
-                    prevLineType_ = PrevLineType::ELIF;
-                } else {
-                    addError(lineNum, "'elif' must follow 'if' or 'elif'");
-                }
-                continue;
-            }
-
-            // else
-            if (trimmed.size() >= 4 && trimmed.substr(0, 4) == "else" && (trimmed.size() == 4 || trimmed[4] == ' ')) {
-                if (prevLineType_ == PrevLineType::IF || prevLineType_ == PrevLineType::ELIF) {
-                    parseElseLine(trimmed, lineNum);
-                } else {
-                    parseDialogueLine(trimmed, lineNum);
-                }
-                prevLineType_ = PrevLineType::NONE;
-                continue;
-            }
+    auto absPath = std::filesystem::absolute(filepath);
+    importedFiles_.insert(absPath.string());
 
-            // @ 엔진 명령
-            if (trimmed[0] == '@') {
-                parseCommandLine(trimmed, lineNum);
-                prevLineType_ = PrevLineType::NONE;
-                continue;
-            }
+    StoryEmitter emitter;
+    emitter_ = &emitter;
+    parseFile(filepath);
+    emitFinishedNodes(); // 마지막 노드
+    emitter_ = nullptr;
 
-            // 대사
-            parseDialogueLine(trimmed, lineNum);
-            prevLineType_ = PrevLineType::NONE;
-            continue;
-        }
+    if (!finishParse(filepath)) return false;
+    outBuffer = emitter.finish(story_);
+    return true;
+}
 
-        // --- 들여쓰기 레벨 8+: menu 선택지 / random 분기 ---
-        if (indent >= 8) {
-            if (inMenu_) {
-                parseMenuChoiceLine(trimmed, lineNum);
-                continue;
-            }
-            if (inRandom_) {
-                parseRandomBranchLine(trimmed, lineNum);
-                continue;
-            }
-            addError(lineNum, "unexpected deep indentation (not inside menu: or random:)");
-            continue;
-        }
+void Parser::emitFinishedNodes() {
+    for (; emittedNodes_ < story_.nodes.size(); ++emittedNodes_) {
+        const size_t ni = emittedNodes_;
+        auto& node = *story_.nodes[ni];
+        // 에러가 이미 있으면 버퍼를 버리므로 쓰기/대상 수집 없이 해제만 한다
+        if (!hasErrors()) {
+            // 이미 정의된 노드를 가리키는 참조는 검증할 필요가 없다 (앞으로의 참조만 보관)
+            forEachJumpTarget(node, [&](size_t ii, int32_t targetId, const char* what) {
+                if (nodeNames_.count(story_.string_pool[targetId])) return;
+                auto it = instrLineMap_.find(instrKey(ni, ii));
+                pendingJumpTargets_.push_back({targetId, what, it != instrLineMap_.end() ? it->second : 0});
+            });
+            emitter_->emitNode(node);
+        }
+        for (size_t ii = 0; ii < node.lines.size(); ++ii) {
+            instrLineMap_.erase(instrKey(ni, ii));
+        }
+        std::vector<std::unique_ptr<InstructionT>>().swap(node.lines);
     }
+}
 
-    // 마지막 random 블록 플러시
-    if (inRandom_) { flushRandomBlock(lineNum); }
-
+// =================================================================
+// 파싱 후처리 (parse/parseString/parseToBuffer 공용)
+// =================================================================
+bool Parser::finishParse(const std::string& sourceName) {
     // 마지막 캐릭터 블록 완성
     flushCharacterBlock();
 
-    // "No labels found" 체크
+    // "No labels found" 체크 (import 포함 전체 결과)
     if (!hasErrors() && story_.nodes.empty()) {
-        std::string msg = "No labels found in " + filename;
+        std::string msg = "No labels found in " + sourceName;
         if (error_.empty()) error_ = msg;
         errors_.push_back(msg);
     }
 
-    // Jump target 검증 패스
+    // Jump target 검증 패스 (모든 파일의 노드 대상)
     if (!hasErrors()) {
         validateJumpTargets();
     }
@@ -2549,6 +2477,17 @@ bool Parser::parseString(const std::string& source, const std::string& filename)
     return !hasErrors();
 }
 
+// =================================================================
+// 문자열에서 직접 파싱 (WASM 등 파일 시스템 없는 환경용)
+// =================================================================
+bool Parser::parseString(const std::string& source, const std::string& filename) {
+    resetState(filename);
+
+    parseSource(source, filename, false);
+
+    return finishParse(filename);
+}
+
 // =================================================================
 // 파싱된 결과를 메모리 버퍼로 컴파일 (WASM 등 파일 시스템 없는 환경용)
 // =================================================================
@@ -2560,6 +2499,7 @@ std::vector<uint8_t> Parser::compileToBuffer() {
 
     // line_ids → story_ 복사
     story_.line_ids = lineIds_;
+    StoryLinker::linkStory(story_);
 
     flatbuffers::FlatBufferBuilder builder;
 
@@ -2575,36 +2515,71 @@ std::vector<uint8_t> Parser::compileToBuffer() {
 // =================================================================
 // 단일 파일 파싱 (state 리셋 없이, import 재귀 호출용)
 // =================================================================
-bool Parser::parseFile(const std::string& filepath) {
-    std::string savedFilename = filename_;
-    filename_ = filepath;
+bool Parser::readSourceFile(const std::string& filepath, std::string& out) {
+    std::ifstream ifs(filepath, std::ios::binary);
+    if (!ifs.is_open()) return false;
+    out.clear();
+    ifs.seekg(0, std::ios::end);
+    const std::streamoff size = ifs.tellg();
+    ifs.seekg(0, std::ios::beg);
+    if (size > 0) {
+        out.resize(static_cast<size_t>(size));
+        ifs.read(&out[0], size);
+        out.resize(static_cast<size_t>(ifs.gcount()));
+    }
+    return true;
+}
 
-    std::ifstream ifs(filepath);
-    if (!ifs.is_open()) {
+bool Parser::parseFile(const std::string& filepath) {
+    // 파일 전체를 한 번에 읽어 버퍼 하나로 파싱 (줄/토큰은 이 버퍼의 view)
+    std::string source;
+    if (!readSourceFile(filepath, source)) {
+        std::string savedFilename = filename_;
+        filename_ = filepath;
+        importStats_.files++;
         addError(0, "Failed to open file: " + filepath);
         filename_ = savedFilename;
         return false;
     }
+    parseLoadedFile(filepath, source);
+    return true;
+}
+
+void Parser::parseLoadedFile(const std::string& filepath, std::string_view source) {
+    std::string savedFilename = filename_;
+    filename_ = filepath;
+    importStats_.files++;
+    parseSource(source, filepath, true);
+    filename_ = savedFilename;
+}
+
+// =================================================================
+// 소스 버퍼 줄 단위 파싱 (parseFile/parseString 공용)
+// =================================================================
+void Parser::parseSource(std::string_view source, const std::string& filepath, bool allowImports) {
+    // BOM 제거 (UTF-8 BOM)
+    if (source.size() >= 3 &&
+        source[0] == '\xEF' && source[1] == '\xBB' && source[2] == '\xBF') {
+        source.remove_prefix(3);
+    }
 
-    std::string rawLine;
     int lineNum = 0;
+    size_t lineStart = 0;
 
-    while (std::getline(ifs, rawLine)) {
+    while (lineStart < source.size()) {
+        size_t lineEnd = source.find('\n', lineStart);
+        if (lineEnd == std::string_view::npos) lineEnd = source.size();
+        std::string_view rawLine = source.substr(lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
         lineNum++;
 
-        // BOM 제거 (UTF-8 BOM)
-        if (lineNum == 1 && rawLine.size() >= 3 &&
-            rawLine[0] == '\xEF' && rawLine[1] == '\xBB' && rawLine[2] == '\xBF') {
-            rawLine = rawLine.substr(3);
-        }
-
         // CR 제거
         if (!rawLine.empty() && rawLine.back() == '\r') {
-            rawLine.pop_back();
+            rawLine.remove_suffix(1);
         }
 
         // 빈 줄
-        std::string trimmed = trim(rawLine);
+        std::string_view trimmed = trim(rawLine);
         if (trimmed.empty()) continue;
 
         // 주석
@@ -2612,11 +2587,23 @@ bool Parser::parseFile(const std::string& filepath) {
 
         size_t indent = countIndent(rawLine);
 
+        // fragment 모드: import 경계(파일 시작/import 직후) 다음 줄은 label이어야
+        // 앞뒤 파일의 파싱 상태와 무관하다 — 아니면 병합을 포기하고 직렬로 파싱
+        bool boundaryLabel = false;
+        if (pendingImportBoundary_ && !(indent == 0 && startsWithKeyword(trimmed, "import"))) {
+            pendingImportBoundary_ = false;
+            boundaryLabel = indent == 0 && trimmed.substr(0, 5) == "label";
+            if (!boundaryLabel) markFragmentIssue(lineNum, "content between an import boundary and the next label");
+        }
+
         // --- 들여쓰기 레벨 0: import, label, 또는 global var ---
         if (indent == 0) {
             // import "filepath"
-            if (trimmed.size() >= 6 && trimmed.substr(0, 6) == "import" &&
-                (trimmed.size() == 6 || trimmed[6] == ' ')) {
+            if (startsWithKeyword(trimmed, "import")) {
+                if (!allowImports) {
+                    addError(lineNum, "import is not supported in parseString mode");
+                    continue;
+                }
                 size_t pos = 6;
                 skipSpaces(trimmed, pos);
                 if (pos >= trimmed.size() || trimmed[pos] != '"') {
@@ -2634,6 +2621,15 @@ bool Parser::parseFile(const std::string& filepath) {
                 std::filesystem::path resolvedPath = std::filesystem::absolute(currentDir / importPath);
                 std::string absImportPath = resolvedPath.string();
 
+                // fragment 모드: 재귀하지 않고 위치만 기록 (순환/존재 검사는 병합 때 직렬 순서로)
+                if (fragmentMode_) {
+                    if (inRandom_) markFragmentIssue(lineNum, "import inside an open random: block");
+                    importMarkers_.push_back({lineNum, importPath, absImportPath, poolEvents_.size(),
+                                              errors_.size(), warnings_.size(), story_.nodes.size()});
+                    pendingImportBoundary_ = true;
+                    continue;
+                }
+
                 // 순환 import 감지
                 if (importedFiles_.count(absImportPath)) {
                     addError(lineNum, "circular import detected: " + importPath);
@@ -2655,9 +2651,7 @@ bool Parser::parseFile(const std::string& filepath) {
             }
 
             // character definition: character hero:
-            if (!seenFirstLabel_ && trimmed.size() >= 9 &&
-                trimmed.substr(0, 9) == "character" &&
-                (trimmed.size() == 9 || trimmed[9] == ' ')) {
+            if (!seenFirstLabel_ && startsWithKeyword(trimmed, "character")) {
                 parseCharacterLine(trimmed, lineNum);
                 continue;
             }
@@ -2667,7 +2661,10 @@ bool Parser::parseFile(const std::string& filepath) {
                 if (inRandom_) { flushRandomBlock(lineNum); inRandom_ = false; }
                 inMenu_ = false;
                 prevLineType_ = PrevLineType::NONE;
-                if (!parseLabelLine(trimmed, lineNum)) continue; // 에러 복구
+                if (!parseLabelLine(trimmed, lineNum)) { // 에러 복구
+                    if (boundaryLabel) markFragmentIssue(lineNum, "invalid label after an import boundary");
+                    continue;
+                }
                 continue;
             }
 
@@ -2679,7 +2676,9 @@ bool Parser::parseFile(const std::string& filepath) {
             }
 
             // 들여쓰기 0에서 다른 것은 에러
-            addError(lineNum, "unexpected content at column 0 (expected 'label', 'character', 'import', or global '$')");
+            addError(lineNum, allowImports
+                ? "unexpected content at column 0 (expected 'label', 'character', 'import', or global '$')"
+                : "unexpected content at column 0 (expected 'label', 'character', or global '$')");
             continue; // 에러 복구
         }
 
@@ -2707,39 +2706,29 @@ bool Parser::parseFile(const std::string& filepath) {
                 continue;
             }
 
-            // jump
-            if (trimmed.substr(0, 4) == "jump" && (trimmed.size() == 4 || trimmed[4] == ' ')) {
-                parseJumpLine(trimmed, lineNum, false);
-                prevLineType_ = PrevLineType::NONE;
-                continue;
-            }
-
-            // call
-            if (trimmed.substr(0, 4) == "call" && (trimmed.size() == 4 || trimmed[4] == ' ')) {
-                parseJumpLine(trimmed, lineNum, true);
+            // jump / call
+            if (startsWithKeyword(trimmed, "jump") || startsWithKeyword(trimmed, "call")) {
+                parseJumpLine(trimmed, lineNum, trimmed[0] == 'c');
                 prevLineType_ = PrevLineType::NONE;
                 continue;
             }
 
             // return [expr]
-            if (trimmed.size() >= 6 && trimmed.substr(0, 6) == "return" &&
-                (trimmed.size() == 6 || trimmed[6] == ' ')) {
+            if (startsWithKeyword(trimmed, "return")) {
                 parseReturnLine(trimmed, lineNum);
                 prevLineType_ = PrevLineType::NONE;
                 continue;
             }
 
             // wait / wait "tag"
-            if (trimmed.size() >= 4 && trimmed.substr(0, 4) == "wait" &&
-                (trimmed.size() == 4 || trimmed[4] == ' ')) {
+            if (startsWithKeyword(trimmed, "wait")) {
                 parseWaitLine(trimmed, lineNum);
                 prevLineType_ = PrevLineType::NONE;
                 continue;
             }
 
             // yield
-            if (trimmed.size() >= 5 && trimmed.substr(0, 5) == "yield" &&
-                (trimmed.size() == 5 || trimmed[5] == ' ')) {
+            if (startsWithKeyword(trimmed, "yield")) {
                 parseYieldLine(trimmed, lineNum);
                 prevLineType_ = PrevLineType::NONE;
                 continue;
@@ -2753,14 +2742,14 @@ bool Parser::parseFile(const std::string& filepath) {
             }
 
             // if 조건문
-            if (trimmed.substr(0, 2) == "if" && (trimmed.size() == 2 || trimmed[2] == ' ')) {
+            if (startsWithKeyword(trimmed, "if")) {
                 parseConditionLine(trimmed, lineNum);
                 prevLineType_ = PrevLineType::IF;
                 continue;
             }
 
             // elif 조건문
-            if (trimmed.size() >= 4 && trimmed.substr(0, 4) == "elif" && (trimmed.size() == 4 || trimmed[4] == ' ')) {
+            if (startsWithKeyword(trimmed, "elif")) {
                 if (prevLineType_ == PrevLineType::IF || prevLineType_ == PrevLineType::ELIF) {
                     parseElifLine(trimmed, lineNum);
                     prevLineType_ = PrevLineType::ELIF;
@@ -2771,7 +2760,7 @@ bool Parser::parseFile(const std::string& filepath) {
             }
 
             // standalone else
-            if (trimmed.size() >= 4 && trimmed.substr(0, 4) == "else" && (trimmed.size() == 4 || trimmed[4] == ' ')) {
+            if (startsWithKeyword(trimmed, "else")) {
                 if (prevLineType_ == PrevLineType::IF || prevLineType_ == PrevLineType::ELIF) {
                     parseElseLine(trimmed, lineNum);
                 } else {
@@ -2812,88 +2801,36 @@ bool Parser::parseFile(const std::string& filepath) {
 
     // 파일 끝에서 pending random 블록 flush
     if (inRandom_) { flushRandomBlock(lineNum); inRandom_ = false; }
-
-    filename_ = savedFilename;
-    return true;
 }
 
 // =================================================================
 // Jump target 검증
 // =================================================================
 void Parser::validateJumpTargets() {
-    // 모든 노드 이름 수집
-    std::unordered_set<std::string> nodeNames;
-    for (const auto& node : story_.nodes) {
-        nodeNames.insert(node->name);
-    }
-
-    // 모든 instruction 순회하며 타겟 검증
-    for (size_t ni = 0; ni < story_.nodes.size(); ++ni) {
-        const auto& node = story_.nodes[ni];
-        for (size_t ii = 0; ii < node->lines.size(); ++ii) {
-            const auto& instr = node->lines[ii];
+    // 노드 이름은 label 파싱/병합 때 모아 둔 nodeNames_를 그대로 쓴다
+    const auto& nodeNames = nodeNames_;
+    auto check = [&](int32_t targetId, const char* what, const auto& lineNum) {
+        const std::string& target = story_.string_pool[targetId];
+        if (nodeNames.find(target) == nodeNames.end()) {
+            addError(lineNum(), std::string(what) + " target '" + target + "' does not exist");
+        }
+    };
 
-            int lineNum = 0;
-            auto it = instrLineMap_.find(instrKey(ni, ii));
-            if (it != instrLineMap_.end()) {
-                lineNum = it->second;
-            }
+    // 스트리밍 경로가 해제한 앞쪽 노드의 참조 (노드 순서 그대로)
+    for (const auto& ref : pendingJumpTargets_) {
+        check(ref.targetId, ref.what, [&]() { return ref.lineNum; });
+    }
+    pendingJumpTargets_.clear();
 
-            switch (instr->data.type) {
-                case OpData::Jump: {
-                    auto* jump = instr->data.AsJump();
-                    const std::string& target = story_.string_pool[jump->target_node_name_id];
-                    if (nodeNames.find(target) == nodeNames.end()) {
-                        addError(lineNum, "jump target '" + target + "' does not exist");
-                    }
-                    break;
-                }
-                case OpData::Choice: {
-                    auto* choice = instr->data.AsChoice();
-                    const std::string& target = story_.string_pool[choice->target_node_name_id];
-                    if (nodeNames.find(target) == nodeNames.end()) {
-                        addError(lineNum, "choice target '" + target + "' does not exist");
-                    }
-                    break;
-                }
-                case OpData::Condition: {
-                    auto* cond = instr->data.AsCondition();
-                    if (cond->true_jump_node_id >= 0) {
-                        const std::string& target = story_.string_pool[cond->true_jump_node_id];
-                        if (nodeNames.find(target) == nodeNames.end()) {
-                            addError(lineNum, "condition true target '" + target + "' does not exist");
-                        }
-                    }
-                    if (cond->false_jump_node_id >= 0) {
-                        const std::string& target = story_.string_pool[cond->false_jump_node_id];
-                        if (nodeNames.find(target) == nodeNames.end()) {
-                            addError(lineNum, "condition false target '" + target + "' does not exist");
-                        }
-                    }
-                    break;
-                }
-                case OpData::Random: {
-                    auto* random = instr->data.AsRandom();
-                    for (const auto& branch : random->branches) {
-                        const std::string& target = story_.string_pool[branch->target_node_name_id];
-                        if (nodeNames.find(target) == nodeNames.end()) {
-                            addError(lineNum, "random target '" + target + "' does not exist");
-                        }
-                    }
-                    break;
-                }
-                case OpData::CallWithReturn: {
-                    auto* cwr = instr->data.AsCallWithReturn();
-                    const std::string& target = story_.string_pool[cwr->target_node_name_id];
-                    if (nodeNames.find(target) == nodeNames.end()) {
-                        addError(lineNum, "call target '" + target + "' does not exist");
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-        }
+    // 남아 있는 노드의 모든 instruction 순회하며 타겟 검증
+    for (size_t ni = emittedNodes_; ni < story_.nodes.size(); ++ni) {
+        forEachJumpTarget(*story_.nodes[ni], [&](size_t ii, int32_t targetId, const char* what) {
+            // 줄 번호는 에러가 날 때만 찾는다
+            check(targetId, what, [&]() {
+                auto it = instrLineMap_.find(instrKey(ni, ii));
+                return it != instrLineMap_.end() ? it->second : 0;
+            });
+        });
     }
 }
 
@@ -3029,6 +2966,7 @@ bool Parser::compile(const std::string& outputPath) {
 
     // line_ids → story_ 복사
     story_.line_ids = lineIds_;
+    StoryLinker::linkStory(story_);
 
     flatbuffers::FlatBufferBuilder builder;
 
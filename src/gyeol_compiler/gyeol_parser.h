@@ -1,6 +1,7 @@
 #pragma once
 #include "gyeol_generated.h"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -8,6 +9,8 @@
 
 namespace Gyeol {
 
+class StoryEmitter;
+
 class Parser {
 public:
     // .gyeol 파일을 파싱하여 내부 StoryT 객체 생성
@@ -22,6 +25,13 @@ public:
     // 파싱된 결과를 메모리 버퍼로 컴파일 (WASM 등 파일 시스템 없는 환경용)
     std::vector<uint8_t> compileToBuffer();
 
+    // 파싱하면서 바로 .gyb 버퍼를 만든다 (대형 스토리용 스트리밍 경로).
+    // 노드는 다음 label이 시작될 때 FlatBufferBuilder에 쓰고 명령 트리를 즉시 해제한다.
+    // 에러/경고는 parse()와 같고, UnPack한 결과는 parse() + compileToBuffer()와 같다.
+    // 성공 후 getStory()의 노드에는 이름/매개변수/태그만 남는다 (lines는 비어 있음).
+    // import는 직렬로 따라간다 (fragment 병렬/캐시 경로는 쓰지 않는다).
+    bool parseToBuffer(const std::string& filepath, std::vector<uint8_t>& outBuffer);
+
     // 첫 번째 에러 (하위 호환)
     const std::string& getError() const { return error_; }
 
@@ -42,17 +52,44 @@ public:
     const ICPDev::Gyeol::Schema::StoryT& getStory() const { return story_; }
     ICPDev::Gyeol::Schema::StoryT& getStoryMutable() { return story_; }
 
+    // 노드별 소스 파일 경로 (story.nodes와 병렬, import된 파일이면 그 파일)
+    const std::vector<std::string>& getNodeSourceFiles() const { return nodeSourceFiles_; }
+
+    // import된 파일을 파일별 fragment로 병렬 파싱할 스레드 수 (0/1 = 직렬, 기본값).
+    // 병합 결과(string pool 순서, line id, start node, 에러 순서)는 직렬 파싱과 같다.
+    void setImportThreads(unsigned threads) { importThreads_ = threads; }
+    unsigned getImportThreads() const { return importThreads_; }
+
+    // 파일별 fragment를 dir 아래에 캐시한다 (빈 문자열 = 끔). 소스 내용 해시와 compilerVersion이
+    // 같은 파일은 다시 파싱하지 않고 캐시에서 읽어 병합한다. 스레드 수와 무관하게 fragment 경로를 탄다.
+    void setFragmentCache(const std::string& dir, const std::string& compilerVersion);
+
+    struct ImportParseStats {
+        size_t files = 0;              // 파싱한 소스 파일 수 (메인 포함)
+        unsigned threads = 1;          // 실제로 사용한 스레드 수
+        bool parallel = false;         // fragment 병합 결과를 사용했는지
+        std::string fallbackReason;    // 직렬로 되돌아간 이유 (비어 있으면 없음)
+        size_t cacheHits = 0;          // 캐시에서 읽은 fragment 수
+        size_t cacheMisses = 0;        // 캐시가 없거나 낡아서 새로 파싱한 fragment 수
+    };
+    const ImportParseStats& getImportParseStats() const { return importStats_; }
+
 private:
     ICPDev::Gyeol::Schema::StoryT story_;
     std::string error_;
     std::vector<std::string> errors_;
     std::vector<std::string> warnings_;
     std::string filename_;
+    std::vector<std::string> nodeSourceFiles_;
+    std::unordered_set<std::string_view> nodeNames_; // 중복 label 검사 (NodeT::name을 가리키는 view)
 
     // String Pool 관리 (중복 제거)
-    std::unordered_map<std::string, int32_t> stringMap_;
-    int32_t addString(const std::string& str);
-    int32_t addStringWithId(const std::string& str, const std::string& lineId);
+    // 키는 story_.string_pool 원소를 가리키는 view — pool이 재할당되면 다시 만든다.
+    std::unordered_map<std::string_view, int32_t> stringMap_;
+    void rebuildStringMap();
+    int32_t addString(std::string_view str);
+    int32_t addStringWithId(std::string_view str, const std::string& lineId);
+    int32_t appendString(std::string&& str, std::string lineId); // 검색 없이 pool 끝에 추가
 
     // Line ID 추적 (string_pool과 병렬)
     std::vector<std::string> lineIds_;
@@ -69,7 +106,7 @@ private:
     std::string currentCharacterId_;
     std::unique_ptr<ICPDev::Gyeol::Schema::CharacterDefT> currentCharacter_;
     std::unordered_set<std::string> definedCharacters_;
-    std::unordered_set<std::string> usedCharacters_;
+    std::unordered_set<int32_t> usedCharacters_; // string_pool 인덱스
 
     // random: 블록 분기 수집
     std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::RandomBranchT>> pendingRandomBranches_;
@@ -86,54 +123,54 @@ private:
     void addWarning(int lineNum, const std::string& msg);
 
     // 파싱 헬퍼
-    static size_t countIndent(const std::string& line);
-    static std::string trim(const std::string& str);
-    std::string parseQuotedString(const std::string& text, size_t& pos);
-    static std::string parseWord(const std::string& text, size_t& pos);
-    static void skipSpaces(const std::string& text, size_t& pos);
+    static size_t countIndent(std::string_view line);
+    static std::string_view trim(std::string_view str);
+    std::string parseQuotedString(std::string_view text, size_t& pos);
+    static std::string_view parseWord(std::string_view text, size_t& pos);
+    static void skipSpaces(std::string_view text, size_t& pos);
 
     // 라인별 파서
-    bool parseLabelLine(const std::string& content, int lineNum);
-    bool parseDialogueLine(const std::string& content, int lineNum);
-    bool parseMenuChoiceLine(const std::string& content, int lineNum);
-    bool parseJumpLine(const std::string& content, int lineNum, bool isCall);
-    bool parseSetVarLine(const std::string& content, int lineNum);
-    bool parseGlobalVarLine(const std::string& content, int lineNum);
-    bool parseConditionLine(const std::string& content, int lineNum);
-    bool parseElifLine(const std::string& content, int lineNum);
-    bool parseElseLine(const std::string& content, int lineNum);
-    bool parseRandomBranchLine(const std::string& content, int lineNum);
+    bool parseLabelLine(std::string_view content, int lineNum);
+    bool parseDialogueLine(std::string_view content, int lineNum);
+    bool parseMenuChoiceLine(std::string_view content, int lineNum);
+    bool parseJumpLine(std::string_view content, int lineNum, bool isCall);
+    bool parseSetVarLine(std::string_view content, int lineNum);
+    bool parseGlobalVarLine(std::string_view content, int lineNum);
+    bool parseConditionLine(std::string_view content, int lineNum);
+    bool parseElifLine(std::string_view content, int lineNum);
+    bool parseElseLine(std::string_view content, int lineNum);
+    bool parseRandomBranchLine(std::string_view content, int lineNum);
     void flushRandomBlock(int lineNum);
-    bool parseCommandLine(const std::string& content, int lineNum);
-    bool parseWaitLine(const std::string& content, int lineNum);
-    bool parseYieldLine(const std::string& content, int lineNum);
-    bool parseReturnLine(const std::string& content, int lineNum);
+    bool parseCommandLine(std::string_view content, int lineNum);
+    bool parseWaitLine(std::string_view content, int lineNum);
+    bool parseYieldLine(std::string_view content, int lineNum);
+    bool parseReturnLine(std::string_view content, int lineNum);
 
     // 캐릭터 정의 블록
-    bool parseCharacterLine(const std::string& content, int lineNum);
-    bool parseCharacterProperty(const std::string& content, int lineNum);
+    bool parseCharacterLine(std::string_view content, int lineNum);
+    bool parseCharacterProperty(std::string_view content, int lineNum);
     void flushCharacterBlock();
     void validateCharacters();
 
     // 매개변수/인자 파싱 헬퍼
-    bool parseParamList(const std::string& content, size_t& pos,
+    bool parseParamList(std::string_view content, size_t& pos,
                         std::vector<std::string>& outParamNames, int lineNum);
-    bool parseArgList(const std::string& content, size_t& pos,
+    bool parseArgList(std::string_view content, size_t& pos,
                       std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT>>& outArgExprs,
                       int lineNum);
 
     // 값 파싱
-    bool parseValue(const std::string& text, size_t& pos,
+    bool parseValue(std::string_view text, size_t& pos,
                     ICPDev::Gyeol::Schema::ValueDataUnion& outValue);
 
     // 표현식 파싱 (Shunting-yard → RPN)
-    bool parseExpression(const std::string& text, size_t& pos,
+    bool parseExpression(std::string_view text, size_t& pos,
                          std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT>& outExpr,
                          ICPDev::Gyeol::Schema::ValueDataUnion& outSimpleValue,
                          bool& isSimpleLiteral);
 
     // 조건 표현식 파싱 (산술 + 비교 + 논리 → 단일 RPN)
-    bool parseFullConditionExpr(const std::string& text, size_t& pos,
+    bool parseFullConditionExpr(std::string_view text, size_t& pos,
                                 std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT>& outExpr,
                                 bool& hasLogicalOps);
 
@@ -142,10 +179,23 @@ private:
     static uint64_t instrKey(size_t nodeIdx, size_t instrIdx) {
         return (static_cast<uint64_t>(nodeIdx) << 32) | static_cast<uint64_t>(instrIdx);
     }
+    // 스트리밍 경로에서 해제한 노드의 아직 정의되지 않은 이동 대상 (끝에서 검증)
+    struct JumpTargetRef {
+        int32_t targetId = 0;
+        const char* what = "";  // 에러 메시지용 참조 종류 ("jump", "choice", ...)
+        int lineNum = 0;
+    };
+    std::vector<JumpTargetRef> pendingJumpTargets_;
     void validateJumpTargets();
 
+    // --- 스트리밍 출력 (parseToBuffer) ---
+    StoryEmitter* emitter_ = nullptr;
+    size_t emittedNodes_ = 0;  // 이미 emitter_로 내보낸 앞쪽 노드 수
+    void emitFinishedNodes();
+    bool finishParse(const std::string& sourceName);
+
     // Line ID 생성 헬퍼
-    static std::string hashText(const std::string& text);
+    static std::string hashText(std::string_view text);
 
     // --- Import tracking ---
     std::unordered_set<std::string> importedFiles_;  // 절대 경로 (순환 감지)
@@ -154,6 +204,57 @@ private:
 
     // 단일 파일 파싱 (state 리셋 없이, import 재귀 호출용)
     bool parseFile(const std::string& filepath);
+    void parseLoadedFile(const std::string& filepath, std::string_view source);
+    static bool readSourceFile(const std::string& filepath, std::string& out);
+    void resetState(const std::string& filename);
+
+    // --- 병렬 import 파싱 (gyeol_parser_imports.cpp) ---
+    // fragment = import를 따라가지 않고 파일 하나만 파싱한 Parser (string id는 파일 로컬).
+    struct ImportMarker {
+        int lineNum = 0;
+        std::string importPath;     // 소스에 적힌 경로 (에러 메시지용)
+        std::string absPath;        // 직렬 파서와 같은 방식으로 해석한 절대 경로
+        size_t poolEvents = 0;      // import 시점까지의 poolEvents_/errors_/warnings_/nodes 개수
+        size_t errors = 0;
+        size_t warnings = 0;
+        size_t nodes = 0;
+    };
+    // 로컬 string pool에 새 문자열이 들어오거나 빈 line id가 채워진 순간 (병합 때 순서대로 재생).
+    // line id는 로컬 id마다 한 번만 정해지므로 값은 fragment의 최종 lineIds_에서 읽는다.
+    struct PoolEvent {
+        int32_t localId = 0;
+        bool withLineId = false;
+    };
+    unsigned importThreads_ = 1;
+    ImportParseStats importStats_;
+    bool fragmentMode_ = false;
+    bool pendingImportBoundary_ = false;
+    std::vector<ImportMarker> importMarkers_;
+    std::vector<PoolEvent> poolEvents_;
+    std::string fragmentIssue_;  // 비어 있지 않으면 앞뒤 파일 상태에 의존 → 직렬 파싱 필요
+
+    std::string cacheDir_;
+    std::string cacheCompilerVersion_;
+
+    void markFragmentIssue(int lineNum, const std::string& reason);
+    static std::unique_ptr<Parser> newFragment(const std::string& path, bool isMainFile);
+    static std::unique_ptr<Parser> parseFragment(const std::string& path, bool isMainFile);
+    std::unique_ptr<Parser> obtainFragment(const std::string& path, bool isMainFile, bool& cacheHit) const;
+    bool parseByFragments(const std::string& filepath);
+    bool mergeFragment(Parser& fragment,
+                       std::unordered_map<std::string, std::unique_ptr<Parser>>& fragments);
+
+    // --- fragment 디스크 캐시 (gyeol_parser_cache.cpp) ---
+    static std::string hashSource(std::string_view source);
+    std::string fragmentCachePath(const std::string& path, bool isMainFile) const;
+    std::unique_ptr<Parser> loadCachedFragment(const std::string& cachePath, const std::string& path,
+                                               bool isMainFile, const std::string& contentHash) const;
+    bool saveCachedFragment(const Parser& fragment, const std::string& cachePath,
+                            const std::string& contentHash) const;
+
+    // 소스 버퍼 하나를 줄 단위 view로 훑는 공용 루프 (parseFile/parseString).
+    // allowImports=false면 import 줄은 에러로 처리한다.
+    void parseSource(std::string_view source, const std::string& filepath, bool allowImports);
 };
 
 namespace LocaleTools {
@@ -179,6 +280,12 @@ bool buildLocaleCatalog(const std::vector<std::string>& localePaths,
                         const std::string& outputPath,
                         const std::string& defaultLocale,
                         std::string* errorOut = nullptr);
+// FlatBuffers 기반 카탈로그 (.gylc): string_pool 인덱스 기준, fallback 평탄화
+bool buildLocaleCatalogBinary(const std::vector<std::string>& localePaths,
+                              const ICPDev::Gyeol::Schema::StoryT& story,
+                              const std::string& outputPath,
+                              const std::string& defaultLocale,
+                              std::string* errorOut = nullptr);
 }
 
 } // namespace Gyeol
@@ -0,0 +1,252 @@
+#include "gyeol_parser.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+using namespace ICPDev::Gyeol::Schema;
+
+// =================================================================
+// fragment 디스크 캐시
+//
+// 소스 파일 하나를 import 없이 파싱한 fragment(gyeol_parser_imports.cpp)를
+// ParsedFragment FlatBuffer(식별자 GYFC)로 저장한다. 캐시 파일은
+// (절대 경로, 넘긴 경로, 메인 여부)마다 한 칸이고, 소스 내용 해시와
+// 컴파일러 버전/포맷 버전이 모두 같을 때만 재사용한다. 파일 존재/순환 import
+// 검사는 병합 때 다시 하므로 캐시에 들어가지 않는다.
+// fragment를 만드는 파서 동작이 바뀌면 kFragmentCacheFormat을 올린다.
+// =================================================================
+
+namespace Gyeol {
+
+namespace {
+
+constexpr uint32_t kFragmentCacheFormat = 2;
+constexpr const char* kFragmentCacheIdentifier = "GYFC";
+
+uint64_t fnv1a64(std::string_view data, uint64_t hash = 14695981039346656037ull) {
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string toHex64(uint64_t value) {
+    char buf[17];
+    std::snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(value));
+    return buf;
+}
+
+std::string str(const flatbuffers::String* s) {
+    return s ? s->str() : std::string();
+}
+
+} // namespace
+
+void Parser::setFragmentCache(const std::string& dir, const std::string& compilerVersion) {
+    cacheDir_ = dir;
+    cacheCompilerVersion_ = compilerVersion;
+}
+
+std::string Parser::hashSource(std::string_view source) {
+    return toHex64(fnv1a64(source));
+}
+
+std::string Parser::fragmentCachePath(const std::string& path, bool isMainFile) const {
+    std::string key = std::filesystem::absolute(path).string();
+    key += '\n';
+    key += path;
+    key += isMainFile ? "\nmain" : "\nimport";
+    return (std::filesystem::path(cacheDir_) / (toHex64(fnv1a64(key)) + ".gyfc")).string();
+}
+
+std::unique_ptr<Parser> Parser::loadCachedFragment(const std::string& cachePath, const std::string& path,
+                                                   bool isMainFile, const std::string& contentHash) const {
+    std::string data;
+    if (!readSourceFile(cachePath, data) || data.empty()) return nullptr;
+
+    const auto* bytes = reinterpret_cast<const uint8_t*>(data.data());
+    flatbuffers::Verifier verifier(bytes, data.size());
+    if (!flatbuffers::BufferHasIdentifier(bytes, kFragmentCacheIdentifier) ||
+        !verifier.VerifyBuffer<ParsedFragment>(kFragmentCacheIdentifier)) {
+        return nullptr;
+    }
+    const auto* cached = flatbuffers::GetRoot<ParsedFragment>(bytes);
+    if (cached->format_version() != kFragmentCacheFormat ||
+        str(cached->compiler_version()) != cacheCompilerVersion_ ||
+        str(cached->source_path()) != path || cached->main_file() != isMainFile ||
+        str(cached->content_hash()) != contentHash || !cached->story()) {
+        return nullptr;
+    }
+
+    auto fragment = newFragment(path, isMainFile);
+    fragment->story_.string_pool.clear();
+    fragment->lineIds_.clear();
+    cached->story()->UnPackTo(&fragment->story_);
+    fragment->lineIds_ = std::move(fragment->story_.line_ids);
+    fragment->story_.line_ids.clear();
+    if (fragment->story_.string_pool.empty() ||
+        fragment->lineIds_.size() != fragment->story_.string_pool.size()) {
+        return nullptr;
+    }
+    fragment->nodeSourceFiles_.assign(fragment->story_.nodes.size(), path);
+    fragment->importStats_.files = 1;
+
+    const auto* eventIds = cached->pool_event_ids();
+    const auto* eventLineIds = cached->pool_event_line_ids();
+    const size_t eventCount = eventIds ? eventIds->size() : 0;
+    if ((eventLineIds ? eventLineIds->size() : 0) != eventCount) return nullptr;
+    fragment->poolEvents_.reserve(eventCount);
+    for (size_t i = 0; i < eventCount; ++i) {
+        const int32_t localId = eventIds->Get(static_cast<flatbuffers::uoffset_t>(i));
+        if (localId <= 0 || static_cast<size_t>(localId) >= fragment->story_.string_pool.size()) return nullptr;
+        fragment->poolEvents_.push_back({localId, eventLineIds->Get(static_cast<flatbuffers::uoffset_t>(i)) != 0});
+    }
+
+    if (const auto* markers = cached->import_markers()) {
+        for (const auto* m : *markers) {
+            ImportMarker marker;
+            marker.lineNum = m->line();
+            marker.importPath = str(m->import_path());
+            marker.absPath = str(m->abs_path());
+            marker.poolEvents = m->pool_events();
+            marker.errors = m->errors();
+            marker.warnings = m->warnings();
+            marker.nodes = m->nodes();
+            fragment->importMarkers_.push_back(std::move(marker));
+        }
+    }
+    if (const auto* errors = cached->errors()) {
+        for (const auto* e : *errors) fragment->errors_.push_back(e->str());
+    }
+    if (!fragment->errors_.empty()) fragment->error_ = fragment->errors_.front();
+    if (const auto* warnings = cached->warnings()) {
+        for (const auto* w : *warnings) fragment->warnings_.push_back(w->str());
+    }
+    // 병합이 인덱스로 읽는 값은 범위를 확인한다 (손상된 캐시는 다시 파싱)
+    for (const auto& marker : fragment->importMarkers_) {
+        if (marker.poolEvents > fragment->poolEvents_.size() || marker.errors > fragment->errors_.size() ||
+            marker.warnings > fragment->warnings_.size() || marker.nodes > fragment->story_.nodes.size()) {
+            return nullptr;
+        }
+    }
+
+    const auto* instrNodes = cached->instr_nodes();
+    const auto* instrIndices = cached->instr_indices();
+    const auto* instrLines = cached->instr_lines();
+    if (instrNodes && instrIndices && instrLines &&
+        instrNodes->size() == instrIndices->size() && instrNodes->size() == instrLines->size()) {
+        fragment->instrLineMap_.reserve(instrNodes->size());
+        for (flatbuffers::uoffset_t i = 0; i < instrNodes->size(); ++i) {
+            fragment->instrLineMap_[instrKey(instrNodes->Get(i), instrIndices->Get(i))] = instrLines->Get(i);
+        }
+    }
+    if (const auto* used = cached->used_characters()) {
+        for (int32_t id : *used) {
+            if (id < 0 || static_cast<size_t>(id) >= fragment->story_.string_pool.size()) return nullptr;
+            fragment->usedCharacters_.insert(id);
+        }
+    }
+    if (const auto* defined = cached->defined_characters()) {
+        for (const auto* d : *defined) fragment->definedCharacters_.insert(d->str());
+    }
+    fragment->startNodeSet_ = cached->start_node_set();
+    fragment->fragmentIssue_ = str(cached->fragment_issue());
+    return fragment;
+}
+
+bool Parser::saveCachedFragment(const Parser& fragment, const std::string& cachePath,
+                                const std::string& contentHash) const {
+    const auto& story = fragment.story_;
+    flatbuffers::FlatBufferBuilder fbb;
+
+    auto storyOffset = CreateStory(
+        fbb,
+        story.version.empty() ? 0 : fbb.CreateString(story.version),
+        fbb.CreateVectorOfStrings(story.string_pool),
+        fbb.CreateVectorOfStrings(fragment.lineIds_),
+        fbb.CreateVector<flatbuffers::Offset<SetVar>>(story.global_vars.size(), [&](size_t i) {
+            return CreateSetVar(fbb, story.global_vars[i].get());
+        }),
+        fbb.CreateVector<flatbuffers::Offset<Node>>(story.nodes.size(), [&](size_t i) {
+            return CreateNode(fbb, story.nodes[i].get());
+        }),
+        story.start_node_name.empty() ? 0 : fbb.CreateString(story.start_node_name),
+        fbb.CreateVector<flatbuffers::Offset<CharacterDef>>(story.characters.size(), [&](size_t i) {
+            return CreateCharacterDef(fbb, story.characters[i].get());
+        }));
+
+    std::vector<int32_t> eventIds;
+    std::vector<uint8_t> eventLineIds;
+    eventIds.reserve(fragment.poolEvents_.size());
+    eventLineIds.reserve(fragment.poolEvents_.size());
+    for (const auto& ev : fragment.poolEvents_) {
+        eventIds.push_back(ev.localId);
+        eventLineIds.push_back(ev.withLineId ? 1 : 0);
+    }
+
+    std::vector<flatbuffers::Offset<FragmentImportMarker>> markers;
+    for (const auto& m : fragment.importMarkers_) {
+        markers.push_back(CreateFragmentImportMarker(
+            fbb, m.lineNum, fbb.CreateString(m.importPath), fbb.CreateString(m.absPath),
+            static_cast<uint32_t>(m.poolEvents), static_cast<uint32_t>(m.errors),
+            static_cast<uint32_t>(m.warnings), static_cast<uint32_t>(m.nodes)));
+    }
+
+    // 같은 fragment는 같은 바이트가 되도록 해시 컨테이너는 정렬해서 쓴다
+    std::vector<std::pair<uint64_t, int>> instrLines(fragment.instrLineMap_.begin(), fragment.instrLineMap_.end());
+    std::sort(instrLines.begin(), instrLines.end());
+    std::vector<uint32_t> instrNodes;
+    std::vector<uint32_t> instrIndices;
+    std::vector<int32_t> instrLineNums;
+    for (const auto& entry : instrLines) {
+        instrNodes.push_back(static_cast<uint32_t>(entry.first >> 32));
+        instrIndices.push_back(static_cast<uint32_t>(entry.first & 0xFFFFFFFFu));
+        instrLineNums.push_back(entry.second);
+    }
+    std::vector<int32_t> used(fragment.usedCharacters_.begin(), fragment.usedCharacters_.end());
+    std::sort(used.begin(), used.end());
+    std::vector<std::string> defined(fragment.definedCharacters_.begin(), fragment.definedCharacters_.end());
+    std::sort(defined.begin(), defined.end());
+
+    fbb.Finish(CreateParsedFragment(
+                   fbb, kFragmentCacheFormat, fbb.CreateString(cacheCompilerVersion_),
+                   fbb.CreateString(fragment.filename_), fbb.CreateString(contentHash),
+                   fragment.isMainFile_, storyOffset, fbb.CreateVector(eventIds),
+                   fbb.CreateVector(eventLineIds), fbb.CreateVector(markers),
+                   fbb.CreateVectorOfStrings(fragment.errors_), fbb.CreateVectorOfStrings(fragment.warnings_),
+                   fbb.CreateVector(instrNodes), fbb.CreateVector(instrIndices),
+                   fbb.CreateVector(instrLineNums), fbb.CreateVector(used),
+                   fbb.CreateVectorOfStrings(defined), fragment.startNodeSet_,
+                   fbb.CreateString(fragment.fragmentIssue_)),
+               kFragmentCacheIdentifier);
+
+    // 임시 파일에 쓰고 이름을 바꿔 동시에 도는 빌드가 반쯤 쓴 파일을 읽지 않게 한다
+    std::error_code ec;
+    std::filesystem::create_directories(cacheDir_, ec);
+    const std::string tempPath =
+        cachePath + ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+        std::ofstream ofs(tempPath, std::ios::binary);
+        if (!ofs.is_open()) return false;
+        ofs.write(reinterpret_cast<const char*>(fbb.GetBufferPointer()),
+                  static_cast<std::streamsize>(fbb.GetSize()));
+        if (!ofs.good()) {
+            ofs.close();
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
+    std::filesystem::rename(tempPath, cachePath, ec);
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+} // namespace Gyeol
@@ -0,0 +1,287 @@
+#include "gyeol_parser.h"
+#include "gyeol_pool_tools.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+using namespace ICPDev::Gyeol::Schema;
+
+// =================================================================
+// 병렬 import 파싱
+//
+// 1) 메인 파일과 import된 파일을 각각 독립된 Parser(fragment)로 파싱한다.
+//    fragment는 import를 따라가지 않고 위치(ImportMarker)만 기록하며,
+//    string id는 파일 로컬 pool 기준이다.
+// 2) 직렬 파서와 같은 깊이 우선 순서로 fragment를 이어 붙인다.
+//    로컬 pool 이벤트를 순서대로 재생하므로 string pool 순서와 line id가 같고,
+//    순환/중복 import와 파일 없음 에러도 같은 위치에서 같은 순서로 난다.
+// 3) 파일이 앞뒤 파일의 파싱 상태(열린 random 블록, import 뒤 label 전 내용,
+//    파일 간 중복 label 등)에 의존하면 병합을 포기하고 직렬로 다시 파싱한다.
+// fragment 캐시가 켜져 있으면 1)에서 내용이 바뀌지 않은 파일은 캐시에서 읽는다.
+// =================================================================
+
+namespace Gyeol {
+
+void Parser::markFragmentIssue(int lineNum, const std::string& reason) {
+    if (fragmentIssue_.empty()) {
+        fragmentIssue_ = filename_ + ":" + std::to_string(lineNum) + ": " + reason;
+    }
+}
+
+std::unique_ptr<Parser> Parser::newFragment(const std::string& path, bool isMainFile) {
+    auto fragment = std::make_unique<Parser>();
+    fragment->resetState(path);
+    fragment->fragmentMode_ = true;
+    fragment->isMainFile_ = isMainFile;
+    // import된 파일의 첫 내용은 import 경계 바로 뒤와 같다
+    fragment->pendingImportBoundary_ = !isMainFile;
+    // 로컬 id 0은 병합 때 전역 0으로 그대로 옮기는 자리 (기본값 0인 필드 보존).
+    // stringMap_에 넣지 않으므로 실제 문자열은 1부터 시작한다.
+    fragment->story_.string_pool.emplace_back();
+    fragment->lineIds_.emplace_back();
+    return fragment;
+}
+
+std::unique_ptr<Parser> Parser::parseFragment(const std::string& path, bool isMainFile) {
+    auto fragment = newFragment(path, isMainFile);
+    fragment->parseFile(path);
+    fragment->flushCharacterBlock();
+    return fragment;
+}
+
+std::unique_ptr<Parser> Parser::obtainFragment(const std::string& path, bool isMainFile,
+                                               bool& cacheHit) const {
+    cacheHit = false;
+    std::string source;
+    // 캐시가 꺼져 있거나 파일을 못 읽으면 일반 경로 (파일 에러 메시지도 그쪽에서)
+    if (cacheDir_.empty() || !readSourceFile(path, source)) return parseFragment(path, isMainFile);
+
+    const std::string contentHash = hashSource(source);
+    const std::string cachePath = fragmentCachePath(path, isMainFile);
+    if (auto cached = loadCachedFragment(cachePath, path, isMainFile, contentHash)) {
+        cacheHit = true;
+        return cached;
+    }
+
+    auto fragment = newFragment(path, isMainFile);
+    fragment->parseLoadedFile(path, source);
+    fragment->flushCharacterBlock();
+    saveCachedFragment(*fragment, cachePath, contentHash); // 실패해도 이번 빌드에는 영향 없음
+    return fragment;
+}
+
+bool Parser::parseByFragments(const std::string& filepath) {
+    if (importThreads_ <= 1 && cacheDir_.empty()) return false;
+
+    std::unordered_map<std::string, std::unique_ptr<Parser>> fragments;
+    size_t cacheHits = 0;
+    size_t cacheMisses = 0;
+    bool hit = false;
+    std::unique_ptr<Parser> mainFragment = obtainFragment(filepath, true, hit);
+    (hit ? cacheHits : cacheMisses)++;
+
+    // import 그래프를 따라 fragment를 스레드 풀에서 파싱 (한 파일은 한 번만)
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::string> queue;
+    size_t active = 0;
+    auto schedule = [&](const Parser& fragment) {
+        for (const auto& marker : fragment.importMarkers_) {
+            if (fragments.count(marker.absPath)) continue;
+            if (!std::filesystem::exists(marker.absPath)) continue;
+            fragments.emplace(marker.absPath, nullptr);
+            queue.push_back(marker.absPath);
+        }
+    };
+    schedule(*mainFragment);
+
+    const unsigned threadCount = std::max(1u, importThreads_);
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            cv.wait(lock, [&] { return !queue.empty() || active == 0; });
+            if (queue.empty()) return;
+            std::string path = std::move(queue.front());
+            queue.pop_front();
+            active++;
+            lock.unlock();
+            bool fragmentHit = false;
+            std::unique_ptr<Parser> fragment = obtainFragment(path, false, fragmentHit);
+            lock.lock();
+            (fragmentHit ? cacheHits : cacheMisses)++;
+            schedule(*fragment);
+            fragments[path] = std::move(fragment);
+            active--;
+            cv.notify_all();
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < threadCount; ++i) workers.emplace_back(worker);
+    worker();
+    for (auto& t : workers) t.join();
+
+    // 병합 중 pool 재할당(= stringMap_ 재구성)이 반복되지 않게 상한만큼 미리 잡는다
+    size_t poolTotal = mainFragment->story_.string_pool.size();
+    size_t nodeTotal = mainFragment->story_.nodes.size();
+    size_t instrTotal = mainFragment->instrLineMap_.size();
+    for (const auto& entry : fragments) {
+        if (!entry.second) continue;
+        poolTotal += entry.second->story_.string_pool.size();
+        nodeTotal += entry.second->story_.nodes.size();
+        instrTotal += entry.second->instrLineMap_.size();
+    }
+    story_.string_pool.reserve(poolTotal);
+    lineIds_.reserve(poolTotal);
+    rebuildStringMap();
+    story_.nodes.reserve(nodeTotal);
+    nodeSourceFiles_.reserve(nodeTotal);
+    nodeNames_.reserve(nodeTotal);
+    instrLineMap_.reserve(instrTotal);
+
+    // 직렬 순서로 병합 (parse()가 importedFiles_에 메인 파일을 이미 넣어 두었다)
+    if (mergeFragment(*mainFragment, fragments)) {
+        filename_ = filepath;
+        importStats_.threads = threadCount;
+        importStats_.parallel = true;
+        importStats_.cacheHits = cacheHits;
+        importStats_.cacheMisses = cacheMisses;
+        return true;
+    }
+
+    // 직렬로 다시 파싱할 수 있게 상태를 되돌린다 (이유와 캐시 통계는 남김)
+    std::string reason = fragmentIssue_;
+    resetState(filepath);
+    importedFiles_.insert(std::filesystem::absolute(filepath).string());
+    importStats_.fallbackReason = std::move(reason);
+    importStats_.cacheHits = cacheHits;
+    importStats_.cacheMisses = cacheMisses;
+    return false;
+}
+
+bool Parser::mergeFragment(Parser& fragment,
+                           std::unordered_map<std::string, std::unique_ptr<Parser>>& fragments) {
+    if (!fragment.fragmentIssue_.empty()) {
+        fragmentIssue_ = fragment.fragmentIssue_;
+        return false;
+    }
+    importStats_.files++;
+
+    std::vector<int32_t> idMap(fragment.story_.string_pool.size(), -1);
+    idMap[0] = 0;
+    std::vector<size_t> nodeMap(fragment.story_.nodes.size());
+    size_t eventPos = 0;
+    size_t errorPos = 0;
+    size_t warningPos = 0;
+    size_t nodePos = 0;
+
+    const PoolTools::PoolRefVisitor remap = [&](int32_t& id, PoolTools::PoolRefKind) {
+        if (id < 0) return;
+        if (static_cast<size_t>(id) < idMap.size() && idMap[id] >= 0) {
+            id = idMap[id];
+        } else {
+            fragmentIssue_ = fragment.filename_ + ": unresolved string reference while merging";
+        }
+    };
+
+    // 이벤트/에러/경고/노드를 import 지점까지 옮긴다
+    auto appendUntil = [&](size_t events, size_t errors, size_t warnings, size_t nodes) {
+        for (; eventPos < events; ++eventPos) {
+            const auto& ev = fragment.poolEvents_[eventPos];
+            // line id가 붙는 이벤트는 로컬 id마다 하나뿐이라 옮겨 와도 된다
+            std::string lineId = ev.withLineId ? std::move(fragment.lineIds_[ev.localId]) : std::string();
+            int32_t& mapped = idMap[ev.localId];
+            if (mapped >= 0) {
+                // 이미 옮긴 로컬 문자열의 빈 line id가 채워진 경우
+                if (!lineId.empty() && lineIds_[mapped].empty()) lineIds_[mapped] = std::move(lineId);
+                continue;
+            }
+            std::string& text = fragment.story_.string_pool[ev.localId];
+            // 전역 pool에 없는 문자열은 복사하지 않고 fragment에서 옮겨 온다
+            mapped = stringMap_.count(text) ? addStringWithId(text, lineId)
+                                            : appendString(std::move(text), std::move(lineId));
+        }
+        for (; errorPos < errors; ++errorPos) {
+            errors_.push_back(fragment.errors_[errorPos]);
+            if (error_.empty()) error_ = errors_.back();
+        }
+        for (; warningPos < warnings; ++warningPos) {
+            warnings_.push_back(fragment.warnings_[warningPos]);
+        }
+        for (; nodePos < nodes; ++nodePos) {
+            auto& node = fragment.story_.nodes[nodePos];
+            if (nodeNames_.count(node->name)) {
+                fragmentIssue_ = fragment.filename_ + ": label '" + node->name +
+                                 "' is also defined in another file";
+                return false;
+            }
+            PoolTools::visitNodePoolRefs(*node, remap);
+            nodeMap[nodePos] = story_.nodes.size();
+            story_.nodes.push_back(std::move(node));
+            nodeNames_.insert(story_.nodes.back()->name);
+            nodeSourceFiles_.push_back(fragment.nodeSourceFiles_[nodePos]);
+        }
+        return fragmentIssue_.empty();
+    };
+
+    for (const auto& marker : fragment.importMarkers_) {
+        if (!appendUntil(marker.poolEvents, marker.errors, marker.warnings, marker.nodes)) return false;
+
+        // parseSource의 import 처리와 같은 검사, 같은 순서
+        filename_ = fragment.filename_;
+        if (importedFiles_.count(marker.absPath)) {
+            addError(marker.lineNum, "circular import detected: " + marker.importPath);
+            continue;
+        }
+        if (!std::filesystem::exists(marker.absPath)) {
+            addError(marker.lineNum, "imported file not found: " + marker.importPath);
+            continue;
+        }
+        importedFiles_.insert(marker.absPath);
+        auto it = fragments.find(marker.absPath);
+        if (it == fragments.end() || !it->second) {
+            fragmentIssue_ = marker.absPath + ": imported file was not parsed";
+            return false;
+        }
+        if (!mergeFragment(*it->second, fragments)) return false;
+    }
+    if (!appendUntil(fragment.poolEvents_.size(), fragment.errors_.size(),
+                     fragment.warnings_.size(), fragment.story_.nodes.size())) {
+        return false;
+    }
+
+    // 노드 단위 부가 정보
+    for (const auto& entry : fragment.instrLineMap_) {
+        const size_t localNode = static_cast<size_t>(entry.first >> 32);
+        const size_t instrIdx = static_cast<size_t>(entry.first & 0xFFFFFFFFu);
+        if (localNode < nodeMap.size()) {
+            instrLineMap_[instrKey(nodeMap[localNode], instrIdx)] = entry.second;
+        }
+    }
+    for (int32_t localId : fragment.usedCharacters_) {
+        if (static_cast<size_t>(localId) < idMap.size() && idMap[localId] >= 0) {
+            usedCharacters_.insert(idMap[localId]);
+        }
+    }
+    definedCharacters_.insert(fragment.definedCharacters_.begin(), fragment.definedCharacters_.end());
+
+    // 전역 변수/캐릭터 정의는 첫 label 전에만 오므로 메인 파일에서만 나온다
+    for (auto& gv : fragment.story_.global_vars) {
+        PoolTools::visitSetVarPoolRefs(*gv, remap);
+        story_.global_vars.push_back(std::move(gv));
+    }
+    for (auto& ch : fragment.story_.characters) {
+        PoolTools::visitCharacterPoolRefs(*ch, remap);
+        story_.characters.push_back(std::move(ch));
+    }
+    if (fragment.isMainFile_ && fragment.startNodeSet_) {
+        story_.start_node_name = fragment.story_.start_node_name;
+        startNodeSet_ = true;
+    }
+    return fragmentIssue_.empty();
+}
+
+} // namespace Gyeol
@@ -0,0 +1,372 @@
+#include "gyeol_pool_tools.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol::PoolTools {
+
+namespace {
+
+constexpr PoolRefKind kStruct = PoolRefKind::STRUCTURAL;
+
+bool setError(std::string* errorOut, const std::string& message) {
+    if (errorOut) *errorOut = message;
+    return false;
+}
+
+void visitValue(ValueDataUnion& value, const PoolRefVisitor& visit) {
+    if (auto* ref = value.AsStringRef()) visit(ref->index, kStruct);
+    if (auto* list = value.AsListValue()) {
+        for (auto& item : list->items) visit(item, kStruct);
+    }
+}
+
+void visitExpr(ExpressionT* expr, const PoolRefVisitor& visit) {
+    if (!expr) return;
+    for (auto& token : expr->tokens) {
+        if (!token) continue;
+        visitValue(token->literal_value, visit);
+        visit(token->var_name_id, kStruct);
+    }
+}
+
+void visitTags(std::vector<std::unique_ptr<TagT>>& tags, const PoolRefVisitor& visit) {
+    for (auto& tag : tags) {
+        if (!tag) continue;
+        visit(tag->key_id, kStruct);
+        visit(tag->value_id, kStruct);
+    }
+}
+
+void visitInstruction(InstructionT& instr, const PoolRefVisitor& visit) {
+    switch (instr.data.type) {
+        case OpData::Line: {
+            auto* line = instr.data.AsLine();
+            visit(line->character_id, kStruct);
+            visit(line->text_id, PoolRefKind::TEXT);
+            visit(line->voice_asset_id, kStruct);
+            visitTags(line->tags, visit);
+            break;
+        }
+        case OpData::Choice: {
+            auto* choice = instr.data.AsChoice();
+            visit(choice->text_id, PoolRefKind::TEXT);
+            visit(choice->target_node_name_id, kStruct);
+            visit(choice->condition_var_id, kStruct);
+            break;
+        }
+        case OpData::Jump: {
+            auto* jump = instr.data.AsJump();
+            visit(jump->target_node_name_id, kStruct);
+            for (auto& arg : jump->arg_exprs) visitExpr(arg.get(), visit);
+            break;
+        }
+        case OpData::Command: {
+            auto* cmd = instr.data.AsCommand();
+            visit(cmd->type_id, kStruct);
+            for (auto& arg : cmd->args) {
+                if (arg) visit(arg->string_id, kStruct);
+            }
+            break;
+        }
+        case OpData::Wait:
+            visit(instr.data.AsWait()->tag_id, kStruct);
+            break;
+        case OpData::SetVar:
+            visitSetVarPoolRefs(*instr.data.AsSetVar(), visit);
+            break;
+        case OpData::Condition: {
+            auto* cond = instr.data.AsCondition();
+            visit(cond->var_name_id, kStruct);
+            visitValue(cond->compare_value, visit);
+            visit(cond->true_jump_node_id, kStruct);
+            visit(cond->false_jump_node_id, kStruct);
+            visitExpr(cond->lhs_expr.get(), visit);
+            visitExpr(cond->rhs_expr.get(), visit);
+            visitExpr(cond->cond_expr.get(), visit);
+            break;
+        }
+        case OpData::Random:
+            for (auto& branch : instr.data.AsRandom()->branches) {
+                if (branch) visit(branch->target_node_name_id, kStruct);
+            }
+            break;
+        case OpData::Return: {
+            auto* ret = instr.data.AsReturn();
+            visitExpr(ret->expr.get(), visit);
+            visitValue(ret->value, visit);
+            break;
+        }
+        case OpData::CallWithReturn: {
+            auto* cwr = instr.data.AsCallWithReturn();
+            visit(cwr->target_node_name_id, kStruct);
+            visit(cwr->return_var_name_id, kStruct);
+            for (auto& arg : cwr->arg_exprs) visitExpr(arg.get(), visit);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+// --- PoolCodec 부호화 (형식은 gyeol_pool_codec.h 참고) ---
+
+constexpr size_t kMinMatch = 4;
+constexpr size_t kMaxOffset = 65535;
+constexpr int kHashBits = 14;
+
+uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+uint32_t hash4(const uint8_t* p) {
+    return (read32(p) * 2654435761u) >> (32 - kHashBits);
+}
+
+void writeLength(std::vector<uint8_t>& out, size_t length) {
+    while (length >= 255) {
+        out.push_back(255);
+        length -= 255;
+    }
+    out.push_back(static_cast<uint8_t>(length));
+}
+
+void emitSequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalCount,
+                  size_t matchLength, size_t offset) {
+    const size_t matchCode = matchLength ? matchLength - kMinMatch : 0;
+    uint8_t token = static_cast<uint8_t>((literalCount >= 15 ? 15 : literalCount) << 4);
+    if (matchLength) token |= static_cast<uint8_t>(matchCode >= 15 ? 15 : matchCode);
+    out.push_back(token);
+    if (literalCount >= 15) writeLength(out, literalCount - 15);
+    out.insert(out.end(), literals, literals + literalCount);
+    if (!matchLength) return;
+    out.push_back(static_cast<uint8_t>(offset & 0xFF));
+    out.push_back(static_cast<uint8_t>(offset >> 8));
+    if (matchCode >= 15) writeLength(out, matchCode - 15);
+}
+
+std::vector<std::string> splitWords(const std::string& text) {
+    std::vector<std::string> words;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        while (pos < text.size() && text[pos] == ' ') ++pos;
+        size_t start = pos;
+        while (pos < text.size() && text[pos] != ' ') ++pos;
+        if (pos > start) words.push_back(text.substr(start, pos - start));
+    }
+    return words;
+}
+
+} // namespace
+
+void visitSetVarPoolRefs(SetVarT& setVar, const PoolRefVisitor& visit) {
+    visit(setVar.var_name_id, kStruct);
+    visitValue(setVar.value, visit);
+    visitExpr(setVar.expr.get(), visit);
+}
+
+void visitNodePoolRefs(NodeT& node, const PoolRefVisitor& visit) {
+    for (auto& pid : node.param_ids) visit(pid, kStruct);
+    visitTags(node.tags, visit);
+    for (auto& instr : node.lines) {
+        if (instr) visitInstruction(*instr, visit);
+    }
+    // 압축 레코드는 불변 struct라 값을 꺼내 방문한 뒤 다시 만든다
+    for (auto& rec : node.ops) {
+        int32_t a = rec.a();
+        int32_t c = rec.c();
+        switch (rec.op()) {
+            case CompactOp::Line: {
+                int32_t text = rec.b();
+                visit(a, kStruct);
+                visit(text, PoolRefKind::TEXT);
+                visit(c, kStruct);
+                rec = CompactInstr(rec.op(), rec.kind(), a, text, c);
+                continue;
+            }
+            case CompactOp::Jump:
+            case CompactOp::Wait:
+            case CompactOp::SetVar:
+                visit(a, kStruct);
+                break;
+            default:
+                continue;
+        }
+        rec = CompactInstr(rec.op(), rec.kind(), a, rec.b(), c);
+    }
+}
+
+void visitCharacterPoolRefs(CharacterDefT& character, const PoolRefVisitor& visit) {
+    visit(character.name_id, kStruct);
+    visitTags(character.properties, visit);
+}
+
+void visitStoryPoolRefs(StoryT& story, const PoolRefVisitor& visit) {
+    for (auto& gv : story.global_vars) {
+        if (gv) visitSetVarPoolRefs(*gv, visit);
+    }
+    for (auto& node : story.nodes) {
+        if (node) visitNodePoolRefs(*node, visit);
+    }
+    for (auto& ch : story.characters) {
+        if (ch) visitCharacterPoolRefs(*ch, visit);
+    }
+}
+
+void compressBlock(const uint8_t* src, size_t size,
+                   const uint8_t* dict, size_t dictSize,
+                   std::vector<uint8_t>& out) {
+    out.clear();
+    if (dictSize > kMaxOffset) {
+        dict += dictSize - kMaxOffset;
+        dictSize = kMaxOffset;
+    }
+
+    // dictionary + 입력을 하나의 히스토리로 보고 입력 부분만 부호화
+    std::vector<uint8_t> window(dictSize + size);
+    if (dictSize) std::memcpy(window.data(), dict, dictSize);
+    if (size) std::memcpy(window.data() + dictSize, src, size);
+    const uint8_t* base = window.data();
+    const size_t end = window.size();
+
+    std::vector<int64_t> table(size_t(1) << kHashBits, -1);
+    for (size_t i = 0; i + kMinMatch <= dictSize; ++i) {
+        table[hash4(base + i)] = static_cast<int64_t>(i);
+    }
+
+    size_t anchor = dictSize;
+    size_t pos = dictSize;
+    while (pos + kMinMatch <= end) {
+        const uint32_t h = hash4(base + pos);
+        const int64_t candidate = table[h];
+        table[h] = static_cast<int64_t>(pos);
+        if (candidate < 0 || pos - static_cast<size_t>(candidate) > kMaxOffset ||
+            read32(base + candidate) != read32(base + pos)) {
+            ++pos;
+            continue;
+        }
+
+        size_t length = kMinMatch;
+        while (pos + length < end && base[static_cast<size_t>(candidate) + length] == base[pos + length]) {
+            ++length;
+        }
+        emitSequence(out, base + anchor, pos - anchor, length, pos - static_cast<size_t>(candidate));
+        for (size_t i = pos + 1; i < pos + length && i + kMinMatch <= end; ++i) {
+            table[hash4(base + i)] = static_cast<int64_t>(i);
+        }
+        pos += length;
+        anchor = pos;
+    }
+    emitSequence(out, base + anchor, end - anchor, 0, 0);
+}
+
+std::vector<uint8_t> trainDictionary(const std::vector<std::string>& samples, size_t maxBytes) {
+    maxBytes = std::min(maxBytes, kMaxOffset);
+    if (maxBytes == 0) return {};
+
+    // 1~3 단어 n-gram 빈도 (std::map으로 순서 고정 → 결정적)
+    std::map<std::string, uint32_t> counts;
+    for (const auto& sample : samples) {
+        auto words = splitWords(sample);
+        for (size_t i = 0; i < words.size(); ++i) {
+            std::string gram;
+            for (size_t n = 0; n < 3 && i + n < words.size(); ++n) {
+                if (n) gram.push_back(' ');
+                gram += words[i + n];
+                if (gram.size() >= kMinMatch) counts[gram]++;
+            }
+        }
+    }
+
+    struct Candidate {
+        uint64_t score;
+        const std::string* text;
+    };
+    std::vector<Candidate> candidates;
+    for (const auto& [text, count] : counts) {
+        if (count < 2) continue;
+        candidates.push_back({static_cast<uint64_t>(count - 1) * text.size(), &text});
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const Candidate& a, const Candidate& b) { return a.score > b.score; });
+
+    // 점수 높은 항목이 데이터에 가깝도록 뒤쪽에 둔다
+    std::vector<const std::string*> chosen;
+    size_t total = 0;
+    std::string joined;
+    for (const auto& c : candidates) {
+        if (total + c.text->size() + 1 > maxBytes) continue;
+        if (joined.find(*c.text) != std::string::npos) continue;
+        chosen.push_back(c.text);
+        joined += *c.text;
+        joined.push_back(' ');
+        total += c.text->size() + 1;
+    }
+
+    std::vector<uint8_t> dict;
+    dict.reserve(total);
+    for (auto it = chosen.rbegin(); it != chosen.rend(); ++it) {
+        dict.insert(dict.end(), (*it)->begin(), (*it)->end());
+        dict.push_back(' ');
+    }
+    return dict;
+}
+
+bool compressStringPool(StoryT& story, const PoolCompressionOptions& options, std::string* errorOut) {
+    if (story.compressed_pool) return setError(errorOut, "String pool is already compressed.");
+    if (options.blockBytes == 0) return setError(errorOut, "Compressed pool block size must be positive.");
+
+    // TEXT로만 쓰이는 항목만 압축 (이름/리터럴과 공유되는 문자열은 그대로 둔다)
+    const size_t poolSize = story.string_pool.size();
+    std::vector<uint8_t> textRef(poolSize, 0);
+    std::vector<uint8_t> structRef(poolSize, 0);
+    visitStoryPoolRefs(story, [&](int32_t& id, PoolRefKind kind) {
+        if (id < 0 || static_cast<size_t>(id) >= poolSize) return;
+        (kind == PoolRefKind::TEXT ? textRef : structRef)[static_cast<size_t>(id)] = 1;
+    });
+
+    std::vector<int32_t> entries;
+    std::vector<std::string> samples;
+    for (size_t i = 0; i < poolSize; ++i) {
+        if (!textRef[i] || structRef[i] || story.string_pool[i].empty()) continue;
+        if (story.string_pool[i].find('\0') != std::string::npos) continue;
+        entries.push_back(static_cast<int32_t>(i));
+        samples.push_back(story.string_pool[i]);
+    }
+    if (entries.empty()) return true;
+
+    auto pool = std::make_unique<CompressedStringPoolT>();
+    pool->codec = 1;
+    pool->dictionary = trainDictionary(samples, options.dictionaryBytes);
+    pool->entries = entries;
+
+    std::vector<uint8_t> raw;
+    std::vector<uint8_t> packed;
+    auto flush = [&]() {
+        compressBlock(raw.data(), raw.size(), pool->dictionary.data(), pool->dictionary.size(), packed);
+        pool->block_offsets.push_back(static_cast<uint32_t>(pool->data.size()));
+        pool->block_raw_sizes.push_back(static_cast<uint32_t>(raw.size()));
+        pool->data.insert(pool->data.end(), packed.begin(), packed.end());
+        raw.clear();
+    };
+    for (size_t e = 0; e < entries.size(); ++e) {
+        if (raw.empty()) pool->block_first_entry.push_back(static_cast<uint32_t>(e));
+        auto& text = story.string_pool[static_cast<size_t>(entries[e])];
+        raw.insert(raw.end(), text.begin(), text.end());
+        raw.push_back('\0');
+        text.clear();
+        if (raw.size() >= options.blockBytes) flush();
+    }
+    if (!raw.empty()) flush();
+    pool->block_offsets.push_back(static_cast<uint32_t>(pool->data.size()));
+
+    story.compressed_pool = std::move(pool);
+    return true;
+}
+
+} // namespace Gyeol::PoolTools
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "gyeol_generated.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Gyeol::PoolTools {
+
+// String Pool 참조 종류: TEXT = 대사/선택지 텍스트, 나머지(이름, 태그, 리터럴 등)는 STRUCTURAL
+enum class PoolRefKind { STRUCTURAL, TEXT };
+using PoolRefVisitor = std::function<void(int32_t& id, PoolRefKind kind)>;
+
+// 노드/SetVar/캐릭터/스토리 전체의 모든 String Pool 참조를 방문한다 (id 수정 가능).
+void visitNodePoolRefs(ICPDev::Gyeol::Schema::NodeT& node, const PoolRefVisitor& visit);
+void visitSetVarPoolRefs(ICPDev::Gyeol::Schema::SetVarT& setVar, const PoolRefVisitor& visit);
+void visitCharacterPoolRefs(ICPDev::Gyeol::Schema::CharacterDefT& character, const PoolRefVisitor& visit);
+void visitStoryPoolRefs(ICPDev::Gyeol::Schema::StoryT& story, const PoolRefVisitor& visit);
+
+struct PoolCompressionOptions {
+    size_t blockBytes = 4096;      // 블록 하나의 목표 압축 해제 크기
+    size_t dictionaryBytes = 0;    // 0이면 사전 없음 (최대 65535)
+};
+
+// PoolCodec 형식으로 블록 하나를 압축한다 (런타임 PoolCodec::decompress와 짝).
+void compressBlock(const uint8_t* src, size_t size,
+                   const uint8_t* dict, size_t dictSize,
+                   std::vector<uint8_t>& out);
+
+// 텍스트 샘플에서 자주 나오는 단어 n-gram으로 공용 사전을 만든다 (결정적).
+std::vector<uint8_t> trainDictionary(const std::vector<std::string>& samples, size_t maxBytes);
+
+// TEXT로만 참조되는 string_pool 항목을 compressed_pool 블록으로 옮기고 원래 자리는 비운다.
+// 압축할 텍스트가 없으면 story를 바꾸지 않고 true를 반환한다.
+bool compressStringPool(ICPDev::Gyeol::Schema::StoryT& story,
+                        const PoolCompressionOptions& options = {},
+                        std::string* errorOut = nullptr);
+
+} // namespace Gyeol::PoolTools
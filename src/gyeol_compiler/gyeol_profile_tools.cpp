@@ -0,0 +1,162 @@
+#include "gyeol_profile_tools.h"
+
+#include <algorithm>
+#include <memory>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol::ProfileTools {
+
+namespace {
+
+bool setError(std::string* errorOut, const std::string& message) {
+    if (errorOut) *errorOut = message;
+    return false;
+}
+
+bool readCount(const nlohmann::json& entry, const char* key, uint64_t& out) {
+    const auto it = entry.find(key);
+    if (it == entry.end() || !it->is_number_integer() || it->get<int64_t>() < 0) return false;
+    out = it->get<uint64_t>();
+    return true;
+}
+
+// 최댓값 기준 hot 문턱 (최소 minCount)
+uint64_t hotThreshold(uint64_t maxCount, const ProfileOptions& options) {
+    const auto scaled = static_cast<uint64_t>(static_cast<double>(maxCount) * options.hotRatio);
+    return std::max<uint64_t>({scaled, options.minCount, 1});
+}
+
+} // namespace
+
+bool mergePlayProfile(const nlohmann::json& profile, PlayProfile& outProfile, std::string* errorOut) {
+    if (!profile.is_object() || profile.value("format", "") != "gyeol-play-profile") {
+        return setError(errorOut, "profile format must be 'gyeol-play-profile'");
+    }
+    const auto nodes = profile.find("nodes");
+    if (nodes == profile.end() || !nodes->is_array()) {
+        return setError(errorOut, "profile.nodes must be an array");
+    }
+
+    // 검사를 모두 통과한 뒤에 더한다 (실패하면 outProfile은 그대로)
+    PlayProfile session;
+    for (const auto& entry : *nodes) {
+        if (!entry.is_object() || !entry.contains("node") || !entry["node"].is_string()) {
+            return setError(errorOut, "profile node entry must have a string 'node'");
+        }
+        const std::string name = entry["node"].get<std::string>();
+        auto& stats = session.nodes[name];
+        uint64_t visits = 0;
+        if (!readCount(entry, "visits", visits)) {
+            return setError(errorOut, "profile node entry must have a non-negative 'visits': " + name);
+        }
+        stats.visits += visits;
+
+        if (entry.contains("branches")) {
+            const auto& branches = entry["branches"];
+            if (!branches.is_array()) return setError(errorOut, "profile branches must be an array: " + name);
+            for (const auto& branch : branches) {
+                if (!branch.is_object() || !branch.contains("taken") || !branch["taken"].is_array()) {
+                    return setError(errorOut, "profile branch entry must have a 'taken' array: " + name);
+                }
+            }
+        }
+        if (entry.contains("calls")) {
+            const auto& calls = entry["calls"];
+            if (!calls.is_array()) return setError(errorOut, "profile calls must be an array: " + name);
+            for (const auto& call : calls) {
+                uint64_t count = 0;
+                if (!call.is_object() || !call.contains("target") || !call["target"].is_string() ||
+                    !readCount(call, "count", count)) {
+                    return setError(errorOut, "profile call entry must have 'target' and 'count': " + name);
+                }
+                stats.calls[call["target"].get<std::string>()] += count;
+            }
+        }
+        if (entry.contains("interpolations")) {
+            const auto& interpolations = entry["interpolations"];
+            if (!interpolations.is_array()) return setError(errorOut, "profile interpolations must be an array: " + name);
+            for (const auto& interp : interpolations) {
+                uint64_t count = 0;
+                if (!interp.is_object() || !interp.contains("text") || !interp["text"].is_string() ||
+                    !readCount(interp, "count", count)) {
+                    return setError(errorOut, "profile interpolation entry must have 'text' and 'count': " + name);
+                }
+                stats.interpolations[interp["text"].get<std::string>()] += count;
+            }
+        }
+    }
+
+    for (auto& [name, stats] : session.nodes) {
+        auto& merged = outProfile.nodes[name];
+        merged.visits += stats.visits;
+        for (const auto& [target, count] : stats.calls) merged.calls[target] += count;
+        for (const auto& [text, count] : stats.interpolations) merged.interpolations[text] += count;
+    }
+    outProfile.sessions++;
+    return true;
+}
+
+std::unordered_map<std::string, uint64_t> nodeWeights(const PlayProfile& profile) {
+    std::unordered_map<std::string, uint64_t> weights;
+    for (const auto& [name, stats] : profile.nodes) {
+        if (stats.visits > 0) weights[name] = stats.visits;
+    }
+    return weights;
+}
+
+std::unordered_set<std::string> hotNodes(const PlayProfile& profile, const ProfileOptions& options) {
+    uint64_t maxVisits = 0;
+    for (const auto& [name, stats] : profile.nodes) maxVisits = std::max(maxVisits, stats.visits);
+    const uint64_t threshold = hotThreshold(maxVisits, options);
+    std::unordered_set<std::string> hot;
+    for (const auto& [name, stats] : profile.nodes) {
+        if (stats.visits >= threshold) hot.insert(name);
+    }
+    return hot;
+}
+
+std::unordered_set<std::string> hotCallTargets(const PlayProfile& profile, const ProfileOptions& options) {
+    std::unordered_map<std::string, uint64_t> totals;
+    uint64_t maxCalls = 0;
+    for (const auto& [name, stats] : profile.nodes) {
+        for (const auto& [target, count] : stats.calls) {
+            maxCalls = std::max(maxCalls, totals[target] += count);
+        }
+    }
+    const uint64_t threshold = hotThreshold(maxCalls, options);
+    std::unordered_set<std::string> hot;
+    for (const auto& [target, count] : totals) {
+        if (count >= threshold) hot.insert(target);
+    }
+    return hot;
+}
+
+size_t markHotTemplates(StoryT& story, const PlayProfile& profile, const ProfileOptions& options) {
+    if (story.compressed_pool) return 0;
+    uint64_t maxCount = 0;
+    for (const auto& [name, stats] : profile.nodes) {
+        for (const auto& [text, count] : stats.interpolations) maxCount = std::max(maxCount, count);
+    }
+    const uint64_t threshold = hotThreshold(maxCount, options);
+
+    const auto poolSize = static_cast<int32_t>(story.string_pool.size());
+    size_t marked = 0;
+    for (auto& node : story.nodes) {
+        if (!node) continue;
+        auto stats = profile.nodes.find(node->name);
+        if (stats == profile.nodes.end() || stats->second.interpolations.empty()) continue;
+        for (auto& instr : node->lines) {
+            if (!instr || instr->data.type != OpData::Line) continue;
+            auto* line = instr->data.AsLine();
+            if (line->hot_template || line->text_id < 0 || line->text_id >= poolSize) continue;
+            auto hit = stats->second.interpolations.find(story.string_pool[line->text_id]);
+            if (hit == stats->second.interpolations.end() || hit->second < threshold) continue;
+            line->hot_template = true;
+            marked++;
+        }
+    }
+    return marked;
+}
+
+} // namespace Gyeol::ProfileTools
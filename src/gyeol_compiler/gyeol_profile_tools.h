@@ -0,0 +1,49 @@
+#pragma once
+
+#include "gyeol_generated.h"
+#include <nlohmann/json.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Gyeol::ProfileTools {
+
+// Runner::exportPlayProfileJson()(format "gyeol-play-profile")을 여러 세션 합친 것
+struct PlayProfile {
+    struct NodeStats {
+        uint64_t visits = 0;
+        std::map<std::string, uint64_t> calls;          // 호출 대상 노드 → 횟수
+        std::map<std::string, uint64_t> interpolations; // 보간한 대사 원문 → 횟수
+    };
+    std::map<std::string, NodeStats> nodes;
+    size_t sessions = 0;
+};
+
+// 범주(방문/호출/보간)별 최댓값의 hotRatio 이상이고 minCount 이상이면 hot
+struct ProfileOptions {
+    double hotRatio = 0.05;
+    uint64_t minCount = 2;
+};
+
+// 플레이 프로파일 JSON 하나를 outProfile에 더한다 (분기 결과는 형식만 검사하고 쓰지 않음)
+bool mergePlayProfile(const nlohmann::json& profile, PlayProfile& outProfile,
+                      std::string* errorOut = nullptr);
+
+// LayoutOptions::nodeWeights용 노드 방문 수
+std::unordered_map<std::string, uint64_t> nodeWeights(const PlayProfile& profile);
+
+// 방문 수가 hot인 노드 이름
+std::unordered_set<std::string> hotNodes(const PlayProfile& profile, const ProfileOptions& options = {});
+
+// 호출 횟수(모든 호출 자리 합)가 hot인 call 대상 노드 이름
+std::unordered_set<std::string> hotCallTargets(const PlayProfile& profile, const ProfileOptions& options = {});
+
+// 보간 횟수가 hot인 대사에 Line.hot_template을 켠다. 노드 이름 + 원문(text_id의 pool 문자열)으로 찾는다.
+// 반환값: 표시한 Line 수. 압축된 pool(compressed_pool)에서는 원문을 비교할 수 없어 0 (압축 전에 호출).
+size_t markHotTemplates(ICPDev::Gyeol::Schema::StoryT& story, const PlayProfile& profile,
+                        const ProfileOptions& options = {});
+
+} // namespace Gyeol::ProfileTools
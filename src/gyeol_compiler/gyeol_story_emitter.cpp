@@ -0,0 +1,121 @@
+#include "gyeol_story_emitter.h"
+#include "gyeol_story_linker.h"
+
+#include <string_view>
+#include <unordered_map>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol {
+
+namespace {
+
+// 아직 모르는 노드 인덱스 (기본값 -1과 달라야 필드가 버퍼에 쓰인다)
+constexpr int32_t kPendingNodeIndex = -2;
+
+// 생성 코드에 mutate_ 접근자가 없어 Table::SetField로 제자리 수정한다 (필드가 버퍼에 있어야 함)
+template <typename T>
+void setIndexField(const T* table, flatbuffers::voffset_t field, int32_t value) {
+    reinterpret_cast<flatbuffers::Table*>(const_cast<T*>(table))->SetField<int32_t>(field, value, -1);
+}
+
+} // namespace
+
+void StoryEmitter::emitNode(NodeT& node) {
+    for (auto& instr : node.lines) {
+        if (!instr) continue;
+        StoryLinker::forEachTargetField(*instr, [](int32_t nameId, int32_t& index) {
+            index = nameId >= 0 ? kPendingNodeIndex : -1;
+        });
+    }
+    names_.push_back(node.name);
+    nodes_.push_back(CreateNode(builder_, &node));
+}
+
+std::vector<uint8_t> StoryEmitter::finish(const StoryT& header) {
+    auto& fbb = builder_;
+    // 필드 값/생략 규칙은 생성된 CreateStory(StoryT)와 같게 맞춘다 (nodes만 미리 쓴 오프셋)
+    auto version = header.version.empty() ? 0 : fbb.CreateString(header.version);
+    auto stringPool = header.string_pool.empty() ? 0 : fbb.CreateVectorOfStrings(header.string_pool);
+    auto lineIds = header.line_ids.empty() ? 0 : fbb.CreateVectorOfStrings(header.line_ids);
+    auto globalVars = header.global_vars.empty() ? 0 :
+        fbb.CreateVector<flatbuffers::Offset<SetVar>>(header.global_vars.size(), [&](size_t i) {
+            return CreateSetVar(fbb, header.global_vars[i].get());
+        });
+    auto nodes = nodes_.empty() ? 0 : fbb.CreateVector(nodes_);
+    auto startNode = header.start_node_name.empty() ? 0 : fbb.CreateString(header.start_node_name);
+    auto characters = header.characters.empty() ? 0 :
+        fbb.CreateVector<flatbuffers::Offset<CharacterDef>>(header.characters.size(), [&](size_t i) {
+            return CreateCharacterDef(fbb, header.characters[i].get());
+        });
+    auto compressedPool = header.compressed_pool ?
+        CreateCompressedStringPool(fbb, header.compressed_pool.get()) : 0;
+    auto nameTable = StoryLinker::buildNodeNameTable(names_);
+    auto nodeNames = nameTable ? CreateNodeNameTable(fbb, nameTable.get()) : 0;
+    fbb.Finish(CreateStory(fbb, version, stringPool, lineIds, globalVars, nodes, startNode,
+                           characters, compressedPool, nodeNames));
+
+    std::vector<uint8_t> out(fbb.GetBufferPointer(), fbb.GetBufferPointer() + fbb.GetSize());
+    fbb.Clear();
+    nodes_.clear();
+    linkNodeIndices(out, header);
+    names_.clear();
+    return out;
+}
+
+// emitNode가 자리 표시한 *_node_index를 실제 인덱스로 고친다
+void StoryEmitter::linkNodeIndices(std::vector<uint8_t>& buffer, const StoryT& header) const {
+    std::unordered_map<std::string_view, int32_t> byName;
+    for (size_t i = 0; i < names_.size(); ++i) {
+        byName.emplace(names_[i], static_cast<int32_t>(i));
+    }
+    auto resolve = [&](int32_t nameId) -> int32_t {
+        if (nameId < 0 || static_cast<size_t>(nameId) >= header.string_pool.size()) return -1;
+        auto it = byName.find(header.string_pool[nameId]);
+        return it != byName.end() ? it->second : -1;
+    };
+
+    const Story* story = GetStory(buffer.data());
+    if (!story->nodes()) return;
+    for (const Node* node : *story->nodes()) {
+        if (!node->lines()) continue;
+        for (const Instruction* instr : *node->lines()) {
+            switch (instr->data_type()) {
+                case OpData::Choice: {
+                    auto* choice = instr->data_as_Choice();
+                    setIndexField(choice, Choice::VT_TARGET_NODE_INDEX, resolve(choice->target_node_name_id()));
+                    break;
+                }
+                case OpData::Jump: {
+                    auto* jump = instr->data_as_Jump();
+                    setIndexField(jump, Jump::VT_TARGET_NODE_INDEX, resolve(jump->target_node_name_id()));
+                    break;
+                }
+                case OpData::Condition: {
+                    auto* cond = instr->data_as_Condition();
+                    setIndexField(cond, Condition::VT_TRUE_JUMP_NODE_INDEX, resolve(cond->true_jump_node_id()));
+                    setIndexField(cond, Condition::VT_FALSE_JUMP_NODE_INDEX, resolve(cond->false_jump_node_id()));
+                    break;
+                }
+                case OpData::Random: {
+                    auto* branches = instr->data_as_Random()->branches();
+                    if (!branches) break;
+                    for (const RandomBranch* branch : *branches) {
+                        setIndexField(branch, RandomBranch::VT_TARGET_NODE_INDEX,
+                                      resolve(branch->target_node_name_id()));
+                    }
+                    break;
+                }
+                case OpData::CallWithReturn: {
+                    auto* cwr = instr->data_as_CallWithReturn();
+                    setIndexField(cwr, CallWithReturn::VT_TARGET_NODE_INDEX, resolve(cwr->target_node_name_id()));
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+} // namespace Gyeol
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "gyeol_generated.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Gyeol {
+
+// .gyb 스트리밍 출력기: 노드가 완성되는 대로 FlatBufferBuilder에 바로 쓴다.
+// 호출자는 emitNode() 뒤에 노드의 명령 트리를 버릴 수 있어 StoryT 전체를 들고 있지 않아도 된다.
+// 바이트 배치는 Story::Pack과 다르지만 UnPack하면 같은 StoryT가 된다.
+// 앞으로 나올 노드를 가리키는 *_node_index는 finish()에서 버퍼를 제자리 수정해 채운다
+// (linkStory와 같은 결과).
+class StoryEmitter {
+public:
+    // 점프 대상의 *_node_index에 자리 표시 값을 넣고 쓴다 (node를 고침)
+    void emitNode(ICPDev::Gyeol::Schema::NodeT& node);
+    size_t emittedNodes() const { return nodes_.size(); }
+
+    // 헤더(version/string_pool/line_ids/global_vars/start_node_name/characters/compressed_pool)로
+    // 루트를 닫고 버퍼를 돌려준다. header.nodes는 읽지 않는다. 호출 후 emitter는 비워진다.
+    std::vector<uint8_t> finish(const ICPDev::Gyeol::Schema::StoryT& header);
+
+private:
+    void linkNodeIndices(std::vector<uint8_t>& buffer, const ICPDev::Gyeol::Schema::StoryT& header) const;
+
+    flatbuffers::FlatBufferBuilder builder_;
+    std::vector<flatbuffers::Offset<ICPDev::Gyeol::Schema::Node>> nodes_;
+    std::vector<std::string> names_; // 쓴 노드 이름 (nodes 순서)
+};
+
+} // namespace Gyeol
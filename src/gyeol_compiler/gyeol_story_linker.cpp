@@ -0,0 +1,109 @@
+#include "gyeol_story_linker.h"
+#include "gyeol_node_names.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string_view>
+#include <unordered_map>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol::StoryLinker {
+
+namespace {
+
+// 버킷 하나에 시도할 최대 시드 수 (넘으면 표 없이 이름 비교로 동작)
+constexpr uint32_t kMaxSeedAttempts = 1u << 16;
+
+} // namespace
+
+std::unique_ptr<NodeNameTableT> buildNodeNameTable(const std::vector<std::string>& names) {
+    std::unordered_map<std::string_view, int32_t> seen;
+    std::vector<std::pair<std::string_view, int32_t>> entries;
+    for (size_t i = 0; i < names.size(); ++i) {
+        if (seen.emplace(names[i], static_cast<int32_t>(i)).second) {
+            entries.emplace_back(names[i], static_cast<int32_t>(i));
+        }
+    }
+    if (entries.empty()) return nullptr;
+
+    // 버킷당 평균 2개, 적재율 약 0.8
+    const size_t bucketCount = std::max<size_t>(1, entries.size() / 2);
+    const size_t slotCount = entries.size() + entries.size() / 4 + 1;
+    std::vector<std::vector<size_t>> buckets(bucketCount);
+    for (size_t e = 0; e < entries.size(); ++e) {
+        buckets[NodeNameHash::hash(entries[e].first, 0) % bucketCount].push_back(e);
+    }
+
+    // 큰 버킷부터 빈 슬롯에 배치 (stable_sort라 같은 입력이면 같은 표)
+    std::vector<size_t> order(bucketCount);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    auto table = std::make_unique<NodeNameTableT>();
+    table->seeds.assign(bucketCount, 0);
+    table->slots.assign(slotCount, -1);
+    std::vector<size_t> placed;
+    for (size_t b : order) {
+        const auto& bucket = buckets[b];
+        if (bucket.empty()) break;
+        bool ok = false;
+        for (uint32_t seed = 1; seed <= kMaxSeedAttempts && !ok; ++seed) {
+            placed.clear();
+            ok = true;
+            for (size_t e : bucket) {
+                const size_t slot = NodeNameHash::hash(entries[e].first, seed) % slotCount;
+                if (table->slots[slot] != -1 || std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+                    ok = false;
+                    break;
+                }
+                placed.push_back(slot);
+            }
+            if (ok) {
+                table->seeds[b] = seed;
+                for (size_t k = 0; k < bucket.size(); ++k) {
+                    table->slots[placed[k]] = entries[bucket[k]].second;
+                }
+            }
+        }
+        if (!ok) return nullptr;
+    }
+    return table;
+}
+
+void linkStory(StoryT& story) {
+    std::vector<std::string> names;
+    names.reserve(story.nodes.size());
+    std::unordered_map<std::string_view, int32_t> byName;
+    for (const auto& node : story.nodes) {
+        names.push_back(node ? node->name : std::string());
+    }
+    for (size_t i = 0; i < names.size(); ++i) {
+        byName.emplace(names[i], static_cast<int32_t>(i));
+    }
+
+    const int32_t poolSize = static_cast<int32_t>(story.string_pool.size());
+    auto resolve = [&](int32_t nameId) -> int32_t {
+        if (nameId < 0 || nameId >= poolSize) return -1;
+        auto it = byName.find(story.string_pool[nameId]);
+        return it != byName.end() ? it->second : -1;
+    };
+    for (auto& node : story.nodes) {
+        if (!node) continue;
+        for (auto& instr : node->lines) {
+            if (!instr) continue;
+            forEachTargetField(*instr, [&](int32_t nameId, int32_t& index) {
+                index = resolve(nameId);
+            });
+        }
+        for (auto& rec : node->ops) {
+            if (rec.op() != CompactOp::Jump) continue;
+            rec = CompactInstr(rec.op(), rec.kind(), rec.a(), resolve(rec.a()), rec.c());
+        }
+    }
+    story.node_names = buildNodeNameTable(names);
+}
+
+} // namespace Gyeol::StoryLinker
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "gyeol_generated.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Gyeol::StoryLinker {
+
+// 명령 하나의 (이름 id, 인덱스 필드) 쌍을 모두 방문한다 (const InstructionT면 읽기 전용)
+template <typename Instr, typename Fn>
+void forEachTargetField(Instr& instr, Fn&& fn) {
+    using namespace ICPDev::Gyeol::Schema;
+    switch (instr.data.type) {
+        case OpData::Choice: {
+            auto* choice = instr.data.AsChoice();
+            fn(choice->target_node_name_id, choice->target_node_index);
+            break;
+        }
+        case OpData::Jump: {
+            auto* jump = instr.data.AsJump();
+            fn(jump->target_node_name_id, jump->target_node_index);
+            break;
+        }
+        case OpData::Condition: {
+            auto* cond = instr.data.AsCondition();
+            fn(cond->true_jump_node_id, cond->true_jump_node_index);
+            fn(cond->false_jump_node_id, cond->false_jump_node_index);
+            break;
+        }
+        case OpData::Random:
+            for (auto& branch : instr.data.AsRandom()->branches) {
+                if (branch) fn(branch->target_node_name_id, branch->target_node_index);
+            }
+            break;
+        case OpData::CallWithReturn: {
+            auto* cwr = instr.data.AsCallWithReturn();
+            fn(cwr->target_node_name_id, cwr->target_node_index);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+// 노드 이름 목록(nodes 순서)으로 완전 해시 표를 만든다.
+// 같은 이름이 여럿이면 첫 번째 노드를 가리킨다 (런타임 이름 검색과 같음).
+// 시드를 찾지 못하면 nullptr (런타임은 이름을 순차 비교한다).
+std::unique_ptr<ICPDev::Gyeol::Schema::NodeNameTableT> buildNodeNameTable(const std::vector<std::string>& names);
+
+// 명령의 모든 점프 대상 *_node_index(압축 Jump 레코드 포함)와 story.node_names를 다시 계산한다.
+// 이 스토리에 없는 대상(청크 밖 노드 등)은 -1로 남아 런타임이 이름으로 찾는다.
+// .gyb를 쓰기 직전에 호출한다 (UnPack한 스토리를 고친 뒤에도 다시 호출해야 함).
+void linkStory(ICPDev::Gyeol::Schema::StoryT& story);
+
+} // namespace Gyeol::StoryLinker
@@ -109,6 +109,8 @@ struct Instruction;
 struct InstructionBuilder;
 struct InstructionT;
 
+struct CompactInstr;
+
 struct Node;
 struct NodeBuilder;
 struct NodeT;
@@ -137,10 +139,49 @@ struct SaveState;
 struct SaveStateBuilder;
 struct SaveStateT;
 
+struct CompiledLocaleProperty;
+struct CompiledLocalePropertyBuilder;
+struct CompiledLocalePropertyT;
+
+struct CompiledLocaleCharacter;
+struct CompiledLocaleCharacterBuilder;
+struct CompiledLocaleCharacterT;
+
+struct CompiledLocale;
+struct CompiledLocaleBuilder;
+struct CompiledLocaleT;
+
+struct CompiledLocaleCatalog;
+struct CompiledLocaleCatalogBuilder;
+struct CompiledLocaleCatalogT;
+
+struct StoryChunkEntry;
+struct StoryChunkEntryBuilder;
+struct StoryChunkEntryT;
+
+struct StoryChunkIndex;
+struct StoryChunkIndexBuilder;
+struct StoryChunkIndexT;
+
+struct CompressedStringPool;
+struct CompressedStringPoolBuilder;
+struct CompressedStringPoolT;
+
+struct NodeNameTable;
+struct NodeNameTableBuilder;
+struct NodeNameTableT;
+
 struct Story;
 struct StoryBuilder;
 struct StoryT;
 
+struct FragmentImportMarker;
+struct FragmentImportMarkerBuilder;
+struct FragmentImportMarkerT;
+
+struct ParsedFragment;
+struct ParsedFragmentBuilder;
+struct ParsedFragmentT;
 enum class Operator : int8_t {
   Equal = 0,
   NotEqual = 1,
@@ -757,11 +798,13 @@ enum class ExprOp : int8_t {
   PushVisited = 18,
   ListContains = 19,
   ListLength = 20,
+  SkipIfFalse = 21,
+  SkipIfTrue = 22,
   MIN = PushLiteral,
-  MAX = ListLength
+  MAX = SkipIfTrue
 };
 
-inline const ExprOp (&EnumValuesExprOp())[21] {
+inline const ExprOp (&EnumValuesExprOp())[23] {
   static const ExprOp values[] = {
     ExprOp::PushLiteral,
     ExprOp::PushVar,
@@ -783,13 +826,15 @@ inline const ExprOp (&EnumValuesExprOp())[21] {
     ExprOp::PushVisitCount,
     ExprOp::PushVisited,
     ExprOp::ListContains,
-    ExprOp::ListLength
+    ExprOp::ListLength,
+    ExprOp::SkipIfFalse,
+    ExprOp::SkipIfTrue
   };
   return values;
 }
 
 inline const char * const *EnumNamesExprOp() {
-  static const char * const names[22] = {
+  static const char * const names[24] = {
     "PushLiteral",
     "PushVar",
     "Add",
@@ -811,17 +856,107 @@ inline const char * const *EnumNamesExprOp() {
     "PushVisited",
     "ListContains",
     "ListLength",
+    "SkipIfFalse",
+    "SkipIfTrue",
     nullptr
   };
   return names;
 }
 
 inline const char *EnumNameExprOp(ExprOp e) {
-  if (::flatbuffers::IsOutRange(e, ExprOp::PushLiteral, ExprOp::ListLength)) return "";
+  if (::flatbuffers::IsOutRange(e, ExprOp::PushLiteral, ExprOp::SkipIfTrue)) return "";
   const size_t index = static_cast<size_t>(e);
   return EnumNamesExprOp()[index];
 }
 
+enum class CompactOp : uint8_t {
+  Table = 0,
+  Line = 1,
+  Jump = 2,
+  Wait = 3,
+  Yield = 4,
+  SetVar = 5,
+  MIN = Table,
+  MAX = SetVar
+};
+
+inline const CompactOp (&EnumValuesCompactOp())[6] {
+  static const CompactOp values[] = {
+    CompactOp::Table,
+    CompactOp::Line,
+    CompactOp::Jump,
+    CompactOp::Wait,
+    CompactOp::Yield,
+    CompactOp::SetVar
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesCompactOp() {
+  static const char * const names[7] = {
+    "Table",
+    "Line",
+    "Jump",
+    "Wait",
+    "Yield",
+    "SetVar",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameCompactOp(CompactOp e) {
+  if (::flatbuffers::IsOutRange(e, CompactOp::Table, CompactOp::SetVar)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesCompactOp()[index];
+}
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) CompactInstr FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint8_t op_;
+  uint8_t kind_;
+  int16_t padding0__;
+  int32_t a_;
+  int32_t b_;
+  int32_t c_;
+
+ public:
+  CompactInstr()
+      : op_(0),
+        kind_(0),
+        padding0__(0),
+        a_(0),
+        b_(0),
+        c_(0) {
+    (void)padding0__;
+  }
+  CompactInstr(ICPDev::Gyeol::Schema::CompactOp _op, uint8_t _kind, int32_t _a, int32_t _b, int32_t _c)
+      : op_(::flatbuffers::EndianScalar(static_cast<uint8_t>(_op))),
+        kind_(::flatbuffers::EndianScalar(_kind)),
+        padding0__(0),
+        a_(::flatbuffers::EndianScalar(_a)),
+        b_(::flatbuffers::EndianScalar(_b)),
+        c_(::flatbuffers::EndianScalar(_c)) {
+    (void)padding0__;
+  }
+  ICPDev::Gyeol::Schema::CompactOp op() const {
+    return static_cast<ICPDev::Gyeol::Schema::CompactOp>(::flatbuffers::EndianScalar(op_));
+  }
+  uint8_t kind() const {
+    return ::flatbuffers::EndianScalar(kind_);
+  }
+  int32_t a() const {
+    return ::flatbuffers::EndianScalar(a_);
+  }
+  int32_t b() const {
+    return ::flatbuffers::EndianScalar(b_);
+  }
+  int32_t c() const {
+    return ::flatbuffers::EndianScalar(c_);
+  }
+};
+FLATBUFFERS_STRUCT_END(CompactInstr, 16);
+
 struct BoolValueT : public ::flatbuffers::NativeTable {
   typedef BoolValue TableType;
   bool val = false;
@@ -1197,6 +1332,7 @@ struct LineT : public ::flatbuffers::NativeTable {
   int32_t text_id = 0;
   int32_t voice_asset_id = -1;
   std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::TagT>> tags{};
+  bool hot_template = false;
   LineT() = default;
   LineT(const LineT &o);
   LineT(LineT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -1211,7 +1347,8 @@ struct Line FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_CHARACTER_ID = 4,
     VT_TEXT_ID = 6,
     VT_VOICE_ASSET_ID = 8,
-    VT_TAGS = 10
+    VT_TAGS = 10,
+    VT_HOT_TEMPLATE = 12
   };
   int32_t character_id() const {
     return GetField<int32_t>(VT_CHARACTER_ID, -1);
@@ -1225,6 +1362,9 @@ struct Line FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>> *tags() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>> *>(VT_TAGS);
   }
+  bool hot_template() const {
+    return GetField<uint8_t>(VT_HOT_TEMPLATE, 0) != 0;
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int32_t>(verifier, VT_CHARACTER_ID, 4) &&
@@ -1233,6 +1373,7 @@ struct Line FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyOffset(verifier, VT_TAGS) &&
            verifier.VerifyVector(tags()) &&
            verifier.VerifyVectorOfTables(tags()) &&
+           VerifyField<uint8_t>(verifier, VT_HOT_TEMPLATE, 1) &&
            verifier.EndTable();
   }
   LineT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -1256,6 +1397,9 @@ struct LineBuilder {
   void add_tags(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>>> tags) {
     fbb_.AddOffset(Line::VT_TAGS, tags);
   }
+  void add_hot_template(bool hot_template) {
+    fbb_.AddElement<uint8_t>(Line::VT_HOT_TEMPLATE, static_cast<uint8_t>(hot_template), 0);
+  }
   explicit LineBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -1272,12 +1416,14 @@ inline ::flatbuffers::Offset<Line> CreateLine(
     int32_t character_id = -1,
     int32_t text_id = 0,
     int32_t voice_asset_id = -1,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>>> tags = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>>> tags = 0,
+    bool hot_template = false) {
   LineBuilder builder_(_fbb);
   builder_.add_tags(tags);
   builder_.add_voice_asset_id(voice_asset_id);
   builder_.add_text_id(text_id);
   builder_.add_character_id(character_id);
+  builder_.add_hot_template(hot_template);
   return builder_.Finish();
 }
 
@@ -1291,14 +1437,16 @@ inline ::flatbuffers::Offset<Line> CreateLineDirect(
     int32_t character_id = -1,
     int32_t text_id = 0,
     int32_t voice_asset_id = -1,
-    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>> *tags = nullptr) {
+    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>> *tags = nullptr,
+    bool hot_template = false) {
   auto tags__ = tags ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>>(*tags) : 0;
   return ICPDev::Gyeol::Schema::CreateLine(
       _fbb,
       character_id,
       text_id,
       voice_asset_id,
-      tags__);
+      tags__,
+      hot_template);
 }
 
 ::flatbuffers::Offset<Line> CreateLine(::flatbuffers::FlatBufferBuilder &_fbb, const LineT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -1309,6 +1457,7 @@ struct ChoiceT : public ::flatbuffers::NativeTable {
   int32_t target_node_name_id = 0;
   int32_t condition_var_id = -1;
   ICPDev::Gyeol::Schema::ChoiceModifier choice_modifier = ICPDev::Gyeol::Schema::ChoiceModifier::Default;
+  int32_t target_node_index = -1;
 };
 
 struct Choice FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
@@ -1319,7 +1468,8 @@ struct Choice FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_TEXT_ID = 4,
     VT_TARGET_NODE_NAME_ID = 6,
     VT_CONDITION_VAR_ID = 8,
-    VT_CHOICE_MODIFIER = 10
+    VT_CHOICE_MODIFIER = 10,
+    VT_TARGET_NODE_INDEX = 12
   };
   int32_t text_id() const {
     return GetField<int32_t>(VT_TEXT_ID, 0);
@@ -1333,12 +1483,16 @@ struct Choice FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   ICPDev::Gyeol::Schema::ChoiceModifier choice_modifier() const {
     return static_cast<ICPDev::Gyeol::Schema::ChoiceModifier>(GetField<int8_t>(VT_CHOICE_MODIFIER, 0));
   }
+  int32_t target_node_index() const {
+    return GetField<int32_t>(VT_TARGET_NODE_INDEX, -1);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int32_t>(verifier, VT_TEXT_ID, 4) &&
            VerifyField<int32_t>(verifier, VT_TARGET_NODE_NAME_ID, 4) &&
            VerifyField<int32_t>(verifier, VT_CONDITION_VAR_ID, 4) &&
            VerifyField<int8_t>(verifier, VT_CHOICE_MODIFIER, 1) &&
+           VerifyField<int32_t>(verifier, VT_TARGET_NODE_INDEX, 4) &&
            verifier.EndTable();
   }
   ChoiceT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -1362,6 +1516,9 @@ struct ChoiceBuilder {
   void add_choice_modifier(ICPDev::Gyeol::Schema::ChoiceModifier choice_modifier) {
     fbb_.AddElement<int8_t>(Choice::VT_CHOICE_MODIFIER, static_cast<int8_t>(choice_modifier), 0);
   }
+  void add_target_node_index(int32_t target_node_index) {
+    fbb_.AddElement<int32_t>(Choice::VT_TARGET_NODE_INDEX, target_node_index, -1);
+  }
   explicit ChoiceBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -1378,8 +1535,10 @@ inline ::flatbuffers::Offset<Choice> CreateChoice(
     int32_t text_id = 0,
     int32_t target_node_name_id = 0,
     int32_t condition_var_id = -1,
-    ICPDev::Gyeol::Schema::ChoiceModifier choice_modifier = ICPDev::Gyeol::Schema::ChoiceModifier::Default) {
+    ICPDev::Gyeol::Schema::ChoiceModifier choice_modifier = ICPDev::Gyeol::Schema::ChoiceModifier::Default,
+    int32_t target_node_index = -1) {
   ChoiceBuilder builder_(_fbb);
+  builder_.add_target_node_index(target_node_index);
   builder_.add_condition_var_id(condition_var_id);
   builder_.add_target_node_name_id(target_node_name_id);
   builder_.add_text_id(text_id);
@@ -1399,6 +1558,7 @@ struct JumpT : public ::flatbuffers::NativeTable {
   int32_t target_node_name_id = 0;
   bool is_call = false;
   std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT>> arg_exprs{};
+  int32_t target_node_index = -1;
   JumpT() = default;
   JumpT(const JumpT &o);
   JumpT(JumpT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -1412,7 +1572,8 @@ struct Jump FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_TARGET_NODE_NAME_ID = 4,
     VT_IS_CALL = 6,
-    VT_ARG_EXPRS = 8
+    VT_ARG_EXPRS = 8,
+    VT_TARGET_NODE_INDEX = 10
   };
   int32_t target_node_name_id() const {
     return GetField<int32_t>(VT_TARGET_NODE_NAME_ID, 0);
@@ -1423,6 +1584,9 @@ struct Jump FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>> *arg_exprs() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>> *>(VT_ARG_EXPRS);
   }
+  int32_t target_node_index() const {
+    return GetField<int32_t>(VT_TARGET_NODE_INDEX, -1);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int32_t>(verifier, VT_TARGET_NODE_NAME_ID, 4) &&
@@ -1430,6 +1594,7 @@ struct Jump FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyOffset(verifier, VT_ARG_EXPRS) &&
            verifier.VerifyVector(arg_exprs()) &&
            verifier.VerifyVectorOfTables(arg_exprs()) &&
+           VerifyField<int32_t>(verifier, VT_TARGET_NODE_INDEX, 4) &&
            verifier.EndTable();
   }
   JumpT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -1450,6 +1615,9 @@ struct JumpBuilder {
   void add_arg_exprs(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>>> arg_exprs) {
     fbb_.AddOffset(Jump::VT_ARG_EXPRS, arg_exprs);
   }
+  void add_target_node_index(int32_t target_node_index) {
+    fbb_.AddElement<int32_t>(Jump::VT_TARGET_NODE_INDEX, target_node_index, -1);
+  }
   explicit JumpBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -1465,8 +1633,10 @@ inline ::flatbuffers::Offset<Jump> CreateJump(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     int32_t target_node_name_id = 0,
     bool is_call = false,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>>> arg_exprs = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>>> arg_exprs = 0,
+    int32_t target_node_index = -1) {
   JumpBuilder builder_(_fbb);
+  builder_.add_target_node_index(target_node_index);
   builder_.add_arg_exprs(arg_exprs);
   builder_.add_target_node_name_id(target_node_name_id);
   builder_.add_is_call(is_call);
@@ -1482,13 +1652,15 @@ inline ::flatbuffers::Offset<Jump> CreateJumpDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     int32_t target_node_name_id = 0,
     bool is_call = false,
-    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>> *arg_exprs = nullptr) {
+    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>> *arg_exprs = nullptr,
+    int32_t target_node_index = -1) {
   auto arg_exprs__ = arg_exprs ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>>(*arg_exprs) : 0;
   return ICPDev::Gyeol::Schema::CreateJump(
       _fbb,
       target_node_name_id,
       is_call,
-      arg_exprs__);
+      arg_exprs__,
+      target_node_index);
 }
 
 ::flatbuffers::Offset<Jump> CreateJump(::flatbuffers::FlatBufferBuilder &_fbb, const JumpT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -1789,6 +1961,7 @@ struct ExprTokenT : public ::flatbuffers::NativeTable {
   ICPDev::Gyeol::Schema::ExprOp op = ICPDev::Gyeol::Schema::ExprOp::PushLiteral;
   ICPDev::Gyeol::Schema::ValueDataUnion literal_value{};
   int32_t var_name_id = -1;
+  int32_t skip = 0;
 };
 
 struct ExprToken FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
@@ -1799,7 +1972,8 @@ struct ExprToken FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_OP = 4,
     VT_LITERAL_VALUE_TYPE = 6,
     VT_LITERAL_VALUE = 8,
-    VT_VAR_NAME_ID = 10
+    VT_VAR_NAME_ID = 10,
+    VT_SKIP = 12
   };
   ICPDev::Gyeol::Schema::ExprOp op() const {
     return static_cast<ICPDev::Gyeol::Schema::ExprOp>(GetField<int8_t>(VT_OP, 0));
@@ -1829,6 +2003,9 @@ struct ExprToken FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   int32_t var_name_id() const {
     return GetField<int32_t>(VT_VAR_NAME_ID, -1);
   }
+  int32_t skip() const {
+    return GetField<int32_t>(VT_SKIP, 0);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_OP, 1) &&
@@ -1836,6 +2013,7 @@ struct ExprToken FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyOffset(verifier, VT_LITERAL_VALUE) &&
            VerifyValueData(verifier, literal_value(), literal_value_type()) &&
            VerifyField<int32_t>(verifier, VT_VAR_NAME_ID, 4) &&
+           VerifyField<int32_t>(verifier, VT_SKIP, 4) &&
            verifier.EndTable();
   }
   ExprTokenT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -1879,6 +2057,9 @@ struct ExprTokenBuilder {
   void add_var_name_id(int32_t var_name_id) {
     fbb_.AddElement<int32_t>(ExprToken::VT_VAR_NAME_ID, var_name_id, -1);
   }
+  void add_skip(int32_t skip) {
+    fbb_.AddElement<int32_t>(ExprToken::VT_SKIP, skip, 0);
+  }
   explicit ExprTokenBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -1895,8 +2076,10 @@ inline ::flatbuffers::Offset<ExprToken> CreateExprToken(
     ICPDev::Gyeol::Schema::ExprOp op = ICPDev::Gyeol::Schema::ExprOp::PushLiteral,
     ICPDev::Gyeol::Schema::ValueData literal_value_type = ICPDev::Gyeol::Schema::ValueData::NONE,
     ::flatbuffers::Offset<void> literal_value = 0,
-    int32_t var_name_id = -1) {
+    int32_t var_name_id = -1,
+    int32_t skip = 0) {
   ExprTokenBuilder builder_(_fbb);
+  builder_.add_skip(skip);
   builder_.add_var_name_id(var_name_id);
   builder_.add_literal_value(literal_value);
   builder_.add_literal_value_type(literal_value_type);
@@ -2137,6 +2320,8 @@ struct ConditionT : public ::flatbuffers::NativeTable {
   std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT> lhs_expr{};
   std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT> rhs_expr{};
   std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT> cond_expr{};
+  int32_t true_jump_node_index = -1;
+  int32_t false_jump_node_index = -1;
   ConditionT() = default;
   ConditionT(const ConditionT &o);
   ConditionT(ConditionT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -2156,7 +2341,9 @@ struct Condition FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_FALSE_JUMP_NODE_ID = 14,
     VT_LHS_EXPR = 16,
     VT_RHS_EXPR = 18,
-    VT_COND_EXPR = 20
+    VT_COND_EXPR = 20,
+    VT_TRUE_JUMP_NODE_INDEX = 22,
+    VT_FALSE_JUMP_NODE_INDEX = 24
   };
   int32_t var_name_id() const {
     return GetField<int32_t>(VT_VAR_NAME_ID, 0);
@@ -2201,6 +2388,12 @@ struct Condition FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ICPDev::Gyeol::Schema::Expression *cond_expr() const {
     return GetPointer<const ICPDev::Gyeol::Schema::Expression *>(VT_COND_EXPR);
   }
+  int32_t true_jump_node_index() const {
+    return GetField<int32_t>(VT_TRUE_JUMP_NODE_INDEX, -1);
+  }
+  int32_t false_jump_node_index() const {
+    return GetField<int32_t>(VT_FALSE_JUMP_NODE_INDEX, -1);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int32_t>(verifier, VT_VAR_NAME_ID, 4) &&
@@ -2216,6 +2409,8 @@ struct Condition FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            verifier.VerifyTable(rhs_expr()) &&
            VerifyOffset(verifier, VT_COND_EXPR) &&
            verifier.VerifyTable(cond_expr()) &&
+           VerifyField<int32_t>(verifier, VT_TRUE_JUMP_NODE_INDEX, 4) &&
+           VerifyField<int32_t>(verifier, VT_FALSE_JUMP_NODE_INDEX, 4) &&
            verifier.EndTable();
   }
   ConditionT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -2274,6 +2469,12 @@ struct ConditionBuilder {
   void add_cond_expr(::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression> cond_expr) {
     fbb_.AddOffset(Condition::VT_COND_EXPR, cond_expr);
   }
+  void add_true_jump_node_index(int32_t true_jump_node_index) {
+    fbb_.AddElement<int32_t>(Condition::VT_TRUE_JUMP_NODE_INDEX, true_jump_node_index, -1);
+  }
+  void add_false_jump_node_index(int32_t false_jump_node_index) {
+    fbb_.AddElement<int32_t>(Condition::VT_FALSE_JUMP_NODE_INDEX, false_jump_node_index, -1);
+  }
   explicit ConditionBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -2295,8 +2496,12 @@ inline ::flatbuffers::Offset<Condition> CreateCondition(
     int32_t false_jump_node_id = 0,
     ::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression> lhs_expr = 0,
     ::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression> rhs_expr = 0,
-    ::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression> cond_expr = 0) {
+    ::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression> cond_expr = 0,
+    int32_t true_jump_node_index = -1,
+    int32_t false_jump_node_index = -1) {
   ConditionBuilder builder_(_fbb);
+  builder_.add_false_jump_node_index(false_jump_node_index);
+  builder_.add_true_jump_node_index(true_jump_node_index);
   builder_.add_cond_expr(cond_expr);
   builder_.add_rhs_expr(rhs_expr);
   builder_.add_lhs_expr(lhs_expr);
@@ -2320,6 +2525,7 @@ struct RandomBranchT : public ::flatbuffers::NativeTable {
   typedef RandomBranch TableType;
   int32_t target_node_name_id = 0;
   int32_t weight = 1;
+  int32_t target_node_index = -1;
 };
 
 struct RandomBranch FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
@@ -2328,7 +2534,8 @@ struct RandomBranch FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   struct Traits;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_TARGET_NODE_NAME_ID = 4,
-    VT_WEIGHT = 6
+    VT_WEIGHT = 6,
+    VT_TARGET_NODE_INDEX = 8
   };
   int32_t target_node_name_id() const {
     return GetField<int32_t>(VT_TARGET_NODE_NAME_ID, 0);
@@ -2336,10 +2543,14 @@ struct RandomBranch FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   int32_t weight() const {
     return GetField<int32_t>(VT_WEIGHT, 1);
   }
+  int32_t target_node_index() const {
+    return GetField<int32_t>(VT_TARGET_NODE_INDEX, -1);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int32_t>(verifier, VT_TARGET_NODE_NAME_ID, 4) &&
            VerifyField<int32_t>(verifier, VT_WEIGHT, 4) &&
+           VerifyField<int32_t>(verifier, VT_TARGET_NODE_INDEX, 4) &&
            verifier.EndTable();
   }
   RandomBranchT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -2357,6 +2568,9 @@ struct RandomBranchBuilder {
   void add_weight(int32_t weight) {
     fbb_.AddElement<int32_t>(RandomBranch::VT_WEIGHT, weight, 1);
   }
+  void add_target_node_index(int32_t target_node_index) {
+    fbb_.AddElement<int32_t>(RandomBranch::VT_TARGET_NODE_INDEX, target_node_index, -1);
+  }
   explicit RandomBranchBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -2371,8 +2585,10 @@ struct RandomBranchBuilder {
 inline ::flatbuffers::Offset<RandomBranch> CreateRandomBranch(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     int32_t target_node_name_id = 0,
-    int32_t weight = 1) {
+    int32_t weight = 1,
+    int32_t target_node_index = -1) {
   RandomBranchBuilder builder_(_fbb);
+  builder_.add_target_node_index(target_node_index);
   builder_.add_weight(weight);
   builder_.add_target_node_name_id(target_node_name_id);
   return builder_.Finish();
@@ -2584,6 +2800,7 @@ struct CallWithReturnT : public ::flatbuffers::NativeTable {
   int32_t target_node_name_id = 0;
   int32_t return_var_name_id = 0;
   std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT>> arg_exprs{};
+  int32_t target_node_index = -1;
   CallWithReturnT() = default;
   CallWithReturnT(const CallWithReturnT &o);
   CallWithReturnT(CallWithReturnT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -2597,7 +2814,8 @@ struct CallWithReturn FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_TARGET_NODE_NAME_ID = 4,
     VT_RETURN_VAR_NAME_ID = 6,
-    VT_ARG_EXPRS = 8
+    VT_ARG_EXPRS = 8,
+    VT_TARGET_NODE_INDEX = 10
   };
   int32_t target_node_name_id() const {
     return GetField<int32_t>(VT_TARGET_NODE_NAME_ID, 0);
@@ -2608,6 +2826,9 @@ struct CallWithReturn FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>> *arg_exprs() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>> *>(VT_ARG_EXPRS);
   }
+  int32_t target_node_index() const {
+    return GetField<int32_t>(VT_TARGET_NODE_INDEX, -1);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int32_t>(verifier, VT_TARGET_NODE_NAME_ID, 4) &&
@@ -2615,6 +2836,7 @@ struct CallWithReturn FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyOffset(verifier, VT_ARG_EXPRS) &&
            verifier.VerifyVector(arg_exprs()) &&
            verifier.VerifyVectorOfTables(arg_exprs()) &&
+           VerifyField<int32_t>(verifier, VT_TARGET_NODE_INDEX, 4) &&
            verifier.EndTable();
   }
   CallWithReturnT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -2635,6 +2857,9 @@ struct CallWithReturnBuilder {
   void add_arg_exprs(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>>> arg_exprs) {
     fbb_.AddOffset(CallWithReturn::VT_ARG_EXPRS, arg_exprs);
   }
+  void add_target_node_index(int32_t target_node_index) {
+    fbb_.AddElement<int32_t>(CallWithReturn::VT_TARGET_NODE_INDEX, target_node_index, -1);
+  }
   explicit CallWithReturnBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -2650,8 +2875,10 @@ inline ::flatbuffers::Offset<CallWithReturn> CreateCallWithReturn(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     int32_t target_node_name_id = 0,
     int32_t return_var_name_id = 0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>>> arg_exprs = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>>> arg_exprs = 0,
+    int32_t target_node_index = -1) {
   CallWithReturnBuilder builder_(_fbb);
+  builder_.add_target_node_index(target_node_index);
   builder_.add_arg_exprs(arg_exprs);
   builder_.add_return_var_name_id(return_var_name_id);
   builder_.add_target_node_name_id(target_node_name_id);
@@ -2667,13 +2894,15 @@ inline ::flatbuffers::Offset<CallWithReturn> CreateCallWithReturnDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     int32_t target_node_name_id = 0,
     int32_t return_var_name_id = 0,
-    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>> *arg_exprs = nullptr) {
+    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>> *arg_exprs = nullptr,
+    int32_t target_node_index = -1) {
   auto arg_exprs__ = arg_exprs ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>>(*arg_exprs) : 0;
   return ICPDev::Gyeol::Schema::CreateCallWithReturn(
       _fbb,
       target_node_name_id,
       return_var_name_id,
-      arg_exprs__);
+      arg_exprs__,
+      target_node_index);
 }
 
 ::flatbuffers::Offset<CallWithReturn> CreateCallWithReturn(::flatbuffers::FlatBufferBuilder &_fbb, const CallWithReturnT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -2917,6 +3146,7 @@ struct NodeT : public ::flatbuffers::NativeTable {
   std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::InstructionT>> lines{};
   std::vector<int32_t> param_ids{};
   std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::TagT>> tags{};
+  std::vector<ICPDev::Gyeol::Schema::CompactInstr> ops{};
   NodeT() = default;
   NodeT(const NodeT &o);
   NodeT(NodeT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -2931,7 +3161,8 @@ struct Node FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_NAME = 4,
     VT_LINES = 6,
     VT_PARAM_IDS = 8,
-    VT_TAGS = 10
+    VT_TAGS = 10,
+    VT_OPS = 12
   };
   const ::flatbuffers::String *name() const {
     return GetPointer<const ::flatbuffers::String *>(VT_NAME);
@@ -2957,6 +3188,9 @@ struct Node FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>> *tags() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>> *>(VT_TAGS);
   }
+  const ::flatbuffers::Vector<const ICPDev::Gyeol::Schema::CompactInstr *> *ops() const {
+    return GetPointer<const ::flatbuffers::Vector<const ICPDev::Gyeol::Schema::CompactInstr *> *>(VT_OPS);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_NAME) &&
@@ -2969,6 +3203,8 @@ struct Node FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyOffset(verifier, VT_TAGS) &&
            verifier.VerifyVector(tags()) &&
            verifier.VerifyVectorOfTables(tags()) &&
+           VerifyOffset(verifier, VT_OPS) &&
+           verifier.VerifyVector(ops()) &&
            verifier.EndTable();
   }
   NodeT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -2992,6 +3228,9 @@ struct NodeBuilder {
   void add_tags(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>>> tags) {
     fbb_.AddOffset(Node::VT_TAGS, tags);
   }
+  void add_ops(::flatbuffers::Offset<::flatbuffers::Vector<const ICPDev::Gyeol::Schema::CompactInstr *>> ops) {
+    fbb_.AddOffset(Node::VT_OPS, ops);
+  }
   explicit NodeBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -3009,8 +3248,10 @@ inline ::flatbuffers::Offset<Node> CreateNode(
     ::flatbuffers::Offset<::flatbuffers::String> name = 0,
     ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Instruction>>> lines = 0,
     ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> param_ids = 0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>>> tags = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>>> tags = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const ICPDev::Gyeol::Schema::CompactInstr *>> ops = 0) {
   NodeBuilder builder_(_fbb);
+  builder_.add_ops(ops);
   builder_.add_tags(tags);
   builder_.add_param_ids(param_ids);
   builder_.add_lines(lines);
@@ -3028,17 +3269,20 @@ inline ::flatbuffers::Offset<Node> CreateNodeDirect(
     const char *name = nullptr,
     const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Instruction>> *lines = nullptr,
     const std::vector<int32_t> *param_ids = nullptr,
-    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>> *tags = nullptr) {
+    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>> *tags = nullptr,
+    const std::vector<ICPDev::Gyeol::Schema::CompactInstr> *ops = nullptr) {
   auto name__ = name ? _fbb.CreateString(name) : 0;
   auto lines__ = lines ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Instruction>>(*lines) : 0;
   auto param_ids__ = param_ids ? _fbb.CreateVector<int32_t>(*param_ids) : 0;
   auto tags__ = tags ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>>(*tags) : 0;
+  auto ops__ = ops ? _fbb.CreateVectorOfStructs<ICPDev::Gyeol::Schema::CompactInstr>(*ops) : 0;
   return ICPDev::Gyeol::Schema::CreateNode(
       _fbb,
       name__,
       lines__,
       param_ids__,
-      tags__);
+      tags__,
+      ops__);
 }
 
 ::flatbuffers::Offset<Node> CreateNode(::flatbuffers::FlatBufferBuilder &_fbb, const NodeT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -3923,176 +4167,1548 @@ inline ::flatbuffers::Offset<SaveState> CreateSaveStateDirect(
 
 ::flatbuffers::Offset<SaveState> CreateSaveState(::flatbuffers::FlatBufferBuilder &_fbb, const SaveStateT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
-struct StoryT : public ::flatbuffers::NativeTable {
-  typedef Story TableType;
-  std::string version{};
-  std::vector<std::string> string_pool{};
-  std::vector<std::string> line_ids{};
-  std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::SetVarT>> global_vars{};
-  std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::NodeT>> nodes{};
-  std::string start_node_name{};
-  std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::CharacterDefT>> characters{};
-  StoryT() = default;
-  StoryT(const StoryT &o);
-  StoryT(StoryT&&) FLATBUFFERS_NOEXCEPT = default;
-  StoryT &operator=(StoryT o) FLATBUFFERS_NOEXCEPT;
+struct CompiledLocalePropertyT : public ::flatbuffers::NativeTable {
+  typedef CompiledLocaleProperty TableType;
+  std::string key{};
+  std::string value{};
 };
 
-struct Story FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
-  typedef StoryT NativeTableType;
-  typedef StoryBuilder Builder;
+struct CompiledLocaleProperty FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef CompiledLocalePropertyT NativeTableType;
+  typedef CompiledLocalePropertyBuilder Builder;
   struct Traits;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_VERSION = 4,
-    VT_STRING_POOL = 6,
-    VT_LINE_IDS = 8,
-    VT_GLOBAL_VARS = 10,
-    VT_NODES = 12,
-    VT_START_NODE_NAME = 14,
-    VT_CHARACTERS = 16
+    VT_KEY = 4,
+    VT_VALUE = 6
   };
-  const ::flatbuffers::String *version() const {
-    return GetPointer<const ::flatbuffers::String *>(VT_VERSION);
+  const ::flatbuffers::String *key() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_KEY);
   }
-  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *string_pool() const {
-    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_STRING_POOL);
+  const ::flatbuffers::String *value() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_VALUE);
   }
-  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *line_ids() const {
-    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_LINE_IDS);
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_KEY) &&
+           verifier.VerifyString(key()) &&
+           VerifyOffset(verifier, VT_VALUE) &&
+           verifier.VerifyString(value()) &&
+           verifier.EndTable();
   }
-  const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::SetVar>> *global_vars() const {
-    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::SetVar>> *>(VT_GLOBAL_VARS);
+  CompiledLocalePropertyT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(CompiledLocalePropertyT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<CompiledLocaleProperty> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocalePropertyT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct CompiledLocalePropertyBuilder {
+  typedef CompiledLocaleProperty Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_key(::flatbuffers::Offset<::flatbuffers::String> key) {
+    fbb_.AddOffset(CompiledLocaleProperty::VT_KEY, key);
   }
-  const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Node>> *nodes() const {
-    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Node>> *>(VT_NODES);
+  void add_value(::flatbuffers::Offset<::flatbuffers::String> value) {
+    fbb_.AddOffset(CompiledLocaleProperty::VT_VALUE, value);
   }
-  const ::flatbuffers::String *start_node_name() const {
-    return GetPointer<const ::flatbuffers::String *>(VT_START_NODE_NAME);
+  explicit CompiledLocalePropertyBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
   }
-  const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>> *characters() const {
-    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>> *>(VT_CHARACTERS);
+  ::flatbuffers::Offset<CompiledLocaleProperty> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<CompiledLocaleProperty>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<CompiledLocaleProperty> CreateCompiledLocaleProperty(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> key = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> value = 0) {
+  CompiledLocalePropertyBuilder builder_(_fbb);
+  builder_.add_value(value);
+  builder_.add_key(key);
+  return builder_.Finish();
+}
+
+struct CompiledLocaleProperty::Traits {
+  using type = CompiledLocaleProperty;
+  static auto constexpr Create = CreateCompiledLocaleProperty;
+};
+
+inline ::flatbuffers::Offset<CompiledLocaleProperty> CreateCompiledLocalePropertyDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *key = nullptr,
+    const char *value = nullptr) {
+  auto key__ = key ? _fbb.CreateString(key) : 0;
+  auto value__ = value ? _fbb.CreateString(value) : 0;
+  return ICPDev::Gyeol::Schema::CreateCompiledLocaleProperty(
+      _fbb,
+      key__,
+      value__);
+}
+
+::flatbuffers::Offset<CompiledLocaleProperty> CreateCompiledLocaleProperty(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocalePropertyT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct CompiledLocaleCharacterT : public ::flatbuffers::NativeTable {
+  typedef CompiledLocaleCharacter TableType;
+  std::string character_id{};
+  std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::CompiledLocalePropertyT>> properties{};
+  CompiledLocaleCharacterT() = default;
+  CompiledLocaleCharacterT(const CompiledLocaleCharacterT &o);
+  CompiledLocaleCharacterT(CompiledLocaleCharacterT&&) FLATBUFFERS_NOEXCEPT = default;
+  CompiledLocaleCharacterT &operator=(CompiledLocaleCharacterT o) FLATBUFFERS_NOEXCEPT;
+};
+
+struct CompiledLocaleCharacter FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef CompiledLocaleCharacterT NativeTableType;
+  typedef CompiledLocaleCharacterBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CHARACTER_ID = 4,
+    VT_PROPERTIES = 6
+  };
+  const ::flatbuffers::String *character_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_CHARACTER_ID);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleProperty>> *properties() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleProperty>> *>(VT_PROPERTIES);
   }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyOffset(verifier, VT_VERSION) &&
-           verifier.VerifyString(version()) &&
-           VerifyOffset(verifier, VT_STRING_POOL) &&
-           verifier.VerifyVector(string_pool()) &&
-           verifier.VerifyVectorOfStrings(string_pool()) &&
-           VerifyOffset(verifier, VT_LINE_IDS) &&
-           verifier.VerifyVector(line_ids()) &&
-           verifier.VerifyVectorOfStrings(line_ids()) &&
-           VerifyOffset(verifier, VT_GLOBAL_VARS) &&
-           verifier.VerifyVector(global_vars()) &&
-           verifier.VerifyVectorOfTables(global_vars()) &&
-           VerifyOffset(verifier, VT_NODES) &&
-           verifier.VerifyVector(nodes()) &&
-           verifier.VerifyVectorOfTables(nodes()) &&
-           VerifyOffset(verifier, VT_START_NODE_NAME) &&
-           verifier.VerifyString(start_node_name()) &&
-           VerifyOffset(verifier, VT_CHARACTERS) &&
-           verifier.VerifyVector(characters()) &&
-           verifier.VerifyVectorOfTables(characters()) &&
+           VerifyOffset(verifier, VT_CHARACTER_ID) &&
+           verifier.VerifyString(character_id()) &&
+           VerifyOffset(verifier, VT_PROPERTIES) &&
+           verifier.VerifyVector(properties()) &&
+           verifier.VerifyVectorOfTables(properties()) &&
            verifier.EndTable();
   }
-  StoryT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  void UnPackTo(StoryT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
-  static ::flatbuffers::Offset<Story> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const StoryT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  CompiledLocaleCharacterT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(CompiledLocaleCharacterT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<CompiledLocaleCharacter> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocaleCharacterT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
-struct StoryBuilder {
-  typedef Story Table;
+struct CompiledLocaleCharacterBuilder {
+  typedef CompiledLocaleCharacter Table;
   ::flatbuffers::FlatBufferBuilder &fbb_;
   ::flatbuffers::uoffset_t start_;
-  void add_version(::flatbuffers::Offset<::flatbuffers::String> version) {
-    fbb_.AddOffset(Story::VT_VERSION, version);
+  void add_character_id(::flatbuffers::Offset<::flatbuffers::String> character_id) {
+    fbb_.AddOffset(CompiledLocaleCharacter::VT_CHARACTER_ID, character_id);
   }
-  void add_string_pool(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> string_pool) {
-    fbb_.AddOffset(Story::VT_STRING_POOL, string_pool);
+  void add_properties(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleProperty>>> properties) {
+    fbb_.AddOffset(CompiledLocaleCharacter::VT_PROPERTIES, properties);
   }
-  void add_line_ids(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> line_ids) {
-    fbb_.AddOffset(Story::VT_LINE_IDS, line_ids);
+  explicit CompiledLocaleCharacterBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
   }
-  void add_global_vars(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::SetVar>>> global_vars) {
-    fbb_.AddOffset(Story::VT_GLOBAL_VARS, global_vars);
+  ::flatbuffers::Offset<CompiledLocaleCharacter> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<CompiledLocaleCharacter>(end);
+    return o;
   }
-  void add_nodes(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Node>>> nodes) {
-    fbb_.AddOffset(Story::VT_NODES, nodes);
+};
+
+inline ::flatbuffers::Offset<CompiledLocaleCharacter> CreateCompiledLocaleCharacter(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> character_id = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleProperty>>> properties = 0) {
+  CompiledLocaleCharacterBuilder builder_(_fbb);
+  builder_.add_properties(properties);
+  builder_.add_character_id(character_id);
+  return builder_.Finish();
+}
+
+struct CompiledLocaleCharacter::Traits {
+  using type = CompiledLocaleCharacter;
+  static auto constexpr Create = CreateCompiledLocaleCharacter;
+};
+
+inline ::flatbuffers::Offset<CompiledLocaleCharacter> CreateCompiledLocaleCharacterDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *character_id = nullptr,
+    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleProperty>> *properties = nullptr) {
+  auto character_id__ = character_id ? _fbb.CreateString(character_id) : 0;
+  auto properties__ = properties ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleProperty>>(*properties) : 0;
+  return ICPDev::Gyeol::Schema::CreateCompiledLocaleCharacter(
+      _fbb,
+      character_id__,
+      properties__);
+}
+
+::flatbuffers::Offset<CompiledLocaleCharacter> CreateCompiledLocaleCharacter(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocaleCharacterT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct CompiledLocaleT : public ::flatbuffers::NativeTable {
+  typedef CompiledLocale TableType;
+  std::string locale{};
+  std::vector<std::string> fallback_chain{};
+  std::vector<int32_t> line_text_ids{};
+  std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::CompiledLocaleCharacterT>> characters{};
+  CompiledLocaleT() = default;
+  CompiledLocaleT(const CompiledLocaleT &o);
+  CompiledLocaleT(CompiledLocaleT&&) FLATBUFFERS_NOEXCEPT = default;
+  CompiledLocaleT &operator=(CompiledLocaleT o) FLATBUFFERS_NOEXCEPT;
+};
+
+struct CompiledLocale FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef CompiledLocaleT NativeTableType;
+  typedef CompiledLocaleBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_LOCALE = 4,
+    VT_FALLBACK_CHAIN = 6,
+    VT_LINE_TEXT_IDS = 8,
+    VT_CHARACTERS = 10
+  };
+  const ::flatbuffers::String *locale() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_LOCALE);
   }
-  void add_start_node_name(::flatbuffers::Offset<::flatbuffers::String> start_node_name) {
-    fbb_.AddOffset(Story::VT_START_NODE_NAME, start_node_name);
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *fallback_chain() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_FALLBACK_CHAIN);
   }
-  void add_characters(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>>> characters) {
-    fbb_.AddOffset(Story::VT_CHARACTERS, characters);
+  const ::flatbuffers::Vector<int32_t> *line_text_ids() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_LINE_TEXT_IDS);
   }
-  explicit StoryBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+  const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleCharacter>> *characters() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleCharacter>> *>(VT_CHARACTERS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_LOCALE) &&
+           verifier.VerifyString(locale()) &&
+           VerifyOffset(verifier, VT_FALLBACK_CHAIN) &&
+           verifier.VerifyVector(fallback_chain()) &&
+           verifier.VerifyVectorOfStrings(fallback_chain()) &&
+           VerifyOffset(verifier, VT_LINE_TEXT_IDS) &&
+           verifier.VerifyVector(line_text_ids()) &&
+           VerifyOffset(verifier, VT_CHARACTERS) &&
+           verifier.VerifyVector(characters()) &&
+           verifier.VerifyVectorOfTables(characters()) &&
+           verifier.EndTable();
+  }
+  CompiledLocaleT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(CompiledLocaleT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<CompiledLocale> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocaleT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct CompiledLocaleBuilder {
+  typedef CompiledLocale Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_locale(::flatbuffers::Offset<::flatbuffers::String> locale) {
+    fbb_.AddOffset(CompiledLocale::VT_LOCALE, locale);
+  }
+  void add_fallback_chain(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> fallback_chain) {
+    fbb_.AddOffset(CompiledLocale::VT_FALLBACK_CHAIN, fallback_chain);
+  }
+  void add_line_text_ids(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> line_text_ids) {
+    fbb_.AddOffset(CompiledLocale::VT_LINE_TEXT_IDS, line_text_ids);
+  }
+  void add_characters(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleCharacter>>> characters) {
+    fbb_.AddOffset(CompiledLocale::VT_CHARACTERS, characters);
+  }
+  explicit CompiledLocaleBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  ::flatbuffers::Offset<Story> Finish() {
+  ::flatbuffers::Offset<CompiledLocale> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = ::flatbuffers::Offset<Story>(end);
+    auto o = ::flatbuffers::Offset<CompiledLocale>(end);
     return o;
   }
 };
 
-inline ::flatbuffers::Offset<Story> CreateStory(
+inline ::flatbuffers::Offset<CompiledLocale> CreateCompiledLocale(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::String> version = 0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> string_pool = 0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> line_ids = 0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::SetVar>>> global_vars = 0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Node>>> nodes = 0,
-    ::flatbuffers::Offset<::flatbuffers::String> start_node_name = 0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>>> characters = 0) {
-  StoryBuilder builder_(_fbb);
+    ::flatbuffers::Offset<::flatbuffers::String> locale = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> fallback_chain = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> line_text_ids = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleCharacter>>> characters = 0) {
+  CompiledLocaleBuilder builder_(_fbb);
   builder_.add_characters(characters);
-  builder_.add_start_node_name(start_node_name);
-  builder_.add_nodes(nodes);
-  builder_.add_global_vars(global_vars);
-  builder_.add_line_ids(line_ids);
-  builder_.add_string_pool(string_pool);
-  builder_.add_version(version);
+  builder_.add_line_text_ids(line_text_ids);
+  builder_.add_fallback_chain(fallback_chain);
+  builder_.add_locale(locale);
   return builder_.Finish();
 }
 
-struct Story::Traits {
-  using type = Story;
-  static auto constexpr Create = CreateStory;
+struct CompiledLocale::Traits {
+  using type = CompiledLocale;
+  static auto constexpr Create = CreateCompiledLocale;
 };
 
-inline ::flatbuffers::Offset<Story> CreateStoryDirect(
+inline ::flatbuffers::Offset<CompiledLocale> CreateCompiledLocaleDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const char *version = nullptr,
-    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *string_pool = nullptr,
-    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *line_ids = nullptr,
-    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::SetVar>> *global_vars = nullptr,
-    std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Node>> *nodes = nullptr,
-    const char *start_node_name = nullptr,
-    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>> *characters = nullptr) {
-  auto version__ = version ? _fbb.CreateString(version) : 0;
-  auto string_pool__ = string_pool ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*string_pool) : 0;
-  auto line_ids__ = line_ids ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*line_ids) : 0;
-  auto global_vars__ = global_vars ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::SetVar>>(*global_vars) : 0;
-  auto nodes__ = nodes ? _fbb.CreateVectorOfSortedTables<ICPDev::Gyeol::Schema::Node>(nodes) : 0;
-  auto start_node_name__ = start_node_name ? _fbb.CreateString(start_node_name) : 0;
-  auto characters__ = characters ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>>(*characters) : 0;
-  return ICPDev::Gyeol::Schema::CreateStory(
+    const char *locale = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *fallback_chain = nullptr,
+    const std::vector<int32_t> *line_text_ids = nullptr,
+    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleCharacter>> *characters = nullptr) {
+  auto locale__ = locale ? _fbb.CreateString(locale) : 0;
+  auto fallback_chain__ = fallback_chain ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*fallback_chain) : 0;
+  auto line_text_ids__ = line_text_ids ? _fbb.CreateVector<int32_t>(*line_text_ids) : 0;
+  auto characters__ = characters ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleCharacter>>(*characters) : 0;
+  return ICPDev::Gyeol::Schema::CreateCompiledLocale(
       _fbb,
-      version__,
-      string_pool__,
-      line_ids__,
-      global_vars__,
-      nodes__,
-      start_node_name__,
+      locale__,
+      fallback_chain__,
+      line_text_ids__,
       characters__);
 }
 
-::flatbuffers::Offset<Story> CreateStory(::flatbuffers::FlatBufferBuilder &_fbb, const StoryT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+::flatbuffers::Offset<CompiledLocale> CreateCompiledLocale(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocaleT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
-inline BoolValueT *BoolValue::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
-  auto _o = std::make_unique<BoolValueT>();
-  UnPackTo(_o.get(), _resolver);
+struct CompiledLocaleCatalogT : public ::flatbuffers::NativeTable {
+  typedef CompiledLocaleCatalog TableType;
+  uint32_t version = 0;
+  std::string default_locale{};
+  uint32_t string_pool_size = 0;
+  std::vector<std::string> texts{};
+  std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::CompiledLocaleT>> locales{};
+  CompiledLocaleCatalogT() = default;
+  CompiledLocaleCatalogT(const CompiledLocaleCatalogT &o);
+  CompiledLocaleCatalogT(CompiledLocaleCatalogT&&) FLATBUFFERS_NOEXCEPT = default;
+  CompiledLocaleCatalogT &operator=(CompiledLocaleCatalogT o) FLATBUFFERS_NOEXCEPT;
+};
+
+struct CompiledLocaleCatalog FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef CompiledLocaleCatalogT NativeTableType;
+  typedef CompiledLocaleCatalogBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_VERSION = 4,
+    VT_DEFAULT_LOCALE = 6,
+    VT_STRING_POOL_SIZE = 8,
+    VT_TEXTS = 10,
+    VT_LOCALES = 12
+  };
+  uint32_t version() const {
+    return GetField<uint32_t>(VT_VERSION, 0);
+  }
+  const ::flatbuffers::String *default_locale() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_DEFAULT_LOCALE);
+  }
+  uint32_t string_pool_size() const {
+    return GetField<uint32_t>(VT_STRING_POOL_SIZE, 0);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *texts() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_TEXTS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocale>> *locales() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocale>> *>(VT_LOCALES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint32_t>(verifier, VT_VERSION, 4) &&
+           VerifyOffset(verifier, VT_DEFAULT_LOCALE) &&
+           verifier.VerifyString(default_locale()) &&
+           VerifyField<uint32_t>(verifier, VT_STRING_POOL_SIZE, 4) &&
+           VerifyOffset(verifier, VT_TEXTS) &&
+           verifier.VerifyVector(texts()) &&
+           verifier.VerifyVectorOfStrings(texts()) &&
+           VerifyOffset(verifier, VT_LOCALES) &&
+           verifier.VerifyVector(locales()) &&
+           verifier.VerifyVectorOfTables(locales()) &&
+           verifier.EndTable();
+  }
+  CompiledLocaleCatalogT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(CompiledLocaleCatalogT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<CompiledLocaleCatalog> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocaleCatalogT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct CompiledLocaleCatalogBuilder {
+  typedef CompiledLocaleCatalog Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_version(uint32_t version) {
+    fbb_.AddElement<uint32_t>(CompiledLocaleCatalog::VT_VERSION, version, 0);
+  }
+  void add_default_locale(::flatbuffers::Offset<::flatbuffers::String> default_locale) {
+    fbb_.AddOffset(CompiledLocaleCatalog::VT_DEFAULT_LOCALE, default_locale);
+  }
+  void add_string_pool_size(uint32_t string_pool_size) {
+    fbb_.AddElement<uint32_t>(CompiledLocaleCatalog::VT_STRING_POOL_SIZE, string_pool_size, 0);
+  }
+  void add_texts(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> texts) {
+    fbb_.AddOffset(CompiledLocaleCatalog::VT_TEXTS, texts);
+  }
+  void add_locales(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocale>>> locales) {
+    fbb_.AddOffset(CompiledLocaleCatalog::VT_LOCALES, locales);
+  }
+  explicit CompiledLocaleCatalogBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<CompiledLocaleCatalog> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<CompiledLocaleCatalog>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<CompiledLocaleCatalog> CreateCompiledLocaleCatalog(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t version = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> default_locale = 0,
+    uint32_t string_pool_size = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> texts = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocale>>> locales = 0) {
+  CompiledLocaleCatalogBuilder builder_(_fbb);
+  builder_.add_locales(locales);
+  builder_.add_texts(texts);
+  builder_.add_string_pool_size(string_pool_size);
+  builder_.add_default_locale(default_locale);
+  builder_.add_version(version);
+  return builder_.Finish();
+}
+
+struct CompiledLocaleCatalog::Traits {
+  using type = CompiledLocaleCatalog;
+  static auto constexpr Create = CreateCompiledLocaleCatalog;
+};
+
+inline ::flatbuffers::Offset<CompiledLocaleCatalog> CreateCompiledLocaleCatalogDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t version = 0,
+    const char *default_locale = nullptr,
+    uint32_t string_pool_size = 0,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *texts = nullptr,
+    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocale>> *locales = nullptr) {
+  auto default_locale__ = default_locale ? _fbb.CreateString(default_locale) : 0;
+  auto texts__ = texts ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*texts) : 0;
+  auto locales__ = locales ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocale>>(*locales) : 0;
+  return ICPDev::Gyeol::Schema::CreateCompiledLocaleCatalog(
+      _fbb,
+      version,
+      default_locale__,
+      string_pool_size,
+      texts__,
+      locales__);
+}
+
+::flatbuffers::Offset<CompiledLocaleCatalog> CreateCompiledLocaleCatalog(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocaleCatalogT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct StoryChunkEntryT : public ::flatbuffers::NativeTable {
+  typedef StoryChunkEntry TableType;
+  std::string name{};
+  std::string path{};
+  uint32_t size = 0;
+  std::vector<std::string> node_names{};
+};
+
+struct StoryChunkEntry FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef StoryChunkEntryT NativeTableType;
+  typedef StoryChunkEntryBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_PATH = 6,
+    VT_SIZE = 8,
+    VT_NODE_NAMES = 10
+  };
+  const ::flatbuffers::String *name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_NAME);
+  }
+  const ::flatbuffers::String *path() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_PATH);
+  }
+  uint32_t size() const {
+    return GetField<uint32_t>(VT_SIZE, 0);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *node_names() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_NODE_NAMES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyOffset(verifier, VT_PATH) &&
+           verifier.VerifyString(path()) &&
+           VerifyField<uint32_t>(verifier, VT_SIZE, 4) &&
+           VerifyOffset(verifier, VT_NODE_NAMES) &&
+           verifier.VerifyVector(node_names()) &&
+           verifier.VerifyVectorOfStrings(node_names()) &&
+           verifier.EndTable();
+  }
+  StoryChunkEntryT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(StoryChunkEntryT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<StoryChunkEntry> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const StoryChunkEntryT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct StoryChunkEntryBuilder {
+  typedef StoryChunkEntry Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_name(::flatbuffers::Offset<::flatbuffers::String> name) {
+    fbb_.AddOffset(StoryChunkEntry::VT_NAME, name);
+  }
+  void add_path(::flatbuffers::Offset<::flatbuffers::String> path) {
+    fbb_.AddOffset(StoryChunkEntry::VT_PATH, path);
+  }
+  void add_size(uint32_t size) {
+    fbb_.AddElement<uint32_t>(StoryChunkEntry::VT_SIZE, size, 0);
+  }
+  void add_node_names(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> node_names) {
+    fbb_.AddOffset(StoryChunkEntry::VT_NODE_NAMES, node_names);
+  }
+  explicit StoryChunkEntryBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<StoryChunkEntry> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<StoryChunkEntry>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<StoryChunkEntry> CreateStoryChunkEntry(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> name = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> path = 0,
+    uint32_t size = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> node_names = 0) {
+  StoryChunkEntryBuilder builder_(_fbb);
+  builder_.add_node_names(node_names);
+  builder_.add_size(size);
+  builder_.add_path(path);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+struct StoryChunkEntry::Traits {
+  using type = StoryChunkEntry;
+  static auto constexpr Create = CreateStoryChunkEntry;
+};
+
+inline ::flatbuffers::Offset<StoryChunkEntry> CreateStoryChunkEntryDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const char *path = nullptr,
+    uint32_t size = 0,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *node_names = nullptr) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto path__ = path ? _fbb.CreateString(path) : 0;
+  auto node_names__ = node_names ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*node_names) : 0;
+  return ICPDev::Gyeol::Schema::CreateStoryChunkEntry(
+      _fbb,
+      name__,
+      path__,
+      size,
+      node_names__);
+}
+
+::flatbuffers::Offset<StoryChunkEntry> CreateStoryChunkEntry(::flatbuffers::FlatBufferBuilder &_fbb, const StoryChunkEntryT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct StoryChunkIndexT : public ::flatbuffers::NativeTable {
+  typedef StoryChunkIndex TableType;
+  uint32_t version = 0;
+  std::string start_node_name{};
+  std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::StoryChunkEntryT>> chunks{};
+  StoryChunkIndexT() = default;
+  StoryChunkIndexT(const StoryChunkIndexT &o);
+  StoryChunkIndexT(StoryChunkIndexT&&) FLATBUFFERS_NOEXCEPT = default;
+  StoryChunkIndexT &operator=(StoryChunkIndexT o) FLATBUFFERS_NOEXCEPT;
+};
+
+struct StoryChunkIndex FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef StoryChunkIndexT NativeTableType;
+  typedef StoryChunkIndexBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_VERSION = 4,
+    VT_START_NODE_NAME = 6,
+    VT_CHUNKS = 8
+  };
+  uint32_t version() const {
+    return GetField<uint32_t>(VT_VERSION, 0);
+  }
+  const ::flatbuffers::String *start_node_name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_START_NODE_NAME);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::StoryChunkEntry>> *chunks() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::StoryChunkEntry>> *>(VT_CHUNKS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint32_t>(verifier, VT_VERSION, 4) &&
+           VerifyOffset(verifier, VT_START_NODE_NAME) &&
+           verifier.VerifyString(start_node_name()) &&
+           VerifyOffset(verifier, VT_CHUNKS) &&
+           verifier.VerifyVector(chunks()) &&
+           verifier.VerifyVectorOfTables(chunks()) &&
+           verifier.EndTable();
+  }
+  StoryChunkIndexT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(StoryChunkIndexT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<StoryChunkIndex> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const StoryChunkIndexT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct StoryChunkIndexBuilder {
+  typedef StoryChunkIndex Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_version(uint32_t version) {
+    fbb_.AddElement<uint32_t>(StoryChunkIndex::VT_VERSION, version, 0);
+  }
+  void add_start_node_name(::flatbuffers::Offset<::flatbuffers::String> start_node_name) {
+    fbb_.AddOffset(StoryChunkIndex::VT_START_NODE_NAME, start_node_name);
+  }
+  void add_chunks(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::StoryChunkEntry>>> chunks) {
+    fbb_.AddOffset(StoryChunkIndex::VT_CHUNKS, chunks);
+  }
+  explicit StoryChunkIndexBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<StoryChunkIndex> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<StoryChunkIndex>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<StoryChunkIndex> CreateStoryChunkIndex(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t version = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> start_node_name = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::StoryChunkEntry>>> chunks = 0) {
+  StoryChunkIndexBuilder builder_(_fbb);
+  builder_.add_chunks(chunks);
+  builder_.add_start_node_name(start_node_name);
+  builder_.add_version(version);
+  return builder_.Finish();
+}
+
+struct StoryChunkIndex::Traits {
+  using type = StoryChunkIndex;
+  static auto constexpr Create = CreateStoryChunkIndex;
+};
+
+inline ::flatbuffers::Offset<StoryChunkIndex> CreateStoryChunkIndexDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t version = 0,
+    const char *start_node_name = nullptr,
+    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::StoryChunkEntry>> *chunks = nullptr) {
+  auto start_node_name__ = start_node_name ? _fbb.CreateString(start_node_name) : 0;
+  auto chunks__ = chunks ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::StoryChunkEntry>>(*chunks) : 0;
+  return ICPDev::Gyeol::Schema::CreateStoryChunkIndex(
+      _fbb,
+      version,
+      start_node_name__,
+      chunks__);
+}
+
+::flatbuffers::Offset<StoryChunkIndex> CreateStoryChunkIndex(::flatbuffers::FlatBufferBuilder &_fbb, const StoryChunkIndexT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct CompressedStringPoolT : public ::flatbuffers::NativeTable {
+  typedef CompressedStringPool TableType;
+  uint8_t codec = 0;
+  std::vector<uint8_t> dictionary{};
+  std::vector<int32_t> entries{};
+  std::vector<uint32_t> block_first_entry{};
+  std::vector<uint32_t> block_offsets{};
+  std::vector<uint32_t> block_raw_sizes{};
+  std::vector<uint8_t> data{};
+};
+
+struct CompressedStringPool FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef CompressedStringPoolT NativeTableType;
+  typedef CompressedStringPoolBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CODEC = 4,
+    VT_DICTIONARY = 6,
+    VT_ENTRIES = 8,
+    VT_BLOCK_FIRST_ENTRY = 10,
+    VT_BLOCK_OFFSETS = 12,
+    VT_BLOCK_RAW_SIZES = 14,
+    VT_DATA = 16
+  };
+  uint8_t codec() const {
+    return GetField<uint8_t>(VT_CODEC, 0);
+  }
+  const ::flatbuffers::Vector<uint8_t> *dictionary() const {
+    return GetPointer<const ::flatbuffers::Vector<uint8_t> *>(VT_DICTIONARY);
+  }
+  const ::flatbuffers::Vector<int32_t> *entries() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_ENTRIES);
+  }
+  const ::flatbuffers::Vector<uint32_t> *block_first_entry() const {
+    return GetPointer<const ::flatbuffers::Vector<uint32_t> *>(VT_BLOCK_FIRST_ENTRY);
+  }
+  const ::flatbuffers::Vector<uint32_t> *block_offsets() const {
+    return GetPointer<const ::flatbuffers::Vector<uint32_t> *>(VT_BLOCK_OFFSETS);
+  }
+  const ::flatbuffers::Vector<uint32_t> *block_raw_sizes() const {
+    return GetPointer<const ::flatbuffers::Vector<uint32_t> *>(VT_BLOCK_RAW_SIZES);
+  }
+  const ::flatbuffers::Vector<uint8_t> *data() const {
+    return GetPointer<const ::flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_CODEC, 1) &&
+           VerifyOffset(verifier, VT_DICTIONARY) &&
+           verifier.VerifyVector(dictionary()) &&
+           VerifyOffset(verifier, VT_ENTRIES) &&
+           verifier.VerifyVector(entries()) &&
+           VerifyOffset(verifier, VT_BLOCK_FIRST_ENTRY) &&
+           verifier.VerifyVector(block_first_entry()) &&
+           VerifyOffset(verifier, VT_BLOCK_OFFSETS) &&
+           verifier.VerifyVector(block_offsets()) &&
+           VerifyOffset(verifier, VT_BLOCK_RAW_SIZES) &&
+           verifier.VerifyVector(block_raw_sizes()) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           verifier.EndTable();
+  }
+  CompressedStringPoolT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(CompressedStringPoolT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<CompressedStringPool> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CompressedStringPoolT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct CompressedStringPoolBuilder {
+  typedef CompressedStringPool Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_codec(uint8_t codec) {
+    fbb_.AddElement<uint8_t>(CompressedStringPool::VT_CODEC, codec, 0);
+  }
+  void add_dictionary(::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> dictionary) {
+    fbb_.AddOffset(CompressedStringPool::VT_DICTIONARY, dictionary);
+  }
+  void add_entries(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> entries) {
+    fbb_.AddOffset(CompressedStringPool::VT_ENTRIES, entries);
+  }
+  void add_block_first_entry(::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> block_first_entry) {
+    fbb_.AddOffset(CompressedStringPool::VT_BLOCK_FIRST_ENTRY, block_first_entry);
+  }
+  void add_block_offsets(::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> block_offsets) {
+    fbb_.AddOffset(CompressedStringPool::VT_BLOCK_OFFSETS, block_offsets);
+  }
+  void add_block_raw_sizes(::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> block_raw_sizes) {
+    fbb_.AddOffset(CompressedStringPool::VT_BLOCK_RAW_SIZES, block_raw_sizes);
+  }
+  void add_data(::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data) {
+    fbb_.AddOffset(CompressedStringPool::VT_DATA, data);
+  }
+  explicit CompressedStringPoolBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<CompressedStringPool> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<CompressedStringPool>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<CompressedStringPool> CreateCompressedStringPool(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint8_t codec = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> dictionary = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> entries = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> block_first_entry = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> block_offsets = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> block_raw_sizes = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data = 0) {
+  CompressedStringPoolBuilder builder_(_fbb);
+  builder_.add_data(data);
+  builder_.add_block_raw_sizes(block_raw_sizes);
+  builder_.add_block_offsets(block_offsets);
+  builder_.add_block_first_entry(block_first_entry);
+  builder_.add_entries(entries);
+  builder_.add_dictionary(dictionary);
+  builder_.add_codec(codec);
+  return builder_.Finish();
+}
+
+struct CompressedStringPool::Traits {
+  using type = CompressedStringPool;
+  static auto constexpr Create = CreateCompressedStringPool;
+};
+
+inline ::flatbuffers::Offset<CompressedStringPool> CreateCompressedStringPoolDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint8_t codec = 0,
+    const std::vector<uint8_t> *dictionary = nullptr,
+    const std::vector<int32_t> *entries = nullptr,
+    const std::vector<uint32_t> *block_first_entry = nullptr,
+    const std::vector<uint32_t> *block_offsets = nullptr,
+    const std::vector<uint32_t> *block_raw_sizes = nullptr,
+    const std::vector<uint8_t> *data = nullptr) {
+  auto dictionary__ = dictionary ? _fbb.CreateVector<uint8_t>(*dictionary) : 0;
+  auto entries__ = entries ? _fbb.CreateVector<int32_t>(*entries) : 0;
+  auto block_first_entry__ = block_first_entry ? _fbb.CreateVector<uint32_t>(*block_first_entry) : 0;
+  auto block_offsets__ = block_offsets ? _fbb.CreateVector<uint32_t>(*block_offsets) : 0;
+  auto block_raw_sizes__ = block_raw_sizes ? _fbb.CreateVector<uint32_t>(*block_raw_sizes) : 0;
+  auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+  return ICPDev::Gyeol::Schema::CreateCompressedStringPool(
+      _fbb,
+      codec,
+      dictionary__,
+      entries__,
+      block_first_entry__,
+      block_offsets__,
+      block_raw_sizes__,
+      data__);
+}
+
+::flatbuffers::Offset<CompressedStringPool> CreateCompressedStringPool(::flatbuffers::FlatBufferBuilder &_fbb, const CompressedStringPoolT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct NodeNameTableT : public ::flatbuffers::NativeTable {
+  typedef NodeNameTable TableType;
+  std::vector<uint32_t> seeds{};
+  std::vector<int32_t> slots{};
+};
+
+struct NodeNameTable FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef NodeNameTableT NativeTableType;
+  typedef NodeNameTableBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_SEEDS = 4,
+    VT_SLOTS = 6
+  };
+  const ::flatbuffers::Vector<uint32_t> *seeds() const {
+    return GetPointer<const ::flatbuffers::Vector<uint32_t> *>(VT_SEEDS);
+  }
+  const ::flatbuffers::Vector<int32_t> *slots() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_SLOTS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_SEEDS) &&
+           verifier.VerifyVector(seeds()) &&
+           VerifyOffset(verifier, VT_SLOTS) &&
+           verifier.VerifyVector(slots()) &&
+           verifier.EndTable();
+  }
+  NodeNameTableT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(NodeNameTableT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<NodeNameTable> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const NodeNameTableT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct NodeNameTableBuilder {
+  typedef NodeNameTable Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_seeds(::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> seeds) {
+    fbb_.AddOffset(NodeNameTable::VT_SEEDS, seeds);
+  }
+  void add_slots(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> slots) {
+    fbb_.AddOffset(NodeNameTable::VT_SLOTS, slots);
+  }
+  explicit NodeNameTableBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<NodeNameTable> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<NodeNameTable>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<NodeNameTable> CreateNodeNameTable(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> seeds = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> slots = 0) {
+  NodeNameTableBuilder builder_(_fbb);
+  builder_.add_slots(slots);
+  builder_.add_seeds(seeds);
+  return builder_.Finish();
+}
+
+struct NodeNameTable::Traits {
+  using type = NodeNameTable;
+  static auto constexpr Create = CreateNodeNameTable;
+};
+
+inline ::flatbuffers::Offset<NodeNameTable> CreateNodeNameTableDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint32_t> *seeds = nullptr,
+    const std::vector<int32_t> *slots = nullptr) {
+  auto seeds__ = seeds ? _fbb.CreateVector<uint32_t>(*seeds) : 0;
+  auto slots__ = slots ? _fbb.CreateVector<int32_t>(*slots) : 0;
+  return ICPDev::Gyeol::Schema::CreateNodeNameTable(
+      _fbb,
+      seeds__,
+      slots__);
+}
+
+::flatbuffers::Offset<NodeNameTable> CreateNodeNameTable(::flatbuffers::FlatBufferBuilder &_fbb, const NodeNameTableT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct StoryT : public ::flatbuffers::NativeTable {
+  typedef Story TableType;
+  std::string version{};
+  std::vector<std::string> string_pool{};
+  std::vector<std::string> line_ids{};
+  std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::SetVarT>> global_vars{};
+  std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::NodeT>> nodes{};
+  std::string start_node_name{};
+  std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::CharacterDefT>> characters{};
+  std::unique_ptr<ICPDev::Gyeol::Schema::CompressedStringPoolT> compressed_pool{};
+  std::unique_ptr<ICPDev::Gyeol::Schema::NodeNameTableT> node_names{};
+  StoryT() = default;
+  StoryT(const StoryT &o);
+  StoryT(StoryT&&) FLATBUFFERS_NOEXCEPT = default;
+  StoryT &operator=(StoryT o) FLATBUFFERS_NOEXCEPT;
+};
+
+struct Story FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef StoryT NativeTableType;
+  typedef StoryBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_VERSION = 4,
+    VT_STRING_POOL = 6,
+    VT_LINE_IDS = 8,
+    VT_GLOBAL_VARS = 10,
+    VT_NODES = 12,
+    VT_START_NODE_NAME = 14,
+    VT_CHARACTERS = 16,
+    VT_COMPRESSED_POOL = 18,
+    VT_NODE_NAMES = 20
+  };
+  const ::flatbuffers::String *version() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_VERSION);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *string_pool() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_STRING_POOL);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *line_ids() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_LINE_IDS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::SetVar>> *global_vars() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::SetVar>> *>(VT_GLOBAL_VARS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Node>> *nodes() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Node>> *>(VT_NODES);
+  }
+  const ::flatbuffers::String *start_node_name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_START_NODE_NAME);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>> *characters() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>> *>(VT_CHARACTERS);
+  }
+  const ICPDev::Gyeol::Schema::CompressedStringPool *compressed_pool() const {
+    return GetPointer<const ICPDev::Gyeol::Schema::CompressedStringPool *>(VT_COMPRESSED_POOL);
+  }
+  const ICPDev::Gyeol::Schema::NodeNameTable *node_names() const {
+    return GetPointer<const ICPDev::Gyeol::Schema::NodeNameTable *>(VT_NODE_NAMES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_VERSION) &&
+           verifier.VerifyString(version()) &&
+           VerifyOffset(verifier, VT_STRING_POOL) &&
+           verifier.VerifyVector(string_pool()) &&
+           verifier.VerifyVectorOfStrings(string_pool()) &&
+           VerifyOffset(verifier, VT_LINE_IDS) &&
+           verifier.VerifyVector(line_ids()) &&
+           verifier.VerifyVectorOfStrings(line_ids()) &&
+           VerifyOffset(verifier, VT_GLOBAL_VARS) &&
+           verifier.VerifyVector(global_vars()) &&
+           verifier.VerifyVectorOfTables(global_vars()) &&
+           VerifyOffset(verifier, VT_NODES) &&
+           verifier.VerifyVector(nodes()) &&
+           verifier.VerifyVectorOfTables(nodes()) &&
+           VerifyOffset(verifier, VT_START_NODE_NAME) &&
+           verifier.VerifyString(start_node_name()) &&
+           VerifyOffset(verifier, VT_CHARACTERS) &&
+           verifier.VerifyVector(characters()) &&
+           verifier.VerifyVectorOfTables(characters()) &&
+           VerifyOffset(verifier, VT_COMPRESSED_POOL) &&
+           verifier.VerifyTable(compressed_pool()) &&
+           VerifyOffset(verifier, VT_NODE_NAMES) &&
+           verifier.VerifyTable(node_names()) &&
+           verifier.EndTable();
+  }
+  StoryT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(StoryT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<Story> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const StoryT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct StoryBuilder {
+  typedef Story Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_version(::flatbuffers::Offset<::flatbuffers::String> version) {
+    fbb_.AddOffset(Story::VT_VERSION, version);
+  }
+  void add_string_pool(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> string_pool) {
+    fbb_.AddOffset(Story::VT_STRING_POOL, string_pool);
+  }
+  void add_line_ids(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> line_ids) {
+    fbb_.AddOffset(Story::VT_LINE_IDS, line_ids);
+  }
+  void add_global_vars(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::SetVar>>> global_vars) {
+    fbb_.AddOffset(Story::VT_GLOBAL_VARS, global_vars);
+  }
+  void add_nodes(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Node>>> nodes) {
+    fbb_.AddOffset(Story::VT_NODES, nodes);
+  }
+  void add_start_node_name(::flatbuffers::Offset<::flatbuffers::String> start_node_name) {
+    fbb_.AddOffset(Story::VT_START_NODE_NAME, start_node_name);
+  }
+  void add_characters(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>>> characters) {
+    fbb_.AddOffset(Story::VT_CHARACTERS, characters);
+  }
+  void add_compressed_pool(::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompressedStringPool> compressed_pool) {
+    fbb_.AddOffset(Story::VT_COMPRESSED_POOL, compressed_pool);
+  }
+  void add_node_names(::flatbuffers::Offset<ICPDev::Gyeol::Schema::NodeNameTable> node_names) {
+    fbb_.AddOffset(Story::VT_NODE_NAMES, node_names);
+  }
+  explicit StoryBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Story> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Story>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Story> CreateStory(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> version = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> string_pool = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> line_ids = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::SetVar>>> global_vars = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Node>>> nodes = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> start_node_name = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>>> characters = 0,
+    ::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompressedStringPool> compressed_pool = 0,
+    ::flatbuffers::Offset<ICPDev::Gyeol::Schema::NodeNameTable> node_names = 0) {
+  StoryBuilder builder_(_fbb);
+  builder_.add_node_names(node_names);
+  builder_.add_compressed_pool(compressed_pool);
+  builder_.add_characters(characters);
+  builder_.add_start_node_name(start_node_name);
+  builder_.add_nodes(nodes);
+  builder_.add_global_vars(global_vars);
+  builder_.add_line_ids(line_ids);
+  builder_.add_string_pool(string_pool);
+  builder_.add_version(version);
+  return builder_.Finish();
+}
+
+struct Story::Traits {
+  using type = Story;
+  static auto constexpr Create = CreateStory;
+};
+
+inline ::flatbuffers::Offset<Story> CreateStoryDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *version = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *string_pool = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *line_ids = nullptr,
+    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::SetVar>> *global_vars = nullptr,
+    std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Node>> *nodes = nullptr,
+    const char *start_node_name = nullptr,
+    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>> *characters = nullptr,
+    ::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompressedStringPool> compressed_pool = 0,
+    ::flatbuffers::Offset<ICPDev::Gyeol::Schema::NodeNameTable> node_names = 0) {
+  auto version__ = version ? _fbb.CreateString(version) : 0;
+  auto string_pool__ = string_pool ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*string_pool) : 0;
+  auto line_ids__ = line_ids ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*line_ids) : 0;
+  auto global_vars__ = global_vars ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::SetVar>>(*global_vars) : 0;
+  auto nodes__ = nodes ? _fbb.CreateVectorOfSortedTables<ICPDev::Gyeol::Schema::Node>(nodes) : 0;
+  auto start_node_name__ = start_node_name ? _fbb.CreateString(start_node_name) : 0;
+  auto characters__ = characters ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>>(*characters) : 0;
+  return ICPDev::Gyeol::Schema::CreateStory(
+      _fbb,
+      version__,
+      string_pool__,
+      line_ids__,
+      global_vars__,
+      nodes__,
+      start_node_name__,
+      characters__,
+      compressed_pool,
+      node_names);
+}
+
+::flatbuffers::Offset<Story> CreateStory(::flatbuffers::FlatBufferBuilder &_fbb, const StoryT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct FragmentImportMarkerT : public ::flatbuffers::NativeTable {
+  typedef FragmentImportMarker TableType;
+  int32_t line = 0;
+  std::string import_path{};
+  std::string abs_path{};
+  uint32_t pool_events = 0;
+  uint32_t errors = 0;
+  uint32_t warnings = 0;
+  uint32_t nodes = 0;
+};
+
+struct FragmentImportMarker FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef FragmentImportMarkerT NativeTableType;
+  typedef FragmentImportMarkerBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_LINE = 4,
+    VT_IMPORT_PATH = 6,
+    VT_ABS_PATH = 8,
+    VT_POOL_EVENTS = 10,
+    VT_ERRORS = 12,
+    VT_WARNINGS = 14,
+    VT_NODES = 16
+  };
+  int32_t line() const {
+    return GetField<int32_t>(VT_LINE, 0);
+  }
+  const ::flatbuffers::String *import_path() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_IMPORT_PATH);
+  }
+  const ::flatbuffers::String *abs_path() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_ABS_PATH);
+  }
+  uint32_t pool_events() const {
+    return GetField<uint32_t>(VT_POOL_EVENTS, 0);
+  }
+  uint32_t errors() const {
+    return GetField<uint32_t>(VT_ERRORS, 0);
+  }
+  uint32_t warnings() const {
+    return GetField<uint32_t>(VT_WARNINGS, 0);
+  }
+  uint32_t nodes() const {
+    return GetField<uint32_t>(VT_NODES, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_LINE, 4) &&
+           VerifyOffset(verifier, VT_IMPORT_PATH) &&
+           verifier.VerifyString(import_path()) &&
+           VerifyOffset(verifier, VT_ABS_PATH) &&
+           verifier.VerifyString(abs_path()) &&
+           VerifyField<uint32_t>(verifier, VT_POOL_EVENTS, 4) &&
+           VerifyField<uint32_t>(verifier, VT_ERRORS, 4) &&
+           VerifyField<uint32_t>(verifier, VT_WARNINGS, 4) &&
+           VerifyField<uint32_t>(verifier, VT_NODES, 4) &&
+           verifier.EndTable();
+  }
+  FragmentImportMarkerT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(FragmentImportMarkerT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<FragmentImportMarker> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const FragmentImportMarkerT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct FragmentImportMarkerBuilder {
+  typedef FragmentImportMarker Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_line(int32_t line) {
+    fbb_.AddElement<int32_t>(FragmentImportMarker::VT_LINE, line, 0);
+  }
+  void add_import_path(::flatbuffers::Offset<::flatbuffers::String> import_path) {
+    fbb_.AddOffset(FragmentImportMarker::VT_IMPORT_PATH, import_path);
+  }
+  void add_abs_path(::flatbuffers::Offset<::flatbuffers::String> abs_path) {
+    fbb_.AddOffset(FragmentImportMarker::VT_ABS_PATH, abs_path);
+  }
+  void add_pool_events(uint32_t pool_events) {
+    fbb_.AddElement<uint32_t>(FragmentImportMarker::VT_POOL_EVENTS, pool_events, 0);
+  }
+  void add_errors(uint32_t errors) {
+    fbb_.AddElement<uint32_t>(FragmentImportMarker::VT_ERRORS, errors, 0);
+  }
+  void add_warnings(uint32_t warnings) {
+    fbb_.AddElement<uint32_t>(FragmentImportMarker::VT_WARNINGS, warnings, 0);
+  }
+  void add_nodes(uint32_t nodes) {
+    fbb_.AddElement<uint32_t>(FragmentImportMarker::VT_NODES, nodes, 0);
+  }
+  explicit FragmentImportMarkerBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<FragmentImportMarker> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<FragmentImportMarker>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<FragmentImportMarker> CreateFragmentImportMarker(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t line = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> import_path = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> abs_path = 0,
+    uint32_t pool_events = 0,
+    uint32_t errors = 0,
+    uint32_t warnings = 0,
+    uint32_t nodes = 0) {
+  FragmentImportMarkerBuilder builder_(_fbb);
+  builder_.add_nodes(nodes);
+  builder_.add_warnings(warnings);
+  builder_.add_errors(errors);
+  builder_.add_pool_events(pool_events);
+  builder_.add_abs_path(abs_path);
+  builder_.add_import_path(import_path);
+  builder_.add_line(line);
+  return builder_.Finish();
+}
+
+struct FragmentImportMarker::Traits {
+  using type = FragmentImportMarker;
+  static auto constexpr Create = CreateFragmentImportMarker;
+};
+
+inline ::flatbuffers::Offset<FragmentImportMarker> CreateFragmentImportMarkerDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t line = 0,
+    const char *import_path = nullptr,
+    const char *abs_path = nullptr,
+    uint32_t pool_events = 0,
+    uint32_t errors = 0,
+    uint32_t warnings = 0,
+    uint32_t nodes = 0) {
+  auto import_path__ = import_path ? _fbb.CreateString(import_path) : 0;
+  auto abs_path__ = abs_path ? _fbb.CreateString(abs_path) : 0;
+  return ICPDev::Gyeol::Schema::CreateFragmentImportMarker(
+      _fbb,
+      line,
+      import_path__,
+      abs_path__,
+      pool_events,
+      errors,
+      warnings,
+      nodes);
+}
+
+::flatbuffers::Offset<FragmentImportMarker> CreateFragmentImportMarker(::flatbuffers::FlatBufferBuilder &_fbb, const FragmentImportMarkerT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct ParsedFragmentT : public ::flatbuffers::NativeTable {
+  typedef ParsedFragment TableType;
+  uint32_t format_version = 0;
+  std::string compiler_version{};
+  std::string source_path{};
+  std::string content_hash{};
+  bool main_file = false;
+  std::unique_ptr<ICPDev::Gyeol::Schema::StoryT> story{};
+  std::vector<int32_t> pool_event_ids{};
+  std::vector<uint8_t> pool_event_line_ids{};
+  std::vector<std::unique_ptr<ICPDev::Gyeol::Schema::FragmentImportMarkerT>> import_markers{};
+  std::vector<std::string> errors{};
+  std::vector<std::string> warnings{};
+  std::vector<uint32_t> instr_nodes{};
+  std::vector<uint32_t> instr_indices{};
+  std::vector<int32_t> instr_lines{};
+  std::vector<int32_t> used_characters{};
+  std::vector<std::string> defined_characters{};
+  bool start_node_set = false;
+  std::string fragment_issue{};
+  ParsedFragmentT() = default;
+  ParsedFragmentT(const ParsedFragmentT &o);
+  ParsedFragmentT(ParsedFragmentT&&) FLATBUFFERS_NOEXCEPT = default;
+  ParsedFragmentT &operator=(ParsedFragmentT o) FLATBUFFERS_NOEXCEPT;
+};
+
+struct ParsedFragment FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ParsedFragmentT NativeTableType;
+  typedef ParsedFragmentBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_FORMAT_VERSION = 4,
+    VT_COMPILER_VERSION = 6,
+    VT_SOURCE_PATH = 8,
+    VT_CONTENT_HASH = 10,
+    VT_MAIN_FILE = 12,
+    VT_STORY = 14,
+    VT_POOL_EVENT_IDS = 16,
+    VT_POOL_EVENT_LINE_IDS = 18,
+    VT_IMPORT_MARKERS = 20,
+    VT_ERRORS = 22,
+    VT_WARNINGS = 24,
+    VT_INSTR_NODES = 26,
+    VT_INSTR_INDICES = 28,
+    VT_INSTR_LINES = 30,
+    VT_USED_CHARACTERS = 32,
+    VT_DEFINED_CHARACTERS = 34,
+    VT_START_NODE_SET = 36,
+    VT_FRAGMENT_ISSUE = 38
+  };
+  uint32_t format_version() const {
+    return GetField<uint32_t>(VT_FORMAT_VERSION, 0);
+  }
+  const ::flatbuffers::String *compiler_version() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_COMPILER_VERSION);
+  }
+  const ::flatbuffers::String *source_path() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_SOURCE_PATH);
+  }
+  const ::flatbuffers::String *content_hash() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_CONTENT_HASH);
+  }
+  bool main_file() const {
+    return GetField<uint8_t>(VT_MAIN_FILE, 0) != 0;
+  }
+  const ICPDev::Gyeol::Schema::Story *story() const {
+    return GetPointer<const ICPDev::Gyeol::Schema::Story *>(VT_STORY);
+  }
+  const ::flatbuffers::Vector<int32_t> *pool_event_ids() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_POOL_EVENT_IDS);
+  }
+  const ::flatbuffers::Vector<uint8_t> *pool_event_line_ids() const {
+    return GetPointer<const ::flatbuffers::Vector<uint8_t> *>(VT_POOL_EVENT_LINE_IDS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::FragmentImportMarker>> *import_markers() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::FragmentImportMarker>> *>(VT_IMPORT_MARKERS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *errors() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_ERRORS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *warnings() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_WARNINGS);
+  }
+  const ::flatbuffers::Vector<uint32_t> *instr_nodes() const {
+    return GetPointer<const ::flatbuffers::Vector<uint32_t> *>(VT_INSTR_NODES);
+  }
+  const ::flatbuffers::Vector<uint32_t> *instr_indices() const {
+    return GetPointer<const ::flatbuffers::Vector<uint32_t> *>(VT_INSTR_INDICES);
+  }
+  const ::flatbuffers::Vector<int32_t> *instr_lines() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_INSTR_LINES);
+  }
+  const ::flatbuffers::Vector<int32_t> *used_characters() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_USED_CHARACTERS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *defined_characters() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_DEFINED_CHARACTERS);
+  }
+  bool start_node_set() const {
+    return GetField<uint8_t>(VT_START_NODE_SET, 0) != 0;
+  }
+  const ::flatbuffers::String *fragment_issue() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_FRAGMENT_ISSUE);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint32_t>(verifier, VT_FORMAT_VERSION, 4) &&
+           VerifyOffset(verifier, VT_COMPILER_VERSION) &&
+           verifier.VerifyString(compiler_version()) &&
+           VerifyOffset(verifier, VT_SOURCE_PATH) &&
+           verifier.VerifyString(source_path()) &&
+           VerifyOffset(verifier, VT_CONTENT_HASH) &&
+           verifier.VerifyString(content_hash()) &&
+           VerifyField<uint8_t>(verifier, VT_MAIN_FILE, 1) &&
+           VerifyOffset(verifier, VT_STORY) &&
+           verifier.VerifyTable(story()) &&
+           VerifyOffset(verifier, VT_POOL_EVENT_IDS) &&
+           verifier.VerifyVector(pool_event_ids()) &&
+           VerifyOffset(verifier, VT_POOL_EVENT_LINE_IDS) &&
+           verifier.VerifyVector(pool_event_line_ids()) &&
+           VerifyOffset(verifier, VT_IMPORT_MARKERS) &&
+           verifier.VerifyVector(import_markers()) &&
+           verifier.VerifyVectorOfTables(import_markers()) &&
+           VerifyOffset(verifier, VT_ERRORS) &&
+           verifier.VerifyVector(errors()) &&
+           verifier.VerifyVectorOfStrings(errors()) &&
+           VerifyOffset(verifier, VT_WARNINGS) &&
+           verifier.VerifyVector(warnings()) &&
+           verifier.VerifyVectorOfStrings(warnings()) &&
+           VerifyOffset(verifier, VT_INSTR_NODES) &&
+           verifier.VerifyVector(instr_nodes()) &&
+           VerifyOffset(verifier, VT_INSTR_INDICES) &&
+           verifier.VerifyVector(instr_indices()) &&
+           VerifyOffset(verifier, VT_INSTR_LINES) &&
+           verifier.VerifyVector(instr_lines()) &&
+           VerifyOffset(verifier, VT_USED_CHARACTERS) &&
+           verifier.VerifyVector(used_characters()) &&
+           VerifyOffset(verifier, VT_DEFINED_CHARACTERS) &&
+           verifier.VerifyVector(defined_characters()) &&
+           verifier.VerifyVectorOfStrings(defined_characters()) &&
+           VerifyField<uint8_t>(verifier, VT_START_NODE_SET, 1) &&
+           VerifyOffset(verifier, VT_FRAGMENT_ISSUE) &&
+           verifier.VerifyString(fragment_issue()) &&
+           verifier.EndTable();
+  }
+  ParsedFragmentT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(ParsedFragmentT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<ParsedFragment> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ParsedFragmentT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct ParsedFragmentBuilder {
+  typedef ParsedFragment Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_format_version(uint32_t format_version) {
+    fbb_.AddElement<uint32_t>(ParsedFragment::VT_FORMAT_VERSION, format_version, 0);
+  }
+  void add_compiler_version(::flatbuffers::Offset<::flatbuffers::String> compiler_version) {
+    fbb_.AddOffset(ParsedFragment::VT_COMPILER_VERSION, compiler_version);
+  }
+  void add_source_path(::flatbuffers::Offset<::flatbuffers::String> source_path) {
+    fbb_.AddOffset(ParsedFragment::VT_SOURCE_PATH, source_path);
+  }
+  void add_content_hash(::flatbuffers::Offset<::flatbuffers::String> content_hash) {
+    fbb_.AddOffset(ParsedFragment::VT_CONTENT_HASH, content_hash);
+  }
+  void add_main_file(bool main_file) {
+    fbb_.AddElement<uint8_t>(ParsedFragment::VT_MAIN_FILE, static_cast<uint8_t>(main_file), 0);
+  }
+  void add_story(::flatbuffers::Offset<ICPDev::Gyeol::Schema::Story> story) {
+    fbb_.AddOffset(ParsedFragment::VT_STORY, story);
+  }
+  void add_pool_event_ids(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> pool_event_ids) {
+    fbb_.AddOffset(ParsedFragment::VT_POOL_EVENT_IDS, pool_event_ids);
+  }
+  void add_pool_event_line_ids(::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> pool_event_line_ids) {
+    fbb_.AddOffset(ParsedFragment::VT_POOL_EVENT_LINE_IDS, pool_event_line_ids);
+  }
+  void add_import_markers(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::FragmentImportMarker>>> import_markers) {
+    fbb_.AddOffset(ParsedFragment::VT_IMPORT_MARKERS, import_markers);
+  }
+  void add_errors(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> errors) {
+    fbb_.AddOffset(ParsedFragment::VT_ERRORS, errors);
+  }
+  void add_warnings(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> warnings) {
+    fbb_.AddOffset(ParsedFragment::VT_WARNINGS, warnings);
+  }
+  void add_instr_nodes(::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> instr_nodes) {
+    fbb_.AddOffset(ParsedFragment::VT_INSTR_NODES, instr_nodes);
+  }
+  void add_instr_indices(::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> instr_indices) {
+    fbb_.AddOffset(ParsedFragment::VT_INSTR_INDICES, instr_indices);
+  }
+  void add_instr_lines(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> instr_lines) {
+    fbb_.AddOffset(ParsedFragment::VT_INSTR_LINES, instr_lines);
+  }
+  void add_used_characters(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> used_characters) {
+    fbb_.AddOffset(ParsedFragment::VT_USED_CHARACTERS, used_characters);
+  }
+  void add_defined_characters(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> defined_characters) {
+    fbb_.AddOffset(ParsedFragment::VT_DEFINED_CHARACTERS, defined_characters);
+  }
+  void add_start_node_set(bool start_node_set) {
+    fbb_.AddElement<uint8_t>(ParsedFragment::VT_START_NODE_SET, static_cast<uint8_t>(start_node_set), 0);
+  }
+  void add_fragment_issue(::flatbuffers::Offset<::flatbuffers::String> fragment_issue) {
+    fbb_.AddOffset(ParsedFragment::VT_FRAGMENT_ISSUE, fragment_issue);
+  }
+  explicit ParsedFragmentBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ParsedFragment> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ParsedFragment>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ParsedFragment> CreateParsedFragment(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t format_version = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> compiler_version = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> source_path = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> content_hash = 0,
+    bool main_file = false,
+    ::flatbuffers::Offset<ICPDev::Gyeol::Schema::Story> story = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> pool_event_ids = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> pool_event_line_ids = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::FragmentImportMarker>>> import_markers = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> errors = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> warnings = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> instr_nodes = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> instr_indices = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> instr_lines = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> used_characters = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> defined_characters = 0,
+    bool start_node_set = false,
+    ::flatbuffers::Offset<::flatbuffers::String> fragment_issue = 0) {
+  ParsedFragmentBuilder builder_(_fbb);
+  builder_.add_fragment_issue(fragment_issue);
+  builder_.add_defined_characters(defined_characters);
+  builder_.add_used_characters(used_characters);
+  builder_.add_instr_lines(instr_lines);
+  builder_.add_instr_indices(instr_indices);
+  builder_.add_instr_nodes(instr_nodes);
+  builder_.add_warnings(warnings);
+  builder_.add_errors(errors);
+  builder_.add_import_markers(import_markers);
+  builder_.add_pool_event_line_ids(pool_event_line_ids);
+  builder_.add_pool_event_ids(pool_event_ids);
+  builder_.add_story(story);
+  builder_.add_content_hash(content_hash);
+  builder_.add_source_path(source_path);
+  builder_.add_compiler_version(compiler_version);
+  builder_.add_format_version(format_version);
+  builder_.add_start_node_set(start_node_set);
+  builder_.add_main_file(main_file);
+  return builder_.Finish();
+}
+
+struct ParsedFragment::Traits {
+  using type = ParsedFragment;
+  static auto constexpr Create = CreateParsedFragment;
+};
+
+inline ::flatbuffers::Offset<ParsedFragment> CreateParsedFragmentDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t format_version = 0,
+    const char *compiler_version = nullptr,
+    const char *source_path = nullptr,
+    const char *content_hash = nullptr,
+    bool main_file = false,
+    ::flatbuffers::Offset<ICPDev::Gyeol::Schema::Story> story = 0,
+    const std::vector<int32_t> *pool_event_ids = nullptr,
+    const std::vector<uint8_t> *pool_event_line_ids = nullptr,
+    const std::vector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::FragmentImportMarker>> *import_markers = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *errors = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *warnings = nullptr,
+    const std::vector<uint32_t> *instr_nodes = nullptr,
+    const std::vector<uint32_t> *instr_indices = nullptr,
+    const std::vector<int32_t> *instr_lines = nullptr,
+    const std::vector<int32_t> *used_characters = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *defined_characters = nullptr,
+    bool start_node_set = false,
+    const char *fragment_issue = nullptr) {
+  auto compiler_version__ = compiler_version ? _fbb.CreateString(compiler_version) : 0;
+  auto source_path__ = source_path ? _fbb.CreateString(source_path) : 0;
+  auto content_hash__ = content_hash ? _fbb.CreateString(content_hash) : 0;
+  auto pool_event_ids__ = pool_event_ids ? _fbb.CreateVector<int32_t>(*pool_event_ids) : 0;
+  auto pool_event_line_ids__ = pool_event_line_ids ? _fbb.CreateVector<uint8_t>(*pool_event_line_ids) : 0;
+  auto import_markers__ = import_markers ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::FragmentImportMarker>>(*import_markers) : 0;
+  auto errors__ = errors ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*errors) : 0;
+  auto warnings__ = warnings ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*warnings) : 0;
+  auto instr_nodes__ = instr_nodes ? _fbb.CreateVector<uint32_t>(*instr_nodes) : 0;
+  auto instr_indices__ = instr_indices ? _fbb.CreateVector<uint32_t>(*instr_indices) : 0;
+  auto instr_lines__ = instr_lines ? _fbb.CreateVector<int32_t>(*instr_lines) : 0;
+  auto used_characters__ = used_characters ? _fbb.CreateVector<int32_t>(*used_characters) : 0;
+  auto defined_characters__ = defined_characters ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*defined_characters) : 0;
+  auto fragment_issue__ = fragment_issue ? _fbb.CreateString(fragment_issue) : 0;
+  return ICPDev::Gyeol::Schema::CreateParsedFragment(
+      _fbb,
+      format_version,
+      compiler_version__,
+      source_path__,
+      content_hash__,
+      main_file,
+      story,
+      pool_event_ids__,
+      pool_event_line_ids__,
+      import_markers__,
+      errors__,
+      warnings__,
+      instr_nodes__,
+      instr_indices__,
+      instr_lines__,
+      used_characters__,
+      defined_characters__,
+      start_node_set,
+      fragment_issue__);
+}
+
+::flatbuffers::Offset<ParsedFragment> CreateParsedFragment(::flatbuffers::FlatBufferBuilder &_fbb, const ParsedFragmentT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline BoolValueT *BoolValue::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<BoolValueT>();
+  UnPackTo(_o.get(), _resolver);
   return _o.release();
 }
 
@@ -4252,7 +5868,8 @@ inline ::flatbuffers::Offset<Tag> CreateTag(::flatbuffers::FlatBufferBuilder &_f
 inline LineT::LineT(const LineT &o)
       : character_id(o.character_id),
         text_id(o.text_id),
-        voice_asset_id(o.voice_asset_id) {
+        voice_asset_id(o.voice_asset_id),
+        hot_template(o.hot_template) {
   tags.reserve(o.tags.size());
   for (const auto &tags_ : o.tags) { tags.emplace_back((tags_) ? new ICPDev::Gyeol::Schema::TagT(*tags_) : nullptr); }
 }
@@ -4262,6 +5879,7 @@ inline LineT &LineT::operator=(LineT o) FLATBUFFERS_NOEXCEPT {
   std::swap(text_id, o.text_id);
   std::swap(voice_asset_id, o.voice_asset_id);
   std::swap(tags, o.tags);
+  std::swap(hot_template, o.hot_template);
   return *this;
 }
 
@@ -4278,6 +5896,7 @@ inline void Line::UnPackTo(LineT *_o, const ::flatbuffers::resolver_function_t *
   { auto _e = text_id(); _o->text_id = _e; }
   { auto _e = voice_asset_id(); _o->voice_asset_id = _e; }
   { auto _e = tags(); if (_e) { _o->tags.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->tags[_i]) { _e->Get(_i)->UnPackTo(_o->tags[_i].get(), _resolver); } else { _o->tags[_i] = std::unique_ptr<ICPDev::Gyeol::Schema::TagT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->tags.resize(0); } }
+  { auto _e = hot_template(); _o->hot_template = _e; }
 }
 
 inline ::flatbuffers::Offset<Line> Line::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const LineT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -4292,12 +5911,14 @@ inline ::flatbuffers::Offset<Line> CreateLine(::flatbuffers::FlatBufferBuilder &
   auto _text_id = _o->text_id;
   auto _voice_asset_id = _o->voice_asset_id;
   auto _tags = _o->tags.size() ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>> (_o->tags.size(), [](size_t i, _VectorArgs *__va) { return CreateTag(*__va->__fbb, __va->__o->tags[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _hot_template = _o->hot_template;
   return ICPDev::Gyeol::Schema::CreateLine(
       _fbb,
       _character_id,
       _text_id,
       _voice_asset_id,
-      _tags);
+      _tags,
+      _hot_template);
 }
 
 inline ChoiceT *Choice::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
@@ -4313,6 +5934,7 @@ inline void Choice::UnPackTo(ChoiceT *_o, const ::flatbuffers::resolver_function
   { auto _e = target_node_name_id(); _o->target_node_name_id = _e; }
   { auto _e = condition_var_id(); _o->condition_var_id = _e; }
   { auto _e = choice_modifier(); _o->choice_modifier = _e; }
+  { auto _e = target_node_index(); _o->target_node_index = _e; }
 }
 
 inline ::flatbuffers::Offset<Choice> Choice::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ChoiceT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -4327,17 +5949,20 @@ inline ::flatbuffers::Offset<Choice> CreateChoice(::flatbuffers::FlatBufferBuild
   auto _target_node_name_id = _o->target_node_name_id;
   auto _condition_var_id = _o->condition_var_id;
   auto _choice_modifier = _o->choice_modifier;
+  auto _target_node_index = _o->target_node_index;
   return ICPDev::Gyeol::Schema::CreateChoice(
       _fbb,
       _text_id,
       _target_node_name_id,
       _condition_var_id,
-      _choice_modifier);
+      _choice_modifier,
+      _target_node_index);
 }
 
 inline JumpT::JumpT(const JumpT &o)
       : target_node_name_id(o.target_node_name_id),
-        is_call(o.is_call) {
+        is_call(o.is_call),
+        target_node_index(o.target_node_index) {
   arg_exprs.reserve(o.arg_exprs.size());
   for (const auto &arg_exprs_ : o.arg_exprs) { arg_exprs.emplace_back((arg_exprs_) ? new ICPDev::Gyeol::Schema::ExpressionT(*arg_exprs_) : nullptr); }
 }
@@ -4346,6 +5971,7 @@ inline JumpT &JumpT::operator=(JumpT o) FLATBUFFERS_NOEXCEPT {
   std::swap(target_node_name_id, o.target_node_name_id);
   std::swap(is_call, o.is_call);
   std::swap(arg_exprs, o.arg_exprs);
+  std::swap(target_node_index, o.target_node_index);
   return *this;
 }
 
@@ -4361,6 +5987,7 @@ inline void Jump::UnPackTo(JumpT *_o, const ::flatbuffers::resolver_function_t *
   { auto _e = target_node_name_id(); _o->target_node_name_id = _e; }
   { auto _e = is_call(); _o->is_call = _e; }
   { auto _e = arg_exprs(); if (_e) { _o->arg_exprs.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->arg_exprs[_i]) { _e->Get(_i)->UnPackTo(_o->arg_exprs[_i].get(), _resolver); } else { _o->arg_exprs[_i] = std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->arg_exprs.resize(0); } }
+  { auto _e = target_node_index(); _o->target_node_index = _e; }
 }
 
 inline ::flatbuffers::Offset<Jump> Jump::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const JumpT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -4374,11 +6001,13 @@ inline ::flatbuffers::Offset<Jump> CreateJump(::flatbuffers::FlatBufferBuilder &
   auto _target_node_name_id = _o->target_node_name_id;
   auto _is_call = _o->is_call;
   auto _arg_exprs = _o->arg_exprs.size() ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>> (_o->arg_exprs.size(), [](size_t i, _VectorArgs *__va) { return CreateExpression(*__va->__fbb, __va->__o->arg_exprs[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _target_node_index = _o->target_node_index;
   return ICPDev::Gyeol::Schema::CreateJump(
       _fbb,
       _target_node_name_id,
       _is_call,
-      _arg_exprs);
+      _arg_exprs,
+      _target_node_index);
 }
 
 inline CommandArgT *CommandArg::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
@@ -4522,6 +6151,7 @@ inline void ExprToken::UnPackTo(ExprTokenT *_o, const ::flatbuffers::resolver_fu
   { auto _e = literal_value_type(); _o->literal_value.type = _e; }
   { auto _e = literal_value(); if (_e) _o->literal_value.value = ICPDev::Gyeol::Schema::ValueDataUnion::UnPack(_e, literal_value_type(), _resolver); }
   { auto _e = var_name_id(); _o->var_name_id = _e; }
+  { auto _e = skip(); _o->skip = _e; }
 }
 
 inline ::flatbuffers::Offset<ExprToken> ExprToken::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ExprTokenT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -4536,12 +6166,14 @@ inline ::flatbuffers::Offset<ExprToken> CreateExprToken(::flatbuffers::FlatBuffe
   auto _literal_value_type = _o->literal_value.type;
   auto _literal_value = _o->literal_value.Pack(_fbb);
   auto _var_name_id = _o->var_name_id;
+  auto _skip = _o->skip;
   return ICPDev::Gyeol::Schema::CreateExprToken(
       _fbb,
       _op,
       _literal_value_type,
       _literal_value,
-      _var_name_id);
+      _var_name_id,
+      _skip);
 }
 
 inline ExpressionT::ExpressionT(const ExpressionT &o) {
@@ -4641,7 +6273,9 @@ inline ConditionT::ConditionT(const ConditionT &o)
         false_jump_node_id(o.false_jump_node_id),
         lhs_expr((o.lhs_expr) ? new ICPDev::Gyeol::Schema::ExpressionT(*o.lhs_expr) : nullptr),
         rhs_expr((o.rhs_expr) ? new ICPDev::Gyeol::Schema::ExpressionT(*o.rhs_expr) : nullptr),
-        cond_expr((o.cond_expr) ? new ICPDev::Gyeol::Schema::ExpressionT(*o.cond_expr) : nullptr) {
+        cond_expr((o.cond_expr) ? new ICPDev::Gyeol::Schema::ExpressionT(*o.cond_expr) : nullptr),
+        true_jump_node_index(o.true_jump_node_index),
+        false_jump_node_index(o.false_jump_node_index) {
 }
 
 inline ConditionT &ConditionT::operator=(ConditionT o) FLATBUFFERS_NOEXCEPT {
@@ -4653,6 +6287,8 @@ inline ConditionT &ConditionT::operator=(ConditionT o) FLATBUFFERS_NOEXCEPT {
   std::swap(lhs_expr, o.lhs_expr);
   std::swap(rhs_expr, o.rhs_expr);
   std::swap(cond_expr, o.cond_expr);
+  std::swap(true_jump_node_index, o.true_jump_node_index);
+  std::swap(false_jump_node_index, o.false_jump_node_index);
   return *this;
 }
 
@@ -4674,6 +6310,8 @@ inline void Condition::UnPackTo(ConditionT *_o, const ::flatbuffers::resolver_fu
   { auto _e = lhs_expr(); if (_e) { if(_o->lhs_expr) { _e->UnPackTo(_o->lhs_expr.get(), _resolver); } else { _o->lhs_expr = std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT>(_e->UnPack(_resolver)); } } else if (_o->lhs_expr) { _o->lhs_expr.reset(); } }
   { auto _e = rhs_expr(); if (_e) { if(_o->rhs_expr) { _e->UnPackTo(_o->rhs_expr.get(), _resolver); } else { _o->rhs_expr = std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT>(_e->UnPack(_resolver)); } } else if (_o->rhs_expr) { _o->rhs_expr.reset(); } }
   { auto _e = cond_expr(); if (_e) { if(_o->cond_expr) { _e->UnPackTo(_o->cond_expr.get(), _resolver); } else { _o->cond_expr = std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT>(_e->UnPack(_resolver)); } } else if (_o->cond_expr) { _o->cond_expr.reset(); } }
+  { auto _e = true_jump_node_index(); _o->true_jump_node_index = _e; }
+  { auto _e = false_jump_node_index(); _o->false_jump_node_index = _e; }
 }
 
 inline ::flatbuffers::Offset<Condition> Condition::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ConditionT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -4693,6 +6331,8 @@ inline ::flatbuffers::Offset<Condition> CreateCondition(::flatbuffers::FlatBuffe
   auto _lhs_expr = _o->lhs_expr ? CreateExpression(_fbb, _o->lhs_expr.get(), _rehasher) : 0;
   auto _rhs_expr = _o->rhs_expr ? CreateExpression(_fbb, _o->rhs_expr.get(), _rehasher) : 0;
   auto _cond_expr = _o->cond_expr ? CreateExpression(_fbb, _o->cond_expr.get(), _rehasher) : 0;
+  auto _true_jump_node_index = _o->true_jump_node_index;
+  auto _false_jump_node_index = _o->false_jump_node_index;
   return ICPDev::Gyeol::Schema::CreateCondition(
       _fbb,
       _var_name_id,
@@ -4703,7 +6343,9 @@ inline ::flatbuffers::Offset<Condition> CreateCondition(::flatbuffers::FlatBuffe
       _false_jump_node_id,
       _lhs_expr,
       _rhs_expr,
-      _cond_expr);
+      _cond_expr,
+      _true_jump_node_index,
+      _false_jump_node_index);
 }
 
 inline RandomBranchT *RandomBranch::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
@@ -4717,6 +6359,7 @@ inline void RandomBranch::UnPackTo(RandomBranchT *_o, const ::flatbuffers::resol
   (void)_resolver;
   { auto _e = target_node_name_id(); _o->target_node_name_id = _e; }
   { auto _e = weight(); _o->weight = _e; }
+  { auto _e = target_node_index(); _o->target_node_index = _e; }
 }
 
 inline ::flatbuffers::Offset<RandomBranch> RandomBranch::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const RandomBranchT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -4729,10 +6372,12 @@ inline ::flatbuffers::Offset<RandomBranch> CreateRandomBranch(::flatbuffers::Fla
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const RandomBranchT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _target_node_name_id = _o->target_node_name_id;
   auto _weight = _o->weight;
+  auto _target_node_index = _o->target_node_index;
   return ICPDev::Gyeol::Schema::CreateRandomBranch(
       _fbb,
       _target_node_name_id,
-      _weight);
+      _weight,
+      _target_node_index);
 }
 
 inline RandomT::RandomT(const RandomT &o) {
@@ -4816,7 +6461,8 @@ inline ::flatbuffers::Offset<Return> CreateReturn(::flatbuffers::FlatBufferBuild
 
 inline CallWithReturnT::CallWithReturnT(const CallWithReturnT &o)
       : target_node_name_id(o.target_node_name_id),
-        return_var_name_id(o.return_var_name_id) {
+        return_var_name_id(o.return_var_name_id),
+        target_node_index(o.target_node_index) {
   arg_exprs.reserve(o.arg_exprs.size());
   for (const auto &arg_exprs_ : o.arg_exprs) { arg_exprs.emplace_back((arg_exprs_) ? new ICPDev::Gyeol::Schema::ExpressionT(*arg_exprs_) : nullptr); }
 }
@@ -4825,6 +6471,7 @@ inline CallWithReturnT &CallWithReturnT::operator=(CallWithReturnT o) FLATBUFFER
   std::swap(target_node_name_id, o.target_node_name_id);
   std::swap(return_var_name_id, o.return_var_name_id);
   std::swap(arg_exprs, o.arg_exprs);
+  std::swap(target_node_index, o.target_node_index);
   return *this;
 }
 
@@ -4840,6 +6487,7 @@ inline void CallWithReturn::UnPackTo(CallWithReturnT *_o, const ::flatbuffers::r
   { auto _e = target_node_name_id(); _o->target_node_name_id = _e; }
   { auto _e = return_var_name_id(); _o->return_var_name_id = _e; }
   { auto _e = arg_exprs(); if (_e) { _o->arg_exprs.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->arg_exprs[_i]) { _e->Get(_i)->UnPackTo(_o->arg_exprs[_i].get(), _resolver); } else { _o->arg_exprs[_i] = std::unique_ptr<ICPDev::Gyeol::Schema::ExpressionT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->arg_exprs.resize(0); } }
+  { auto _e = target_node_index(); _o->target_node_index = _e; }
 }
 
 inline ::flatbuffers::Offset<CallWithReturn> CallWithReturn::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CallWithReturnT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -4853,11 +6501,13 @@ inline ::flatbuffers::Offset<CallWithReturn> CreateCallWithReturn(::flatbuffers:
   auto _target_node_name_id = _o->target_node_name_id;
   auto _return_var_name_id = _o->return_var_name_id;
   auto _arg_exprs = _o->arg_exprs.size() ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Expression>> (_o->arg_exprs.size(), [](size_t i, _VectorArgs *__va) { return CreateExpression(*__va->__fbb, __va->__o->arg_exprs[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _target_node_index = _o->target_node_index;
   return ICPDev::Gyeol::Schema::CreateCallWithReturn(
       _fbb,
       _target_node_name_id,
       _return_var_name_id,
-      _arg_exprs);
+      _arg_exprs,
+      _target_node_index);
 }
 
 inline CharacterDefT::CharacterDefT(const CharacterDefT &o)
@@ -4932,7 +6582,8 @@ inline ::flatbuffers::Offset<Instruction> CreateInstruction(::flatbuffers::FlatB
 
 inline NodeT::NodeT(const NodeT &o)
       : name(o.name),
-        param_ids(o.param_ids) {
+        param_ids(o.param_ids),
+        ops(o.ops) {
   lines.reserve(o.lines.size());
   for (const auto &lines_ : o.lines) { lines.emplace_back((lines_) ? new ICPDev::Gyeol::Schema::InstructionT(*lines_) : nullptr); }
   tags.reserve(o.tags.size());
@@ -4944,6 +6595,7 @@ inline NodeT &NodeT::operator=(NodeT o) FLATBUFFERS_NOEXCEPT {
   std::swap(lines, o.lines);
   std::swap(param_ids, o.param_ids);
   std::swap(tags, o.tags);
+  std::swap(ops, o.ops);
   return *this;
 }
 
@@ -4960,6 +6612,7 @@ inline void Node::UnPackTo(NodeT *_o, const ::flatbuffers::resolver_function_t *
   { auto _e = lines(); if (_e) { _o->lines.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->lines[_i]) { _e->Get(_i)->UnPackTo(_o->lines[_i].get(), _resolver); } else { _o->lines[_i] = std::unique_ptr<ICPDev::Gyeol::Schema::InstructionT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->lines.resize(0); } }
   { auto _e = param_ids(); if (_e) { _o->param_ids.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->param_ids[_i] = _e->Get(_i); } } else { _o->param_ids.resize(0); } }
   { auto _e = tags(); if (_e) { _o->tags.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->tags[_i]) { _e->Get(_i)->UnPackTo(_o->tags[_i].get(), _resolver); } else { _o->tags[_i] = std::unique_ptr<ICPDev::Gyeol::Schema::TagT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->tags.resize(0); } }
+  { auto _e = ops(); if (_e) { _o->ops.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->ops[_i] = *_e->Get(_i); } } else { _o->ops.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<Node> Node::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const NodeT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -4974,12 +6627,14 @@ inline ::flatbuffers::Offset<Node> CreateNode(::flatbuffers::FlatBufferBuilder &
   auto _lines = _o->lines.size() ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Instruction>> (_o->lines.size(), [](size_t i, _VectorArgs *__va) { return CreateInstruction(*__va->__fbb, __va->__o->lines[i].get(), __va->__rehasher); }, &_va ) : 0;
   auto _param_ids = _o->param_ids.size() ? _fbb.CreateVector(_o->param_ids) : 0;
   auto _tags = _o->tags.size() ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Tag>> (_o->tags.size(), [](size_t i, _VectorArgs *__va) { return CreateTag(*__va->__fbb, __va->__o->tags[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _ops = _o->ops.size() ? _fbb.CreateVectorOfStructs(_o->ops) : 0;
   return ICPDev::Gyeol::Schema::CreateNode(
       _fbb,
       _name,
       _lines,
       _param_ids,
-      _tags);
+      _tags,
+      _ops);
 }
 
 inline SavedVarT *SavedVar::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
@@ -5272,11 +6927,344 @@ inline ::flatbuffers::Offset<SaveState> CreateSaveState(::flatbuffers::FlatBuffe
       _chosen_once_choices);
 }
 
+inline CompiledLocalePropertyT *CompiledLocaleProperty::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<CompiledLocalePropertyT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void CompiledLocaleProperty::UnPackTo(CompiledLocalePropertyT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = key(); if (_e) _o->key = _e->str(); }
+  { auto _e = value(); if (_e) _o->value = _e->str(); }
+}
+
+inline ::flatbuffers::Offset<CompiledLocaleProperty> CompiledLocaleProperty::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocalePropertyT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateCompiledLocaleProperty(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<CompiledLocaleProperty> CreateCompiledLocaleProperty(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocalePropertyT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const CompiledLocalePropertyT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _key = _o->key.empty() ? 0 : _fbb.CreateString(_o->key);
+  auto _value = _o->value.empty() ? 0 : _fbb.CreateString(_o->value);
+  return ICPDev::Gyeol::Schema::CreateCompiledLocaleProperty(
+      _fbb,
+      _key,
+      _value);
+}
+
+inline CompiledLocaleCharacterT::CompiledLocaleCharacterT(const CompiledLocaleCharacterT &o)
+      : character_id(o.character_id) {
+  properties.reserve(o.properties.size());
+  for (const auto &properties_ : o.properties) { properties.emplace_back((properties_) ? new ICPDev::Gyeol::Schema::CompiledLocalePropertyT(*properties_) : nullptr); }
+}
+
+inline CompiledLocaleCharacterT &CompiledLocaleCharacterT::operator=(CompiledLocaleCharacterT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(character_id, o.character_id);
+  std::swap(properties, o.properties);
+  return *this;
+}
+
+inline CompiledLocaleCharacterT *CompiledLocaleCharacter::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<CompiledLocaleCharacterT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void CompiledLocaleCharacter::UnPackTo(CompiledLocaleCharacterT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = character_id(); if (_e) _o->character_id = _e->str(); }
+  { auto _e = properties(); if (_e) { _o->properties.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->properties[_i]) { _e->Get(_i)->UnPackTo(_o->properties[_i].get(), _resolver); } else { _o->properties[_i] = std::unique_ptr<ICPDev::Gyeol::Schema::CompiledLocalePropertyT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->properties.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<CompiledLocaleCharacter> CompiledLocaleCharacter::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocaleCharacterT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateCompiledLocaleCharacter(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<CompiledLocaleCharacter> CreateCompiledLocaleCharacter(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocaleCharacterT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const CompiledLocaleCharacterT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _character_id = _o->character_id.empty() ? 0 : _fbb.CreateString(_o->character_id);
+  auto _properties = _o->properties.size() ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleProperty>> (_o->properties.size(), [](size_t i, _VectorArgs *__va) { return CreateCompiledLocaleProperty(*__va->__fbb, __va->__o->properties[i].get(), __va->__rehasher); }, &_va ) : 0;
+  return ICPDev::Gyeol::Schema::CreateCompiledLocaleCharacter(
+      _fbb,
+      _character_id,
+      _properties);
+}
+
+inline CompiledLocaleT::CompiledLocaleT(const CompiledLocaleT &o)
+      : locale(o.locale),
+        fallback_chain(o.fallback_chain),
+        line_text_ids(o.line_text_ids) {
+  characters.reserve(o.characters.size());
+  for (const auto &characters_ : o.characters) { characters.emplace_back((characters_) ? new ICPDev::Gyeol::Schema::CompiledLocaleCharacterT(*characters_) : nullptr); }
+}
+
+inline CompiledLocaleT &CompiledLocaleT::operator=(CompiledLocaleT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(locale, o.locale);
+  std::swap(fallback_chain, o.fallback_chain);
+  std::swap(line_text_ids, o.line_text_ids);
+  std::swap(characters, o.characters);
+  return *this;
+}
+
+inline CompiledLocaleT *CompiledLocale::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<CompiledLocaleT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void CompiledLocale::UnPackTo(CompiledLocaleT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = locale(); if (_e) _o->locale = _e->str(); }
+  { auto _e = fallback_chain(); if (_e) { _o->fallback_chain.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->fallback_chain[_i] = _e->Get(_i)->str(); } } else { _o->fallback_chain.resize(0); } }
+  { auto _e = line_text_ids(); if (_e) { _o->line_text_ids.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->line_text_ids[_i] = _e->Get(_i); } } else { _o->line_text_ids.resize(0); } }
+  { auto _e = characters(); if (_e) { _o->characters.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->characters[_i]) { _e->Get(_i)->UnPackTo(_o->characters[_i].get(), _resolver); } else { _o->characters[_i] = std::unique_ptr<ICPDev::Gyeol::Schema::CompiledLocaleCharacterT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->characters.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<CompiledLocale> CompiledLocale::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocaleT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateCompiledLocale(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<CompiledLocale> CreateCompiledLocale(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocaleT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const CompiledLocaleT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _locale = _o->locale.empty() ? 0 : _fbb.CreateString(_o->locale);
+  auto _fallback_chain = _o->fallback_chain.size() ? _fbb.CreateVectorOfStrings(_o->fallback_chain) : 0;
+  auto _line_text_ids = _o->line_text_ids.size() ? _fbb.CreateVector(_o->line_text_ids) : 0;
+  auto _characters = _o->characters.size() ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocaleCharacter>> (_o->characters.size(), [](size_t i, _VectorArgs *__va) { return CreateCompiledLocaleCharacter(*__va->__fbb, __va->__o->characters[i].get(), __va->__rehasher); }, &_va ) : 0;
+  return ICPDev::Gyeol::Schema::CreateCompiledLocale(
+      _fbb,
+      _locale,
+      _fallback_chain,
+      _line_text_ids,
+      _characters);
+}
+
+inline CompiledLocaleCatalogT::CompiledLocaleCatalogT(const CompiledLocaleCatalogT &o)
+      : version(o.version),
+        default_locale(o.default_locale),
+        string_pool_size(o.string_pool_size),
+        texts(o.texts) {
+  locales.reserve(o.locales.size());
+  for (const auto &locales_ : o.locales) { locales.emplace_back((locales_) ? new ICPDev::Gyeol::Schema::CompiledLocaleT(*locales_) : nullptr); }
+}
+
+inline CompiledLocaleCatalogT &CompiledLocaleCatalogT::operator=(CompiledLocaleCatalogT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(version, o.version);
+  std::swap(default_locale, o.default_locale);
+  std::swap(string_pool_size, o.string_pool_size);
+  std::swap(texts, o.texts);
+  std::swap(locales, o.locales);
+  return *this;
+}
+
+inline CompiledLocaleCatalogT *CompiledLocaleCatalog::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<CompiledLocaleCatalogT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void CompiledLocaleCatalog::UnPackTo(CompiledLocaleCatalogT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = version(); _o->version = _e; }
+  { auto _e = default_locale(); if (_e) _o->default_locale = _e->str(); }
+  { auto _e = string_pool_size(); _o->string_pool_size = _e; }
+  { auto _e = texts(); if (_e) { _o->texts.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->texts[_i] = _e->Get(_i)->str(); } } else { _o->texts.resize(0); } }
+  { auto _e = locales(); if (_e) { _o->locales.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->locales[_i]) { _e->Get(_i)->UnPackTo(_o->locales[_i].get(), _resolver); } else { _o->locales[_i] = std::unique_ptr<ICPDev::Gyeol::Schema::CompiledLocaleT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->locales.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<CompiledLocaleCatalog> CompiledLocaleCatalog::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocaleCatalogT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateCompiledLocaleCatalog(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<CompiledLocaleCatalog> CreateCompiledLocaleCatalog(::flatbuffers::FlatBufferBuilder &_fbb, const CompiledLocaleCatalogT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const CompiledLocaleCatalogT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _version = _o->version;
+  auto _default_locale = _o->default_locale.empty() ? 0 : _fbb.CreateString(_o->default_locale);
+  auto _string_pool_size = _o->string_pool_size;
+  auto _texts = _o->texts.size() ? _fbb.CreateVectorOfStrings(_o->texts) : 0;
+  auto _locales = _o->locales.size() ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CompiledLocale>> (_o->locales.size(), [](size_t i, _VectorArgs *__va) { return CreateCompiledLocale(*__va->__fbb, __va->__o->locales[i].get(), __va->__rehasher); }, &_va ) : 0;
+  return ICPDev::Gyeol::Schema::CreateCompiledLocaleCatalog(
+      _fbb,
+      _version,
+      _default_locale,
+      _string_pool_size,
+      _texts,
+      _locales);
+}
+
+inline StoryChunkEntryT *StoryChunkEntry::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<StoryChunkEntryT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void StoryChunkEntry::UnPackTo(StoryChunkEntryT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = name(); if (_e) _o->name = _e->str(); }
+  { auto _e = path(); if (_e) _o->path = _e->str(); }
+  { auto _e = size(); _o->size = _e; }
+  { auto _e = node_names(); if (_e) { _o->node_names.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->node_names[_i] = _e->Get(_i)->str(); } } else { _o->node_names.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<StoryChunkEntry> StoryChunkEntry::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const StoryChunkEntryT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateStoryChunkEntry(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<StoryChunkEntry> CreateStoryChunkEntry(::flatbuffers::FlatBufferBuilder &_fbb, const StoryChunkEntryT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const StoryChunkEntryT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _name = _o->name.empty() ? 0 : _fbb.CreateString(_o->name);
+  auto _path = _o->path.empty() ? 0 : _fbb.CreateString(_o->path);
+  auto _size = _o->size;
+  auto _node_names = _o->node_names.size() ? _fbb.CreateVectorOfStrings(_o->node_names) : 0;
+  return ICPDev::Gyeol::Schema::CreateStoryChunkEntry(
+      _fbb,
+      _name,
+      _path,
+      _size,
+      _node_names);
+}
+
+inline StoryChunkIndexT::StoryChunkIndexT(const StoryChunkIndexT &o)
+      : version(o.version),
+        start_node_name(o.start_node_name) {
+  chunks.reserve(o.chunks.size());
+  for (const auto &chunks_ : o.chunks) { chunks.emplace_back((chunks_) ? new ICPDev::Gyeol::Schema::StoryChunkEntryT(*chunks_) : nullptr); }
+}
+
+inline StoryChunkIndexT &StoryChunkIndexT::operator=(StoryChunkIndexT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(version, o.version);
+  std::swap(start_node_name, o.start_node_name);
+  std::swap(chunks, o.chunks);
+  return *this;
+}
+
+inline StoryChunkIndexT *StoryChunkIndex::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<StoryChunkIndexT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void StoryChunkIndex::UnPackTo(StoryChunkIndexT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = version(); _o->version = _e; }
+  { auto _e = start_node_name(); if (_e) _o->start_node_name = _e->str(); }
+  { auto _e = chunks(); if (_e) { _o->chunks.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->chunks[_i]) { _e->Get(_i)->UnPackTo(_o->chunks[_i].get(), _resolver); } else { _o->chunks[_i] = std::unique_ptr<ICPDev::Gyeol::Schema::StoryChunkEntryT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->chunks.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<StoryChunkIndex> StoryChunkIndex::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const StoryChunkIndexT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateStoryChunkIndex(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<StoryChunkIndex> CreateStoryChunkIndex(::flatbuffers::FlatBufferBuilder &_fbb, const StoryChunkIndexT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const StoryChunkIndexT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _version = _o->version;
+  auto _start_node_name = _o->start_node_name.empty() ? 0 : _fbb.CreateString(_o->start_node_name);
+  auto _chunks = _o->chunks.size() ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::StoryChunkEntry>> (_o->chunks.size(), [](size_t i, _VectorArgs *__va) { return CreateStoryChunkEntry(*__va->__fbb, __va->__o->chunks[i].get(), __va->__rehasher); }, &_va ) : 0;
+  return ICPDev::Gyeol::Schema::CreateStoryChunkIndex(
+      _fbb,
+      _version,
+      _start_node_name,
+      _chunks);
+}
+
+inline CompressedStringPoolT *CompressedStringPool::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<CompressedStringPoolT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void CompressedStringPool::UnPackTo(CompressedStringPoolT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = codec(); _o->codec = _e; }
+  { auto _e = dictionary(); if (_e) { _o->dictionary.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->dictionary.begin()); } }
+  { auto _e = entries(); if (_e) { _o->entries.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->entries[_i] = _e->Get(_i); } } else { _o->entries.resize(0); } }
+  { auto _e = block_first_entry(); if (_e) { _o->block_first_entry.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->block_first_entry[_i] = _e->Get(_i); } } else { _o->block_first_entry.resize(0); } }
+  { auto _e = block_offsets(); if (_e) { _o->block_offsets.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->block_offsets[_i] = _e->Get(_i); } } else { _o->block_offsets.resize(0); } }
+  { auto _e = block_raw_sizes(); if (_e) { _o->block_raw_sizes.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->block_raw_sizes[_i] = _e->Get(_i); } } else { _o->block_raw_sizes.resize(0); } }
+  { auto _e = data(); if (_e) { _o->data.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->data.begin()); } }
+}
+
+inline ::flatbuffers::Offset<CompressedStringPool> CompressedStringPool::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CompressedStringPoolT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateCompressedStringPool(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<CompressedStringPool> CreateCompressedStringPool(::flatbuffers::FlatBufferBuilder &_fbb, const CompressedStringPoolT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const CompressedStringPoolT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _codec = _o->codec;
+  auto _dictionary = _o->dictionary.size() ? _fbb.CreateVector(_o->dictionary) : 0;
+  auto _entries = _o->entries.size() ? _fbb.CreateVector(_o->entries) : 0;
+  auto _block_first_entry = _o->block_first_entry.size() ? _fbb.CreateVector(_o->block_first_entry) : 0;
+  auto _block_offsets = _o->block_offsets.size() ? _fbb.CreateVector(_o->block_offsets) : 0;
+  auto _block_raw_sizes = _o->block_raw_sizes.size() ? _fbb.CreateVector(_o->block_raw_sizes) : 0;
+  auto _data = _o->data.size() ? _fbb.CreateVector(_o->data) : 0;
+  return ICPDev::Gyeol::Schema::CreateCompressedStringPool(
+      _fbb,
+      _codec,
+      _dictionary,
+      _entries,
+      _block_first_entry,
+      _block_offsets,
+      _block_raw_sizes,
+      _data);
+}
+
+inline NodeNameTableT *NodeNameTable::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<NodeNameTableT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void NodeNameTable::UnPackTo(NodeNameTableT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = seeds(); if (_e) { _o->seeds.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->seeds[_i] = _e->Get(_i); } } else { _o->seeds.resize(0); } }
+  { auto _e = slots(); if (_e) { _o->slots.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->slots[_i] = _e->Get(_i); } } else { _o->slots.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<NodeNameTable> NodeNameTable::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const NodeNameTableT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateNodeNameTable(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<NodeNameTable> CreateNodeNameTable(::flatbuffers::FlatBufferBuilder &_fbb, const NodeNameTableT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const NodeNameTableT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _seeds = _o->seeds.size() ? _fbb.CreateVector(_o->seeds) : 0;
+  auto _slots = _o->slots.size() ? _fbb.CreateVector(_o->slots) : 0;
+  return ICPDev::Gyeol::Schema::CreateNodeNameTable(
+      _fbb,
+      _seeds,
+      _slots);
+}
+
 inline StoryT::StoryT(const StoryT &o)
       : version(o.version),
         string_pool(o.string_pool),
         line_ids(o.line_ids),
-        start_node_name(o.start_node_name) {
+        start_node_name(o.start_node_name),
+        compressed_pool((o.compressed_pool) ? new ICPDev::Gyeol::Schema::CompressedStringPoolT(*o.compressed_pool) : nullptr),
+        node_names((o.node_names) ? new ICPDev::Gyeol::Schema::NodeNameTableT(*o.node_names) : nullptr) {
   global_vars.reserve(o.global_vars.size());
   for (const auto &global_vars_ : o.global_vars) { global_vars.emplace_back((global_vars_) ? new ICPDev::Gyeol::Schema::SetVarT(*global_vars_) : nullptr); }
   nodes.reserve(o.nodes.size());
@@ -5293,6 +7281,8 @@ inline StoryT &StoryT::operator=(StoryT o) FLATBUFFERS_NOEXCEPT {
   std::swap(nodes, o.nodes);
   std::swap(start_node_name, o.start_node_name);
   std::swap(characters, o.characters);
+  std::swap(compressed_pool, o.compressed_pool);
+  std::swap(node_names, o.node_names);
   return *this;
 }
 
@@ -5312,6 +7302,8 @@ inline void Story::UnPackTo(StoryT *_o, const ::flatbuffers::resolver_function_t
   { auto _e = nodes(); if (_e) { _o->nodes.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->nodes[_i]) { _e->Get(_i)->UnPackTo(_o->nodes[_i].get(), _resolver); } else { _o->nodes[_i] = std::unique_ptr<ICPDev::Gyeol::Schema::NodeT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->nodes.resize(0); } }
   { auto _e = start_node_name(); if (_e) _o->start_node_name = _e->str(); }
   { auto _e = characters(); if (_e) { _o->characters.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->characters[_i]) { _e->Get(_i)->UnPackTo(_o->characters[_i].get(), _resolver); } else { _o->characters[_i] = std::unique_ptr<ICPDev::Gyeol::Schema::CharacterDefT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->characters.resize(0); } }
+  { auto _e = compressed_pool(); if (_e) { if(_o->compressed_pool) { _e->UnPackTo(_o->compressed_pool.get(), _resolver); } else { _o->compressed_pool = std::unique_ptr<ICPDev::Gyeol::Schema::CompressedStringPoolT>(_e->UnPack(_resolver)); } } else if (_o->compressed_pool) { _o->compressed_pool.reset(); } }
+  { auto _e = node_names(); if (_e) { if(_o->node_names) { _e->UnPackTo(_o->node_names.get(), _resolver); } else { _o->node_names = std::unique_ptr<ICPDev::Gyeol::Schema::NodeNameTableT>(_e->UnPack(_resolver)); } } else if (_o->node_names) { _o->node_names.reset(); } }
 }
 
 inline ::flatbuffers::Offset<Story> Story::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const StoryT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -5329,6 +7321,8 @@ inline ::flatbuffers::Offset<Story> CreateStory(::flatbuffers::FlatBufferBuilder
   auto _nodes = _o->nodes.size() ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::Node>> (_o->nodes.size(), [](size_t i, _VectorArgs *__va) { return CreateNode(*__va->__fbb, __va->__o->nodes[i].get(), __va->__rehasher); }, &_va ) : 0;
   auto _start_node_name = _o->start_node_name.empty() ? 0 : _fbb.CreateString(_o->start_node_name);
   auto _characters = _o->characters.size() ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::CharacterDef>> (_o->characters.size(), [](size_t i, _VectorArgs *__va) { return CreateCharacterDef(*__va->__fbb, __va->__o->characters[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _compressed_pool = _o->compressed_pool ? CreateCompressedStringPool(_fbb, _o->compressed_pool.get(), _rehasher) : 0;
+  auto _node_names = _o->node_names ? CreateNodeNameTable(_fbb, _o->node_names.get(), _rehasher) : 0;
   return ICPDev::Gyeol::Schema::CreateStory(
       _fbb,
       _version,
@@ -5337,7 +7331,174 @@ inline ::flatbuffers::Offset<Story> CreateStory(::flatbuffers::FlatBufferBuilder
       _global_vars,
       _nodes,
       _start_node_name,
-      _characters);
+      _characters,
+      _compressed_pool,
+      _node_names);
+}
+
+inline FragmentImportMarkerT *FragmentImportMarker::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<FragmentImportMarkerT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void FragmentImportMarker::UnPackTo(FragmentImportMarkerT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = line(); _o->line = _e; }
+  { auto _e = import_path(); if (_e) _o->import_path = _e->str(); }
+  { auto _e = abs_path(); if (_e) _o->abs_path = _e->str(); }
+  { auto _e = pool_events(); _o->pool_events = _e; }
+  { auto _e = errors(); _o->errors = _e; }
+  { auto _e = warnings(); _o->warnings = _e; }
+  { auto _e = nodes(); _o->nodes = _e; }
+}
+
+inline ::flatbuffers::Offset<FragmentImportMarker> FragmentImportMarker::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const FragmentImportMarkerT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateFragmentImportMarker(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<FragmentImportMarker> CreateFragmentImportMarker(::flatbuffers::FlatBufferBuilder &_fbb, const FragmentImportMarkerT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const FragmentImportMarkerT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _line = _o->line;
+  auto _import_path = _o->import_path.empty() ? 0 : _fbb.CreateString(_o->import_path);
+  auto _abs_path = _o->abs_path.empty() ? 0 : _fbb.CreateString(_o->abs_path);
+  auto _pool_events = _o->pool_events;
+  auto _errors = _o->errors;
+  auto _warnings = _o->warnings;
+  auto _nodes = _o->nodes;
+  return ICPDev::Gyeol::Schema::CreateFragmentImportMarker(
+      _fbb,
+      _line,
+      _import_path,
+      _abs_path,
+      _pool_events,
+      _errors,
+      _warnings,
+      _nodes);
+}
+
+inline ParsedFragmentT::ParsedFragmentT(const ParsedFragmentT &o)
+      : format_version(o.format_version),
+        compiler_version(o.compiler_version),
+        source_path(o.source_path),
+        content_hash(o.content_hash),
+        main_file(o.main_file),
+        story((o.story) ? new ICPDev::Gyeol::Schema::StoryT(*o.story) : nullptr),
+        pool_event_ids(o.pool_event_ids),
+        pool_event_line_ids(o.pool_event_line_ids),
+        errors(o.errors),
+        warnings(o.warnings),
+        instr_nodes(o.instr_nodes),
+        instr_indices(o.instr_indices),
+        instr_lines(o.instr_lines),
+        used_characters(o.used_characters),
+        defined_characters(o.defined_characters),
+        start_node_set(o.start_node_set),
+        fragment_issue(o.fragment_issue) {
+  import_markers.reserve(o.import_markers.size());
+  for (const auto &import_markers_ : o.import_markers) { import_markers.emplace_back((import_markers_) ? new ICPDev::Gyeol::Schema::FragmentImportMarkerT(*import_markers_) : nullptr); }
+}
+
+inline ParsedFragmentT &ParsedFragmentT::operator=(ParsedFragmentT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(format_version, o.format_version);
+  std::swap(compiler_version, o.compiler_version);
+  std::swap(source_path, o.source_path);
+  std::swap(content_hash, o.content_hash);
+  std::swap(main_file, o.main_file);
+  std::swap(story, o.story);
+  std::swap(pool_event_ids, o.pool_event_ids);
+  std::swap(pool_event_line_ids, o.pool_event_line_ids);
+  std::swap(import_markers, o.import_markers);
+  std::swap(errors, o.errors);
+  std::swap(warnings, o.warnings);
+  std::swap(instr_nodes, o.instr_nodes);
+  std::swap(instr_indices, o.instr_indices);
+  std::swap(instr_lines, o.instr_lines);
+  std::swap(used_characters, o.used_characters);
+  std::swap(defined_characters, o.defined_characters);
+  std::swap(start_node_set, o.start_node_set);
+  std::swap(fragment_issue, o.fragment_issue);
+  return *this;
+}
+
+inline ParsedFragmentT *ParsedFragment::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<ParsedFragmentT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void ParsedFragment::UnPackTo(ParsedFragmentT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = format_version(); _o->format_version = _e; }
+  { auto _e = compiler_version(); if (_e) _o->compiler_version = _e->str(); }
+  { auto _e = source_path(); if (_e) _o->source_path = _e->str(); }
+  { auto _e = content_hash(); if (_e) _o->content_hash = _e->str(); }
+  { auto _e = main_file(); _o->main_file = _e; }
+  { auto _e = story(); if (_e) { if(_o->story) { _e->UnPackTo(_o->story.get(), _resolver); } else { _o->story = std::unique_ptr<ICPDev::Gyeol::Schema::StoryT>(_e->UnPack(_resolver)); } } else if (_o->story) { _o->story.reset(); } }
+  { auto _e = pool_event_ids(); if (_e) { _o->pool_event_ids.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->pool_event_ids[_i] = _e->Get(_i); } } else { _o->pool_event_ids.resize(0); } }
+  { auto _e = pool_event_line_ids(); if (_e) { _o->pool_event_line_ids.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->pool_event_line_ids.begin()); } }
+  { auto _e = import_markers(); if (_e) { _o->import_markers.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->import_markers[_i]) { _e->Get(_i)->UnPackTo(_o->import_markers[_i].get(), _resolver); } else { _o->import_markers[_i] = std::unique_ptr<ICPDev::Gyeol::Schema::FragmentImportMarkerT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->import_markers.resize(0); } }
+  { auto _e = errors(); if (_e) { _o->errors.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->errors[_i] = _e->Get(_i)->str(); } } else { _o->errors.resize(0); } }
+  { auto _e = warnings(); if (_e) { _o->warnings.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->warnings[_i] = _e->Get(_i)->str(); } } else { _o->warnings.resize(0); } }
+  { auto _e = instr_nodes(); if (_e) { _o->instr_nodes.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->instr_nodes[_i] = _e->Get(_i); } } else { _o->instr_nodes.resize(0); } }
+  { auto _e = instr_indices(); if (_e) { _o->instr_indices.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->instr_indices[_i] = _e->Get(_i); } } else { _o->instr_indices.resize(0); } }
+  { auto _e = instr_lines(); if (_e) { _o->instr_lines.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->instr_lines[_i] = _e->Get(_i); } } else { _o->instr_lines.resize(0); } }
+  { auto _e = used_characters(); if (_e) { _o->used_characters.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->used_characters[_i] = _e->Get(_i); } } else { _o->used_characters.resize(0); } }
+  { auto _e = defined_characters(); if (_e) { _o->defined_characters.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->defined_characters[_i] = _e->Get(_i)->str(); } } else { _o->defined_characters.resize(0); } }
+  { auto _e = start_node_set(); _o->start_node_set = _e; }
+  { auto _e = fragment_issue(); if (_e) _o->fragment_issue = _e->str(); }
+}
+
+inline ::flatbuffers::Offset<ParsedFragment> ParsedFragment::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ParsedFragmentT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateParsedFragment(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<ParsedFragment> CreateParsedFragment(::flatbuffers::FlatBufferBuilder &_fbb, const ParsedFragmentT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const ParsedFragmentT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _format_version = _o->format_version;
+  auto _compiler_version = _o->compiler_version.empty() ? 0 : _fbb.CreateString(_o->compiler_version);
+  auto _source_path = _o->source_path.empty() ? 0 : _fbb.CreateString(_o->source_path);
+  auto _content_hash = _o->content_hash.empty() ? 0 : _fbb.CreateString(_o->content_hash);
+  auto _main_file = _o->main_file;
+  auto _story = _o->story ? CreateStory(_fbb, _o->story.get(), _rehasher) : 0;
+  auto _pool_event_ids = _o->pool_event_ids.size() ? _fbb.CreateVector(_o->pool_event_ids) : 0;
+  auto _pool_event_line_ids = _o->pool_event_line_ids.size() ? _fbb.CreateVector(_o->pool_event_line_ids) : 0;
+  auto _import_markers = _o->import_markers.size() ? _fbb.CreateVector<::flatbuffers::Offset<ICPDev::Gyeol::Schema::FragmentImportMarker>> (_o->import_markers.size(), [](size_t i, _VectorArgs *__va) { return CreateFragmentImportMarker(*__va->__fbb, __va->__o->import_markers[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _errors = _o->errors.size() ? _fbb.CreateVectorOfStrings(_o->errors) : 0;
+  auto _warnings = _o->warnings.size() ? _fbb.CreateVectorOfStrings(_o->warnings) : 0;
+  auto _instr_nodes = _o->instr_nodes.size() ? _fbb.CreateVector(_o->instr_nodes) : 0;
+  auto _instr_indices = _o->instr_indices.size() ? _fbb.CreateVector(_o->instr_indices) : 0;
+  auto _instr_lines = _o->instr_lines.size() ? _fbb.CreateVector(_o->instr_lines) : 0;
+  auto _used_characters = _o->used_characters.size() ? _fbb.CreateVector(_o->used_characters) : 0;
+  auto _defined_characters = _o->defined_characters.size() ? _fbb.CreateVectorOfStrings(_o->defined_characters) : 0;
+  auto _start_node_set = _o->start_node_set;
+  auto _fragment_issue = _o->fragment_issue.empty() ? 0 : _fbb.CreateString(_o->fragment_issue);
+  return ICPDev::Gyeol::Schema::CreateParsedFragment(
+      _fbb,
+      _format_version,
+      _compiler_version,
+      _source_path,
+      _content_hash,
+      _main_file,
+      _story,
+      _pool_event_ids,
+      _pool_event_line_ids,
+      _import_markers,
+      _errors,
+      _warnings,
+      _instr_nodes,
+      _instr_indices,
+      _instr_lines,
+      _used_characters,
+      _defined_characters,
+      _start_node_set,
+      _fragment_issue);
 }
 
 inline bool VerifyValueData(::flatbuffers::Verifier &verifier, const void *obj, ValueData type) {
@@ -0,0 +1,85 @@
+#pragma once
+#include "gyeol_runner.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// AOT(ahead-of-time) 스토리 실행.
+// GyeolCompiler --emit-cpp가 .gyb 하나를 C++ 소스로 바꾸고, 게임이 그 소스를 함께 빌드해
+// Runner::setAotProgram()으로 넘긴다. 노드마다 함수 하나(명령 위치별 case가 있는 상태 기계)가 되고
+// SetVar/Condition/Jump/Yield와 식은 네이티브 코드로, 나머지 명령은 인터프리터 핸들러로 실행한다.
+// 변수/방문 수/콜스택 같은 상태는 Runner가 그대로 가지므로 save/load, 스냅샷, 로케일이 같이 동작한다.
+
+namespace Gyeol {
+
+class AotContext;
+
+// 노드 함수: 결과가 준비되면 true, 노드/위치가 바뀌었거나 노드 끝이면 false (Runner가 다시 dispatch)
+using AotNodeFn = bool (*)(AotContext& ctx, StepResult& result);
+
+struct AotProgram {
+    uint64_t storyHash = 0;   // 생성에 쓴 .gyb 바이트의 aotStoryHash()
+    uint64_t storySize = 0;   // 생성에 쓴 .gyb 크기
+    uint32_t nodeCount = 0;
+    const char* const* nodeNames = nullptr; // nodes 순서
+    const AotNodeFn* nodes = nullptr;
+};
+
+// .gyb 바이트 해시 (FNV-1a 64). start()한 버퍼가 프로그램과 같은 스토리인지 확인한다.
+inline uint64_t aotStoryHash(const uint8_t* data, size_t size) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// 생성 코드가 Runner 상태에 접근하는 통로
+class AotContext {
+public:
+    uint32_t pc() const;
+    // 명령 하나를 시작한다 (pc = 명령 위치 + 1, 인터프리터와 같음).
+    // 명령 예산이 다 되었고 예산 검사 지점이면 pc를 두고 result를 예산 YIELD로 채운 뒤 false
+    bool begin(uint32_t nextPc, StepResult& result);
+    // 위임한 명령 뒤에도 같은 노드/위치인지 (call, 선택지 등으로 바뀌면 false)
+    bool at(uint32_t node, uint32_t nextPc) const;
+    // 현재 명령(pc - 1)을 인터프리터 핸들러로 실행
+    bool execute(StepResult& result);
+    // 노드로 이동 (방문 수 증가)
+    void jump(uint32_t node);
+    // Jump/Condition 명령 집계 (인터프리터와 같은 지표)
+    void countJump();
+    void countCondition();
+
+    const Variant& get(const std::string& name) const; // 없으면 Int(0)
+    void assign(const std::string& name, Variant value);
+    int32_t visitCount(const std::string& node) const;
+    int32_t listLength(const std::string& name) const;
+
+private:
+    friend class Runner;
+    explicit AotContext(Runner& runner) : runner_(runner) {}
+    Runner& runner_;
+};
+
+// 식 연산 (인터프리터 evaluateExpression과 같은 규칙)
+namespace Aot {
+Variant add(const Variant& a, const Variant& b);
+Variant sub(const Variant& a, const Variant& b);
+Variant mul(const Variant& a, const Variant& b);
+Variant div(const Variant& a, const Variant& b);
+Variant mod(const Variant& a, const Variant& b);
+Variant neg(const Variant& v);
+bool eq(const Variant& a, const Variant& b);
+bool ne(const Variant& a, const Variant& b);
+bool gt(const Variant& a, const Variant& b);
+bool lt(const Variant& a, const Variant& b);
+bool ge(const Variant& a, const Variant& b);
+bool le(const Variant& a, const Variant& b);
+bool truthy(const Variant& v);
+bool contains(const Variant& list, const Variant& item);
+} // namespace Aot
+
+} // namespace Gyeol
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Gyeol {
+
+class Runner;
+
+// characterId → (key → value)
+using LocaleCharacterProps = std::unordered_map<std::string, std::unordered_map<std::string, std::string>>;
+
+// fallback 체인(requested → base → default)을 미리 적용한 불변 테이블.
+// lines는 string_pool과 병렬이며 nullptr이면 원본 문자열을 사용한다.
+struct LocaleTable {
+    std::string resolvedLocale;
+    std::vector<const char*> lines;
+    LocaleCharacterProps characterProps;
+    std::shared_ptr<const void> owner; // lines가 가리키는 문자열 보관자 (카탈로그 테이블은 비어있음)
+};
+
+// 여러 Runner가 공유하는 로케일 카탈로그.
+// 한 번 로드하면 내용은 불변이며, locale별 해석 테이블은 최초 요청 시 만들어
+// 캐시한다. 참조 카운트(shared_ptr)로 관리되고 여러 스레드에서 동시에 사용해도 안전하다.
+class LocaleCatalog {
+public:
+    // story 버퍼의 string_pool/line_ids 기준으로 catalog(JSON v2 또는 .gylc)를 읽는다.
+    static std::shared_ptr<LocaleCatalog> load(const uint8_t* storyBuffer, size_t storySize,
+                                               const std::string& path,
+                                               std::string* errorOut = nullptr);
+
+    const std::string& getDefaultLocale() const { return defaultLocale_; }
+    size_t getStringPoolSize() const { return stringPoolSize_; }
+    std::vector<std::string> getLocales() const;
+    bool isCompiled() const { return compiled_ != nullptr; }
+
+    // 요청 locale의 해석 테이블 (캐시됨, 해석할 수 없으면 nullptr)
+    std::shared_ptr<const LocaleTable> resolve(const std::string& requestedLocale) const;
+
+    // "ko-KR" → "ko"
+    static std::string baseLocaleCode(const std::string& localeCode);
+
+private:
+    friend class Runner;
+    LocaleCatalog() = default;
+
+    static std::shared_ptr<LocaleCatalog> loadForStory(const void* story, const std::string& path,
+                                                       std::string* errorOut);
+    static std::shared_ptr<LocaleCatalog> loadCompiled(const void* story, const std::string& path,
+                                                       std::string* errorOut);
+    std::shared_ptr<const LocaleTable> buildTable(const std::string& requestedLocale) const;
+
+    std::string defaultLocale_;
+    size_t stringPoolSize_ = 0;
+
+    // JSON catalog (line id는 string_pool 인덱스로 변환된 상태)
+    std::unordered_map<std::string, std::unordered_map<int32_t, std::string>> lineEntriesByLocale_;
+    std::unordered_map<std::string, LocaleCharacterProps> characterEntriesByLocale_;
+
+    // 바이너리 catalog(.gylc): 매핑된 버퍼를 복사 없이 그대로 참조
+    std::shared_ptr<const void> mappedFile_;
+    const void* compiled_ = nullptr; // CompiledLocaleCatalog 루트
+    std::unordered_map<std::string, uint32_t> compiledLocaleIndex_;
+
+    mutable std::mutex mutex_;
+    mutable std::unordered_map<std::string, std::shared_ptr<const LocaleTable>> tables_;
+};
+
+} // namespace Gyeol
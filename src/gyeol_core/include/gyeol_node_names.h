@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace Gyeol {
+
+// Story.node_names 완전 해시 (hash-and-displace, 이름 → nodes 인덱스).
+//   bucket = hash(name, 0) % seeds 길이
+//   slot   = hash(name, seeds[bucket]) % slots 길이
+// 표는 컴파일러(StoryLinker)가 만들고 런타임은 조회만 한다. 양쪽이 같은 함수를 써야 한다.
+namespace NodeNameHash {
+
+// FNV-1a 32에 시드를 섞고 murmur3 fmix32로 마무리
+inline uint32_t hash(std::string_view name, uint32_t seed) {
+    uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (unsigned char c : name) {
+        h ^= c;
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// 이름이 놓일 수 있는 유일한 슬롯 (seeds/slotCount는 비어 있지 않아야 함).
+// 표에 없는 이름도 어떤 슬롯에 떨어지므로 호출자가 노드 이름을 비교해 확인한다.
+template <typename Seeds>
+size_t slotOf(std::string_view name, const Seeds& seeds, size_t slotCount) {
+    const uint32_t seed = seeds[hash(name, 0) % seeds.size()];
+    return hash(name, seed) % slotCount;
+}
+
+// Story에서 이름으로 노드를 찾는다. node_names 표가 있으면 슬롯 하나만 확인하고,
+// 없으면(이전 형식 버퍼) 순차 비교한다. 같은 이름이 여럿이면 첫 번째 노드.
+template <typename Story>
+auto findNode(const Story* story, const char* name) -> decltype(story->nodes()->Get(0)) {
+    if (!story || !story->nodes() || !name) return nullptr;
+    auto* nodes = story->nodes();
+    auto* table = story->node_names();
+    if (table && table->seeds() && table->slots() && table->seeds()->size() > 0 && table->slots()->size() > 0) {
+        const int32_t index = table->slots()->Get(
+            static_cast<uint32_t>(slotOf(name, *table->seeds(), table->slots()->size())));
+        if (index < 0 || static_cast<uint32_t>(index) >= nodes->size()) return nullptr;
+        auto* node = nodes->Get(static_cast<uint32_t>(index));
+        if (node->name() && std::strcmp(node->name()->c_str(), name) == 0) return node;
+        return nullptr;
+    }
+    for (uint32_t i = 0; i < nodes->size(); ++i) {
+        auto* node = nodes->Get(i);
+        if (node->name() && std::strcmp(node->name()->c_str(), name) == 0) return node;
+    }
+    return nullptr;
+}
+
+} // namespace NodeNameHash
+} // namespace Gyeol
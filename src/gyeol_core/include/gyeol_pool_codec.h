@@ -0,0 +1,21 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Gyeol {
+
+// string_pool 압축용 LZ 코덱 (LZ4 블록 형식과 같은 계열, 외부 라이브러리 없음).
+// 시퀀스 = 토큰(상위 4bit 리터럴 길이, 하위 4bit 매치 길이-4) + 리터럴 + 2바이트 오프셋.
+// 길이 15는 뒤따르는 255 연속 바이트로 확장한다. 마지막 시퀀스는 리터럴만 가진다.
+// dictionary는 모든 블록 앞에 놓인 것처럼 참조되는 공용 히스토리다 (최대 64KB).
+// 부호화는 컴파일러(PoolTools::compressBlock)가 하고 런타임은 복호화만 한다.
+namespace PoolCodec {
+
+// rawSize와 정확히 같은 길이로 풀리지 않거나 범위를 벗어나는 참조가 있으면 false.
+bool decompress(const uint8_t* src, size_t size,
+                const uint8_t* dict, size_t dictSize,
+                size_t rawSize, std::vector<uint8_t>& out);
+
+} // namespace PoolCodec
+} // namespace Gyeol
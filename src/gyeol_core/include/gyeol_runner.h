@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <array>
 #include <string>
 #include <vector>
 #include <cstdint>
@@ -6,10 +7,37 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <random>
+#include <list>
+#include <map>
 #include <set>
 
+#include "gyeol_locale_catalog.h"
+#include "gyeol_story_chunks.h"
+
+// 컴파일 타임 기능 정책 (CMake 옵션 GYEOL_RUNNER_METRICS/DEBUG/TRACE/LAST_ERROR).
+// 0으로 빌드하면 해당 기능의 코드가 step() 루프에서 완전히 제거되고 API는 no-op이 된다.
+#ifndef GYEOL_RUNNER_METRICS
+#define GYEOL_RUNNER_METRICS 1
+#endif
+#ifndef GYEOL_RUNNER_DEBUG
+#define GYEOL_RUNNER_DEBUG 1
+#endif
+#ifndef GYEOL_RUNNER_TRACE
+#define GYEOL_RUNNER_TRACE 1
+#endif
+#ifndef GYEOL_RUNNER_LAST_ERROR
+#define GYEOL_RUNNER_LAST_ERROR 1
+#endif
+
 namespace Gyeol {
 
+struct RunnerFeatures {
+    static constexpr bool metrics = GYEOL_RUNNER_METRICS != 0;     // ExecutionMetrics + 프로파일러
+    static constexpr bool debug = GYEOL_RUNNER_DEBUG != 0;         // breakpoint / step mode
+    static constexpr bool trace = GYEOL_RUNNER_TRACE != 0;         // TraceEvent 기록
+    static constexpr bool lastError = GYEOL_RUNNER_LAST_ERROR != 0; // lastError_ 메시지 + stderr 로그
+};
+
 // --- 변수 값 타입 ---
 struct Variant {
     enum Type { BOOL, INT, FLOAT, STRING, LIST };
@@ -36,7 +64,9 @@ enum class StepType { LINE, CHOICES, COMMAND, WAIT, YIELD, END };
 struct LineData {
     const char* character = nullptr; // nullptr이면 narration
     const char* text = nullptr;
+    const char* voiceAsset = nullptr; // Line.voice_asset_id (없으면 nullptr)
     std::vector<std::pair<const char*, const char*>> tags; // key-value 메타데이터
+    bool seen = false; // 이번 표시 전에 이미 읽은 대사인지 (읽은 대사 기록 기준)
 };
 
 struct ChoiceData {
@@ -69,10 +99,15 @@ struct StepResult {
     std::vector<ChoiceData> choices;
     CommandData command;
     WaitData wait;
+    // YIELD일 때: 스토리의 yield가 아니라 명령 예산(setInstructionBudget)이 다 되어 멈춤
+    bool budgetExhausted = false;
     // 보간된 문자열의 소유권 (const char*가 이 버퍼를 가리킴)
     std::vector<std::string> ownedStrings_;
 };
 
+struct AotProgram;
+class AotContext;
+
 // --- Runner (VM) ---
 class Runner {
 public:
@@ -87,6 +122,58 @@ public:
         std::string detail;
     };
 
+    // 로그 버킷 지연 히스토그램: buckets[i]는 [2^i, 2^(i+1)) ns 구간 (마지막 버킷은 상한 없음)
+    struct LatencyHistogram {
+        static constexpr size_t kBucketCount = 32;
+        uint64_t count = 0;
+        uint64_t totalNs = 0;
+        uint64_t maxNs = 0;
+        std::array<uint64_t, kBucketCount> buckets{};
+
+        void record(uint64_t ns);
+    };
+
+    struct OpcodeCost {
+        uint64_t count = 0;
+        uint64_t totalNs = 0;
+    };
+
+    // setProfilingEnabled(true)일 때만 채워진다. opcodes는 OpData 값으로 인덱싱.
+    struct ExecutionProfile {
+        static constexpr size_t kOpcodeSlots = 16;
+        std::array<OpcodeCost, kOpcodeSlots> opcodes{};
+        LatencyHistogram step;
+        LatencyHistogram choose;
+        LatencyHistogram snapshot;
+        LatencyHistogram restore;
+    };
+
+    // 스토리 프로파일러 결과 (노드 / 노드+PC / 콜스택 단위 집계)
+    struct StoryProfileReport {
+        struct NodeEntry {
+            std::string nodeName;
+            uint64_t instructions = 0;
+            uint64_t wallNs = 0;     // 이 노드에서 실행된 명령어 시간 합 (self time)
+            uint64_t visits = 0;
+            uint64_t calls = 0;
+        };
+        struct InstructionEntry {
+            std::string nodeName;
+            uint32_t pc = 0;
+            std::string instructionType;
+            uint64_t count = 0;
+            uint64_t wallNs = 0;
+        };
+        struct StackEntry {
+            std::vector<std::string> frames; // 바깥 호출자 → 현재 노드
+            uint64_t instructions = 0;
+            uint64_t wallNs = 0;
+        };
+        std::vector<NodeEntry> nodes;               // wallNs 내림차순
+        std::vector<InstructionEntry> instructions; // wallNs 내림차순
+        std::vector<StackEntry> stacks;
+    };
+
     struct ExecutionMetrics {
         uint64_t stepCalls = 0;
         uint64_t instructionsExecuted = 0;
@@ -106,11 +193,21 @@ public:
         uint64_t loadOperations = 0;
         uint64_t errors = 0;
         uint64_t traceEvents = 0;
+        ExecutionProfile profile;
     };
 
     bool start(const uint8_t* buffer, size_t size);
     bool startAtNode(const uint8_t* buffer, size_t size, const std::string& nodeName);
+    // 청크 모드: 루트 청크로 시작하고 다른 청크의 노드로 jump/call/복귀할 때 필요한 청크를 읽는다
+    bool startChunked(std::shared_ptr<StoryChunkSet> chunks);
+    std::shared_ptr<StoryChunkSet> getStoryChunks() const { return chunks_; }
+    int32_t getActiveChunk() const; // 청크 모드가 아니면 -1
     StepResult step();
+    // 명령 예산: step() 한 번에 실행할 명령 수 상한 (0 = 무제한, 기본값).
+    // 다 쓰면 VM 상태를 그대로 둔 채 YIELD(budgetExhausted = true)를 돌려주고 다음 step()이 이어서 실행한다.
+    // 예산 YIELD는 노드 진입과 SetVar/Condition/Jump가 아닌 명령 앞에서만 나므로, 그때의 변수 값은 최적화 수준과 무관하다.
+    void setInstructionBudget(uint32_t maxInstructions);
+    uint32_t getInstructionBudget() const;
     bool resume();
     void choose(int index);
     bool isFinished() const;
@@ -128,6 +225,20 @@ public:
     Snapshot snapshot() const;
     bool restore(const Snapshot& snapshot);
 
+    // 읽은 대사 (skip read, gyeol_runner_seen.cpp): string_pool 인덱스별 비트셋.
+    // LINE을 낼 때마다 그 대사를 읽음으로 표시하고 같은 스토리를 다시 start()해도 유지한다.
+    // 스토리 식별 해시(string_pool/line_ids)가 다른 버퍼로 start()하면 비운다. 청크 모드에서는 기록하지 않는다.
+    // 파일(.gyseen)은 "GYSN" + 버전 + 비트 수 + 식별 해시 + 비트셋. 병합은 OR, 해시가 다르면 거부한다.
+    size_t getSeenLineCount() const;
+    void clearSeenLines();
+    std::vector<uint8_t> exportSeenLines() const;
+    bool mergeSeenLines(const uint8_t* data, size_t size);
+    bool saveSeenLines(const std::string& filepath) const;
+    bool loadSeenLines(const std::string& filepath); // 현재 기록에 병합
+    // 읽은 대사를 StepResult를 만들지 않고 넘긴다.
+    // 처음 보는 대사, 명령, 선택지, WAIT, yield, END(또는 명령 예산 YIELD)에서 멈추고 그 결과를 돌려준다.
+    StepResult skipSeen(uint32_t* skippedLines = nullptr);
+
     // RNG seed (deterministic testing)
     void setSeed(uint32_t seed);
     uint32_t getSeed() const;
@@ -135,6 +246,9 @@ public:
     // Locale (다국어) API
     bool loadLocale(const std::string& path);
     bool loadLocaleCatalog(const std::string& path);
+    // 미리 로드한 카탈로그를 공유 (여러 Runner에 붙여도 카탈로그는 한 벌만 유지)
+    bool attachLocaleCatalog(std::shared_ptr<const LocaleCatalog> catalog);
+    std::shared_ptr<const LocaleCatalog> getLocaleCatalog() const { return localeCatalog_; }
     bool setLocale(const std::string& localeCode);
     void clearLocale();
     std::string getLocale() const;
@@ -189,6 +303,33 @@ public:
 
     GraphData getGraphData() const;
 
+    // --- Asset Prefetch API ---
+    struct UpcomingAsset {
+        enum class Kind { VOICE, COMMAND };
+        Kind kind = Kind::COMMAND;
+        std::string commandType; // COMMAND일 때 커맨드 종류 ("bg", "sfx" 등)
+        std::string value;       // voice 에셋 키 또는 STRING/IDENTIFIER 커맨드 인자
+        uint32_t distance = 0;   // 현재 위치에서 가장 가까운 경로 기준 명령어 수
+    };
+
+    // 현재 위치에서 jump/call/선택지/조건/랜덤의 모든 분기를 정적으로 따라가며
+    // 최대 depth개의 명령어 안에서 필요할 수 있는 에셋을 모은다 (중복 제거, distance 오름차순).
+    std::vector<UpcomingAsset> predictUpcomingAssets(uint32_t depth = 64) const;
+
+    // --- Compressed String Pool ---
+    // compressed_pool이 있는 스토리는 대사 블록을 처음 쓸 때 풀어 LRU 캐시에 둔다.
+    // 캐시는 step() 시작 시에만 capacity로 줄이므로 StepResult의 문자열은 다음 step()까지 유효하다.
+    struct StringPoolCacheStats {
+        uint64_t decompressions = 0;
+        uint64_t hits = 0;
+        size_t residentBlocks = 0;
+        size_t residentBytes = 0;
+    };
+    bool hasCompressedStringPool() const { return compressedPool_ != nullptr; }
+    void setStringPoolCacheCapacity(size_t blocks);
+    size_t getStringPoolCacheCapacity() const { return poolCacheCapacity_; }
+    StringPoolCacheStats getStringPoolCacheStats() const;
+
     // --- Debug API ---
     struct DebugLocation {
         std::string nodeName;
@@ -223,6 +364,30 @@ public:
     void clearLastError();
     const ExecutionMetrics& getMetrics() const;
     void resetMetrics();
+    void setProfilingEnabled(bool enabled);  // opcode별 비용 + 지연 히스토그램 수집
+    bool isProfilingEnabled() const;
+    // 사전 디코딩 dispatch: start() 때 명령어를 고정 크기 레코드 배열로 풀어 두고 실행한다 (기본 꺼짐).
+    // 디버그/트레이스/프로파일링 중에는 FlatBuffers 참조 경로로 실행된다.
+    void setPredecodedDispatch(bool enabled);
+    bool isPredecodedDispatch() const;
+    // AOT 프로그램 (gyeol_aot.h, GyeolCompiler --emit-cpp). 다음 start()부터 적용되며, 버퍼가 생성에 쓴
+    // .gyb와 같을 때만 쓰고 아니면(내려받은 스토리, 청크 등) 인터프리터로 실행한다.
+    // 디버그/트레이스/프로파일링 중에는 사전 디코딩과 같이 참조 경로로 실행된다.
+    void setAotProgram(const AotProgram* program);
+    bool isAotActive() const;
+    std::string exportMetricsJson() const;
+    std::string exportMetricsPrometheus(const std::string& prefix = "gyeol") const;
+    void setStoryProfilingEnabled(bool enabled);  // 노드/PC/콜스택별 명령어 수 + 시간 집계
+    bool isStoryProfilingEnabled() const;
+    void resetStoryProfile();
+    StoryProfileReport getStoryProfile() const;
+    // flamegraph.pl 등이 읽는 collapsed-stack 형식 ("start;shop;greet 1234"), 가중치는 ns 또는 명령어 수
+    std::string exportStoryProfileCollapsed(bool weightByInstructions = false) const;
+    // 플레이 프로파일: 노드 방문/분기 결과/호출/보간 횟수 (시간 측정 없음, GyeolCompiler --profile 입력)
+    void setPlayProfilingEnabled(bool enabled);
+    bool isPlayProfilingEnabled() const;
+    void resetPlayProfile();
+    std::string exportPlayProfileJson() const; // format "gyeol-play-profile"
     void setTraceEnabled(bool enabled, size_t maxEvents = 256);
     bool isTraceEnabled() const;
     const std::vector<TraceEvent>& getTrace() const;
@@ -241,6 +406,10 @@ private:
     uint32_t pc_ = 0;
     bool finished_ = true;
 
+    // 명령 예산 (0 = 무제한). budgetLeft_는 이번 step()에서 남은 명령 수
+    uint32_t instructionBudget_ = 0;
+    uint64_t budgetLeft_ = 0;
+
     // 변수 상태
     std::unordered_map<std::string, Variant> variables_;
 
@@ -257,6 +426,7 @@ private:
         std::string returnVarName; // empty = 반환값 무시
         std::vector<ShadowedVar> shadowedVars; // 함수 매개변수로 섀도된 변수들
         std::vector<std::string> paramNames;   // 매개변수 이름들
+        std::shared_ptr<const StoryChunk> chunk; // 청크 모드: node가 속한 청크 (복귀 전까지 유지)
     };
     std::vector<CallFrame> callStack_;
 
@@ -264,6 +434,7 @@ private:
     struct PendingChoice {
         int32_t text_id;
         int32_t target_node_name_id;
+        int32_t target_node_index = -1; // 현재 스토리(청크)의 nodes 인덱스, -1이면 이름으로
         int8_t choice_modifier = 0; // 0=Default, 1=Once, 2=Sticky, 3=Fallback
         std::string once_key;       // "nodeName:pc" key for once tracking
     };
@@ -286,12 +457,8 @@ private:
     // Locale 오버레이 (다국어)
     std::string currentLocale_;   // requested locale (or loaded single-locale id)
     std::string resolvedLocale_;  // exact/base/default resolved locale
-    std::vector<std::string> localePool_; // string_pool과 병렬, 비어있으면 원본 사용
-    std::unordered_map<std::string, std::unordered_map<std::string, std::string>> localeCharacterProps_;
-    bool hasLocaleCatalog_ = false;
-    std::string catalogDefaultLocale_;
-    std::unordered_map<std::string, std::unordered_map<int32_t, std::string>> catalogLineEntriesByLocale_;
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::string, std::string>>> catalogCharacterEntriesByLocale_;
+    std::shared_ptr<const LocaleTable> activeLocale_;    // nullptr이면 원본 사용
+    std::shared_ptr<const LocaleCatalog> localeCatalog_; // 여러 Runner가 공유 가능
 
     // 노드 방문 횟수
     std::unordered_map<std::string, uint32_t> visitCounts_;
@@ -310,18 +477,141 @@ private:
     uint32_t currentSeed_ = 0;
     mutable std::string lastError_;
     mutable ExecutionMetrics metrics_;
+    bool profilingEnabled_ = false;
+
+    // 스토리 프로파일러 (노드 포인터 기준으로 모으고 내보낼 때 이름으로 변환)
+    struct StoryProfileCounters {
+        uint64_t instructions = 0;
+        uint64_t wallNs = 0;
+        uint64_t visits = 0;
+        uint64_t calls = 0;
+    };
+    struct StoryProfileData {
+        std::unordered_map<const void*, StoryProfileCounters> nodes;
+        std::map<std::pair<const void*, uint32_t>, StoryProfileCounters> instructions;
+        std::map<std::vector<const void*>, StoryProfileCounters> stacks;
+    };
+    class StoryProfileScope;
+    bool storyProfilingEnabled_ = false;
+    StoryProfileData storyProfile_;
+
+    // 플레이 프로파일 (노드 이름 기준이라 청크 전환/세이브 로드 뒤에도 이어서 모인다)
+    struct PlayBranchCounters {
+        const char* kind = "";          // "condition" [참, 거짓] / "random" [가지별] / "choice" [선택 수]
+        std::vector<uint64_t> taken;
+    };
+    struct PlayNodeCounters {
+        uint64_t visits = 0;
+        std::map<uint32_t, PlayBranchCounters> branches;                 // pc → 결과별 횟수
+        std::map<std::string, uint64_t> calls;                           // 호출 대상 → 횟수
+        std::map<uint32_t, std::pair<std::string, uint64_t>> interpolations; // pc → (원문, 횟수)
+    };
+    bool playProfilingEnabled_ = false;
+    mutable std::map<std::string, PlayNodeCounters> playProfile_;
+    void recordPlayBranch(const char* kind, size_t outcome, size_t outcomeCount);
+    void recordPlayCall(int32_t targetNameId);
+
+    // hot_template 대사의 보간 템플릿 캐시 (text_id → 나눈 조각, 버퍼가 바뀌면 비움)
+    struct TextTemplate {
+        const char* source = nullptr;   // 만든 원문 (원본 pool 포인터, 로케일/압축 pool이면 쓰지 않음)
+        bool simple = false;            // {변수}만 있으면 true, 나머지({if}, 함수)는 interpolateText
+        std::vector<std::pair<std::string, bool>> parts; // (리터럴 또는 변수 이름, 변수면 true)
+    };
+    mutable std::unordered_map<int32_t, TextTemplate> textTemplates_;
+    std::string interpolateHotText(int32_t textId, const char* rawText) const;
     bool traceEnabled_ = false;
     size_t traceLimit_ = 256;
     mutable std::vector<TraceEvent> trace_;
 
+    // 사전 디코딩된 명령어 스트림 (gyeol_runner_dispatch.cpp)
+    struct DecodedProgram;
+    bool predecodeEnabled_ = false;
+    std::shared_ptr<const DecodedProgram> decoded_;
+
+    // AOT 프로그램 (gyeol_runner_aot.cpp)
+    friend class AotContext;
+    const AotProgram* aotProgram_ = nullptr;
+    bool aotActive_ = false;
+    std::vector<const void*> aotNodes_;                    // 프로그램 노드 인덱스 → Node
+    std::unordered_map<const void*, uint32_t> aotNodeIndex_;
+    void bindAotProgram(const uint8_t* buffer, size_t size);
+    bool stepAot(StepResult& result);
+
+    // 청크 모드 (gyeol_runner_chunks.cpp)
+    std::shared_ptr<StoryChunkSet> chunks_;
+    std::shared_ptr<const StoryChunk> activeChunk_;
+    bool enterChunkForNode(const char* name);
+    void switchChunk(const std::shared_ptr<const StoryChunk>& chunk);
+    const void* findChunkNode(const char* name, std::shared_ptr<const StoryChunk>& outChunk);
+    void cacheNodeTags();
+
+    // 압축된 string_pool 블록 캐시 (gyeol_runner_pool.cpp)
+    struct PoolBlock {
+        std::vector<uint8_t> text;      // '\0'으로 끝나는 문자열들
+        std::vector<uint32_t> offsets;  // 블록 내 문자열 시작 위치
+        std::list<uint32_t>::iterator lru;
+    };
+    const void* compressedPool_ = nullptr;
+    size_t poolCacheCapacity_ = 8;
+    mutable std::unordered_map<uint32_t, PoolBlock> poolBlocks_;
+    mutable std::list<uint32_t> poolBlockLru_; // 앞쪽이 가장 최근
+    mutable StringPoolCacheStats poolCacheStats_;
+    void bindStringPool();
+    void trimStringPoolCache();
+
+    // 읽은 대사 비트셋 (gyeol_runner_seen.cpp)
+    std::vector<uint64_t> seenLines_;
+    uint32_t seenLineBits_ = 0; // string_pool 크기
+    uint64_t seenStoryHash_ = 0; // string_pool/line_ids 식별 해시 (.gyseen 헤더에 기록)
+    const void* seenHashStory_ = nullptr; // seenStoryHash_를 계산한 버퍼 (주소 + 크기로 재계산 생략)
+    size_t seenHashSize_ = 0;
+    bool skipping_ = false;     // skipSeen 중: 읽은 대사는 결과를 채우지 않는다
+    void bindSeenLines(size_t bufferSize);
+    bool markLineSeen(int32_t textId); // 이전 표시 여부를 돌려주고 읽음으로 표시
+    const char* compressedPoolStr(int32_t index) const; // 압축 항목이 아니면 nullptr
+
     // 헬퍼
     const char* poolStr(int32_t index) const;
     void jumpToNode(const char* name);
-    void jumpToNodeById(int32_t nameId);
+    void jumpToNodeById(int32_t nameId, int32_t nodeIndex = -1);
+    void enterNode(const void* nodePtr);
     void setError(const std::string& message) const;
     void clearErrorInternal() const;
+    bool traceActive() const { return RunnerFeatures::trace && traceEnabled_ && traceLimit_ > 0; }
+    bool profilingActive() const { return RunnerFeatures::metrics && profilingEnabled_; }
+    bool storyProfilingActive() const { return RunnerFeatures::metrics && storyProfilingEnabled_; }
+    bool playProfilingActive() const { return RunnerFeatures::metrics && playProfilingEnabled_; }
+    void countMetric(uint64_t ExecutionMetrics::* counter) const {
+        if constexpr (RunnerFeatures::metrics) ++(metrics_.*counter);
+    }
+    // node의 pc 명령 하나를 실행할 예산을 쓴다.
+    // 다 썼고 pc가 예산 검사 지점이면 result를 예산 YIELD로 채우고 false (아니면 검사 지점까지 이어서 실행)
+    bool takeInstructionBudget(StepResult& result, const void* node, uint32_t pc) {
+        if (budgetLeft_ != 0) {
+            --budgetLeft_;
+            return true;
+        }
+        if (!budgetCheckpoint(node, pc)) return true;
+        yieldForBudget(result);
+        return false;
+    }
+    static bool budgetCheckpoint(const void* node, uint32_t pc);
+    void yieldForBudget(StepResult& result);
     void recordTrace(const std::string& kind, const std::string& detail = "") const;
     void recordTrace(const std::string& kind, const std::string& nodeName, uint32_t pc, const std::string& detail) const;
+    bool returnFromNodeEnd();
+    bool executeInstruction(const void* instrPtr, StepResult& result);
+    bool executeCompact(const void* recPtr, StepResult& result); // 압축 레코드 (CompactInstr)
+    void emitLine(const void* linePtr, StepResult& result);
+    void emitLineData(int32_t characterId, int32_t textId, int32_t voiceId,
+                      const void* tags, StepResult& result, bool hotTemplate = false);
+    void enterWait(int32_t tagId, StepResult& result);
+    void executeSetVar(const void* setVarPtr, const std::string& varName);
+    bool evaluateCondition(const void* condPtr) const;
+    void buildDecodedProgram();
+    bool referenceDispatchRequired() const;
+    void advance(StepResult& result); // step() 본문: 다음 결과까지 실행
+    bool stepDecoded(StepResult& result);
     void seedRngForStart();
     std::string exportRngState() const;
     void importRngState(const std::string& state);
@@ -347,7 +637,9 @@ private:
     std::string nodeNameFromPtr(const void* nodePtr) const;
     const void* findNodeByName(const char* name) const;
     int32_t findStringInPool(const char* str) const;
-    std::string baseLocaleCode(const std::string& localeCode) const;
+    static std::shared_ptr<const LocaleTable> makeOwnedLocaleTable(std::vector<std::string> strings,
+                                                                   LocaleCharacterProps characterProps,
+                                                                   const std::string& resolvedLocale);
     bool applyLocaleSelection(const std::string& requestedLocale, bool recordTraceEvent);
 };
 
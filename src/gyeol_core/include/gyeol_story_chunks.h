@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Gyeol {
+
+class MappedFile;
+
+// 로드된 청크 하나 (Story 버퍼). Runner/call stack이 shared_ptr로 잡고 있는 동안은 evict되지 않는다.
+struct StoryChunk {
+    uint32_t index = 0;
+    std::string name;
+    std::shared_ptr<const MappedFile> file;
+    const uint8_t* data() const;
+    size_t size() const;
+};
+
+// 청크 인덱스(.gyci) + 필요할 때 청크를 읽고 메모리 예산을 넘으면 오래 안 쓴 청크를 내리는 캐시.
+// 여러 Runner가 공유할 수 있고 여러 스레드에서 동시에 사용해도 안전하다.
+class StoryChunkSet {
+public:
+    // memoryBudgetBytes == 0이면 예산 없음 (한 번 읽은 청크를 계속 유지)
+    static std::shared_ptr<StoryChunkSet> load(const std::string& indexPath,
+                                               size_t memoryBudgetBytes = 0,
+                                               std::string* errorOut = nullptr);
+
+    size_t getChunkCount() const { return chunks_.size(); }
+    const std::string& getChunkName(uint32_t chunk) const { return chunks_[chunk].name; }
+    size_t getChunkSize(uint32_t chunk) const { return chunks_[chunk].size; } // 인덱스에 기록된 크기
+    const std::string& getStartNodeName() const { return startNodeName_; }
+    int32_t findChunkForNode(const std::string& nodeName) const; // 없으면 -1
+
+    // 청크를 읽거나(캐시 miss) 캐시에서 꺼낸다. 실패하면 nullptr.
+    std::shared_ptr<const StoryChunk> acquire(uint32_t chunk, std::string* errorOut = nullptr);
+
+    void setMemoryBudget(size_t bytes);
+    size_t getMemoryBudget() const;
+    size_t getResidentBytes() const;
+    bool isResident(uint32_t chunk) const;
+
+    struct Stats {
+        uint64_t loads = 0;
+        uint64_t hits = 0;
+        uint64_t evictions = 0;
+    };
+    Stats getStats() const;
+
+private:
+    StoryChunkSet() = default;
+    void evictLocked();
+
+    struct ChunkInfo {
+        std::string name;
+        std::string path; // 절대/인덱스 기준 경로
+        size_t size = 0;
+    };
+    std::vector<ChunkInfo> chunks_;
+    std::unordered_map<std::string, uint32_t> nodeToChunk_;
+    std::string startNodeName_;
+
+    mutable std::mutex mutex_;
+    size_t memoryBudget_ = 0;
+    size_t residentBytes_ = 0;
+    std::list<uint32_t> lru_; // 앞쪽이 가장 최근
+    std::unordered_map<uint32_t, std::pair<std::shared_ptr<const StoryChunk>, std::list<uint32_t>::iterator>> resident_;
+    Stats stats_;
+};
+
+} // namespace Gyeol
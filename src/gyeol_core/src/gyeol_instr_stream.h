@@ -0,0 +1,72 @@
+#pragma once
+#include "gyeol_generated.h"
+
+namespace Gyeol {
+
+// 노드의 명령 스트림 접근 (테이블 형식 / 압축 형식 공용).
+// 압축 노드는 ops가 실행 순서이고, CompactOp::Table 레코드만 lines의 테이블 명령을 가리킨다.
+namespace InstrStream {
+
+using ICPDev::Gyeol::Schema::CompactInstr;
+using ICPDev::Gyeol::Schema::CompactOp;
+using ICPDev::Gyeol::Schema::Instruction;
+using ICPDev::Gyeol::Schema::Node;
+using ICPDev::Gyeol::Schema::OpData;
+
+inline uint32_t count(const Node* node) {
+    if (!node) return 0;
+    if (auto* ops = node->ops()) return ops->size();
+    return node->lines() ? node->lines()->size() : 0;
+}
+
+// pc의 압축 레코드 (테이블 명령이면 nullptr). pc < count(node)여야 한다.
+inline const CompactInstr* compactAt(const Node* node, uint32_t pc) {
+    auto* ops = node->ops();
+    if (!ops) return nullptr;
+    auto* rec = ops->Get(pc);
+    return rec->op() == CompactOp::Table ? nullptr : rec;
+}
+
+// pc의 테이블 명령 (압축 레코드이거나 lines 인덱스가 깨졌으면 nullptr). pc < count(node)여야 한다.
+inline const Instruction* tableAt(const Node* node, uint32_t pc) {
+    auto* lines = node->lines();
+    if (auto* ops = node->ops()) {
+        auto* rec = ops->Get(pc);
+        if (rec->op() != CompactOp::Table || !lines || rec->a() < 0 ||
+            static_cast<uint32_t>(rec->a()) >= lines->size()) {
+            return nullptr;
+        }
+        return lines->Get(static_cast<uint32_t>(rec->a()));
+    }
+    return lines ? lines->Get(pc) : nullptr;
+}
+
+inline OpData toOpData(CompactOp op) {
+    switch (op) {
+        case CompactOp::Line:   return OpData::Line;
+        case CompactOp::Jump:   return OpData::Jump;
+        case CompactOp::Wait:   return OpData::Wait;
+        case CompactOp::Yield:  return OpData::Yield;
+        case CompactOp::SetVar: return OpData::SetVar;
+        default:                return OpData::NONE;
+    }
+}
+
+// 두 형식 공통 명령 종류 (디버그/프로파일링 표시용)
+inline OpData opAt(const Node* node, uint32_t pc) {
+    if (auto* rec = compactAt(node, pc)) return toOpData(rec->op());
+    auto* instr = tableAt(node, pc);
+    return instr ? instr->data_type() : OpData::NONE;
+}
+
+// 명령 예산 YIELD를 낼 수 있는 위치: 노드 진입(pc 0)과 SetVar/Condition/Jump가 아닌 명령 앞.
+// -O2는 SetVar/Condition/Jump가 이어지는 구간 안에서만 대입을 지우거나 조건을 점프로 바꾸므로
+// 이 위치의 변수 값은 -O0과 같다.
+inline bool isBudgetCheckpoint(const Node* node, uint32_t pc) {
+    if (pc == 0) return true;
+    const OpData op = opAt(node, pc);
+    return op != OpData::SetVar && op != OpData::Condition && op != OpData::Jump;
+}
+
+} // namespace InstrStream
+} // namespace Gyeol
@@ -0,0 +1,64 @@
+#include "gyeol_pool_codec.h"
+
+namespace Gyeol {
+namespace PoolCodec {
+
+namespace {
+
+constexpr size_t kMinMatch = 4;
+constexpr size_t kMaxOffset = 65535;
+
+bool readLength(const uint8_t*& p, const uint8_t* end, size_t& length) {
+    uint8_t b;
+    do {
+        if (p >= end) return false;
+        b = *p++;
+        length += b;
+    } while (b == 255);
+    return true;
+}
+
+} // namespace
+
+bool decompress(const uint8_t* src, size_t size,
+                const uint8_t* dict, size_t dictSize,
+                size_t rawSize, std::vector<uint8_t>& out) {
+    out.clear();
+    out.reserve(rawSize);
+    if (dictSize > kMaxOffset) {
+        dict += dictSize - kMaxOffset;
+        dictSize = kMaxOffset;
+    }
+
+    const uint8_t* p = src;
+    const uint8_t* end = src + size;
+    while (p < end) {
+        const uint8_t token = *p++;
+        size_t literalCount = token >> 4;
+        if (literalCount == 15 && !readLength(p, end, literalCount)) return false;
+        if (static_cast<size_t>(end - p) < literalCount || out.size() + literalCount > rawSize) return false;
+        out.insert(out.end(), p, p + literalCount);
+        p += literalCount;
+        if (p == end) break; // 마지막 시퀀스
+
+        if (end - p < 2) return false;
+        const size_t offset = static_cast<size_t>(p[0]) | (static_cast<size_t>(p[1]) << 8);
+        p += 2;
+        size_t matchLength = token & 0x0F;
+        if (matchLength == 15 && !readLength(p, end, matchLength)) return false;
+        matchLength += kMinMatch;
+        if (offset == 0 || offset > out.size() + dictSize || out.size() + matchLength > rawSize) return false;
+
+        // 겹치는 매치(offset < length)가 있으므로 한 바이트씩 복사
+        for (size_t i = 0; i < matchLength; ++i) {
+            const size_t produced = out.size();
+            const uint8_t b = offset <= produced ? out[produced - offset]
+                                                 : dict[dictSize - (offset - produced)];
+            out.push_back(b);
+        }
+    }
+    return out.size() == rawSize;
+}
+
+} // namespace PoolCodec
+} // namespace Gyeol
@@ -1,10 +1,16 @@
 ﻿#include "gyeol_runner.h"
 #include "gyeol_generated.h"
+#include "gyeol_node_names.h"
+#include "gyeol_instr_stream.h"
+#include "gyeol_variant_ops.h"
 #include <iostream>
 #include <fstream>
+#include <cstdlib>
 #include <cstring>
 #include <sstream>
 #include <algorithm>
+#include <chrono>
+#include <limits>
 
 using namespace ICPDev::Gyeol::Schema;
 
@@ -21,6 +27,40 @@ asPool(const void* p) {
 
 namespace {
 
+static_assert(static_cast<size_t>(OpData::MAX) < Runner::ExecutionProfile::kOpcodeSlots,
+              "ExecutionProfile::kOpcodeSlots must cover every OpData");
+
+// 프로파일링 구간 측정. 대상이 nullptr이면(프로파일링 꺼짐) 시계를 읽지 않는다.
+class ProfileScope {
+public:
+    explicit ProfileScope(Runner::LatencyHistogram* histogram)
+        : histogram_(histogram) {
+        if (histogram_) start_ = std::chrono::steady_clock::now();
+    }
+    explicit ProfileScope(Runner::OpcodeCost* cost)
+        : cost_(cost) {
+        if (cost_) start_ = std::chrono::steady_clock::now();
+    }
+    ~ProfileScope() {
+        if (!histogram_ && !cost_) return;
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        const uint64_t ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        if (histogram_) histogram_->record(ns);
+        if (cost_) {
+            cost_->count++;
+            cost_->totalNs += ns;
+        }
+    }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Runner::LatencyHistogram* histogram_ = nullptr;
+    Runner::OpcodeCost* cost_ = nullptr;
+    std::chrono::steady_clock::time_point start_;
+};
+
 constexpr char kStateExtensionMagic[] = {'G', 'Y', 'E', 'X'};
 constexpr uint32_t kStateExtensionVersion = 2;
 
@@ -194,29 +234,84 @@ bool splitSerializedState(
 
 } // namespace
 
+// 명령어 하나의 실행을 스토리 프로파일에 기록한다 (runner가 nullptr이면 아무것도 하지 않음).
+class Runner::StoryProfileScope {
+public:
+    StoryProfileScope(Runner* runner, const void* node, uint32_t pc)
+        : runner_(runner), node_(node), pc_(pc) {
+        if (!runner_) return;
+        depth_ = runner_->callStack_.size();
+        start_ = std::chrono::steady_clock::now();
+    }
+    ~StoryProfileScope() {
+        if (!runner_) return;
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        const uint64_t ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+        auto& profile = runner_->storyProfile_;
+        auto& nodeCounters = profile.nodes[node_];
+        nodeCounters.instructions++;
+        nodeCounters.wallNs += ns;
+        auto& instrCounters = profile.instructions[{node_, pc_}];
+        instrCounters.instructions++;
+        instrCounters.wallNs += ns;
+
+        // 콜스택: 명령어 실행 전 프레임 기준 (바깥 호출자 → 현재 노드)
+        std::vector<const void*> stack;
+        stack.reserve(depth_ + 1);
+        for (size_t i = 0; i < depth_ && i < runner_->callStack_.size(); ++i) {
+            stack.push_back(runner_->callStack_[i].node);
+        }
+        stack.push_back(node_);
+        auto& stackCounters = profile.stacks[stack];
+        stackCounters.instructions++;
+        stackCounters.wallNs += ns;
+
+        if (runner_->callStack_.size() > depth_ && runner_->currentNode_) {
+            profile.nodes[runner_->currentNode_].calls++;
+        }
+    }
+    StoryProfileScope(const StoryProfileScope&) = delete;
+    StoryProfileScope& operator=(const StoryProfileScope&) = delete;
+
+private:
+    Runner* runner_;
+    const void* node_;
+    uint32_t pc_;
+    size_t depth_ = 0;
+    std::chrono::steady_clock::time_point start_;
+};
+
 // --- poolStr ---
 const char* Runner::poolStr(int32_t index) const {
     auto* pool = asPool(pool_);
     if (!pool || index < 0 || index >= static_cast<int32_t>(pool->size())) {
         return "";
     }
-    // 로케일 오버레이 우선
-    if (!localePool_.empty() && index < static_cast<int32_t>(localePool_.size())
-        && !localePool_[static_cast<size_t>(index)].empty()) {
-        return localePool_[static_cast<size_t>(index)].c_str();
+    // 로케일 오버레이 우선 (fallback이 이미 적용된 테이블)
+    if (activeLocale_) {
+        const char* localized = activeLocale_->lines[static_cast<size_t>(index)];
+        if (localized) return localized;
+    }
+    auto* str = pool->Get(static_cast<flatbuffers::uoffset_t>(index));
+    if (compressedPool_ && str->size() == 0) {
+        if (const char* text = compressedPoolStr(index)) return text;
     }
-    return pool->Get(static_cast<flatbuffers::uoffset_t>(index))->c_str();
+    return str->c_str();
 }
 
 void Runner::setError(const std::string& message) const {
-    lastError_ = message;
-    metrics_.errors++;
-    std::cerr << "[Gyeol] " << message << std::endl;
-    recordTrace("ERROR", message);
+    if constexpr (RunnerFeatures::lastError) {
+        lastError_ = message;
+        std::cerr << "[Gyeol] " << message << std::endl;
+    }
+    countMetric(&ExecutionMetrics::errors);
+    if (traceActive()) recordTrace("ERROR", message);
 }
 
 void Runner::clearErrorInternal() const {
-    lastError_.clear();
+    if constexpr (RunnerFeatures::lastError) lastError_.clear();
 }
 
 void Runner::recordTrace(const std::string& kind, const std::string& detail) const {
@@ -224,12 +319,12 @@ void Runner::recordTrace(const std::string& kind, const std::string& detail) con
 }
 
 void Runner::recordTrace(const std::string& kind, const std::string& nodeName, uint32_t pc, const std::string& detail) const {
-    if (!traceEnabled_ || traceLimit_ == 0) return;
+    if (!traceActive()) return;
     if (trace_.size() >= traceLimit_) {
         trace_.erase(trace_.begin());
     }
     trace_.push_back({kind, nodeName, pc, detail});
-    metrics_.traceEvents++;
+    countMetric(&ExecutionMetrics::traceEvents);
 }
 
 void Runner::seedRngForStart() {
@@ -251,31 +346,47 @@ void Runner::importRngState(const std::string& state) {
 }
 
 // --- 노드 검색 및 이동 ---
+void Runner::enterNode(const void* nodePtr) {
+    auto* node = asNode(nodePtr);
+    currentNode_ = node;
+    pc_ = 0;
+    visitCounts_[node->name()->c_str()]++;
+    if (storyProfilingActive()) storyProfile_.nodes[node].visits++;
+    if (playProfilingActive()) playProfile_[node->name()->c_str()].visits++;
+}
+
 void Runner::jumpToNode(const char* name) {
     auto* story = asStory(story_);
-    auto* nodes = story->nodes();
-    if (!nodes) {
+    if (!story->nodes()) {
         setError("Story has no nodes");
         finished_ = true;
         return;
     }
 
-    for (flatbuffers::uoffset_t i = 0; i < nodes->size(); ++i) {
-        auto* node = nodes->Get(i);
-        if (node->name() && std::strcmp(node->name()->c_str(), name) == 0) {
-            currentNode_ = node;
-            pc_ = 0;
-            visitCounts_[name]++;
-            return;
-        }
+    if (const void* node = findNodeByName(name)) {
+        enterNode(node);
+        return;
     }
 
+    if (chunks_ && name && enterChunkForNode(name)) return;
+
     setError(std::string("Node not found: ") + (name ? name : "<null>"));
     finished_ = true;
 }
 
-void Runner::jumpToNodeById(int32_t nameId) {
-    jumpToNode(poolStr(nameId));
+// 링크된 인덱스의 노드 이름이 nameId와 같으면 해시 조회 없이 바로 들어간다
+// (-1/범위 밖/이름 불일치면 이름으로)
+void Runner::jumpToNodeById(int32_t nameId, int32_t nodeIndex) {
+    const char* name = poolStr(nameId);
+    auto* nodes = asStory(story_)->nodes();
+    if (nodes && nodeIndex >= 0 && static_cast<flatbuffers::uoffset_t>(nodeIndex) < nodes->size()) {
+        auto* node = nodes->Get(static_cast<flatbuffers::uoffset_t>(nodeIndex));
+        if (node->name() && std::strcmp(node->name()->c_str(), name) == 0) {
+            enterNode(node);
+            return;
+        }
+    }
+    jumpToNode(name);
 }
 
 // --- Variant로부터 ValueData 읽기 헬퍼 ---
@@ -315,102 +426,6 @@ static Variant readValueData(
     }
 }
 
-// --- 조건 비교 ---
-static bool compareVariants(const Variant& lhs, Operator op, const Variant& rhs) {
-    // 타입이 다르면 INT로 비교 시도
-    if (lhs.type == Variant::BOOL || rhs.type == Variant::BOOL) {
-        bool a = (lhs.type == Variant::BOOL) ? lhs.b : (lhs.i != 0);
-        bool b = (rhs.type == Variant::BOOL) ? rhs.b : (rhs.i != 0);
-        switch (op) {
-            case Operator::Equal:          return a == b;
-            case Operator::NotEqual:       return a != b;
-            default:                       return false;
-        }
-    }
-
-    if (lhs.type == Variant::STRING || rhs.type == Variant::STRING) {
-        switch (op) {
-            case Operator::Equal:          return lhs.s == rhs.s;
-            case Operator::NotEqual:       return lhs.s != rhs.s;
-            default:                       return false;
-        }
-    }
-
-    if (lhs.type == Variant::FLOAT || rhs.type == Variant::FLOAT) {
-        float a = (lhs.type == Variant::FLOAT) ? lhs.f : static_cast<float>(lhs.i);
-        float b = (rhs.type == Variant::FLOAT) ? rhs.f : static_cast<float>(rhs.i);
-        switch (op) {
-            case Operator::Equal:          return a == b;
-            case Operator::NotEqual:       return a != b;
-            case Operator::Greater:        return a > b;
-            case Operator::Less:           return a < b;
-            case Operator::GreaterOrEqual: return a >= b;
-            case Operator::LessOrEqual:    return a <= b;
-        }
-    }
-
-    // INT 비교
-    int32_t a = lhs.i;
-    int32_t b = rhs.i;
-    switch (op) {
-        case Operator::Equal:          return a == b;
-        case Operator::NotEqual:       return a != b;
-        case Operator::Greater:        return a > b;
-        case Operator::Less:           return a < b;
-        case Operator::GreaterOrEqual: return a >= b;
-        case Operator::LessOrEqual:    return a <= b;
-    }
-    return false;
-}
-
-// --- truthiness 변환 ---
-static bool variantToBool(const Variant& v) {
-    switch (v.type) {
-        case Variant::BOOL:   return v.b;
-        case Variant::INT:    return v.i != 0;
-        case Variant::FLOAT:  return v.f != 0.0f;
-        case Variant::STRING: return !v.s.empty();
-        case Variant::LIST:   return !v.list.empty();
-    }
-    return false;
-}
-
-// --- 산술 연산 ---
-static Variant applyBinaryOp(const Variant& lhs, ExprOp op, const Variant& rhs) {
-    // Float 하나라도 있으면 float 연산
-    if (lhs.type == Variant::FLOAT || rhs.type == Variant::FLOAT) {
-        float a = (lhs.type == Variant::FLOAT) ? lhs.f :
-                  (lhs.type == Variant::BOOL) ? (lhs.b ? 1.0f : 0.0f) :
-                  static_cast<float>(lhs.i);
-        float b = (rhs.type == Variant::FLOAT) ? rhs.f :
-                  (rhs.type == Variant::BOOL) ? (rhs.b ? 1.0f : 0.0f) :
-                  static_cast<float>(rhs.i);
-        switch (op) {
-            case ExprOp::Add: return Variant::Float(a + b);
-            case ExprOp::Sub: return Variant::Float(a - b);
-            case ExprOp::Mul: return Variant::Float(a * b);
-            case ExprOp::Div: return (b != 0.0f) ? Variant::Float(a / b) : Variant::Float(0.0f);
-            case ExprOp::Mod: {
-                int32_t ai = static_cast<int32_t>(a);
-                int32_t bi = static_cast<int32_t>(b);
-                return (bi != 0) ? Variant::Int(ai % bi) : Variant::Int(0);
-            }
-            default: return Variant::Int(0);
-        }
-    }
-    // INT (BOOL은 INT로 변환)
-    int32_t a = (lhs.type == Variant::BOOL) ? (lhs.b ? 1 : 0) : lhs.i;
-    int32_t b = (rhs.type == Variant::BOOL) ? (rhs.b ? 1 : 0) : rhs.i;
-    switch (op) {
-        case ExprOp::Add: return Variant::Int(a + b);
-        case ExprOp::Sub: return Variant::Int(a - b);
-        case ExprOp::Mul: return Variant::Int(a * b);
-        case ExprOp::Div: return (b != 0) ? Variant::Int(a / b) : Variant::Int(0);
-        case ExprOp::Mod: return (b != 0) ? Variant::Int(a % b) : Variant::Int(0);
-        default: return Variant::Int(0);
-    }
-}
-
 Variant Runner::evaluateExpression(const void* exprPtr) const {
     auto* expr = static_cast<const Expression*>(exprPtr);
     if (!expr || !expr->tokens()) return Variant::Int(0);
@@ -462,13 +477,7 @@ Variant Runner::evaluateExpression(const void* exprPtr) const {
                     std::cerr << "[Gyeol] Warning: expression stack underflow (negate op)\n";
                     return Variant::Int(0);
                 }
-                Variant val = stack.back(); stack.pop_back();
-                if (val.type == Variant::FLOAT) {
-                    stack.push_back(Variant::Float(-val.f));
-                } else {
-                    int32_t v = (val.type == Variant::BOOL) ? (val.b ? 1 : 0) : val.i;
-                    stack.push_back(Variant::Int(-v));
-                }
+                stack.back() = applyNegate(stack.back());
                 break;
             }
             // --- 비교 연산자 ---
@@ -527,6 +536,22 @@ Variant Runner::evaluateExpression(const void* exprPtr) const {
                 stack.push_back(Variant::Bool(!variantToBool(val)));
                 break;
             }
+            // --- 단락 평가: 왼쪽 값으로 결과가 정해지면 오른쪽 피연산자와 And/Or를 건너뜀 ---
+            case ExprOp::SkipIfFalse:
+            case ExprOp::SkipIfTrue: {
+                if (stack.empty()) {
+                    std::cerr << "[Gyeol] Warning: expression stack underflow (short-circuit skip)\n";
+                    return Variant::Int(0);
+                }
+                const bool value = variantToBool(stack.back());
+                if (value == (token->op() == ExprOp::SkipIfTrue)) {
+                    stack.back() = Variant::Bool(value);
+                    const auto remaining = expr->tokens()->size() - 1 - i;
+                    const auto skip = static_cast<flatbuffers::uoffset_t>(std::max(token->skip(), 0));
+                    i += std::min(skip, remaining);
+                }
+                break;
+            }
             // --- 함수 연산자 ---
             case ExprOp::PushVisitCount: {
                 std::string nodeName = poolStr(token->var_name_id());
@@ -576,25 +601,7 @@ Variant Runner::evaluateExpression(const void* exprPtr) const {
 
 // --- 문자열 보간 ---
 std::string Runner::variantToString(const Variant& v) {
-    switch (v.type) {
-        case Variant::BOOL:   return v.b ? "true" : "false";
-        case Variant::INT:    return std::to_string(v.i);
-        case Variant::FLOAT: {
-            std::ostringstream oss;
-            oss << v.f;
-            return oss.str();
-        }
-        case Variant::STRING: return v.s;
-        case Variant::LIST: {
-            std::string result;
-            for (size_t i = 0; i < v.list.size(); ++i) {
-                if (i > 0) result += ", ";
-                result += v.list[i];
-            }
-            return result;
-        }
-    }
-    return "";
+    return variantText(v);
 }
 
 std::string Runner::interpolateText(const char* text, int depth) const {
@@ -717,6 +724,55 @@ std::string Runner::interpolateText(const char* text, int depth) const {
     return result;
 }
 
+// hot_template 대사: 처음 쓸 때 원문을 리터럴/{변수} 조각으로 나눠 두고 이어 붙이기만 한다.
+// 로케일 오버레이나 압축 pool 문자열(원본 pool 포인터가 아님)과 {if}/함수 태그는 interpolateText로.
+std::string Runner::interpolateHotText(int32_t textId, const char* rawText) const {
+    auto* pool = asPool(pool_);
+    if (!pool || textId < 0 || textId >= static_cast<int32_t>(pool->size()) ||
+        rawText != pool->Get(static_cast<flatbuffers::uoffset_t>(textId))->c_str()) {
+        return interpolateText(rawText);
+    }
+
+    auto& tmpl = textTemplates_[textId];
+    if (tmpl.source != rawText) {
+        tmpl = TextTemplate{};
+        tmpl.source = rawText;
+        tmpl.simple = true;
+        const char* p = rawText;
+        while (*p && tmpl.simple) {
+            const char* open = std::strchr(p, '{');
+            if (!open) {
+                tmpl.parts.emplace_back(std::string(p), false);
+                break;
+            }
+            if (open > p) tmpl.parts.emplace_back(std::string(p, open), false);
+            const char* close = std::strchr(open + 1, '}');
+            std::string tag = close ? std::string(open + 1, close) : std::string();
+            if (!close || tag.compare(0, 3, "if ") == 0 || tag.find('(') != std::string::npos) {
+                tmpl.simple = false;
+                break;
+            }
+            tmpl.parts.emplace_back(std::move(tag), true);
+            p = close + 1;
+        }
+        if (!tmpl.simple) tmpl.parts.clear();
+    }
+    if (!tmpl.simple) return interpolateText(rawText);
+
+    std::string result;
+    bool hasVar = false;
+    for (const auto& [text, isVar] : tmpl.parts) {
+        if (!isVar) {
+            result += text;
+            continue;
+        }
+        hasVar = true;
+        auto it = variables_.find(text);
+        if (it != variables_.end()) result += variantToString(it->second);
+    }
+    return hasVar ? result : std::string(); // interpolateText와 같이 '{'가 없으면 빈 문자열
+}
+
 // --- 인라인 조건 평가 ---
 bool Runner::evaluateInlineCondition(const std::string& condStr) const {
     // 공백으로 토큰 분리
@@ -886,19 +942,21 @@ bool Runner::start(const uint8_t* buffer, size_t size) {
         return false;
     }
 
+    if (story_ != GetStory(buffer)) {
+        storyProfile_ = {}; // 노드 포인터 기준이므로 다른 버퍼면 무효
+    }
+    chunks_.reset();
+    activeChunk_.reset();
     story_ = GetStory(buffer);
     auto* story = asStory(story_);
-    pool_ = story->string_pool();
+    bindStringPool();
+    bindSeenLines(size);
 
     // 로케일 초기화
-    localePool_.clear();
+    activeLocale_.reset();
     currentLocale_.clear();
     resolvedLocale_.clear();
-    localeCharacterProps_.clear();
-    hasLocaleCatalog_ = false;
-    catalogDefaultLocale_.clear();
-    catalogLineEntriesByLocale_.clear();
-    catalogCharacterEntriesByLocale_.clear();
+    localeCatalog_.reset();
 
     // global_vars 초기화
     variables_.clear();
@@ -936,20 +994,7 @@ bool Runner::start(const uint8_t* buffer, size_t size) {
 
     // 노드 메타데이터 태그 캐시
     nodeTags_.clear();
-    if (story->nodes()) {
-        for (flatbuffers::uoffset_t ni = 0; ni < story->nodes()->size(); ++ni) {
-            auto* node = story->nodes()->Get(ni);
-            if (node->tags() && node->tags()->size() > 0) {
-                std::string nodeName = node->name() ? node->name()->c_str() : "";
-                std::vector<std::pair<std::string, std::string>> tags;
-                for (flatbuffers::uoffset_t ti = 0; ti < node->tags()->size(); ++ti) {
-                    auto* tag = node->tags()->Get(ti);
-                    tags.emplace_back(poolStr(tag->key_id()), poolStr(tag->value_id()));
-                }
-                nodeTags_[nodeName] = std::move(tags);
-            }
-        }
-    }
+    cacheNodeTags();
 
     // start_node로 이동
     callStack_.clear();
@@ -962,7 +1007,12 @@ bool Runner::start(const uint8_t* buffer, size_t size) {
     hitBreakpoint_ = false;
     seedRngForStart();
     finished_ = false;
-    recordTrace("START", std::string("seed=") + std::to_string(currentSeed_));
+    if (traceActive()) recordTrace("START", std::string("seed=") + std::to_string(currentSeed_));
+
+    if (predecodeEnabled_) {
+        buildDecodedProgram();
+    }
+    bindAotProgram(buffer, size);
 
     if (story->start_node_name()) {
         jumpToNode(story->start_node_name()->c_str());
@@ -981,531 +1031,693 @@ bool Runner::startAtNode(const uint8_t* buffer, size_t size, const std::string&
     // 지정된 노드로 재점프 (visitCount 리셋 후 다시 증가)
     visitCounts_.clear();
     jumpToNode(nodeName.c_str());
-    recordTrace("START_AT_NODE", nodeName, pc_, "");
+    if (traceActive()) recordTrace("START_AT_NODE", nodeName, pc_, "");
     return !finished_;
 }
 
 // --- step ---
+void Runner::setInstructionBudget(uint32_t maxInstructions) {
+    instructionBudget_ = maxInstructions;
+}
+
+uint32_t Runner::getInstructionBudget() const {
+    return instructionBudget_;
+}
+
+bool Runner::budgetCheckpoint(const void* node, uint32_t pc) {
+    return InstrStream::isBudgetCheckpoint(asNode(node), pc);
+}
+
+void Runner::yieldForBudget(StepResult& result) {
+    result.type = StepType::YIELD;
+    result.budgetExhausted = true;
+    if (traceActive()) recordTrace("BUDGET_YIELD", nodeNameFromPtr(currentNode_), pc_, std::to_string(instructionBudget_));
+}
+
 StepResult Runner::step() {
     StepResult result;
     result.type = StepType::END;
-    metrics_.stepCalls++;
+    countMetric(&ExecutionMetrics::stepCalls);
+    ProfileScope stepScope(profilingActive() ? &metrics_.profile.step : nullptr);
+    if (compressedPool_) trimStringPoolCache(); // 이전 step의 문자열은 여기서부터 무효
 
     if (finished_) {
-        metrics_.endResults++;
-        recordTrace("END", "already_finished");
+        countMetric(&ExecutionMetrics::endResults);
+        if (traceActive()) recordTrace("END", "already_finished");
         return result;
     }
+    budgetLeft_ = instructionBudget_ != 0 ? instructionBudget_ : std::numeric_limits<uint64_t>::max();
+    advance(result);
+    return result;
+}
+
+// 다음 보이는 결과까지 실행 (step/skipSeen 공용, 예산은 호출자가 정한다)
+void Runner::advance(StepResult& result) {
+    // AOT 코드 / 사전 디코딩된 명령어 스트림 (디버그/트레이스/프로파일링 중에는 참조 경로 사용)
+    if ((aotActive_ || decoded_) && !referenceDispatchRequired() &&
+        (aotActive_ ? stepAot(result) : stepDecoded(result))) {
+        return;
+    }
 
     auto* node = asNode(currentNode_);
-    auto* pool = asPool(pool_);
 
     while (true) {
         if (waitBlocked_) {
             result.type = StepType::WAIT;
             result.wait.tag = waitTag_.empty() ? nullptr : waitTag_.c_str();
             setError("Cannot step while waiting; call resume() first");
-            recordTrace("WAIT_BLOCKED", nodeNameFromPtr(currentNode_), pc_, waitTag_);
-            return result;
+            if (traceActive()) recordTrace("WAIT_BLOCKED", nodeNameFromPtr(currentNode_), pc_, waitTag_);
+            return;
         }
 
         // 노드 끝 도달
-        if (!node || !node->lines() || pc_ >= node->lines()->size()) {
+        if (pc_ >= InstrStream::count(node)) {
             // call stack에서 복귀
-            if (!callStack_.empty()) {
-                auto frame = callStack_.back();
-                callStack_.pop_back();
-
-                // 섀도된 변수 먼저 복원
-                restoreShadowedVars(frame);
-
-                // 명시적 return이 있었으면 반환값 저장
-                if (hasPendingReturn_ && !frame.returnVarName.empty()) {
-                    variables_[frame.returnVarName] = pendingReturnValue_;
-                }
-                hasPendingReturn_ = false;
-
-                currentNode_ = frame.node;
-                pc_ = frame.pc;
+            if (returnFromNodeEnd()) {
                 node = asNode(currentNode_);
                 continue;
             }
             // 스토리 종료
             finished_ = true;
             result.type = StepType::END;
-            metrics_.endResults++;
-            recordTrace("END", "story_finished");
-            return result;
+            countMetric(&ExecutionMetrics::endResults);
+            if (traceActive()) recordTrace("END", "story_finished");
+            return;
         }
 
+        if (!takeInstructionBudget(result, node, pc_)) return;
+
         // --- Debug: breakpoint/step mode check (zero-cost when not debugging) ---
-        if (!breakpoints_.empty() || stepMode_) {
+        if (RunnerFeatures::debug && (!breakpoints_.empty() || stepMode_)) {
             if (hitBreakpoint_) {
                 // 이전 호출에서 여기서 멈췄음 — 해제하고 계속 진행
                 hitBreakpoint_ = false;
             } else if (stepMode_) {
                 // Step mode: 매 instruction마다 정지
                 hitBreakpoint_ = true;
-                return result;
+                return;
             } else {
                 // Breakpoint만 체크 (stepMode_ == false)
                 std::string curNode = nodeNameFromPtr(currentNode_);
                 if (breakpoints_.count({curNode, pc_}) > 0) {
                     hitBreakpoint_ = true;
-                    return result;
+                    return;
                 }
             }
         }
 
-        auto* instr = node->lines()->Get(pc_);
+        const auto* rec = InstrStream::compactAt(node, pc_);
+        const auto* instr = rec ? nullptr : InstrStream::tableAt(node, pc_);
         pc_++;
-        metrics_.instructionsExecuted++;
-
-        switch (instr->data_type()) {
-            case OpData::Line: {
-                auto* line = instr->data_as_Line();
-                result.type = StepType::LINE;
-                result.line.character = (line->character_id() >= 0)
-                    ? poolStr(line->character_id()) : nullptr;
-                const char* rawText = poolStr(line->text_id());
-                std::string interp = interpolateText(rawText);
-                if (!interp.empty()) {
-                    result.ownedStrings_.push_back(std::move(interp));
-                    result.line.text = result.ownedStrings_.back().c_str();
-                } else {
-                    result.line.text = rawText;
-                }
-                // tags 채우기
-                if (line->tags()) {
-                    for (flatbuffers::uoffset_t t = 0; t < line->tags()->size(); ++t) {
-                        auto* tag = line->tags()->Get(t);
-                        result.line.tags.emplace_back(
-                            poolStr(tag->key_id()),
-                            poolStr(tag->value_id())
-                        );
-                    }
-                }
-                metrics_.lineResults++;
-                recordTrace(
-                    "LINE",
-                    nodeNameFromPtr(currentNode_),
-                    pc_ - 1,
-                    result.line.text ? result.line.text : "");
-                return result;
-            }
+        countMetric(&ExecutionMetrics::instructionsExecuted);
+        ProfileScope opScope(profilingActive()
+            ? &metrics_.profile.opcodes[static_cast<size_t>(
+                  rec ? InstrStream::toOpData(rec->op()) : instr ? instr->data_type() : OpData::NONE)]
+            : nullptr);
+        StoryProfileScope storyScope(storyProfilingActive() ? this : nullptr, node, pc_ - 1);
+
+        if (rec ? executeCompact(rec, result) : instr && executeInstruction(instr, result)) {
+            return;
+        }
+        node = asNode(currentNode_);
+    }
+}
 
-            case OpData::Choice: {
-                // Choice를 연속으로 수집 (수식어 + 조건 필터링)
-                auto* choice = instr->data_as_Choice();
-                pendingChoices_.clear();
-                std::string curNodeName = node->name() ? node->name()->c_str() : "";
-
-                // 모든 연속 Choice를 먼저 수집 (raw)
-                struct RawChoice {
-                    int32_t text_id;
-                    int32_t target_node_name_id;
-                    int32_t condition_var_id;
-                    int8_t choice_modifier;
-                    uint32_t instrPc; // instruction의 PC (once_key용)
-                };
-                std::vector<RawChoice> rawChoices;
-                rawChoices.push_back({choice->text_id(), choice->target_node_name_id(),
-                                      choice->condition_var_id(),
-                                      static_cast<int8_t>(choice->choice_modifier()),
-                                      pc_ - 1});
-
-                while (node->lines() && pc_ < node->lines()->size()) {
-                    auto* next = node->lines()->Get(pc_);
-                    if (next->data_type() != OpData::Choice) break;
-                    auto* nextChoice = next->data_as_Choice();
-                    rawChoices.push_back({nextChoice->text_id(), nextChoice->target_node_name_id(),
-                                          nextChoice->condition_var_id(),
-                                          static_cast<int8_t>(nextChoice->choice_modifier()),
-                                          pc_});
-                    pc_++;
-                }
+// 노드 끝에서 호출자로 복귀. call stack이 비어 있으면 false.
+bool Runner::returnFromNodeEnd() {
+    if (callStack_.empty()) return false;
 
-                // 조건 + once + modifier 필터링
-                std::vector<PendingChoice> normalChoices;  // Default/Sticky/Once (visible)
-                std::vector<PendingChoice> fallbackChoices; // Fallback (visible)
-
-                for (const auto& rc : rawChoices) {
-                    // 1) condition_var_id 체크
-                    bool condVisible = true;
-                    if (rc.condition_var_id >= 0) {
-                        std::string condVar = poolStr(rc.condition_var_id);
-                        auto it = variables_.find(condVar);
-                        if (it != variables_.end()) {
-                            condVisible = (it->second.type == Variant::BOOL) ? it->second.b : (it->second.i != 0);
-                        } else {
-                            condVisible = false;
-                        }
-                    }
-                    if (!condVisible) continue;
+    auto frame = callStack_.back();
+    callStack_.pop_back();
 
-                    // 2) once 체크: 이미 선택한 once 선택지는 숨김
-                    std::string onceKey = curNodeName + ":" + std::to_string(rc.instrPc);
-                    if (rc.choice_modifier == 1 /* Once */) {
-                        if (chosenOnceChoices_.count(onceKey) > 0) continue;
-                    }
+    // 섀도된 변수 먼저 복원
+    restoreShadowedVars(frame);
+
+    // 명시적 return이 있었으면 반환값 저장
+    if (hasPendingReturn_ && !frame.returnVarName.empty()) {
+        variables_[frame.returnVarName] = pendingReturnValue_;
+    }
+    hasPendingReturn_ = false;
 
-                    PendingChoice pc;
-                    pc.text_id = rc.text_id;
-                    pc.target_node_name_id = rc.target_node_name_id;
-                    pc.choice_modifier = rc.choice_modifier;
-                    pc.once_key = onceKey;
+    if (frame.chunk && frame.chunk != activeChunk_) switchChunk(frame.chunk);
+    currentNode_ = frame.node;
+    pc_ = frame.pc;
+    return true;
+}
 
-                    if (rc.choice_modifier == 3 /* Fallback */) {
-                        fallbackChoices.push_back(std::move(pc));
+// 명령어 하나를 FlatBuffers에서 직접 읽어 실행한다 (참조 경로).
+// true면 result를 step() 호출자에게 돌려주고, false면 다음 명령어로 진행한다.
+bool Runner::executeInstruction(const void* instrPtr, StepResult& result) {
+    auto* instr = static_cast<const Instruction*>(instrPtr);
+    auto* node = asNode(currentNode_);
+    auto* pool = asPool(pool_);
+
+    switch (instr->data_type()) {
+        case OpData::Line:
+            emitLine(instr->data_as_Line(), result);
+            return true;
+
+        case OpData::Choice: {
+            // Choice를 연속으로 수집 (수식어 + 조건 필터링)
+            auto* choice = instr->data_as_Choice();
+            pendingChoices_.clear();
+            std::string curNodeName = node->name() ? node->name()->c_str() : "";
+
+            // 모든 연속 Choice를 먼저 수집 (raw)
+            struct RawChoice {
+                int32_t text_id;
+                int32_t target_node_name_id;
+                int32_t target_node_index;
+                int32_t condition_var_id;
+                int8_t choice_modifier;
+                uint32_t instrPc; // instruction의 PC (once_key용)
+            };
+            std::vector<RawChoice> rawChoices;
+            rawChoices.push_back({choice->text_id(), choice->target_node_name_id(),
+                                  choice->target_node_index(),
+                                  choice->condition_var_id(),
+                                  static_cast<int8_t>(choice->choice_modifier()),
+                                  pc_ - 1});
+
+            while (pc_ < InstrStream::count(node)) {
+                auto* next = InstrStream::tableAt(node, pc_);
+                if (!next || next->data_type() != OpData::Choice) break;
+                auto* nextChoice = next->data_as_Choice();
+                rawChoices.push_back({nextChoice->text_id(), nextChoice->target_node_name_id(),
+                                      nextChoice->target_node_index(),
+                                      nextChoice->condition_var_id(),
+                                      static_cast<int8_t>(nextChoice->choice_modifier()),
+                                      pc_});
+                pc_++;
+            }
+
+            // 조건 + once + modifier 필터링
+            std::vector<PendingChoice> normalChoices;  // Default/Sticky/Once (visible)
+            std::vector<PendingChoice> fallbackChoices; // Fallback (visible)
+
+            for (const auto& rc : rawChoices) {
+                // 1) condition_var_id 체크
+                bool condVisible = true;
+                if (rc.condition_var_id >= 0) {
+                    std::string condVar = poolStr(rc.condition_var_id);
+                    auto it = variables_.find(condVar);
+                    if (it != variables_.end()) {
+                        condVisible = (it->second.type == Variant::BOOL) ? it->second.b : (it->second.i != 0);
                     } else {
-                        normalChoices.push_back(std::move(pc));
+                        condVisible = false;
                     }
                 }
+                if (!condVisible) continue;
 
-                // Fallback: normal이 모두 비었을 때만 fallback 사용
-                if (normalChoices.empty()) {
-                    pendingChoices_ = std::move(fallbackChoices);
+                // 2) once 체크: 이미 선택한 once 선택지는 숨김
+                std::string onceKey = curNodeName + ":" + std::to_string(rc.instrPc);
+                if (rc.choice_modifier == 1 /* Once */) {
+                    if (chosenOnceChoices_.count(onceKey) > 0) continue;
+                }
+
+                PendingChoice pc;
+                pc.text_id = rc.text_id;
+                pc.target_node_name_id = rc.target_node_name_id;
+                pc.target_node_index = rc.target_node_index;
+                pc.choice_modifier = rc.choice_modifier;
+                pc.once_key = onceKey;
+
+                if (rc.choice_modifier == 3 /* Fallback */) {
+                    fallbackChoices.push_back(std::move(pc));
                 } else {
-                    pendingChoices_ = std::move(normalChoices);
+                    normalChoices.push_back(std::move(pc));
                 }
+            }
 
-                // 결과 반환
-                result.type = StepType::CHOICES;
-                for (int k = 0; k < static_cast<int>(pendingChoices_.size()); ++k) {
-                    ChoiceData cd;
-                    const char* rawText = poolStr(pendingChoices_[k].text_id);
-                    std::string interp = interpolateText(rawText);
-                    if (!interp.empty()) {
-                        result.ownedStrings_.push_back(std::move(interp));
-                        cd.text = result.ownedStrings_.back().c_str();
-                    } else {
-                        cd.text = rawText;
-                    }
-                    cd.index = k;
-                    result.choices.push_back(cd);
+            // Fallback: normal이 모두 비었을 때만 fallback 사용
+            if (normalChoices.empty()) {
+                pendingChoices_ = std::move(fallbackChoices);
+            } else {
+                pendingChoices_ = std::move(normalChoices);
+            }
+
+            // 결과 반환
+            result.type = StepType::CHOICES;
+            for (int k = 0; k < static_cast<int>(pendingChoices_.size()); ++k) {
+                ChoiceData cd;
+                const char* rawText = poolStr(pendingChoices_[k].text_id);
+                std::string interp = interpolateText(rawText);
+                if (!interp.empty()) {
+                    result.ownedStrings_.push_back(std::move(interp));
+                    cd.text = result.ownedStrings_.back().c_str();
+                } else {
+                    cd.text = rawText;
                 }
-                metrics_.choiceResults++;
-                recordTrace(
-                    "CHOICES",
-                    nodeNameFromPtr(currentNode_),
-                    pc_ - 1,
-                    std::to_string(result.choices.size()));
-                return result;
+                cd.index = k;
+                result.choices.push_back(cd);
             }
+            countMetric(&ExecutionMetrics::choiceResults);
+            if (traceActive()) recordTrace(
+                "CHOICES",
+                nodeNameFromPtr(currentNode_),
+                pc_ - 1,
+                std::to_string(result.choices.size()));
+            return true;
+        }
 
-            case OpData::Jump: {
-                auto* jump = instr->data_as_Jump();
-                metrics_.jumps++;
-                if (jump->is_call()) {
-                    // 1. 호출자 컨텍스트에서 인자 평가
-                    std::vector<Variant> argValues;
-                    if (jump->arg_exprs()) {
-                        for (flatbuffers::uoffset_t ai = 0; ai < jump->arg_exprs()->size(); ++ai) {
-                            argValues.push_back(evaluateExpression(jump->arg_exprs()->Get(ai)));
-                        }
-                    }
-                    // 2. call frame push
-                    callStack_.push_back({currentNode_, pc_, "", {}, {}});
-                    metrics_.calls++;
-                    recordTrace("CALL", nodeNameFromPtr(currentNode_), pc_ - 1, poolStr(jump->target_node_name_id()));
-                    // 3. 대상 노드로 이동
-                    jumpToNodeById(jump->target_node_name_id());
-                    // 4. 매개변수 바인딩
-                    if (!finished_) {
-                        bindParameters(currentNode_, argValues, callStack_.back());
+        case OpData::Jump: {
+            auto* jump = instr->data_as_Jump();
+            countMetric(&ExecutionMetrics::jumps);
+            if (jump->is_call()) {
+                // 1. 호출자 컨텍스트에서 인자 평가
+                std::vector<Variant> argValues;
+                if (jump->arg_exprs()) {
+                    for (flatbuffers::uoffset_t ai = 0; ai < jump->arg_exprs()->size(); ++ai) {
+                        argValues.push_back(evaluateExpression(jump->arg_exprs()->Get(ai)));
                     }
-                } else {
-                    recordTrace("JUMP", nodeNameFromPtr(currentNode_), pc_ - 1, poolStr(jump->target_node_name_id()));
-                    jumpToNodeById(jump->target_node_name_id());
                 }
-                node = asNode(currentNode_);
+                // 2. call frame push
+                callStack_.push_back({currentNode_, pc_, "", {}, {}, activeChunk_});
+                countMetric(&ExecutionMetrics::calls);
+                if (traceActive()) recordTrace("CALL", nodeNameFromPtr(currentNode_), pc_ - 1, poolStr(jump->target_node_name_id()));
+                if (playProfilingActive()) recordPlayCall(jump->target_node_name_id());
+                // 3. 대상 노드로 이동
+                jumpToNodeById(jump->target_node_name_id(), jump->target_node_index());
+                // 4. 매개변수 바인딩
+                if (!finished_) {
+                    bindParameters(currentNode_, argValues, callStack_.back());
+                }
+            } else {
+                if (traceActive()) recordTrace("JUMP", nodeNameFromPtr(currentNode_), pc_ - 1, poolStr(jump->target_node_name_id()));
+                jumpToNodeById(jump->target_node_name_id(), jump->target_node_index());
+            }
+            if (finished_) {
+                result.type = StepType::END;
+                return true;
+            }
+            return false; // 다음 instruction 계속
+        }
+
+        case OpData::SetVar: {
+            auto* setvar = instr->data_as_SetVar();
+            executeSetVar(setvar, poolStr(setvar->var_name_id()));
+            return false;
+        }
+
+        case OpData::Condition: {
+            auto* cond = instr->data_as_Condition();
+            countMetric(&ExecutionMetrics::conditionsEvaluated);
+            const bool condResult = evaluateCondition(cond);
+
+            int32_t targetId = condResult ? cond->true_jump_node_id() : cond->false_jump_node_id();
+            int32_t targetIndex = condResult ? cond->true_jump_node_index() : cond->false_jump_node_index();
+            if (traceActive()) recordTrace(
+                "CONDITION",
+                nodeNameFromPtr(currentNode_),
+                pc_ - 1,
+                condResult ? "true" : "false");
+            if (playProfilingActive()) recordPlayBranch("condition", condResult ? 0 : 1, 2);
+            if (targetId >= 0) {
+                jumpToNodeById(targetId, targetIndex);
                 if (finished_) {
                     result.type = StepType::END;
-                    return result;
+                    return true;
                 }
-                continue; // 다음 instruction 계속
             }
+            // targetId < 0이면 다음 줄로 계속
+            return false;
+        }
 
-            case OpData::SetVar: {
-                auto* setvar = instr->data_as_SetVar();
-                std::string varName = poolStr(setvar->var_name_id());
-                Variant newVal = Variant::Int(0);
-                if (setvar->expr()) {
-                    newVal = evaluateExpression(setvar->expr());
-                } else if (setvar->value() && setvar->value_type() != ValueData::NONE) {
-                    newVal = readValueData(setvar->value(), setvar->value_type(), pool);
+        case OpData::Random: {
+            auto* random = instr->data_as_Random();
+            if (!random || !random->branches() || random->branches()->size() == 0)
+                return false;
+
+            int64_t totalWeight = 0;
+            for (flatbuffers::uoffset_t k = 0; k < random->branches()->size(); ++k) {
+                int w = random->branches()->Get(k)->weight();
+                if (w > 0) {
+                    totalWeight += w;
+                    if (totalWeight > 0x7FFFFFFF) {
+                        std::cerr << "[Gyeol] Warning: random weight sum overflow, capping\n";
+                        totalWeight = 0x7FFFFFFF;
+                        break;
+                    }
+                }
+            }
+            if (totalWeight <= 0) return false; // 모든 weight 0 → skip
+
+            std::uniform_int_distribution<int> dist(0, static_cast<int>(totalWeight) - 1);
+            int roll = dist(rng_);
+            countMetric(&ExecutionMetrics::randomRolls);
+            if (traceActive()) recordTrace("RANDOM", nodeNameFromPtr(currentNode_), pc_ - 1, std::to_string(roll));
+
+            int64_t cumulative = 0;
+            for (flatbuffers::uoffset_t k = 0; k < random->branches()->size(); ++k) {
+                int w = random->branches()->Get(k)->weight();
+                if (w <= 0) continue;
+                cumulative += w;
+                if (roll < cumulative) {
+                    if (playProfilingActive()) recordPlayBranch("random", k, random->branches()->size());
+                    auto* branch = random->branches()->Get(k);
+                    jumpToNodeById(branch->target_node_name_id(), branch->target_node_index());
+                    if (finished_) { result.type = StepType::END; return true; }
+                    break;
                 }
+            }
+            return false;
+        }
 
-                switch (setvar->assign_op()) {
-                    case AssignOp::Assign:
-                        variables_[varName] = newVal;
+        case OpData::Command: {
+            auto* cmd = instr->data_as_Command();
+            result.type = StepType::COMMAND;
+            result.command.type = poolStr(cmd->type_id());
+            result.command.args.clear();
+            auto* args = cmd->args();
+            if (args) {
+                for (flatbuffers::uoffset_t k = 0; k < args->size(); ++k) {
+                    const auto* arg = args->Get(k);
+                    if (!arg) continue;
+                    CommandArgData outArg;
+                    switch (arg->kind()) {
+                    case CommandArgKind::String:
+                        outArg.type = CommandArgType::STRING;
+                        outArg.text = poolStr(arg->string_id());
                         break;
-                    case AssignOp::Append: {
-                        auto& existing = variables_[varName];
-                        if (existing.type == Variant::LIST) {
-                            std::string item = (newVal.type == Variant::STRING) ? newVal.s : variantToString(newVal);
-                            if (std::find(existing.list.begin(), existing.list.end(), item) == existing.list.end()) {
-                                existing.list.push_back(item);
-                            }
-                        } else {
-                            variables_[varName] = newVal;
-                        }
+                    case CommandArgKind::Identifier:
+                        outArg.type = CommandArgType::IDENTIFIER;
+                        outArg.text = poolStr(arg->string_id());
                         break;
-                    }
-                    case AssignOp::Remove: {
-                        auto it = variables_.find(varName);
-                        if (it != variables_.end() && it->second.type == Variant::LIST) {
-                            std::string item = (newVal.type == Variant::STRING) ? newVal.s : variantToString(newVal);
-                            auto& list = it->second.list;
-                            list.erase(std::remove(list.begin(), list.end(), item), list.end());
-                        }
+                    case CommandArgKind::Int:
+                        outArg.type = CommandArgType::INT;
+                        outArg.intValue = arg->int_value();
+                        break;
+                    case CommandArgKind::Float:
+                        outArg.type = CommandArgType::FLOAT;
+                        outArg.floatValue = arg->float_value();
+                        break;
+                    case CommandArgKind::Bool:
+                        outArg.type = CommandArgType::BOOL;
+                        outArg.boolValue = arg->bool_value();
+                        break;
+                    default:
+                        outArg.type = CommandArgType::STRING;
+                        outArg.text.clear();
                         break;
                     }
+                    result.command.args.push_back(std::move(outArg));
                 }
-                recordTrace("SET_VAR", nodeNameFromPtr(currentNode_), pc_ - 1, varName);
-                continue;
             }
+            countMetric(&ExecutionMetrics::commandResults);
+            if (traceActive()) recordTrace(
+                "COMMAND",
+                nodeNameFromPtr(currentNode_),
+                pc_ - 1,
+                result.command.type ? result.command.type : "");
+            return true;
+        }
 
-            case OpData::Condition: {
-                auto* cond = instr->data_as_Condition();
-                bool condResult;
-                metrics_.conditionsEvaluated++;
+        case OpData::Wait: {
+            auto* wait = instr->data_as_Wait();
+            enterWait(wait ? wait->tag_id() : -1, result);
+            return true;
+        }
 
-                if (cond->cond_expr()) {
-                    // 논리 연산자 경로: 전체 불리언 표현식 평가
-                    Variant result = evaluateExpression(cond->cond_expr());
-                    condResult = variantToBool(result);
-                } else {
-                    // 기존 경로: lhs_expr/op/rhs_expr 또는 var_name_id/compare_value
-                    Variant lhs = Variant::Int(0);
-                    if (cond->lhs_expr()) {
-                        lhs = evaluateExpression(cond->lhs_expr());
-                    } else {
-                        std::string varName = poolStr(cond->var_name_id());
-                        auto it = variables_.find(varName);
-                        if (it != variables_.end()) {
-                            lhs = it->second;
-                        }
-                    }
+        case OpData::Yield: {
+            result.type = StepType::YIELD;
+            if (traceActive()) recordTrace("YIELD", nodeNameFromPtr(currentNode_), pc_ - 1, "");
+            return true;
+        }
 
-                    Variant rhs = Variant::Int(0);
-                    if (cond->rhs_expr()) {
-                        rhs = evaluateExpression(cond->rhs_expr());
-                    } else if (cond->compare_value() && cond->compare_value_type() != ValueData::NONE) {
-                        rhs = readValueData(cond->compare_value(), cond->compare_value_type(), pool);
-                    }
+        case OpData::Return: {
+            auto* ret = instr->data_as_Return();
+            countMetric(&ExecutionMetrics::returns);
+            if (traceActive()) recordTrace("RETURN", nodeNameFromPtr(currentNode_), pc_ - 1, "");
+            // 반환값 평가
+            if (ret->expr()) {
+                pendingReturnValue_ = evaluateExpression(ret->expr());
+                hasPendingReturn_ = true;
+            } else if (ret->value() && ret->value_type() != ValueData::NONE) {
+                pendingReturnValue_ = readValueData(ret->value(), ret->value_type(), pool);
+                hasPendingReturn_ = true;
+            } else {
+                // bare "return" (값 없음)
+                hasPendingReturn_ = false;
+            }
 
-                    condResult = compareVariants(lhs, cond->op(), rhs);
-                }
+            // call stack pop
+            if (!callStack_.empty()) {
+                auto frame = callStack_.back();
+                callStack_.pop_back();
 
-                int32_t targetId = condResult ? cond->true_jump_node_id() : cond->false_jump_node_id();
-                recordTrace(
-                    "CONDITION",
-                    nodeNameFromPtr(currentNode_),
-                    pc_ - 1,
-                    condResult ? "true" : "false");
-                if (targetId >= 0) {
-                    jumpToNodeById(targetId);
-                    node = asNode(currentNode_);
-                    if (finished_) {
-                        result.type = StepType::END;
-                        return result;
-                    }
-                }
-                // targetId < 0이면 다음 줄로 계속
-                continue;
-            }
+                // 섀도된 변수 먼저 복원
+                restoreShadowedVars(frame);
 
-            case OpData::Random: {
-                auto* random = instr->data_as_Random();
-                if (!random || !random->branches() || random->branches()->size() == 0)
-                    continue;
-
-                int64_t totalWeight = 0;
-                for (flatbuffers::uoffset_t k = 0; k < random->branches()->size(); ++k) {
-                    int w = random->branches()->Get(k)->weight();
-                    if (w > 0) {
-                        totalWeight += w;
-                        if (totalWeight > 0x7FFFFFFF) {
-                            std::cerr << "[Gyeol] Warning: random weight sum overflow, capping\n";
-                            totalWeight = 0x7FFFFFFF;
-                            break;
-                        }
-                    }
-                }
-                if (totalWeight <= 0) continue; // 모든 weight 0 → skip
-
-                std::uniform_int_distribution<int> dist(0, static_cast<int>(totalWeight) - 1);
-                int roll = dist(rng_);
-                metrics_.randomRolls++;
-                recordTrace("RANDOM", nodeNameFromPtr(currentNode_), pc_ - 1, std::to_string(roll));
-
-                int64_t cumulative = 0;
-                for (flatbuffers::uoffset_t k = 0; k < random->branches()->size(); ++k) {
-                    int w = random->branches()->Get(k)->weight();
-                    if (w <= 0) continue;
-                    cumulative += w;
-                    if (roll < cumulative) {
-                        jumpToNodeById(random->branches()->Get(k)->target_node_name_id());
-                        node = asNode(currentNode_);
-                        if (finished_) { result.type = StepType::END; return result; }
-                        break;
-                    }
+                // 반환값 저장 (호출자 스코프)
+                if (hasPendingReturn_ && !frame.returnVarName.empty()) {
+                    variables_[frame.returnVarName] = pendingReturnValue_;
                 }
-                continue;
-            }
+                hasPendingReturn_ = false;
 
-            case OpData::Command: {
-                auto* cmd = instr->data_as_Command();
-                result.type = StepType::COMMAND;
-                result.command.type = poolStr(cmd->type_id());
-                result.command.args.clear();
-                auto* args = cmd->args();
-                if (args) {
-                    for (flatbuffers::uoffset_t k = 0; k < args->size(); ++k) {
-                        const auto* arg = args->Get(k);
-                        if (!arg) continue;
-                        CommandArgData outArg;
-                        switch (arg->kind()) {
-                        case CommandArgKind::String:
-                            outArg.type = CommandArgType::STRING;
-                            outArg.text = poolStr(arg->string_id());
-                            break;
-                        case CommandArgKind::Identifier:
-                            outArg.type = CommandArgType::IDENTIFIER;
-                            outArg.text = poolStr(arg->string_id());
-                            break;
-                        case CommandArgKind::Int:
-                            outArg.type = CommandArgType::INT;
-                            outArg.intValue = arg->int_value();
-                            break;
-                        case CommandArgKind::Float:
-                            outArg.type = CommandArgType::FLOAT;
-                            outArg.floatValue = arg->float_value();
-                            break;
-                        case CommandArgKind::Bool:
-                            outArg.type = CommandArgType::BOOL;
-                            outArg.boolValue = arg->bool_value();
-                            break;
-                        default:
-                            outArg.type = CommandArgType::STRING;
-                            outArg.text.clear();
-                            break;
-                        }
-                        result.command.args.push_back(std::move(outArg));
-                    }
-                }
-                metrics_.commandResults++;
-                recordTrace(
-                    "COMMAND",
-                    nodeNameFromPtr(currentNode_),
-                    pc_ - 1,
-                    result.command.type ? result.command.type : "");
-                return result;
+                if (frame.chunk && frame.chunk != activeChunk_) switchChunk(frame.chunk);
+                currentNode_ = frame.node;
+                pc_ = frame.pc;
+                return false;
             }
 
-            case OpData::Wait: {
-                auto* wait = instr->data_as_Wait();
-                waitBlocked_ = true;
-                waitTag_.clear();
-                if (wait && wait->tag_id() >= 0) {
-                    waitTag_ = poolStr(wait->tag_id());
-                }
+            // call stack 비어있으면 스토리 종료
+            hasPendingReturn_ = false;
+            finished_ = true;
+            result.type = StepType::END;
+            countMetric(&ExecutionMetrics::endResults);
+            if (traceActive()) recordTrace("END", "return_without_call");
+            return true;
+        }
 
-                result.type = StepType::WAIT;
-                result.wait.tag = waitTag_.empty() ? nullptr : waitTag_.c_str();
-                recordTrace("WAIT", nodeNameFromPtr(currentNode_), pc_ - 1, waitTag_);
-                return result;
-            }
+        case OpData::CallWithReturn: {
+            auto* cwr = instr->data_as_CallWithReturn();
+            std::string returnVarName = poolStr(cwr->return_var_name_id());
 
-            case OpData::Yield: {
-                result.type = StepType::YIELD;
-                recordTrace("YIELD", nodeNameFromPtr(currentNode_), pc_ - 1, "");
-                return result;
+            // 1. 호출자 컨텍스트에서 인자 평가
+            std::vector<Variant> argValues;
+            if (cwr->arg_exprs()) {
+                for (flatbuffers::uoffset_t ai = 0; ai < cwr->arg_exprs()->size(); ++ai) {
+                    argValues.push_back(evaluateExpression(cwr->arg_exprs()->Get(ai)));
+                }
             }
 
-            case OpData::Return: {
-                auto* ret = instr->data_as_Return();
-                metrics_.returns++;
-                recordTrace("RETURN", nodeNameFromPtr(currentNode_), pc_ - 1, "");
-                // 반환값 평가
-                if (ret->expr()) {
-                    pendingReturnValue_ = evaluateExpression(ret->expr());
-                    hasPendingReturn_ = true;
-                } else if (ret->value() && ret->value_type() != ValueData::NONE) {
-                    pendingReturnValue_ = readValueData(ret->value(), ret->value_type(), pool);
-                    hasPendingReturn_ = true;
-                } else {
-                    // bare "return" (값 없음)
-                    hasPendingReturn_ = false;
-                }
+            // 2. call stack에 반환변수 이름 포함하여 push
+            callStack_.push_back({currentNode_, pc_, returnVarName, {}, {}, activeChunk_});
+            countMetric(&ExecutionMetrics::calls);
+            if (traceActive()) recordTrace("CALL_RETURN", nodeNameFromPtr(currentNode_), pc_ - 1, poolStr(cwr->target_node_name_id()));
+            if (playProfilingActive()) recordPlayCall(cwr->target_node_name_id());
 
-                // call stack pop
-                if (!callStack_.empty()) {
-                    auto frame = callStack_.back();
-                    callStack_.pop_back();
+            // 3. 대상 노드로 이동
+            jumpToNodeById(cwr->target_node_name_id(), cwr->target_node_index());
 
-                    // 섀도된 변수 먼저 복원
-                    restoreShadowedVars(frame);
+            // 4. 매개변수 바인딩
+            if (!finished_) {
+                bindParameters(currentNode_, argValues, callStack_.back());
+            }
 
-                    // 반환값 저장 (호출자 스코프)
-                    if (hasPendingReturn_ && !frame.returnVarName.empty()) {
-                        variables_[frame.returnVarName] = pendingReturnValue_;
-                    }
-                    hasPendingReturn_ = false;
+            if (finished_) {
+                result.type = StepType::END;
+                return true;
+            }
+            return false;
+        }
 
-                    currentNode_ = frame.node;
-                    pc_ = frame.pc;
-                    node = asNode(currentNode_);
-                    continue;
-                }
+        default:
+            return false;
+    }
+}
 
-                // call stack 비어있으면 스토리 종료
-                hasPendingReturn_ = false;
-                finished_ = true;
+// 압축 레코드 하나를 실행한다 (반환값 의미는 executeInstruction과 같음)
+bool Runner::executeCompact(const void* recPtr, StepResult& result) {
+    auto* rec = static_cast<const CompactInstr*>(recPtr);
+    switch (rec->op()) {
+        case CompactOp::Line:
+            emitLineData(rec->a(), rec->b(), rec->c(), nullptr, result, (rec->kind() & 1) != 0);
+            return true;
+
+        case CompactOp::Jump:
+            countMetric(&ExecutionMetrics::jumps);
+            if (traceActive()) recordTrace("JUMP", nodeNameFromPtr(currentNode_), pc_ - 1, poolStr(rec->a()));
+            jumpToNodeById(rec->a(), rec->b());
+            if (finished_) {
                 result.type = StepType::END;
-                metrics_.endResults++;
-                recordTrace("END", "return_without_call");
-                return result;
+                return true;
             }
+            return false;
 
-            case OpData::CallWithReturn: {
-                auto* cwr = instr->data_as_CallWithReturn();
-                std::string returnVarName = poolStr(cwr->return_var_name_id());
-
-                // 1. 호출자 컨텍스트에서 인자 평가
-                std::vector<Variant> argValues;
-                if (cwr->arg_exprs()) {
-                    for (flatbuffers::uoffset_t ai = 0; ai < cwr->arg_exprs()->size(); ++ai) {
-                        argValues.push_back(evaluateExpression(cwr->arg_exprs()->Get(ai)));
-                    }
+        case CompactOp::Wait:
+            enterWait(rec->a(), result);
+            return true;
+
+        case CompactOp::Yield:
+            result.type = StepType::YIELD;
+            if (traceActive()) recordTrace("YIELD", nodeNameFromPtr(currentNode_), pc_ - 1, "");
+            return true;
+
+        case CompactOp::SetVar: {
+            // 리터럴 대입만 압축된다 (b = 값 비트)
+            Variant value = Variant::Int(rec->b());
+            switch (static_cast<ValueData>(rec->kind())) {
+                case ValueData::BoolValue: value = Variant::Bool(rec->b() != 0); break;
+                case ValueData::FloatValue: {
+                    float f;
+                    const int32_t bits = rec->b();
+                    std::memcpy(&f, &bits, sizeof(f));
+                    value = Variant::Float(f);
+                    break;
                 }
+                default: break;
+            }
+            const char* varName = poolStr(rec->a());
+            variables_[varName] = value;
+            if (traceActive()) recordTrace("SET_VAR", nodeNameFromPtr(currentNode_), pc_ - 1, varName);
+            return false;
+        }
 
-                // 2. call stack에 반환변수 이름 포함하여 push
-                callStack_.push_back({currentNode_, pc_, returnVarName, {}, {}});
-                metrics_.calls++;
-                recordTrace("CALL_RETURN", nodeNameFromPtr(currentNode_), pc_ - 1, poolStr(cwr->target_node_name_id()));
+        default:
+            return false;
+    }
+}
 
-                // 3. 대상 노드로 이동
-                jumpToNodeById(cwr->target_node_name_id());
+void Runner::enterWait(int32_t tagId, StepResult& result) {
+    waitBlocked_ = true;
+    waitTag_.clear();
+    if (tagId >= 0) {
+        waitTag_ = poolStr(tagId);
+    }
 
-                // 4. 매개변수 바인딩
-                if (!finished_) {
-                    bindParameters(currentNode_, argValues, callStack_.back());
-                }
+    result.type = StepType::WAIT;
+    result.wait.tag = waitTag_.empty() ? nullptr : waitTag_.c_str();
+    if (traceActive()) recordTrace("WAIT", nodeNameFromPtr(currentNode_), pc_ - 1, waitTag_);
+}
 
-                node = asNode(currentNode_);
-                if (finished_) {
-                    result.type = StepType::END;
-                    return result;
+// --- Line 결과 채우기 (참조/사전 디코딩 경로 공용) ---
+void Runner::emitLine(const void* linePtr, StepResult& result) {
+    auto* line = static_cast<const Line*>(linePtr);
+    emitLineData(line->character_id(), line->text_id(), line->voice_asset_id(), line->tags(), result,
+                 line->hot_template());
+}
+
+void Runner::emitLineData(int32_t characterId, int32_t textId, int32_t voiceId,
+                          const void* tagsPtr, StepResult& result, bool hotTemplate) {
+    auto* tags = static_cast<const flatbuffers::Vector<flatbuffers::Offset<Tag>>*>(tagsPtr);
+    result.type = StepType::LINE;
+    result.line.seen = markLineSeen(textId);
+    if (skipping_ && result.line.seen) return; // skipSeen: 읽은 대사는 결과를 만들지 않는다
+    result.line.character = (characterId >= 0) ? poolStr(characterId) : nullptr;
+    const char* rawText = poolStr(textId);
+    std::string interp = hotTemplate ? interpolateHotText(textId, rawText) : interpolateText(rawText);
+    if (playProfilingActive() && currentNode_ && std::strchr(rawText, '{')) {
+        auto& entry = playProfile_[nodeNameFromPtr(currentNode_)].interpolations[pc_ - 1];
+        if (entry.first.empty()) {
+            // 컴파일러가 원문으로 대사를 찾으므로 로케일 오버레이가 아닌 원본 pool 문자열을 남긴다
+            auto* pool = asPool(pool_);
+            const char* base = (pool && textId >= 0 && textId < static_cast<int32_t>(pool->size()))
+                ? pool->Get(static_cast<flatbuffers::uoffset_t>(textId))->c_str() : "";
+            entry.first = *base ? base : rawText;
+        }
+        entry.second++;
+    }
+    if (!interp.empty()) {
+        result.ownedStrings_.push_back(std::move(interp));
+        result.line.text = result.ownedStrings_.back().c_str();
+    } else {
+        result.line.text = rawText;
+    }
+    if (voiceId >= 0) {
+        result.line.voiceAsset = poolStr(voiceId);
+    }
+    // tags 채우기
+    if (tags) {
+        for (flatbuffers::uoffset_t t = 0; t < tags->size(); ++t) {
+            auto* tag = tags->Get(t);
+            result.line.tags.emplace_back(
+                poolStr(tag->key_id()),
+                poolStr(tag->value_id())
+            );
+        }
+    }
+    countMetric(&ExecutionMetrics::lineResults);
+    if (traceActive()) recordTrace(
+        "LINE",
+        nodeNameFromPtr(currentNode_),
+        pc_ - 1,
+        result.line.text ? result.line.text : "");
+}
+
+// --- SetVar 실행 (참조/사전 디코딩 경로 공용) ---
+void Runner::executeSetVar(const void* setVarPtr, const std::string& varName) {
+    auto* setvar = static_cast<const SetVar*>(setVarPtr);
+    auto* pool = asPool(pool_);
+    Variant newVal = Variant::Int(0);
+    if (setvar->expr()) {
+        newVal = evaluateExpression(setvar->expr());
+    } else if (setvar->value() && setvar->value_type() != ValueData::NONE) {
+        newVal = readValueData(setvar->value(), setvar->value_type(), pool);
+    }
+
+    switch (setvar->assign_op()) {
+        case AssignOp::Assign:
+            variables_[varName] = newVal;
+            break;
+        case AssignOp::Append: {
+            auto& existing = variables_[varName];
+            if (existing.type == Variant::LIST) {
+                std::string item = (newVal.type == Variant::STRING) ? newVal.s : variantToString(newVal);
+                if (std::find(existing.list.begin(), existing.list.end(), item) == existing.list.end()) {
+                    existing.list.push_back(item);
                 }
-                continue;
+            } else {
+                variables_[varName] = newVal;
+            }
+            break;
+        }
+        case AssignOp::Remove: {
+            auto it = variables_.find(varName);
+            if (it != variables_.end() && it->second.type == Variant::LIST) {
+                std::string item = (newVal.type == Variant::STRING) ? newVal.s : variantToString(newVal);
+                auto& list = it->second.list;
+                list.erase(std::remove(list.begin(), list.end(), item), list.end());
             }
+            break;
+        }
+    }
+    if (traceActive()) recordTrace("SET_VAR", nodeNameFromPtr(currentNode_), pc_ - 1, varName);
+}
 
-            default:
-                continue;
+// --- Condition 판정 (참조/사전 디코딩 경로 공용) ---
+bool Runner::evaluateCondition(const void* condPtr) const {
+    auto* cond = static_cast<const Condition*>(condPtr);
+    auto* pool = asPool(pool_);
+    bool condResult;
+
+    if (cond->cond_expr()) {
+        // 논리 연산자 경로: 전체 불리언 표현식 평가
+        Variant result = evaluateExpression(cond->cond_expr());
+        condResult = variantToBool(result);
+    } else {
+        // 기존 경로: lhs_expr/op/rhs_expr 또는 var_name_id/compare_value
+        Variant lhs = Variant::Int(0);
+        if (cond->lhs_expr()) {
+            lhs = evaluateExpression(cond->lhs_expr());
+        } else {
+            std::string varName = poolStr(cond->var_name_id());
+            auto it = variables_.find(varName);
+            if (it != variables_.end()) {
+                lhs = it->second;
+            }
+        }
+
+        Variant rhs = Variant::Int(0);
+        if (cond->rhs_expr()) {
+            rhs = evaluateExpression(cond->rhs_expr());
+        } else if (cond->compare_value() && cond->compare_value_type() != ValueData::NONE) {
+            rhs = readValueData(cond->compare_value(), cond->compare_value_type(), pool);
         }
+
+        condResult = compareVariants(lhs, cond->op(), rhs);
     }
+    return condResult;
 }
 
 bool Runner::resume() {
@@ -1516,12 +1728,13 @@ bool Runner::resume() {
 
     waitBlocked_ = false;
     waitTag_.clear();
-    recordTrace("RESUME", nodeNameFromPtr(currentNode_), pc_, "");
+    if (traceActive()) recordTrace("RESUME", nodeNameFromPtr(currentNode_), pc_, "");
     return true;
 }
 
 // --- choose ---
 void Runner::choose(int index) {
+    ProfileScope chooseScope(profilingActive() ? &metrics_.profile.choose : nullptr);
     if (waitBlocked_) {
         setError("Cannot choose while waiting; call resume() first");
         return;
@@ -1534,13 +1747,24 @@ void Runner::choose(int index) {
 
     // Once 선택지 추적: 선택된 once 선택지의 키를 기록
     auto& chosen = pendingChoices_[index];
-    metrics_.choicesMade++;
-    recordTrace("CHOOSE", nodeNameFromPtr(currentNode_), pc_, poolStr(chosen.text_id));
+    countMetric(&ExecutionMetrics::choicesMade);
+    if (traceActive()) recordTrace("CHOOSE", nodeNameFromPtr(currentNode_), pc_, poolStr(chosen.text_id));
     if (chosen.choice_modifier == 1 /* Once */ && !chosen.once_key.empty()) {
         chosenOnceChoices_.insert(chosen.once_key);
     }
+    if (playProfilingActive()) {
+        // once_key = "노드:pc" (선택지 명령 위치)
+        const size_t colon = chosen.once_key.rfind(':');
+        if (colon != std::string::npos) {
+            auto& branch = playProfile_[chosen.once_key.substr(0, colon)]
+                .branches[static_cast<uint32_t>(std::strtoul(chosen.once_key.c_str() + colon + 1, nullptr, 10))];
+            branch.kind = "choice";
+            if (branch.taken.empty()) branch.taken.resize(1);
+            branch.taken[0]++;
+        }
+    }
 
-    jumpToNodeById(chosen.target_node_name_id);
+    jumpToNodeById(chosen.target_node_name_id, chosen.target_node_index);
     pendingChoices_.clear();
 }
 
@@ -1599,10 +1823,12 @@ bool Runner::hasVisited(const std::string& nodeName) const {
 
 // --- Character API ---
 std::string Runner::getCharacterProperty(const std::string& characterId, const std::string& key) const {
-    auto overlayIt = localeCharacterProps_.find(characterId);
-    if (overlayIt != localeCharacterProps_.end()) {
-        auto propIt = overlayIt->second.find(key);
-        if (propIt != overlayIt->second.end()) return propIt->second;
+    if (activeLocale_) {
+        auto overlayIt = activeLocale_->characterProps.find(characterId);
+        if (overlayIt != activeLocale_->characterProps.end()) {
+            auto propIt = overlayIt->second.find(key);
+            if (propIt != overlayIt->second.end()) return propIt->second;
+        }
     }
 
     auto it = characterProps_.find(characterId);
@@ -1615,13 +1841,15 @@ std::string Runner::getCharacterProperty(const std::string& characterId, const s
 
 std::vector<std::string> Runner::getCharacterNames() const {
     std::vector<std::string> names;
-    names.reserve(characterProps_.size() + localeCharacterProps_.size());
+    names.reserve(characterProps_.size() + (activeLocale_ ? activeLocale_->characterProps.size() : 0));
     for (const auto& pair : characterProps_) {
         names.push_back(pair.first);
     }
-    for (const auto& pair : localeCharacterProps_) {
-        if (std::find(names.begin(), names.end(), pair.first) == names.end()) {
-            names.push_back(pair.first);
+    if (activeLocale_) {
+        for (const auto& pair : activeLocale_->characterProps) {
+            if (std::find(names.begin(), names.end(), pair.first) == names.end()) {
+                names.push_back(pair.first);
+            }
         }
     }
     return names;
@@ -1673,23 +1901,18 @@ std::string Runner::currentNodeName() const {
 }
 
 const void* Runner::findNodeByName(const char* name) const {
-    auto* story = asStory(story_);
-    if (!story || !story->nodes()) return nullptr;
-    auto* nodes = story->nodes();
-    for (flatbuffers::uoffset_t i = 0; i < nodes->size(); ++i) {
-        auto* node = nodes->Get(i);
-        if (node->name() && std::strcmp(node->name()->c_str(), name) == 0) {
-            return node;
-        }
-    }
-    return nullptr;
+    return NodeNameHash::findNode(asStory(story_), name);
 }
 
 int32_t Runner::findStringInPool(const char* str) const {
     auto* pool = asPool(pool_);
     if (!pool) return -1;
     for (flatbuffers::uoffset_t i = 0; i < pool->size(); ++i) {
-        if (std::strcmp(pool->Get(i)->c_str(), str) == 0) {
+        const char* candidate = pool->Get(i)->c_str();
+        if (compressedPool_ && candidate[0] == '\0') {
+            if (const char* text = compressedPoolStr(static_cast<int32_t>(i))) candidate = text;
+        }
+        if (std::strcmp(candidate, str) == 0) {
             return static_cast<int32_t>(i);
         }
     }
@@ -1843,7 +2066,12 @@ std::vector<uint8_t> Runner::serializeStateBuffer() const {
     }
     ext.currentLocale = currentLocale_;
     ext.resolvedLocale = resolvedLocale_;
-    ext.localePool = localePool_;
+    if (activeLocale_) {
+        ext.localePool.resize(activeLocale_->lines.size());
+        for (size_t i = 0; i < activeLocale_->lines.size(); ++i) {
+            if (activeLocale_->lines[i]) ext.localePool[i] = activeLocale_->lines[i];
+        }
+    }
 
     return attachExtensionToState(baseState, ext);
 }
@@ -1882,7 +2110,9 @@ bool Runner::deserializeStateBuffer(const uint8_t* data, size_t size) {
     hitBreakpoint_ = false;
 
     if (saveState->current_node_name()) {
-        currentNode_ = findNodeByName(saveState->current_node_name()->c_str());
+        std::shared_ptr<const StoryChunk> chunk = activeChunk_;
+        currentNode_ = findChunkNode(saveState->current_node_name()->c_str(), chunk);
+        if (currentNode_ && chunk != activeChunk_) switchChunk(chunk);
         if (!currentNode_ && !finished_) {
             setError(std::string("Save state node not found: ") + saveState->current_node_name()->c_str());
             finished_ = true;
@@ -1925,12 +2155,13 @@ bool Runner::deserializeStateBuffer(const uint8_t* data, size_t size) {
         for (flatbuffers::uoffset_t i = 0; i < stack->size(); ++i) {
             auto* frame = stack->Get(i);
             if (!frame->node_name()) continue;
-            const void* nodePtr = findNodeByName(frame->node_name()->c_str());
+            std::shared_ptr<const StoryChunk> frameChunk = activeChunk_;
+            const void* nodePtr = findChunkNode(frame->node_name()->c_str(), frameChunk);
             if (!nodePtr) continue;
 
             std::string retVar = frame->return_var_name()
                 ? frame->return_var_name()->c_str() : "";
-            CallFrame cf = {nodePtr, frame->pc(), retVar, {}, {}};
+            CallFrame cf = {nodePtr, frame->pc(), retVar, {}, {}, frameChunk};
 
             if (frame->shadowed_vars()) {
                 for (flatbuffers::uoffset_t j = 0; j < frame->shadowed_vars()->size(); ++j) {
@@ -2023,10 +2254,14 @@ bool Runner::deserializeStateBuffer(const uint8_t* data, size_t size) {
 
     currentLocale_ = ext.currentLocale;
     resolvedLocale_ = ext.resolvedLocale;
-    localePool_ = ext.localePool;
-    localeCharacterProps_.clear();
-    if (hasLocaleCatalog_ && !currentLocale_.empty()) {
+    activeLocale_.reset();
+    if (localeCatalog_ && !currentLocale_.empty()) {
         applyLocaleSelection(currentLocale_, false);
+    } else if (!ext.localePool.empty()) {
+        auto* pool = asPool(pool_);
+        std::vector<std::string> strings = std::move(ext.localePool);
+        strings.resize(pool ? pool->size() : 0);
+        activeLocale_ = makeOwnedLocaleTable(std::move(strings), LocaleCharacterProps{}, resolvedLocale_);
     }
 
     return true;
@@ -2050,8 +2285,8 @@ bool Runner::saveState(const std::string& filepath) const {
         return false;
     }
 
-    metrics_.saveOperations++;
-    recordTrace("SAVE", currentNodeName(), pc_, filepath);
+    countMetric(&ExecutionMetrics::saveOperations);
+    if (traceActive()) recordTrace("SAVE", currentNodeName(), pc_, filepath);
     return true;
 }
 
@@ -2075,22 +2310,24 @@ bool Runner::loadState(const std::string& filepath) {
         return false;
     }
 
-    metrics_.loadOperations++;
-    recordTrace("LOAD", currentNodeName(), pc_, filepath);
+    countMetric(&ExecutionMetrics::loadOperations);
+    if (traceActive()) recordTrace("LOAD", currentNodeName(), pc_, filepath);
     return true;
 }
 
 Runner::Snapshot Runner::snapshot() const {
+    ProfileScope snapshotScope(profilingActive() ? &metrics_.profile.snapshot : nullptr);
     Snapshot snapshot;
     snapshot.bytes = serializeStateBuffer();
     if (!snapshot.bytes.empty()) {
-        metrics_.snapshotsCreated++;
-        recordTrace("SNAPSHOT", currentNodeName(), pc_, "create");
+        countMetric(&ExecutionMetrics::snapshotsCreated);
+        if (traceActive()) recordTrace("SNAPSHOT", currentNodeName(), pc_, "create");
     }
     return snapshot;
 }
 
 bool Runner::restore(const Snapshot& snapshot) {
+    ProfileScope restoreScope(profilingActive() ? &metrics_.profile.restore : nullptr);
     if (snapshot.bytes.empty()) {
         setError("Snapshot is empty");
         return false;
@@ -2099,8 +2336,8 @@ bool Runner::restore(const Snapshot& snapshot) {
         return false;
     }
 
-    metrics_.snapshotsRestored++;
-    recordTrace("RESTORE", currentNodeName(), pc_, "snapshot");
+    countMetric(&ExecutionMetrics::snapshotsRestored);
+    if (traceActive()) recordTrace("RESTORE", currentNodeName(), pc_, "snapshot");
     return true;
 }
 
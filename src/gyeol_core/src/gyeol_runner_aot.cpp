@@ -0,0 +1,163 @@
+#include "gyeol_aot.h"
+#include "gyeol_generated.h"
+#include "gyeol_instr_stream.h"
+#include "gyeol_variant_ops.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol {
+
+namespace {
+static const Story* asStory(const void* p) { return static_cast<const Story*>(p); }
+static const Node* asNode(const void* p) { return static_cast<const Node*>(p); }
+} // namespace
+
+void Runner::setAotProgram(const AotProgram* program) {
+    aotProgram_ = program;
+    if (!program) {
+        aotActive_ = false;
+        aotNodes_.clear();
+        aotNodeIndex_.clear();
+    }
+}
+
+bool Runner::isAotActive() const {
+    return aotActive_;
+}
+
+// start()한 버퍼가 프로그램을 만든 .gyb와 같으면 노드 인덱스 표를 만들고 켠다
+void Runner::bindAotProgram(const uint8_t* buffer, size_t size) {
+    aotActive_ = false;
+    aotNodes_.clear();
+    aotNodeIndex_.clear();
+    const AotProgram* program = aotProgram_;
+    auto* story = asStory(story_);
+    if (!program || !story || !story->nodes() || program->storySize != size ||
+        program->nodeCount != story->nodes()->size() || aotStoryHash(buffer, size) != program->storyHash) {
+        return;
+    }
+    aotNodes_.reserve(program->nodeCount);
+    for (uint32_t i = 0; i < program->nodeCount; ++i) {
+        auto* node = story->nodes()->Get(i);
+        aotNodes_.push_back(node);
+        aotNodeIndex_.emplace(node, i);
+    }
+    aotActive_ = true;
+}
+
+// AOT 경로. 현재 노드가 프로그램에 없으면 false (참조 경로가 이어서 실행).
+bool Runner::stepAot(StepResult& result) {
+    AotContext ctx(*this);
+    while (true) {
+        if (waitBlocked_) {
+            result.type = StepType::WAIT;
+            result.wait.tag = waitTag_.empty() ? nullptr : waitTag_.c_str();
+            setError("Cannot step while waiting; call resume() first");
+            return true;
+        }
+        if (!aotActive_) return false;
+        auto it = aotNodeIndex_.find(currentNode_);
+        if (it == aotNodeIndex_.end()) return false;
+
+        if (pc_ >= InstrStream::count(asNode(currentNode_))) {
+            if (!returnFromNodeEnd()) {
+                finished_ = true;
+                result.type = StepType::END;
+                countMetric(&ExecutionMetrics::endResults);
+                return true;
+            }
+            continue;
+        }
+        if (aotProgram_->nodes[it->second](ctx, result)) return true;
+    }
+}
+
+// --- AotContext ---
+
+uint32_t AotContext::pc() const {
+    return runner_.pc_;
+}
+
+bool AotContext::begin(uint32_t nextPc, StepResult& result) {
+    if (!runner_.takeInstructionBudget(result, runner_.currentNode_, nextPc - 1)) return false;
+    runner_.pc_ = nextPc;
+    runner_.countMetric(&Runner::ExecutionMetrics::instructionsExecuted);
+    return true;
+}
+
+bool AotContext::at(uint32_t node, uint32_t nextPc) const {
+    return runner_.pc_ == nextPc && runner_.aotActive_ && node < runner_.aotNodes_.size() &&
+           runner_.currentNode_ == runner_.aotNodes_[node];
+}
+
+bool AotContext::execute(StepResult& result) {
+    auto* node = asNode(runner_.currentNode_);
+    const uint32_t pc = runner_.pc_ - 1;
+    if (auto* rec = InstrStream::compactAt(node, pc)) return runner_.executeCompact(rec, result);
+    auto* instr = InstrStream::tableAt(node, pc);
+    return instr && runner_.executeInstruction(instr, result);
+}
+
+void AotContext::jump(uint32_t node) {
+    runner_.enterNode(runner_.aotNodes_[node]);
+}
+
+void AotContext::countJump() {
+    runner_.countMetric(&Runner::ExecutionMetrics::jumps);
+}
+
+void AotContext::countCondition() {
+    runner_.countMetric(&Runner::ExecutionMetrics::conditionsEvaluated);
+}
+
+const Variant& AotContext::get(const std::string& name) const {
+    static const Variant kZero = Variant::Int(0);
+    auto it = runner_.variables_.find(name);
+    return it != runner_.variables_.end() ? it->second : kZero;
+}
+
+void AotContext::assign(const std::string& name, Variant value) {
+    runner_.variables_[name] = std::move(value);
+}
+
+int32_t AotContext::visitCount(const std::string& node) const {
+    auto it = runner_.visitCounts_.find(node);
+    return it != runner_.visitCounts_.end() ? static_cast<int32_t>(it->second) : 0;
+}
+
+int32_t AotContext::listLength(const std::string& name) const {
+    auto it = runner_.variables_.find(name);
+    return it != runner_.variables_.end() && it->second.type == Variant::LIST
+        ? static_cast<int32_t>(it->second.list.size()) : 0;
+}
+
+// --- 식 연산 ---
+
+namespace Aot {
+Variant add(const Variant& a, const Variant& b) { return applyBinaryOp(a, ExprOp::Add, b); }
+Variant sub(const Variant& a, const Variant& b) { return applyBinaryOp(a, ExprOp::Sub, b); }
+Variant mul(const Variant& a, const Variant& b) { return applyBinaryOp(a, ExprOp::Mul, b); }
+Variant div(const Variant& a, const Variant& b) { return applyBinaryOp(a, ExprOp::Div, b); }
+Variant mod(const Variant& a, const Variant& b) { return applyBinaryOp(a, ExprOp::Mod, b); }
+
+Variant neg(const Variant& v) { return applyNegate(v); }
+
+bool eq(const Variant& a, const Variant& b) { return compareVariants(a, Operator::Equal, b); }
+bool ne(const Variant& a, const Variant& b) { return compareVariants(a, Operator::NotEqual, b); }
+bool gt(const Variant& a, const Variant& b) { return compareVariants(a, Operator::Greater, b); }
+bool lt(const Variant& a, const Variant& b) { return compareVariants(a, Operator::Less, b); }
+bool ge(const Variant& a, const Variant& b) { return compareVariants(a, Operator::GreaterOrEqual, b); }
+bool le(const Variant& a, const Variant& b) { return compareVariants(a, Operator::LessOrEqual, b); }
+bool truthy(const Variant& v) { return variantToBool(v); }
+
+bool contains(const Variant& list, const Variant& item) {
+    if (list.type != Variant::LIST) return false;
+    const std::string needle = (item.type == Variant::STRING) ? item.s : variantText(item);
+    return std::find(list.list.begin(), list.list.end(), needle) != list.list.end();
+}
+} // namespace Aot
+
+} // namespace Gyeol
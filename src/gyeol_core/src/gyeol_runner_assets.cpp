@@ -0,0 +1,188 @@
+#include "gyeol_runner.h"
+#include "gyeol_generated.h"
+#include "gyeol_instr_stream.h"
+
+#include <deque>
+#include <set>
+#include <tuple>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol {
+
+namespace {
+static const Story* asStory(const void* p) { return static_cast<const Story*>(p); }
+static const Node* asNode(const void* p) { return static_cast<const Node*>(p); }
+
+// 탐색 상태: frameLevel >= 0이면 실제 call stack의 해당 깊이에서 실행 중이므로
+// 노드 끝에서 callStack_[frameLevel - 1]로 복귀한다. -1은 탐색 중 만난 call 안쪽.
+struct WalkState {
+    const Node* node;
+    uint32_t pc;
+    int frameLevel;
+    uint32_t distance;
+};
+} // namespace
+
+std::vector<Runner::UpcomingAsset> Runner::predictUpcomingAssets(uint32_t depth) const {
+    std::vector<UpcomingAsset> assets;
+    auto* story = asStory(story_);
+    if (!story || finished_ || depth == 0) return assets;
+
+    std::deque<WalkState> queue;
+    std::set<std::tuple<const Node*, uint32_t, int>> visited;
+    std::set<std::tuple<int, std::string, std::string>> seen;
+
+    auto push = [&](const Node* node, uint32_t pc, int frameLevel, uint32_t distance) {
+        if (!node) return;
+        if (!visited.emplace(node, pc, frameLevel).second) return;
+        queue.push_back({node, pc, frameLevel, distance});
+    };
+    auto pushNode = [&](int32_t nameId, int frameLevel, uint32_t distance) {
+        if (nameId < 0) return;
+        push(asNode(findNodeByName(poolStr(nameId))), 0, frameLevel, distance);
+    };
+    auto addAsset = [&](UpcomingAsset::Kind kind, const char* commandType, const char* value, uint32_t distance) {
+        if (!value || !*value) return;
+        UpcomingAsset asset;
+        asset.kind = kind;
+        asset.commandType = commandType ? commandType : "";
+        asset.value = value;
+        asset.distance = distance;
+        // BFS 순서라 처음 만난 경로가 가장 가깝다
+        auto key = std::make_tuple(static_cast<int>(kind), asset.commandType, asset.value);
+        if (seen.insert(key).second) assets.push_back(std::move(asset));
+    };
+
+    const int baseLevel = static_cast<int>(callStack_.size());
+    if (!pendingChoices_.empty()) {
+        // 선택지 대기 중: 다음 실행은 선택된 대상 노드에서 시작
+        for (const auto& choice : pendingChoices_) {
+            pushNode(choice.target_node_name_id, baseLevel, 0);
+        }
+    } else {
+        push(asNode(currentNode_), pc_, baseLevel, 0);
+    }
+
+    uint32_t examined = 0;
+    while (!queue.empty() && examined < depth) {
+        WalkState state = queue.front();
+        queue.pop_front();
+
+        // 노드 끝 또는 return: 실제 call stack 위라면 호출자로 복귀
+        auto returnToCaller = [&]() {
+            if (state.frameLevel <= 0) return;
+            const auto& frame = callStack_[static_cast<size_t>(state.frameLevel - 1)];
+            push(asNode(frame.node), frame.pc, state.frameLevel - 1, state.distance);
+        };
+
+        const uint32_t count = InstrStream::count(state.node);
+        if (state.pc >= count) {
+            returnToCaller();
+            continue;
+        }
+
+        const uint32_t next = state.distance + 1;
+        examined++;
+        bool fallsThrough = true;
+
+        if (auto* rec = InstrStream::compactAt(state.node, state.pc)) {
+            if (rec->op() == CompactOp::Line && rec->c() >= 0) {
+                addAsset(UpcomingAsset::Kind::VOICE, nullptr, poolStr(rec->c()), state.distance);
+            } else if (rec->op() == CompactOp::Jump) {
+                pushNode(rec->a(), state.frameLevel, next);
+                fallsThrough = false;
+            }
+            if (fallsThrough) push(state.node, state.pc + 1, state.frameLevel, next);
+            continue;
+        }
+        auto* instr = InstrStream::tableAt(state.node, state.pc);
+        if (!instr) {
+            push(state.node, state.pc + 1, state.frameLevel, next);
+            continue;
+        }
+
+        switch (instr->data_type()) {
+            case OpData::Line: {
+                auto* line = instr->data_as_Line();
+                if (line->voice_asset_id() >= 0) {
+                    addAsset(UpcomingAsset::Kind::VOICE, nullptr, poolStr(line->voice_asset_id()), state.distance);
+                }
+                break;
+            }
+            case OpData::Command: {
+                auto* cmd = instr->data_as_Command();
+                const char* type = poolStr(cmd->type_id());
+                if (cmd->args()) {
+                    for (flatbuffers::uoffset_t i = 0; i < cmd->args()->size(); ++i) {
+                        auto* arg = cmd->args()->Get(i);
+                        if (arg->kind() == CommandArgKind::String || arg->kind() == CommandArgKind::Identifier) {
+                            addAsset(UpcomingAsset::Kind::COMMAND, type, poolStr(arg->string_id()), state.distance);
+                        }
+                    }
+                }
+                break;
+            }
+            case OpData::Choice: {
+                // 연속된 Choice 묶음의 모든 대상 (조건/수식어와 무관하게)
+                uint32_t pc = state.pc;
+                while (pc < count) {
+                    auto* choiceInstr = InstrStream::tableAt(state.node, pc);
+                    if (!choiceInstr || choiceInstr->data_type() != OpData::Choice) break;
+                    pushNode(choiceInstr->data_as_Choice()->target_node_name_id(), state.frameLevel, next);
+                    pc++;
+                }
+                fallsThrough = false;
+                break;
+            }
+            case OpData::Jump: {
+                auto* jump = instr->data_as_Jump();
+                if (jump->is_call()) {
+                    pushNode(jump->target_node_name_id(), -1, next);
+                } else {
+                    pushNode(jump->target_node_name_id(), state.frameLevel, next);
+                    fallsThrough = false;
+                }
+                break;
+            }
+            case OpData::CallWithReturn:
+                pushNode(instr->data_as_CallWithReturn()->target_node_name_id(), -1, next);
+                break;
+            case OpData::Condition: {
+                auto* cond = instr->data_as_Condition();
+                const bool hasTrue = cond->true_jump_node_id() >= 0;
+                const bool hasFalse = cond->false_jump_node_id() >= 0;
+                pushNode(cond->true_jump_node_id(), state.frameLevel, next);
+                pushNode(cond->false_jump_node_id(), state.frameLevel, next);
+                fallsThrough = !hasTrue || !hasFalse;
+                break;
+            }
+            case OpData::Random: {
+                auto* random = instr->data_as_Random();
+                bool anyWeighted = false;
+                if (random->branches()) {
+                    for (flatbuffers::uoffset_t i = 0; i < random->branches()->size(); ++i) {
+                        auto* branch = random->branches()->Get(i);
+                        if (branch->weight() <= 0) continue;
+                        anyWeighted = true;
+                        pushNode(branch->target_node_name_id(), state.frameLevel, next);
+                    }
+                }
+                fallsThrough = !anyWeighted; // 모든 weight 0 → 다음 줄
+                break;
+            }
+            case OpData::Return:
+                returnToCaller();
+                fallsThrough = false;
+                break;
+            default:
+                break;
+        }
+
+        if (fallsThrough) push(state.node, state.pc + 1, state.frameLevel, next);
+    }
+
+    return assets;
+}
+
+} // namespace Gyeol
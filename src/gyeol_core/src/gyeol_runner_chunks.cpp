@@ -0,0 +1,109 @@
+#include "gyeol_runner.h"
+#include "gyeol_generated.h"
+#include "gyeol_node_names.h"
+
+#include <cstring>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol {
+
+namespace {
+static const Story* asStory(const void* p) { return static_cast<const Story*>(p); }
+
+const Node* findNodeInStory(const Story* story, const char* name) {
+    return NodeNameHash::findNode(story, name);
+}
+} // namespace
+
+bool Runner::startChunked(std::shared_ptr<StoryChunkSet> chunks) {
+    if (!chunks) {
+        setError("No story chunks");
+        return false;
+    }
+    const int32_t rootIndex = chunks->findChunkForNode(chunks->getStartNodeName());
+    std::string error;
+    auto root = chunks->acquire(rootIndex >= 0 ? static_cast<uint32_t>(rootIndex) : 0, &error);
+    if (!root) {
+        setError(error);
+        return false;
+    }
+    if (!start(root->data(), root->size())) return false;
+    chunks_ = std::move(chunks);
+    activeChunk_ = std::move(root);
+    return true;
+}
+
+int32_t Runner::getActiveChunk() const {
+    return activeChunk_ ? static_cast<int32_t>(activeChunk_->index) : -1;
+}
+
+// 현재 청크에 없는 노드로 이동: 해당 청크를 읽어 전환한 뒤 노드로 들어간다
+bool Runner::enterChunkForNode(const char* name) {
+    std::shared_ptr<const StoryChunk> chunk;
+    auto* node = static_cast<const Node*>(findChunkNode(name, chunk));
+    if (!node || chunk == activeChunk_) return false;
+
+    switchChunk(chunk);
+    enterNode(node);
+    return true;
+}
+
+void Runner::switchChunk(const std::shared_ptr<const StoryChunk>& chunk) {
+    activeChunk_ = chunk;
+    story_ = GetStory(chunk->data());
+    bindStringPool();
+    storyProfile_ = {}; // 노드 포인터 기준이므로 다른 버퍼면 무효
+
+    // 로케일 테이블은 청크별 string_pool 기준이라 이어서 쓸 수 없다
+    activeLocale_.reset();
+    localeCatalog_.reset();
+    currentLocale_.clear();
+    resolvedLocale_.clear();
+
+    cacheNodeTags();
+    if (predecodeEnabled_) buildDecodedProgram();
+    aotActive_ = false; // AOT 프로그램은 start()한 버퍼에만 맞는다
+    if (traceActive()) recordTrace("CHUNK", chunk->name);
+}
+
+// 현재 청크에서 먼저 찾고, 없으면 청크 인덱스로 해당 청크를 읽어 찾는다 (전환하지는 않음)
+const void* Runner::findChunkNode(const char* name, std::shared_ptr<const StoryChunk>& outChunk) {
+    if (const void* node = findNodeByName(name)) {
+        outChunk = activeChunk_;
+        return node;
+    }
+    if (!chunks_) return nullptr;
+
+    const int32_t index = chunks_->findChunkForNode(name);
+    if (index < 0) return nullptr;
+    std::string error;
+    auto chunk = chunks_->acquire(static_cast<uint32_t>(index), &error);
+    if (!chunk) {
+        setError(error);
+        return nullptr;
+    }
+    const Node* node = findNodeInStory(GetStory(chunk->data()), name);
+    if (node) outChunk = std::move(chunk);
+    return node;
+}
+
+// 노드 메타데이터 태그를 캐시에 더한다 (청크 모드에서는 지나온 청크의 태그가 누적됨)
+void Runner::cacheNodeTags() {
+    auto* story = asStory(story_);
+    if (!story || !story->nodes()) return;
+    for (flatbuffers::uoffset_t ni = 0; ni < story->nodes()->size(); ++ni) {
+        auto* node = story->nodes()->Get(ni);
+        if (node->tags() && node->tags()->size() > 0) {
+            std::string nodeName = node->name() ? node->name()->c_str() : "";
+            std::vector<std::pair<std::string, std::string>> tags;
+            for (flatbuffers::uoffset_t ti = 0; ti < node->tags()->size(); ++ti) {
+                auto* tag = node->tags()->Get(ti);
+                tags.emplace_back(poolStr(tag->key_id()), poolStr(tag->value_id()));
+            }
+            nodeTags_[nodeName] = std::move(tags);
+        }
+    }
+}
+
+} // namespace Gyeol
@@ -1,6 +1,11 @@
 #include "gyeol_runner.h"
 #include "gyeol_generated.h"
+#include "gyeol_instr_stream.h"
+#include <algorithm>
+#include <cstdio>
 #include <set>
+#include <sstream>
+#include <utility>
 
 using namespace ICPDev::Gyeol::Schema;
 
@@ -9,6 +14,79 @@ namespace Gyeol {
 namespace {
 static const Story* asStory(const void* p) { return static_cast<const Story*>(p); }
 static const Node* asNode(const void* p) { return static_cast<const Node*>(p); }
+
+// JSON 문자열 리터럴 (따옴표 포함). UTF-8은 그대로 두고 제어 문자만 \u 이스케이프
+std::string jsonString(const std::string& text) {
+    std::string out = "\"";
+    for (unsigned char c : text) {
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out += buf;
+                } else {
+                    out += static_cast<char>(c);
+                }
+        }
+    }
+    out += '"';
+    return out;
+}
+
+std::vector<std::pair<const char*, uint64_t>> metricCounters(const Runner::ExecutionMetrics& m) {
+    return {
+        {"step_calls", m.stepCalls},
+        {"instructions_executed", m.instructionsExecuted},
+        {"line_results", m.lineResults},
+        {"choice_results", m.choiceResults},
+        {"command_results", m.commandResults},
+        {"end_results", m.endResults},
+        {"jumps", m.jumps},
+        {"calls", m.calls},
+        {"returns", m.returns},
+        {"conditions_evaluated", m.conditionsEvaluated},
+        {"random_rolls", m.randomRolls},
+        {"choices_made", m.choicesMade},
+        {"snapshots_created", m.snapshotsCreated},
+        {"snapshots_restored", m.snapshotsRestored},
+        {"save_operations", m.saveOperations},
+        {"load_operations", m.loadOperations},
+        {"errors", m.errors},
+        {"trace_events", m.traceEvents},
+    };
+}
+
+std::vector<std::pair<const char*, const Runner::LatencyHistogram*>> latencyHistograms(
+    const Runner::ExecutionProfile& profile) {
+    return {
+        {"step", &profile.step},
+        {"choose", &profile.choose},
+        {"snapshot", &profile.snapshot},
+        {"restore", &profile.restore},
+    };
+}
+
+const char* opcodeName(size_t slot) {
+    if (slot > static_cast<size_t>(OpData::MAX)) return "Unknown";
+    return EnumNameOpData(static_cast<OpData>(slot));
+}
+}
+
+void Runner::LatencyHistogram::record(uint64_t ns) {
+    size_t bucket = 0;
+    for (uint64_t v = ns; v > 1 && bucket + 1 < kBucketCount; v >>= 1) {
+        ++bucket;
+    }
+    buckets[bucket]++;
+    count++;
+    totalNs += ns;
+    if (ns > maxNs) maxNs = ns;
 }
 
 void Runner::addBreakpoint(const std::string& nodeName, uint32_t pc) {
@@ -37,7 +115,7 @@ std::vector<std::pair<std::string, uint32_t>> Runner::getBreakpoints() const {
 }
 
 void Runner::setStepMode(bool enabled) {
-    stepMode_ = enabled;
+    stepMode_ = RunnerFeatures::debug && enabled;
 }
 
 bool Runner::isStepMode() const {
@@ -52,9 +130,8 @@ Runner::DebugLocation Runner::getLocation() const {
     loc.pc = pc_;
 
     auto* node = asNode(currentNode_);
-    if (node && node->lines() && pc_ < node->lines()->size()) {
-        auto* instr = node->lines()->Get(pc_);
-        switch (instr->data_type()) {
+    if (pc_ < InstrStream::count(node)) {
+        switch (InstrStream::opAt(node, pc_)) {
             case OpData::Line:            loc.instructionType = "Line"; break;
             case OpData::Choice:          loc.instructionType = "Choice"; break;
             case OpData::Jump:            loc.instructionType = "Jump"; break;
@@ -111,8 +188,248 @@ void Runner::resetMetrics() {
     metrics_ = {};
 }
 
+void Runner::setProfilingEnabled(bool enabled) {
+    profilingEnabled_ = RunnerFeatures::metrics && enabled;
+}
+
+bool Runner::isProfilingEnabled() const {
+    return profilingEnabled_;
+}
+
+std::string Runner::exportMetricsJson() const {
+    std::ostringstream out;
+    out << "{\"counters\":{";
+    bool first = true;
+    for (const auto& counter : metricCounters(metrics_)) {
+        out << (first ? "" : ",") << '"' << counter.first << "\":" << counter.second;
+        first = false;
+    }
+    out << "},\"profiling\":" << (profilingEnabled_ ? "true" : "false");
+
+    out << ",\"opcodes\":{";
+    first = true;
+    for (size_t slot = 0; slot < metrics_.profile.opcodes.size(); ++slot) {
+        const auto& cost = metrics_.profile.opcodes[slot];
+        if (cost.count == 0) continue;
+        out << (first ? "" : ",") << '"' << opcodeName(slot) << "\":{\"count\":" << cost.count
+            << ",\"total_ns\":" << cost.totalNs << "}";
+        first = false;
+    }
+
+    out << "},\"latency\":{";
+    first = true;
+    for (const auto& entry : latencyHistograms(metrics_.profile)) {
+        const LatencyHistogram& h = *entry.second;
+        out << (first ? "" : ",") << '"' << entry.first << "\":{\"count\":" << h.count
+            << ",\"total_ns\":" << h.totalNs << ",\"max_ns\":" << h.maxNs << ",\"buckets\":[";
+        for (size_t i = 0; i < h.buckets.size(); ++i) {
+            out << (i ? "," : "") << h.buckets[i];
+        }
+        out << "]}";
+        first = false;
+    }
+    out << "}}";
+    return out.str();
+}
+
+void Runner::setStoryProfilingEnabled(bool enabled) {
+    storyProfilingEnabled_ = RunnerFeatures::metrics && enabled;
+}
+
+bool Runner::isStoryProfilingEnabled() const {
+    return storyProfilingEnabled_;
+}
+
+void Runner::resetStoryProfile() {
+    storyProfile_ = {};
+}
+
+Runner::StoryProfileReport Runner::getStoryProfile() const {
+    StoryProfileReport report;
+
+    // 현재 스토리의 노드만 이름으로 변환 (다른 버퍼의 포인터는 역참조하지 않음)
+    std::unordered_map<const void*, std::string> names;
+    auto* story = asStory(story_);
+    if (story && story->nodes()) {
+        for (flatbuffers::uoffset_t i = 0; i < story->nodes()->size(); ++i) {
+            auto* node = story->nodes()->Get(i);
+            names[node] = node->name() ? node->name()->c_str() : "";
+        }
+    }
+    auto nameOf = [&names](const void* node) -> std::string {
+        auto it = names.find(node);
+        return it != names.end() ? it->second : "<unknown>";
+    };
+
+    for (const auto& entry : storyProfile_.nodes) {
+        StoryProfileReport::NodeEntry node;
+        node.nodeName = nameOf(entry.first);
+        node.instructions = entry.second.instructions;
+        node.wallNs = entry.second.wallNs;
+        node.visits = entry.second.visits;
+        node.calls = entry.second.calls;
+        report.nodes.push_back(std::move(node));
+    }
+    std::sort(report.nodes.begin(), report.nodes.end(),
+              [](const StoryProfileReport::NodeEntry& a, const StoryProfileReport::NodeEntry& b) {
+                  if (a.wallNs != b.wallNs) return a.wallNs > b.wallNs;
+                  return a.nodeName < b.nodeName;
+              });
+
+    for (const auto& entry : storyProfile_.instructions) {
+        StoryProfileReport::InstructionEntry instr;
+        instr.nodeName = nameOf(entry.first.first);
+        instr.pc = entry.first.second;
+        auto nameIt = names.find(entry.first.first);
+        if (nameIt != names.end()) {
+            auto* node = asNode(entry.first.first);
+            if (instr.pc < InstrStream::count(node)) {
+                instr.instructionType = EnumNameOpData(InstrStream::opAt(node, instr.pc));
+            }
+        }
+        instr.count = entry.second.instructions;
+        instr.wallNs = entry.second.wallNs;
+        report.instructions.push_back(std::move(instr));
+    }
+    std::sort(report.instructions.begin(), report.instructions.end(),
+              [](const StoryProfileReport::InstructionEntry& a, const StoryProfileReport::InstructionEntry& b) {
+                  if (a.wallNs != b.wallNs) return a.wallNs > b.wallNs;
+                  if (a.nodeName != b.nodeName) return a.nodeName < b.nodeName;
+                  return a.pc < b.pc;
+              });
+
+    for (const auto& entry : storyProfile_.stacks) {
+        StoryProfileReport::StackEntry stack;
+        for (const void* frame : entry.first) {
+            stack.frames.push_back(nameOf(frame));
+        }
+        stack.instructions = entry.second.instructions;
+        stack.wallNs = entry.second.wallNs;
+        report.stacks.push_back(std::move(stack));
+    }
+    std::sort(report.stacks.begin(), report.stacks.end(),
+              [](const StoryProfileReport::StackEntry& a, const StoryProfileReport::StackEntry& b) {
+                  return a.frames < b.frames;
+              });
+    return report;
+}
+
+std::string Runner::exportStoryProfileCollapsed(bool weightByInstructions) const {
+    std::ostringstream out;
+    for (const auto& stack : getStoryProfile().stacks) {
+        for (size_t i = 0; i < stack.frames.size(); ++i) {
+            out << (i ? ";" : "") << stack.frames[i];
+        }
+        out << " " << (weightByInstructions ? stack.instructions : stack.wallNs) << "\n";
+    }
+    return out.str();
+}
+
+void Runner::setPlayProfilingEnabled(bool enabled) {
+    playProfilingEnabled_ = RunnerFeatures::metrics && enabled;
+}
+
+bool Runner::isPlayProfilingEnabled() const {
+    return playProfilingEnabled_;
+}
+
+void Runner::resetPlayProfile() {
+    playProfile_.clear();
+}
+
+void Runner::recordPlayBranch(const char* kind, size_t outcome, size_t outcomeCount) {
+    if (!currentNode_ || outcome >= outcomeCount) return;
+    auto& branch = playProfile_[nodeNameFromPtr(currentNode_)].branches[pc_ - 1];
+    branch.kind = kind;
+    if (branch.taken.size() < outcomeCount) branch.taken.resize(outcomeCount);
+    branch.taken[outcome]++;
+}
+
+void Runner::recordPlayCall(int32_t targetNameId) {
+    if (!currentNode_) return;
+    playProfile_[nodeNameFromPtr(currentNode_)].calls[poolStr(targetNameId)]++;
+}
+
+std::string Runner::exportPlayProfileJson() const {
+    std::ostringstream out;
+    out << "{\"format\":\"gyeol-play-profile\",\"version\":1,\"nodes\":[";
+    bool firstNode = true;
+    for (const auto& [name, counters] : playProfile_) {
+        out << (firstNode ? "" : ",") << "{\"node\":" << jsonString(name) << ",\"visits\":" << counters.visits;
+        firstNode = false;
+        if (!counters.branches.empty()) {
+            out << ",\"branches\":[";
+            bool first = true;
+            for (const auto& [pc, branch] : counters.branches) {
+                out << (first ? "" : ",") << "{\"pc\":" << pc << ",\"kind\":\"" << branch.kind << "\",\"taken\":[";
+                for (size_t i = 0; i < branch.taken.size(); ++i) out << (i ? "," : "") << branch.taken[i];
+                out << "]}";
+                first = false;
+            }
+            out << "]";
+        }
+        if (!counters.calls.empty()) {
+            out << ",\"calls\":[";
+            bool first = true;
+            for (const auto& [target, count] : counters.calls) {
+                out << (first ? "" : ",") << "{\"target\":" << jsonString(target) << ",\"count\":" << count << "}";
+                first = false;
+            }
+            out << "]";
+        }
+        if (!counters.interpolations.empty()) {
+            out << ",\"interpolations\":[";
+            bool first = true;
+            for (const auto& [pc, entry] : counters.interpolations) {
+                out << (first ? "" : ",") << "{\"pc\":" << pc << ",\"text\":" << jsonString(entry.first)
+                    << ",\"count\":" << entry.second << "}";
+                first = false;
+            }
+            out << "]";
+        }
+        out << "}";
+    }
+    out << "]}";
+    return out.str();
+}
+
+std::string Runner::exportMetricsPrometheus(const std::string& prefix) const {
+    std::ostringstream out;
+    for (const auto& counter : metricCounters(metrics_)) {
+        const std::string name = prefix + "_" + counter.first + "_total";
+        out << "# TYPE " << name << " counter\n";
+        out << name << " " << counter.second << "\n";
+    }
+
+    const std::string opCount = prefix + "_opcode_instructions_total";
+    const std::string opNs = prefix + "_opcode_nanoseconds_total";
+    out << "# TYPE " << opCount << " counter\n";
+    out << "# TYPE " << opNs << " counter\n";
+    for (size_t slot = 0; slot < metrics_.profile.opcodes.size(); ++slot) {
+        const auto& cost = metrics_.profile.opcodes[slot];
+        if (cost.count == 0) continue;
+        out << opCount << "{op=\"" << opcodeName(slot) << "\"} " << cost.count << "\n";
+        out << opNs << "{op=\"" << opcodeName(slot) << "\"} " << cost.totalNs << "\n";
+    }
+
+    for (const auto& entry : latencyHistograms(metrics_.profile)) {
+        const LatencyHistogram& h = *entry.second;
+        const std::string name = prefix + "_" + entry.first + "_latency_nanoseconds";
+        out << "# TYPE " << name << " histogram\n";
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i + 1 < h.buckets.size(); ++i) {
+            cumulative += h.buckets[i];
+            out << name << "_bucket{le=\"" << (uint64_t{1} << (i + 1)) << "\"} " << cumulative << "\n";
+        }
+        out << name << "_bucket{le=\"+Inf\"} " << h.count << "\n";
+        out << name << "_sum " << h.totalNs << "\n";
+        out << name << "_count " << h.count << "\n";
+    }
+    return out.str();
+}
+
 void Runner::setTraceEnabled(bool enabled, size_t maxEvents) {
-    traceEnabled_ = enabled;
+    traceEnabled_ = RunnerFeatures::trace && enabled;
     traceLimit_ = maxEvents;
     if (!traceEnabled_ || traceLimit_ == 0) {
         trace_.clear();
@@ -152,9 +469,7 @@ std::vector<std::string> Runner::getNodeNames() const {
 uint32_t Runner::getNodeInstructionCount(const std::string& nodeName) const {
     const void* nodePtr = findNodeByName(nodeName.c_str());
     if (!nodePtr) return 0;
-    auto* node = asNode(nodePtr);
-    if (!node->lines()) return 0;
-    return node->lines()->size();
+    return InstrStream::count(asNode(nodePtr));
 }
 
 std::string Runner::getInstructionInfo(const std::string& nodeName, uint32_t pc) const {
@@ -162,9 +477,29 @@ std::string Runner::getInstructionInfo(const std::string& nodeName, uint32_t pc)
     const void* nodePtr = findNodeByName(nodeName.c_str());
     if (!nodePtr) return "";
     auto* node = asNode(nodePtr);
-    if (!node->lines() || pc >= node->lines()->size()) return "";
+    if (pc >= InstrStream::count(node)) return "";
 
-    auto* instr = node->lines()->Get(pc);
+    if (auto* rec = InstrStream::compactAt(node, pc)) {
+        switch (rec->op()) {
+            case CompactOp::Line: {
+                std::string chr = (rec->a() >= 0) ? poolStr(rec->a()) : "(narration)";
+                return "Line: " + chr + " \"" + poolStr(rec->b()) + "\"";
+            }
+            case CompactOp::Jump:
+                return "Jump: -> " + std::string(poolStr(rec->a()));
+            case CompactOp::Wait:
+                if (rec->a() >= 0) return "Wait: \"" + std::string(poolStr(rec->a())) + "\"";
+                return "Wait";
+            case CompactOp::Yield:
+                return "Yield";
+            case CompactOp::SetVar:
+                return "SetVar: $ " + std::string(poolStr(rec->a())) + " = ...";
+            default:
+                return "Unknown";
+        }
+    }
+    auto* instr = InstrStream::tableAt(node, pc);
+    if (!instr) return "Unknown";
     switch (instr->data_type()) {
         case OpData::Line: {
             auto* line = instr->data_as_Line();
@@ -288,7 +623,8 @@ Runner::GraphData Runner::getGraphData() const {
 
         GraphNode gn;
         gn.name = node->name()->c_str();
-        gn.instructionCount = node->lines() ? static_cast<int>(node->lines()->size()) : 0;
+        const uint32_t instrCount = InstrStream::count(node);
+        gn.instructionCount = static_cast<int>(instrCount);
 
         if (node->param_ids()) {
             for (flatbuffers::uoffset_t pi = 0; pi < node->param_ids()->size(); ++pi) {
@@ -304,25 +640,42 @@ Runner::GraphData Runner::getGraphData() const {
         }
 
         std::set<std::string> charSet;
-        if (node->lines()) {
-            for (flatbuffers::uoffset_t li = 0; li < node->lines()->size(); ++li) {
-                auto* instr = node->lines()->Get(li);
+        auto addLine = [&](int32_t characterId, int32_t textId) {
+            gn.summary.lineCount++;
+            if (characterId >= 0) {
+                charSet.insert(poolStr(characterId));
+            }
+            if (gn.summary.firstLine.empty()) {
+                std::string txt = poolStr(textId);
+                if (txt.length() > 40) txt = txt.substr(0, 40) + "...";
+                if (characterId >= 0) {
+                    gn.summary.firstLine = std::string(poolStr(characterId)) + ": \"" + txt + "\"";
+                } else {
+                    gn.summary.firstLine = "\"" + txt + "\"";
+                }
+            }
+        };
+        if (instrCount > 0) {
+            for (uint32_t li = 0; li < instrCount; ++li) {
+                if (auto* rec = InstrStream::compactAt(node, li)) {
+                    if (rec->op() == CompactOp::Line) {
+                        addLine(rec->a(), rec->b());
+                    } else if (rec->op() == CompactOp::Jump) {
+                        gn.summary.hasJump = true;
+                        GraphEdge edge;
+                        edge.from = gn.name;
+                        edge.to = poolStr(rec->a());
+                        edge.type = "jump";
+                        data.edges.push_back(std::move(edge));
+                    }
+                    continue;
+                }
+                auto* instr = InstrStream::tableAt(node, li);
+                if (!instr) continue;
                 switch (instr->data_type()) {
                 case OpData::Line: {
                     auto* line = instr->data_as_Line();
-                    gn.summary.lineCount++;
-                    if (line->character_id() >= 0) {
-                        charSet.insert(poolStr(line->character_id()));
-                    }
-                    if (gn.summary.firstLine.empty()) {
-                        std::string txt = poolStr(line->text_id());
-                        if (txt.length() > 40) txt = txt.substr(0, 40) + "...";
-                        if (line->character_id() >= 0) {
-                            gn.summary.firstLine = std::string(poolStr(line->character_id())) + ": \"" + txt + "\"";
-                        } else {
-                            gn.summary.firstLine = "\"" + txt + "\"";
-                        }
-                    }
+                    addLine(line->character_id(), line->text_id());
                     break;
                 }
                 case OpData::Choice: {
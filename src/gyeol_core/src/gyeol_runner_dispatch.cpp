@@ -0,0 +1,317 @@
+#include "gyeol_runner.h"
+#include "gyeol_generated.h"
+#include "gyeol_instr_stream.h"
+
+#include <cstring>
+#include <unordered_map>
+
+using namespace ICPDev::Gyeol::Schema;
+
+// GCC/Clang은 computed goto(direct threading), 그 외 컴파일러는 switch로 dispatch
+#if defined(__GNUC__) || defined(__clang__)
+#define GYEOL_COMPUTED_GOTO 1
+#else
+#define GYEOL_COMPUTED_GOTO 0
+#endif
+
+namespace Gyeol {
+
+namespace {
+
+static const Story* asStory(const void* p) { return static_cast<const Story*>(p); }
+
+// 사전 디코딩된 명령어 종류. Generic은 FlatBuffers 참조 핸들러(executeInstruction)로 실행한다.
+enum class DecodedOp : uint8_t {
+    Generic = 0,
+    Line,
+    Jump,
+    SetVar,
+    Condition,
+    Yield,
+    Compact,     // 압축 레코드 (executeCompact)
+    CompactLine, // 압축 Line 레코드
+};
+
+constexpr int32_t kNoTarget = -1;
+
+} // namespace
+
+struct Runner::DecodedProgram {
+    // 고정 크기 명령어 레코드 (모든 노드가 하나의 연속 배열에 들어감)
+    struct Instr {
+        DecodedOp op = DecodedOp::Generic;
+        int32_t a = kNoTarget;        // Jump/Condition(true): 노드 인덱스, SetVar: 이름 슬롯
+        int32_t b = kNoTarget;        // Condition(false): 노드 인덱스
+        const void* instr = nullptr;  // 원본 Instruction
+        const void* data = nullptr;   // union 테이블 (Line/SetVar/Condition) 또는 CompactInstr
+    };
+    // 노드 = code 배열의 [first, first + count) 구간
+    struct Node {
+        uint32_t first = 0;
+        uint32_t count = 0;
+        const void* node = nullptr;
+        std::string name;
+    };
+
+    std::vector<Instr> code;
+    std::vector<Node> nodes;
+    std::unordered_map<const void*, uint32_t> nodeIndex;
+    std::vector<std::string> names; // SetVar 변수 이름 슬롯
+
+    const Node* find(const void* node) const {
+        auto it = nodeIndex.find(node);
+        return it != nodeIndex.end() ? &nodes[it->second] : nullptr;
+    }
+};
+
+void Runner::setPredecodedDispatch(bool enabled) {
+    predecodeEnabled_ = enabled;
+    if (!enabled) {
+        decoded_.reset();
+    } else if (story_) {
+        buildDecodedProgram();
+    }
+}
+
+bool Runner::isPredecodedDispatch() const {
+    return predecodeEnabled_;
+}
+
+void Runner::buildDecodedProgram() {
+    decoded_.reset();
+    auto* story = asStory(story_);
+    if (!story || !story->nodes()) return;
+
+    auto program = std::make_shared<DecodedProgram>();
+    auto* nodes = story->nodes();
+    program->nodes.reserve(nodes->size());
+
+    // 이름 → 노드 인덱스 (같은 이름이 여럿이면 jumpToNode처럼 첫 번째)
+    std::unordered_map<std::string, int32_t> nodeByName;
+    for (flatbuffers::uoffset_t i = 0; i < nodes->size(); ++i) {
+        auto* node = nodes->Get(i);
+        std::string name = node->name() ? node->name()->c_str() : "";
+        nodeByName.emplace(name, static_cast<int32_t>(i));
+
+        DecodedProgram::Node decodedNode;
+        decodedNode.node = node;
+        decodedNode.name = std::move(name);
+        program->nodeIndex.emplace(node, static_cast<uint32_t>(i));
+        program->nodes.push_back(std::move(decodedNode));
+    }
+
+    // 링크된 인덱스의 노드 이름이 같으면 그대로 쓰고, 없거나 다르면(이전 형식 버퍼) 이름으로 찾는다
+    auto resolveNode = [&](int32_t nameId, int32_t linkedIndex, int32_t& outIndex) -> bool {
+        if (nameId < 0) {
+            outIndex = kNoTarget;
+            return true;
+        }
+        const char* name = poolStr(nameId);
+        if (linkedIndex >= 0 && static_cast<flatbuffers::uoffset_t>(linkedIndex) < nodes->size()) {
+            auto* linked = nodes->Get(static_cast<flatbuffers::uoffset_t>(linkedIndex));
+            if (linked->name() && std::strcmp(linked->name()->c_str(), name) == 0) {
+                outIndex = linkedIndex;
+                return true;
+            }
+        }
+        auto it = nodeByName.find(name);
+        if (it == nodeByName.end()) return false; // 참조 경로에서 에러 처리
+        outIndex = it->second;
+        return true;
+    };
+
+    std::unordered_map<std::string, int32_t> nameSlots;
+    for (flatbuffers::uoffset_t i = 0; i < nodes->size(); ++i) {
+        auto* node = nodes->Get(i);
+        auto& decodedNode = program->nodes[i];
+        decodedNode.first = static_cast<uint32_t>(program->code.size());
+        const uint32_t count = InstrStream::count(node);
+
+        for (uint32_t pc = 0; pc < count; ++pc) {
+            DecodedProgram::Instr decoded;
+            if (auto* rec = InstrStream::compactAt(node, pc)) {
+                decoded.data = rec;
+                decoded.op = DecodedOp::Compact;
+                if (rec->op() == CompactOp::Line) {
+                    decoded.op = DecodedOp::CompactLine;
+                } else if (rec->op() == CompactOp::Jump && rec->a() >= 0 &&
+                           resolveNode(rec->a(), rec->b(), decoded.a)) {
+                    decoded.op = DecodedOp::Jump;
+                } else if (rec->op() == CompactOp::Yield) {
+                    decoded.op = DecodedOp::Yield;
+                }
+                program->code.push_back(decoded);
+                continue;
+            }
+            auto* instr = InstrStream::tableAt(node, pc);
+            if (!instr) {
+                // 깨진 lines 인덱스: 참조 경로처럼 아무것도 하지 않는 압축 레코드로 둔다
+                decoded.data = node->ops()->Get(pc);
+                decoded.op = DecodedOp::Compact;
+                program->code.push_back(decoded);
+                continue;
+            }
+            decoded.instr = instr;
+            decoded.data = instr->data();
+
+            switch (instr->data_type()) {
+                case OpData::Line:
+                    decoded.op = DecodedOp::Line;
+                    break;
+                case OpData::Jump: {
+                    auto* jump = instr->data_as_Jump();
+                    if (!jump->is_call() && jump->target_node_name_id() >= 0 &&
+                        resolveNode(jump->target_node_name_id(), jump->target_node_index(), decoded.a)) {
+                        decoded.op = DecodedOp::Jump;
+                    }
+                    break;
+                }
+                case OpData::SetVar: {
+                    std::string varName = poolStr(instr->data_as_SetVar()->var_name_id());
+                    auto slot = nameSlots.emplace(varName, static_cast<int32_t>(program->names.size()));
+                    if (slot.second) program->names.push_back(std::move(varName));
+                    decoded.a = slot.first->second;
+                    decoded.op = DecodedOp::SetVar;
+                    break;
+                }
+                case OpData::Condition: {
+                    auto* cond = instr->data_as_Condition();
+                    if (resolveNode(cond->true_jump_node_id(), cond->true_jump_node_index(), decoded.a) &&
+                        resolveNode(cond->false_jump_node_id(), cond->false_jump_node_index(), decoded.b)) {
+                        decoded.op = DecodedOp::Condition;
+                    }
+                    break;
+                }
+                case OpData::Yield:
+                    decoded.op = DecodedOp::Yield;
+                    break;
+                default:
+                    break;
+            }
+            program->code.push_back(decoded);
+        }
+        decodedNode.count = count;
+    }
+
+    decoded_ = std::move(program);
+}
+
+bool Runner::referenceDispatchRequired() const {
+    return (RunnerFeatures::debug && (!breakpoints_.empty() || stepMode_)) ||
+           traceActive() || profilingActive() || storyProfilingActive() || playProfilingActive();
+}
+
+// 사전 디코딩 경로. 현재 노드가 프로그램에 없으면 false (참조 경로가 이어서 실행).
+bool Runner::stepDecoded(StepResult& result) {
+    // 청크 전환 시 decoded_가 다시 만들어지므로 실행 중인 프로그램을 잡아 둔다
+    const std::shared_ptr<const DecodedProgram> programRef = decoded_;
+    const DecodedProgram& program = *programRef;
+    const DecodedProgram::Node* dn = program.find(currentNode_);
+    if (!dn) return false;
+
+#if GYEOL_COMPUTED_GOTO
+    static const void* const kHandlers[] = {
+        &&op_Generic, &&op_Line, &&op_Jump, &&op_SetVar, &&op_Condition, &&op_Yield,
+        &&op_Compact, &&op_CompactLine,
+    };
+#define GYEOL_DECODED_OP(name) op_##name
+#else
+#define GYEOL_DECODED_OP(name) case DecodedOp::name
+#endif
+
+    while (true) {
+        if (waitBlocked_) {
+            result.type = StepType::WAIT;
+            result.wait.tag = waitTag_.empty() ? nullptr : waitTag_.c_str();
+            setError("Cannot step while waiting; call resume() first");
+            return true;
+        }
+
+        if (pc_ >= dn->count) {
+            if (!returnFromNodeEnd()) {
+                finished_ = true;
+                result.type = StepType::END;
+                countMetric(&ExecutionMetrics::endResults);
+                return true;
+            }
+            if (decoded_ != programRef) return false;
+            dn = program.find(currentNode_);
+            if (!dn) return false;
+            continue;
+        }
+
+        if (!takeInstructionBudget(result, dn->node, pc_)) return true;
+
+        const DecodedProgram::Instr& in = program.code[dn->first + pc_];
+        pc_++;
+        countMetric(&ExecutionMetrics::instructionsExecuted);
+
+#if GYEOL_COMPUTED_GOTO
+        goto *kHandlers[static_cast<size_t>(in.op)];
+#else
+        switch (in.op) {
+#endif
+        GYEOL_DECODED_OP(Line):
+            emitLine(in.data, result);
+            return true;
+
+        GYEOL_DECODED_OP(Jump): {
+            countMetric(&ExecutionMetrics::jumps);
+            dn = &program.nodes[static_cast<size_t>(in.a)];
+            currentNode_ = dn->node;
+            pc_ = 0;
+            visitCounts_[dn->name]++;
+            continue;
+        }
+
+        GYEOL_DECODED_OP(SetVar):
+            executeSetVar(in.data, program.names[static_cast<size_t>(in.a)]);
+            continue;
+
+        GYEOL_DECODED_OP(Condition): {
+            countMetric(&ExecutionMetrics::conditionsEvaluated);
+            const int32_t target = evaluateCondition(in.data) ? in.a : in.b;
+            if (target != kNoTarget) {
+                dn = &program.nodes[static_cast<size_t>(target)];
+                currentNode_ = dn->node;
+                pc_ = 0;
+                visitCounts_[dn->name]++;
+            }
+            continue;
+        }
+
+        GYEOL_DECODED_OP(Yield):
+            result.type = StepType::YIELD;
+            return true;
+
+        GYEOL_DECODED_OP(CompactLine): {
+            auto* rec = static_cast<const CompactInstr*>(in.data);
+            emitLineData(rec->a(), rec->b(), rec->c(), nullptr, result, (rec->kind() & 1) != 0);
+            return true;
+        }
+
+        GYEOL_DECODED_OP(Compact):
+            if (executeCompact(in.data, result)) return true;
+            if (decoded_ != programRef) return false;
+            if (currentNode_ != dn->node) {
+                dn = program.find(currentNode_);
+                if (!dn) return false;
+            }
+            continue;
+
+        GYEOL_DECODED_OP(Generic):
+            if (executeInstruction(in.instr, result)) return true;
+            if (decoded_ != programRef) return false;
+            if (currentNode_ != dn->node) {
+                dn = program.find(currentNode_);
+                if (!dn) return false;
+            }
+            continue;
+#if !GYEOL_COMPUTED_GOTO
+        }
+#endif
+    }
+#undef GYEOL_DECODED_OP
+}
+
+} // namespace Gyeol
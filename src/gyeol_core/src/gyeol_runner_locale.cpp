@@ -1,10 +1,12 @@
 #include "gyeol_runner.h"
 #include "gyeol_generated.h"
+#include "gyeol_mapped_file.h"
 
 #include <algorithm>
 #include <cctype>
 #include <cstring>
 #include <fstream>
+#include <memory>
 #include <sstream>
 #include <unordered_map>
 
@@ -414,31 +416,184 @@ bool parseLocaleCatalog(const std::string& jsonText, LocaleCatalogPayload& paylo
            format == "gyeol-locale-catalog" && version == 2;
 }
 
+bool isCompiledLocaleCatalogFile(const std::string& path) {
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs.is_open()) return false;
+    char header[8] = {};
+    if (!ifs.read(header, sizeof(header))) return false;
+    return std::memcmp(header + 4, "GYLC", 4) == 0;
+}
+
 } // namespace
 
-std::string Runner::baseLocaleCode(const std::string& localeCode) const {
+// =========================================================================
+// LocaleCatalog
+// =========================================================================
+
+std::string LocaleCatalog::baseLocaleCode(const std::string& localeCode) {
     size_t sep = localeCode.find_first_of("-_");
     if (sep == std::string::npos) return localeCode;
     if (sep == 0) return "";
     return localeCode.substr(0, sep);
 }
 
-bool Runner::applyLocaleSelection(const std::string& requestedLocale, bool recordTraceEvent) {
-    auto* pool = asPool(pool_);
+std::shared_ptr<LocaleCatalog> LocaleCatalog::load(const uint8_t* storyBuffer, size_t storySize,
+                                                   const std::string& path,
+                                                   std::string* errorOut) {
+    if (!storyBuffer || storySize == 0) {
+        if (errorOut) *errorOut = "No story loaded for locale catalog";
+        return nullptr;
+    }
+    flatbuffers::Verifier verifier(storyBuffer, storySize);
+    if (!VerifyStoryBuffer(verifier)) {
+        if (errorOut) *errorOut = "Invalid buffer";
+        return nullptr;
+    }
+    return loadForStory(GetStory(storyBuffer), path, errorOut);
+}
+
+std::shared_ptr<LocaleCatalog> LocaleCatalog::loadForStory(const void* storyPtr, const std::string& path,
+                                                           std::string* errorOut) {
+    if (isCompiledLocaleCatalogFile(path)) {
+        return loadCompiled(storyPtr, path, errorOut);
+    }
+
+    auto* story = asStory(storyPtr);
+    auto* lineIds = story ? story->line_ids() : nullptr;
+    if (!lineIds || lineIds->size() == 0) {
+        if (errorOut) *errorOut = "No line_ids in story";
+        return nullptr;
+    }
+
+    std::ifstream ifs(path);
+    if (!ifs.is_open()) {
+        if (errorOut) *errorOut = "Failed to open locale catalog: " + path;
+        return nullptr;
+    }
+    std::ostringstream oss;
+    oss << ifs.rdbuf();
+
+    LocaleCatalogPayload payload;
+    if (!parseLocaleCatalog(oss.str(), payload)) {
+        if (errorOut) *errorOut = "Invalid locale catalog JSON: " + path;
+        return nullptr;
+    }
+
+    std::unordered_map<std::string, int32_t> lineIdToPoolIndex;
+    for (flatbuffers::uoffset_t i = 0; i < lineIds->size(); ++i) {
+        auto* lid = lineIds->Get(i);
+        if (lid && lid->size() > 0) {
+            lineIdToPoolIndex[lid->str()] = static_cast<int32_t>(i);
+        }
+    }
+
+    std::shared_ptr<LocaleCatalog> catalog(new LocaleCatalog());
+    catalog->stringPoolSize_ = story->string_pool() ? story->string_pool()->size() : 0;
+    for (const auto& localeEntry : payload.lineEntriesByLocale) {
+        auto& dst = catalog->lineEntriesByLocale_[localeEntry.first];
+        for (const auto& lineEntry : localeEntry.second) {
+            auto it = lineIdToPoolIndex.find(lineEntry.first);
+            if (it != lineIdToPoolIndex.end() && !lineEntry.second.empty()) {
+                dst[it->second] = lineEntry.second;
+            }
+        }
+    }
+    for (const auto& localeEntry : payload.characterEntriesByLocale) {
+        catalog->characterEntriesByLocale_[localeEntry.first] = localeEntry.second;
+    }
+
+    catalog->defaultLocale_ = payload.defaultLocale;
+    if (catalog->defaultLocale_.empty() && !payload.lineEntriesByLocale.empty()) {
+        catalog->defaultLocale_ = payload.lineEntriesByLocale.begin()->first;
+    }
+    if (catalog->defaultLocale_.empty() && !payload.characterEntriesByLocale.empty()) {
+        catalog->defaultLocale_ = payload.characterEntriesByLocale.begin()->first;
+    }
+    if (catalog->defaultLocale_.empty()) {
+        if (errorOut) *errorOut = "Locale catalog has no locales";
+        return nullptr;
+    }
+    return catalog;
+}
+
+std::shared_ptr<LocaleCatalog> LocaleCatalog::loadCompiled(const void* storyPtr, const std::string& path,
+                                                           std::string* errorOut) {
+    auto* story = asStory(storyPtr);
+    auto* pool = story ? story->string_pool() : nullptr;
     if (!pool) {
-        setError("No story loaded for locale selection");
-        return false;
+        if (errorOut) *errorOut = "No story loaded for locale catalog";
+        return nullptr;
     }
-    if (!hasLocaleCatalog_) {
-        setError("Locale catalog is not loaded");
-        return false;
+
+    auto mapped = std::make_shared<MappedFile>();
+    if (!mapped->open(path)) {
+        if (errorOut) *errorOut = "Failed to open locale catalog: " + path;
+        return nullptr;
     }
 
-    currentLocale_ = requestedLocale;
-    resolvedLocale_.clear();
-    localePool_.assign(pool->size(), "");
-    localeCharacterProps_.clear();
+    flatbuffers::Verifier verifier(mapped->data(), mapped->size());
+    if (!verifier.VerifyBuffer<CompiledLocaleCatalog>("GYLC")) {
+        if (errorOut) *errorOut = "Invalid compiled locale catalog: " + path;
+        return nullptr;
+    }
+    auto* compiled = flatbuffers::GetRoot<CompiledLocaleCatalog>(mapped->data());
+    if (compiled->string_pool_size() != pool->size()) {
+        if (errorOut) *errorOut = "Locale catalog does not match story string pool: " + path;
+        return nullptr;
+    }
 
+    std::shared_ptr<LocaleCatalog> catalog(new LocaleCatalog());
+    catalog->stringPoolSize_ = pool->size();
+    catalog->compiled_ = compiled;
+    catalog->mappedFile_ = mapped;
+    if (compiled->default_locale()) {
+        catalog->defaultLocale_ = compiled->default_locale()->str();
+    }
+    if (auto* locales = compiled->locales()) {
+        for (flatbuffers::uoffset_t i = 0; i < locales->size(); ++i) {
+            auto* locale = locales->Get(i);
+            if (locale && locale->locale()) {
+                catalog->compiledLocaleIndex_.emplace(locale->locale()->str(), i);
+            }
+        }
+        if (catalog->defaultLocale_.empty() && locales->size() > 0 && locales->Get(0)->locale()) {
+            catalog->defaultLocale_ = locales->Get(0)->locale()->str();
+        }
+    }
+    if (catalog->defaultLocale_.empty()) {
+        if (errorOut) *errorOut = "Locale catalog has no locales";
+        return nullptr;
+    }
+    return catalog;
+}
+
+std::vector<std::string> LocaleCatalog::getLocales() const {
+    std::vector<std::string> locales;
+    if (compiled_) {
+        for (const auto& kv : compiledLocaleIndex_) locales.push_back(kv.first);
+    } else {
+        for (const auto& kv : lineEntriesByLocale_) locales.push_back(kv.first);
+        for (const auto& kv : characterEntriesByLocale_) {
+            if (lineEntriesByLocale_.find(kv.first) == lineEntriesByLocale_.end()) {
+                locales.push_back(kv.first);
+            }
+        }
+    }
+    std::sort(locales.begin(), locales.end());
+    return locales;
+}
+
+std::shared_ptr<const LocaleTable> LocaleCatalog::resolve(const std::string& requestedLocale) const {
+    // locale별 테이블은 최초 요청 시 한 번만 만들고 이후에는 공유한다
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto cached = tables_.find(requestedLocale);
+    if (cached == tables_.end()) {
+        cached = tables_.emplace(requestedLocale, buildTable(requestedLocale)).first;
+    }
+    return cached->second;
+}
+
+std::shared_ptr<const LocaleTable> LocaleCatalog::buildTable(const std::string& requestedLocale) const {
     std::vector<std::string> chain;
     if (!requestedLocale.empty()) {
         chain.push_back(requestedLocale);
@@ -447,38 +602,79 @@ bool Runner::applyLocaleSelection(const std::string& requestedLocale, bool recor
             chain.push_back(base);
         }
     }
-    if (!catalogDefaultLocale_.empty() &&
-        std::find(chain.begin(), chain.end(), catalogDefaultLocale_) == chain.end()) {
-        chain.push_back(catalogDefaultLocale_);
+    if (!defaultLocale_.empty() &&
+        std::find(chain.begin(), chain.end(), defaultLocale_) == chain.end()) {
+        chain.push_back(defaultLocale_);
+    }
+
+    // 테이블은 카탈로그가 소유하므로 owner는 비워둔다 (Runner가 카탈로그를 함께 보유)
+    auto table = std::make_shared<LocaleTable>();
+    table->lines.assign(stringPoolSize_, nullptr);
+
+    if (compiled_) {
+        // 바이너리 카탈로그는 fallback이 이미 평탄화되어 있으므로
+        // 체인에서 처음 발견되는 locale의 테이블을 그대로 쓴다
+        auto* compiled = static_cast<const CompiledLocaleCatalog*>(compiled_);
+        for (const auto& code : chain) {
+            auto idxIt = compiledLocaleIndex_.find(code);
+            if (idxIt == compiledLocaleIndex_.end()) continue;
+
+            auto* locale = compiled->locales()->Get(idxIt->second);
+            table->resolvedLocale = code;
+            auto* texts = compiled->texts();
+            auto* textIds = locale->line_text_ids();
+            if (texts && textIds) {
+                const size_t count = std::min<size_t>(textIds->size(), table->lines.size());
+                for (size_t i = 0; i < count; ++i) {
+                    const int32_t textId = textIds->Get(static_cast<flatbuffers::uoffset_t>(i));
+                    if (textId < 0 || static_cast<flatbuffers::uoffset_t>(textId) >= texts->size()) continue;
+                    // 매핑된 버퍼의 문자열을 직접 가리킨다 (FlatBuffers 문자열은 NUL 종료)
+                    table->lines[i] = texts->Get(static_cast<flatbuffers::uoffset_t>(textId))->c_str();
+                }
+            }
+            if (auto* characters = locale->characters()) {
+                for (auto* character : *characters) {
+                    if (!character || !character->character_id() || !character->properties()) continue;
+                    auto& dst = table->characterProps[character->character_id()->str()];
+                    for (auto* prop : *character->properties()) {
+                        if (!prop || !prop->key() || !prop->value()) continue;
+                        dst[prop->key()->str()] = prop->value()->str();
+                    }
+                }
+            }
+            return table;
+        }
+        return nullptr;
     }
 
     bool appliedAny = false;
     for (const auto& code : chain) {
-        auto lineIt = catalogLineEntriesByLocale_.find(code);
-        auto charIt = catalogCharacterEntriesByLocale_.find(code);
-        if (lineIt == catalogLineEntriesByLocale_.end() &&
-            charIt == catalogCharacterEntriesByLocale_.end()) {
+        auto lineIt = lineEntriesByLocale_.find(code);
+        auto charIt = characterEntriesByLocale_.find(code);
+        if (lineIt == lineEntriesByLocale_.end() &&
+            charIt == characterEntriesByLocale_.end()) {
             continue;
         }
 
-        if (resolvedLocale_.empty()) {
-            resolvedLocale_ = code;
+        if (table->resolvedLocale.empty()) {
+            table->resolvedLocale = code;
         }
         appliedAny = true;
 
-        if (lineIt != catalogLineEntriesByLocale_.end()) {
+        if (lineIt != lineEntriesByLocale_.end()) {
             for (const auto& kv : lineIt->second) {
                 const int32_t idx = kv.first;
-                if (idx < 0 || static_cast<size_t>(idx) >= localePool_.size()) continue;
-                if (localePool_[static_cast<size_t>(idx)].empty()) {
-                    localePool_[static_cast<size_t>(idx)] = kv.second;
+                if (idx < 0 || static_cast<size_t>(idx) >= table->lines.size()) continue;
+                if (!table->lines[static_cast<size_t>(idx)]) {
+                    // 카탈로그 문자열을 직접 가리킨다 (복사 없음)
+                    table->lines[static_cast<size_t>(idx)] = kv.second.c_str();
                 }
             }
         }
 
-        if (charIt != catalogCharacterEntriesByLocale_.end()) {
+        if (charIt != characterEntriesByLocale_.end()) {
             for (const auto& charEntry : charIt->second) {
-                auto& dst = localeCharacterProps_[charEntry.first];
+                auto& dst = table->characterProps[charEntry.first];
                 for (const auto& propEntry : charEntry.second) {
                     if (dst.find(propEntry.first) == dst.end()) {
                         dst[propEntry.first] = propEntry.second;
@@ -488,15 +684,56 @@ bool Runner::applyLocaleSelection(const std::string& requestedLocale, bool recor
         }
     }
 
-    if (!appliedAny) {
-        localePool_.clear();
-        localeCharacterProps_.clear();
+    if (!appliedAny) return nullptr;
+    return table;
+}
+
+// =========================================================================
+// Runner locale API
+// =========================================================================
+
+std::shared_ptr<const LocaleTable> Runner::makeOwnedLocaleTable(
+    std::vector<std::string> strings,
+    LocaleCharacterProps characterProps,
+    const std::string& resolvedLocale) {
+    auto storage = std::make_shared<std::vector<std::string>>(std::move(strings));
+    auto table = std::make_shared<LocaleTable>();
+    table->resolvedLocale = resolvedLocale;
+    table->lines.assign(storage->size(), nullptr);
+    for (size_t i = 0; i < storage->size(); ++i) {
+        if (!(*storage)[i].empty()) table->lines[i] = (*storage)[i].c_str();
+    }
+    table->characterProps = std::move(characterProps);
+    table->owner = std::move(storage);
+    return table;
+}
+
+bool Runner::applyLocaleSelection(const std::string& requestedLocale, bool recordTraceEvent) {
+    auto* pool = asPool(pool_);
+    if (!pool) {
+        setError("No story loaded for locale selection");
+        return false;
+    }
+    if (!localeCatalog_) {
+        setError("Locale catalog is not loaded");
+        return false;
+    }
+
+    currentLocale_ = requestedLocale;
+
+    // 세션은 선택된 테이블 포인터만 보유한다
+    auto table = localeCatalog_->resolve(requestedLocale);
+    if (!table) {
+        activeLocale_.reset();
         resolvedLocale_.clear();
         setError("Requested locale is not available in catalog");
         return false;
     }
 
-    if (recordTraceEvent) {
+    activeLocale_ = std::move(table);
+    resolvedLocale_ = activeLocale_->resolvedLocale;
+
+    if (recordTraceEvent && traceActive()) {
         recordTrace("LOCALE_SET", currentNodeName(), pc_, currentLocale_ + "->" + resolvedLocale_);
     }
     return true;
@@ -519,14 +756,11 @@ bool Runner::loadLocale(const std::string& path) {
         }
     }
 
-    hasLocaleCatalog_ = false;
-    catalogDefaultLocale_.clear();
-    catalogLineEntriesByLocale_.clear();
-    catalogCharacterEntriesByLocale_.clear();
-    localeCharacterProps_.clear();
+    localeCatalog_.reset();
+    activeLocale_.reset();
 
-    localePool_.clear();
-    localePool_.resize(pool->size());
+    std::vector<std::string> localePool(pool->size());
+    LocaleCharacterProps localeCharacterProps;
     currentLocale_ = fileStem(path);
     resolvedLocale_ = currentLocale_;
 
@@ -549,13 +783,13 @@ bool Runner::loadLocale(const std::string& path) {
                 if (kv.second.empty()) continue;
                 auto it = lineIdToPoolIndex.find(kv.first);
                 if (it != lineIdToPoolIndex.end()) {
-                    localePool_[static_cast<size_t>(it->second)] = kv.second;
+                    localePool[static_cast<size_t>(it->second)] = kv.second;
                 }
             }
             for (const auto& charEntry : localePayload.characterEntries) {
                 for (const auto& propEntry : charEntry.second) {
                     if (!propEntry.second.empty()) {
-                        localeCharacterProps_[charEntry.first][propEntry.first] = propEntry.second;
+                        localeCharacterProps[charEntry.first][propEntry.first] = propEntry.second;
                     }
                 }
             }
@@ -573,7 +807,7 @@ bool Runner::loadLocale(const std::string& path) {
                 if (kv.second.empty()) continue;
                 auto it = lineIdToPoolIndex.find(kv.first);
                 if (it != lineIdToPoolIndex.end()) {
-                    localePool_[static_cast<size_t>(it->second)] = kv.second;
+                    localePool[static_cast<size_t>(it->second)] = kv.second;
                 }
             }
             if (!localePayload.locale.empty()) {
@@ -597,80 +831,52 @@ bool Runner::loadLocale(const std::string& path) {
             if (cols.size() < 5 || cols[4].empty()) continue;
             auto it = lineIdToPoolIndex.find(cols[0]);
             if (it != lineIdToPoolIndex.end()) {
-                localePool_[static_cast<size_t>(it->second)] = cols[4];
+                localePool[static_cast<size_t>(it->second)] = cols[4];
             }
         }
     }
 
-    recordTrace("LOCALE_LOAD", currentNodeName(), pc_, currentLocale_);
+    activeLocale_ = makeOwnedLocaleTable(std::move(localePool), std::move(localeCharacterProps), resolvedLocale_);
+    if (traceActive()) recordTrace("LOCALE_LOAD", currentNodeName(), pc_, currentLocale_);
     return true;
 }
 
 bool Runner::loadLocaleCatalog(const std::string& path) {
-    auto* story = asStory(story_);
-    auto* lineIds = story ? story->line_ids() : nullptr;
-    if (!lineIds || lineIds->size() == 0) {
-        setError("No line_ids in story");
+    std::string error;
+    auto catalog = LocaleCatalog::loadForStory(story_, path, &error);
+    if (!catalog) {
+        setError(error);
         return false;
     }
 
-    std::ifstream ifs(path);
-    if (!ifs.is_open()) {
-        setError("Failed to open locale catalog: " + path);
+    localeCatalog_.reset();
+    activeLocale_.reset();
+    if (!attachLocaleCatalog(std::move(catalog))) {
         return false;
     }
-    std::ostringstream oss;
-    oss << ifs.rdbuf();
 
-    LocaleCatalogPayload payload;
-    if (!parseLocaleCatalog(oss.str(), payload)) {
-        setError("Invalid locale catalog JSON: " + path);
-        return false;
-    }
-
-    std::unordered_map<std::string, int32_t> lineIdToPoolIndex;
-    for (flatbuffers::uoffset_t i = 0; i < lineIds->size(); ++i) {
-        auto* lid = lineIds->Get(i);
-        if (lid && lid->size() > 0) {
-            lineIdToPoolIndex[lid->str()] = static_cast<int32_t>(i);
-        }
-    }
-
-    catalogLineEntriesByLocale_.clear();
-    catalogCharacterEntriesByLocale_.clear();
-    for (const auto& localeEntry : payload.lineEntriesByLocale) {
-        auto& dst = catalogLineEntriesByLocale_[localeEntry.first];
-        for (const auto& lineEntry : localeEntry.second) {
-            auto it = lineIdToPoolIndex.find(lineEntry.first);
-            if (it != lineIdToPoolIndex.end() && !lineEntry.second.empty()) {
-                dst[it->second] = lineEntry.second;
-            }
-        }
-    }
-    for (const auto& localeEntry : payload.characterEntriesByLocale) {
-        catalogCharacterEntriesByLocale_[localeEntry.first] = localeEntry.second;
-    }
+    if (traceActive()) recordTrace("LOCALE_CATALOG_LOAD", currentNodeName(), pc_, path);
+    return true;
+}
 
-    hasLocaleCatalog_ = true;
-    catalogDefaultLocale_ = payload.defaultLocale;
-    if (catalogDefaultLocale_.empty() && !payload.lineEntriesByLocale.empty()) {
-        catalogDefaultLocale_ = payload.lineEntriesByLocale.begin()->first;
-    }
-    if (catalogDefaultLocale_.empty() && !payload.characterEntriesByLocale.empty()) {
-        catalogDefaultLocale_ = payload.characterEntriesByLocale.begin()->first;
+bool Runner::attachLocaleCatalog(std::shared_ptr<const LocaleCatalog> catalog) {
+    auto* pool = asPool(pool_);
+    if (!pool) {
+        setError("No story loaded for locale catalog");
+        return false;
     }
-
-    if (catalogDefaultLocale_.empty()) {
-        setError("Locale catalog has no locales");
+    if (!catalog) {
+        setError("Locale catalog is not loaded");
         return false;
     }
-
-    if (!applyLocaleSelection(catalogDefaultLocale_, false)) {
+    if (catalog->getStringPoolSize() != pool->size()) {
+        setError("Locale catalog does not match story string pool");
         return false;
     }
 
-    recordTrace("LOCALE_CATALOG_LOAD", currentNodeName(), pc_, path);
-    return true;
+    activeLocale_.reset();
+    localeCatalog_ = std::move(catalog);
+    return applyLocaleSelection(localeCatalog_->getDefaultLocale(), false);
 }
 
 bool Runner::setLocale(const std::string& localeCode) {
@@ -678,11 +884,10 @@ bool Runner::setLocale(const std::string& localeCode) {
 }
 
 void Runner::clearLocale() {
-    localePool_.clear();
-    localeCharacterProps_.clear();
+    activeLocale_.reset();
     currentLocale_.clear();
     resolvedLocale_.clear();
-    recordTrace("LOCALE_CLEAR", currentNodeName(), pc_, "");
+    if (traceActive()) recordTrace("LOCALE_CLEAR", currentNodeName(), pc_, "");
 }
 
 std::string Runner::getLocale() const {
@@ -0,0 +1,112 @@
+#include "gyeol_runner.h"
+#include "gyeol_generated.h"
+#include "gyeol_pool_codec.h"
+
+#include <algorithm>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol {
+
+namespace {
+static const Story* asStory(const void* p) { return static_cast<const Story*>(p); }
+static const CompressedStringPool* asCompressed(const void* p) {
+    return static_cast<const CompressedStringPool*>(p);
+}
+
+// 블록 인덱스/오프셋이 서로 맞는지 (Verifier는 벡터 구조만 확인한다)
+bool isUsableCompressedPool(const CompressedStringPool* cp) {
+    if (!cp || cp->codec() != 1 || !cp->entries() || !cp->block_first_entry() ||
+        !cp->block_offsets() || !cp->block_raw_sizes() || !cp->data()) {
+        return false;
+    }
+    const auto blocks = cp->block_first_entry()->size();
+    return blocks > 0 && cp->block_raw_sizes()->size() == blocks &&
+           cp->block_offsets()->size() == blocks + 1 &&
+           cp->block_offsets()->Get(blocks) <= cp->data()->size();
+}
+} // namespace
+
+// story_가 바뀔 때 호출: string_pool/compressed_pool 포인터를 다시 잡고 블록 캐시를 비운다
+void Runner::bindStringPool() {
+    auto* story = asStory(story_);
+    pool_ = story ? story->string_pool() : nullptr;
+    auto* cp = story ? story->compressed_pool() : nullptr;
+    compressedPool_ = isUsableCompressedPool(cp) ? cp : nullptr;
+    poolBlocks_.clear();
+    poolBlockLru_.clear();
+    poolCacheStats_.residentBlocks = 0;
+    poolCacheStats_.residentBytes = 0;
+    textTemplates_.clear(); // text_id 기준이므로 다른 버퍼면 무효
+}
+
+void Runner::setStringPoolCacheCapacity(size_t blocks) {
+    poolCacheCapacity_ = blocks > 0 ? blocks : 1;
+    trimStringPoolCache();
+}
+
+Runner::StringPoolCacheStats Runner::getStringPoolCacheStats() const {
+    return poolCacheStats_;
+}
+
+void Runner::trimStringPoolCache() {
+    while (poolBlocks_.size() > poolCacheCapacity_) {
+        auto it = poolBlocks_.find(poolBlockLru_.back());
+        poolCacheStats_.residentBytes -= it->second.text.size();
+        poolBlocks_.erase(it);
+        poolBlockLru_.pop_back();
+    }
+    poolCacheStats_.residentBlocks = poolBlocks_.size();
+}
+
+const char* Runner::compressedPoolStr(int32_t index) const {
+    auto* cp = asCompressed(compressedPool_);
+    if (!cp) return nullptr;
+
+    auto* entries = cp->entries();
+    auto pos = std::lower_bound(entries->begin(), entries->end(), index);
+    if (pos == entries->end() || *pos != index) return nullptr;
+    const uint32_t entry = static_cast<uint32_t>(pos - entries->begin());
+
+    auto* firsts = cp->block_first_entry();
+    auto blockIt = std::upper_bound(firsts->begin(), firsts->end(), entry);
+    if (blockIt == firsts->begin()) return nullptr;
+    const uint32_t block = static_cast<uint32_t>(blockIt - firsts->begin()) - 1;
+    const uint32_t slot = entry - firsts->Get(block);
+
+    auto cached = poolBlocks_.find(block);
+    if (cached != poolBlocks_.end()) {
+        poolBlockLru_.splice(poolBlockLru_.begin(), poolBlockLru_, cached->second.lru);
+        poolCacheStats_.hits++;
+    } else {
+        // 캐시 miss: 블록을 풀고 문자열 시작 위치를 색인 (축출은 다음 step()에서)
+        const uint32_t begin = cp->block_offsets()->Get(block);
+        const uint32_t end = cp->block_offsets()->Get(block + 1);
+        if (begin > end) return nullptr;
+        PoolBlock decoded;
+        const auto* dict = cp->dictionary();
+        if (!PoolCodec::decompress(cp->data()->data() + begin, end - begin,
+                                   dict ? dict->data() : nullptr, dict ? dict->size() : 0,
+                                   cp->block_raw_sizes()->Get(block), decoded.text) ||
+            decoded.text.empty() || decoded.text.back() != '\0') {
+            setError("Corrupt compressed string pool block");
+            return nullptr;
+        }
+        decoded.offsets.push_back(0);
+        for (uint32_t i = 0; i + 1 < decoded.text.size(); ++i) {
+            if (decoded.text[i] == '\0') decoded.offsets.push_back(i + 1);
+        }
+        poolBlockLru_.push_front(block);
+        decoded.lru = poolBlockLru_.begin();
+        poolCacheStats_.decompressions++;
+        poolCacheStats_.residentBytes += decoded.text.size();
+        cached = poolBlocks_.emplace(block, std::move(decoded)).first;
+        poolCacheStats_.residentBlocks = poolBlocks_.size();
+    }
+
+    const auto& offsets = cached->second.offsets;
+    if (slot >= offsets.size()) return nullptr;
+    return reinterpret_cast<const char*>(cached->second.text.data() + offsets[slot]);
+}
+
+} // namespace Gyeol
@@ -0,0 +1,229 @@
+#include "gyeol_runner.h"
+#include "gyeol_generated.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol {
+
+namespace {
+static const Story* asStory(const void* p) { return static_cast<const Story*>(p); }
+
+// .gyseen v2: magic(4) + version(u32) + 비트 수(u32) + 스토리 식별 해시(u64)
+//             + 비트셋(ceil(비트 수 / 8) 바이트, 인덱스 i는 바이트 i/8의 비트 i%8)
+// v1은 식별 해시가 없어 어느 빌드의 기록인지 알 수 없으므로 읽지 않는다.
+constexpr char kSeenMagic[] = {'G', 'Y', 'S', 'N'};
+constexpr uint32_t kSeenVersion = 2;
+constexpr size_t kSeenHeaderSize = sizeof(kSeenMagic) + 16;
+
+// FNV-1a 64
+void hashBytes(uint64_t& hash, const uint8_t* data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+}
+
+void hashStrings(uint64_t& hash, const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>* strings) {
+    const uint8_t separator = 0;
+    if (!strings) return;
+    for (flatbuffers::uoffset_t i = 0; i < strings->size(); ++i) {
+        const auto* str = strings->Get(i);
+        if (str) hashBytes(hash, reinterpret_cast<const uint8_t*>(str->c_str()), str->size());
+        hashBytes(hash, &separator, 1);
+    }
+}
+
+// 비트 인덱스(string_pool 위치)가 같은 대사를 가리키는지 판단하는 스토리 식별 값.
+// string_pool 순서/내용, line_ids, 압축 pool 바이트가 하나라도 다르면(다른 스토리, 재컴파일, --layout 재배치) 달라진다.
+uint64_t seenStoryHash(const Story* story) {
+    uint64_t hash = 14695981039346656037ull;
+    if (!story) return hash;
+    const uint8_t lineIdsTag = 'L';
+    const uint8_t compressedTag = 'C';
+    hashStrings(hash, story->string_pool());
+    hashBytes(hash, &lineIdsTag, 1);
+    hashStrings(hash, story->line_ids());
+    if (auto* cp = story->compressed_pool()) {
+        hashBytes(hash, &compressedTag, 1);
+        if (cp->dictionary()) hashBytes(hash, cp->dictionary()->data(), cp->dictionary()->size());
+        if (cp->data()) hashBytes(hash, cp->data()->data(), cp->data()->size());
+    }
+    return hash;
+}
+
+void appendUint64(std::vector<uint8_t>& out, uint64_t value) {
+    for (int shift = 0; shift < 64; shift += 8) out.push_back(static_cast<uint8_t>((value >> shift) & 0xFF));
+}
+
+void appendUint32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) out.push_back(static_cast<uint8_t>((value >> shift) & 0xFF));
+}
+
+uint32_t readUint32(const uint8_t* data) {
+    return static_cast<uint32_t>(data[0])
+        | (static_cast<uint32_t>(data[1]) << 8)
+        | (static_cast<uint32_t>(data[2]) << 16)
+        | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+uint64_t readUint64(const uint8_t* data) {
+    return static_cast<uint64_t>(readUint32(data)) | (static_cast<uint64_t>(readUint32(data + 4)) << 32);
+}
+} // namespace
+
+// start()에서 호출: 같은 스토리(식별 해시 일치)를 다시 시작하면 기록을 유지하고 아니면 비운다.
+// 해시는 버퍼(주소 + 크기)마다 한 번만 계산한다.
+void Runner::bindSeenLines(size_t bufferSize) {
+    if (story_ == seenHashStory_ && bufferSize == seenHashSize_) return;
+    auto* story = asStory(story_);
+    const uint32_t bits = story && story->string_pool() ? story->string_pool()->size() : 0;
+    const uint64_t hash = seenStoryHash(story);
+    seenHashStory_ = story_;
+    seenHashSize_ = bufferSize;
+    if (bits == seenLineBits_ && hash == seenStoryHash_) return;
+    seenLineBits_ = bits;
+    seenStoryHash_ = hash;
+    seenLines_.assign((bits + 63) / 64, 0);
+}
+
+bool Runner::markLineSeen(int32_t textId) {
+    if (chunks_ || textId < 0 || static_cast<uint32_t>(textId) >= seenLineBits_) return false;
+    uint64_t& word = seenLines_[static_cast<uint32_t>(textId) >> 6];
+    const uint64_t bit = uint64_t{1} << (static_cast<uint32_t>(textId) & 63);
+    const bool seen = (word & bit) != 0;
+    word |= bit;
+    return seen;
+}
+
+size_t Runner::getSeenLineCount() const {
+    size_t count = 0;
+    for (uint64_t word : seenLines_) {
+        for (; word; word &= word - 1) ++count;
+    }
+    return count;
+}
+
+void Runner::clearSeenLines() {
+    std::fill(seenLines_.begin(), seenLines_.end(), 0);
+}
+
+std::vector<uint8_t> Runner::exportSeenLines() const {
+    std::vector<uint8_t> out(kSeenMagic, kSeenMagic + sizeof(kSeenMagic));
+    appendUint32(out, kSeenVersion);
+    appendUint32(out, seenLineBits_);
+    appendUint64(out, seenStoryHash_);
+    const size_t bytes = (static_cast<size_t>(seenLineBits_) + 7) / 8;
+    out.reserve(out.size() + bytes);
+    for (size_t i = 0; i < bytes; ++i) {
+        out.push_back(static_cast<uint8_t>(seenLines_[i / 8] >> ((i % 8) * 8)));
+    }
+    return out;
+}
+
+bool Runner::mergeSeenLines(const uint8_t* data, size_t size) {
+    if (!story_) {
+        setError("Cannot merge seen lines: no story loaded");
+        return false;
+    }
+    if (chunks_) {
+        setError("Seen lines are not recorded in chunk mode");
+        return false;
+    }
+    if (!data || size < sizeof(kSeenMagic) + 4 || std::memcmp(data, kSeenMagic, sizeof(kSeenMagic)) != 0) {
+        setError("Invalid seen-lines data");
+        return false;
+    }
+    // 버전마다 헤더 길이가 다르므로 버전부터 확인한다
+    const uint32_t version = readUint32(data + 4);
+    if (version != kSeenVersion) {
+        setError("Unsupported seen-lines version: " + std::to_string(version));
+        return false;
+    }
+    if (size < kSeenHeaderSize) {
+        setError("Invalid seen-lines data");
+        return false;
+    }
+    const uint32_t bits = readUint32(data + 8);
+    const size_t bytes = (static_cast<size_t>(bits) + 7) / 8;
+    if (size != kSeenHeaderSize + bytes) {
+        setError("Invalid seen-lines data");
+        return false;
+    }
+    if (bits != seenLineBits_) {
+        setError("Seen-lines data is for a different string pool (" + std::to_string(bits) +
+                 " entries, story has " + std::to_string(seenLineBits_) + ")");
+        return false;
+    }
+    if (readUint64(data + 12) != seenStoryHash_) {
+        setError("Seen-lines data is for a different story build");
+        return false;
+    }
+    const uint8_t* bitset = data + kSeenHeaderSize;
+    for (size_t i = 0; i < bytes; ++i) {
+        seenLines_[i / 8] |= static_cast<uint64_t>(bitset[i]) << ((i % 8) * 8);
+    }
+    // string_pool 밖의 패딩 비트는 버린다
+    if (bits % 64 != 0) seenLines_.back() &= (uint64_t{1} << (bits % 64)) - 1;
+    return true;
+}
+
+bool Runner::saveSeenLines(const std::string& filepath) const {
+    const std::vector<uint8_t> data = exportSeenLines();
+    std::ofstream ofs(filepath, std::ios::binary);
+    if (!ofs) {
+        setError("Cannot open seen-lines file: " + filepath);
+        return false;
+    }
+    ofs.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    if (!ofs.good()) {
+        setError("Failed to write seen-lines file: " + filepath);
+        return false;
+    }
+    return true;
+}
+
+bool Runner::loadSeenLines(const std::string& filepath) {
+    std::ifstream ifs(filepath, std::ios::binary | std::ios::ate);
+    if (!ifs) {
+        setError("Cannot open seen-lines file: " + filepath);
+        return false;
+    }
+    auto size = ifs.tellg();
+    ifs.seekg(0, std::ios::beg);
+    std::vector<uint8_t> buf(static_cast<size_t>(size));
+    if (!ifs.read(reinterpret_cast<char*>(buf.data()), size)) {
+        setError("Failed to read seen-lines file");
+        return false;
+    }
+    return mergeSeenLines(buf.data(), buf.size());
+}
+
+StepResult Runner::skipSeen(uint32_t* skippedLines) {
+    StepResult result;
+    result.type = StepType::END;
+    uint32_t skipped = 0;
+    if (compressedPool_) trimStringPoolCache();
+    if (!finished_) {
+        budgetLeft_ = instructionBudget_ != 0 ? instructionBudget_ : std::numeric_limits<uint64_t>::max();
+        skipping_ = true;
+        while (true) {
+            result.type = StepType::END;
+            result.line.seen = false;
+            advance(result);
+            // 명령은 호스트가 처리해야 하므로 넘기지 않고 돌려준다
+            if (result.type != StepType::LINE || !result.line.seen) break;
+            ++skipped;
+        }
+        skipping_ = false;
+    }
+    if (skippedLines) *skippedLines = skipped;
+    if (traceActive()) recordTrace("SKIP_SEEN", currentNodeName(), pc_, std::to_string(skipped));
+    return result;
+}
+
+} // namespace Gyeol
@@ -1,5 +1,7 @@
 ﻿#include "gyeol_story.h"
 #include "gyeol_generated.h"
+#include "gyeol_instr_stream.h"
+#include <cstring>
 #include <iostream>
 #include <fstream>
 
@@ -85,13 +87,52 @@ void Story::printStory() const {
         std::cout << "\n[Node] \"" << (node->name() ? node->name()->c_str() : "?")
                   << "\"" << std::endl;
 
-        const auto* lines = node->lines();
-        if (!lines) continue;
-
-        for (flatbuffers::uoffset_t j = 0; j < lines->size(); ++j) {
-            const auto* instr = lines->Get(j);
+        const uint32_t count = InstrStream::count(node);
+        for (uint32_t j = 0; j < count; ++j) {
             std::cout << "  " << j << ": ";
 
+            // 압축 레코드는 [op*]로 표시
+            if (const auto* rec = InstrStream::compactAt(node, j)) {
+                std::cout << "[" << EnumNameCompactOp(rec->op()) << "*]";
+                switch (rec->op()) {
+                    case CompactOp::Line:
+                        std::cout << " " << (rec->a() >= 0 ? poolStr(pool, rec->a()) : "(narration)")
+                                  << ": \"" << poolStr(pool, rec->b()) << "\"";
+                        if (rec->c() >= 0) std::cout << " [voice:" << poolStr(pool, rec->c()) << "]";
+                        break;
+                    case CompactOp::Jump:
+                        std::cout << " -> " << poolStr(pool, rec->a());
+                        break;
+                    case CompactOp::Wait:
+                        if (rec->a() >= 0) std::cout << " \"" << poolStr(pool, rec->a()) << "\"";
+                        break;
+                    case CompactOp::SetVar: {
+                        std::cout << " " << poolStr(pool, rec->a()) << " = ";
+                        const auto kind = static_cast<ValueData>(rec->kind());
+                        if (kind == ValueData::BoolValue) {
+                            std::cout << (rec->b() ? "true" : "false");
+                        } else if (kind == ValueData::FloatValue) {
+                            float f;
+                            const int32_t bits = rec->b();
+                            std::memcpy(&f, &bits, sizeof(f));
+                            std::cout << f;
+                        } else {
+                            std::cout << rec->b();
+                        }
+                        break;
+                    }
+                    default:
+                        break;
+                }
+                std::cout << std::endl;
+                continue;
+            }
+            const auto* instr = InstrStream::tableAt(node, j);
+            if (!instr) {
+                std::cout << "[Unknown OpData]" << std::endl;
+                continue;
+            }
+
             switch (instr->data_type()) {
                 case OpData::Line: {
                     const auto* line = instr->data_as_Line();
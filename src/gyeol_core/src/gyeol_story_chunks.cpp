@@ -0,0 +1,143 @@
+#include "gyeol_story_chunks.h"
+#include "gyeol_generated.h"
+#include "gyeol_mapped_file.h"
+
+#include <filesystem>
+
+using namespace ICPDev::Gyeol::Schema;
+
+namespace Gyeol {
+
+const uint8_t* StoryChunk::data() const { return file ? file->data() : nullptr; }
+size_t StoryChunk::size() const { return file ? file->size() : 0; }
+
+std::shared_ptr<StoryChunkSet> StoryChunkSet::load(const std::string& indexPath,
+                                                   size_t memoryBudgetBytes,
+                                                   std::string* errorOut) {
+    MappedFile indexFile;
+    if (!indexFile.open(indexPath)) {
+        if (errorOut) *errorOut = "Failed to open story chunk index: " + indexPath;
+        return nullptr;
+    }
+
+    flatbuffers::Verifier verifier(indexFile.data(), indexFile.size());
+    if (!verifier.VerifyBuffer<StoryChunkIndex>("GYCI")) {
+        if (errorOut) *errorOut = "Invalid story chunk index: " + indexPath;
+        return nullptr;
+    }
+    auto* index = flatbuffers::GetRoot<StoryChunkIndex>(indexFile.data());
+    if (!index->chunks() || index->chunks()->size() == 0) {
+        if (errorOut) *errorOut = "Story chunk index has no chunks: " + indexPath;
+        return nullptr;
+    }
+
+    std::shared_ptr<StoryChunkSet> set(new StoryChunkSet());
+    set->memoryBudget_ = memoryBudgetBytes;
+    if (index->start_node_name()) set->startNodeName_ = index->start_node_name()->str();
+
+    const std::filesystem::path baseDir = std::filesystem::path(indexPath).parent_path();
+    for (flatbuffers::uoffset_t i = 0; i < index->chunks()->size(); ++i) {
+        auto* entry = index->chunks()->Get(i);
+        if (!entry->path()) {
+            if (errorOut) *errorOut = "Story chunk has no path: #" + std::to_string(i);
+            return nullptr;
+        }
+        ChunkInfo info;
+        info.name = entry->name() ? entry->name()->str() : "";
+        info.path = (baseDir / entry->path()->str()).string();
+        info.size = entry->size();
+        if (entry->node_names()) {
+            for (flatbuffers::uoffset_t n = 0; n < entry->node_names()->size(); ++n) {
+                set->nodeToChunk_.emplace(entry->node_names()->Get(n)->str(), i);
+            }
+        }
+        set->chunks_.push_back(std::move(info));
+    }
+    return set;
+}
+
+int32_t StoryChunkSet::findChunkForNode(const std::string& nodeName) const {
+    auto it = nodeToChunk_.find(nodeName);
+    return it != nodeToChunk_.end() ? static_cast<int32_t>(it->second) : -1;
+}
+
+std::shared_ptr<const StoryChunk> StoryChunkSet::acquire(uint32_t chunk, std::string* errorOut) {
+    if (chunk >= chunks_.size()) {
+        if (errorOut) *errorOut = "Story chunk index out of range: " + std::to_string(chunk);
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = resident_.find(chunk);
+    if (it != resident_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second.second);
+        stats_.hits++;
+        return it->second.first;
+    }
+
+    auto file = std::make_shared<MappedFile>();
+    if (!file->open(chunks_[chunk].path)) {
+        if (errorOut) *errorOut = "Failed to open story chunk: " + chunks_[chunk].path;
+        return nullptr;
+    }
+    flatbuffers::Verifier verifier(file->data(), file->size());
+    if (!VerifyStoryBuffer(verifier)) {
+        if (errorOut) *errorOut = "Invalid story chunk: " + chunks_[chunk].path;
+        return nullptr;
+    }
+
+    auto loaded = std::make_shared<StoryChunk>();
+    loaded->index = chunk;
+    loaded->name = chunks_[chunk].name;
+    loaded->file = std::move(file);
+
+    lru_.push_front(chunk);
+    resident_.emplace(chunk, std::make_pair(loaded, lru_.begin()));
+    residentBytes_ += loaded->size();
+    stats_.loads++;
+    evictLocked();
+    return loaded;
+}
+
+// 예산을 넘으면 LRU 끝부터, 캐시 밖에서 참조하지 않는 청크만 내린다.
+void StoryChunkSet::evictLocked() {
+    if (memoryBudget_ == 0) return;
+    auto it = lru_.end();
+    while (residentBytes_ > memoryBudget_ && it != lru_.begin()) {
+        --it;
+        auto entry = resident_.find(*it);
+        if (entry->second.first.use_count() > 1) continue; // 사용 중
+        residentBytes_ -= entry->second.first->size();
+        resident_.erase(entry);
+        it = lru_.erase(it);
+        stats_.evictions++;
+    }
+}
+
+void StoryChunkSet::setMemoryBudget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    memoryBudget_ = bytes;
+    evictLocked();
+}
+
+size_t StoryChunkSet::getMemoryBudget() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memoryBudget_;
+}
+
+size_t StoryChunkSet::getResidentBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return residentBytes_;
+}
+
+bool StoryChunkSet::isResident(uint32_t chunk) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return resident_.count(chunk) > 0;
+}
+
+StoryChunkSet::Stats StoryChunkSet::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+} // namespace Gyeol
@@ -0,0 +1,142 @@
+#pragma once
+#include "gyeol_runner.h"
+#include "gyeol_generated.h"
+
+#include <sstream>
+#include <string>
+
+namespace Gyeol {
+
+// Variant 비교/산술/참 판정. 인터프리터(evaluateExpression/evaluateCondition)와
+// AOT 생성 코드(gyeol_aot.h의 Aot:: 함수)가 같은 규칙을 쓰도록 한곳에 둔다.
+using ICPDev::Gyeol::Schema::ExprOp;
+using ICPDev::Gyeol::Schema::Operator;
+
+// --- 조건 비교 ---
+inline bool compareVariants(const Variant& lhs, Operator op, const Variant& rhs) {
+    // 타입이 다르면 INT로 비교 시도
+    if (lhs.type == Variant::BOOL || rhs.type == Variant::BOOL) {
+        bool a = (lhs.type == Variant::BOOL) ? lhs.b : (lhs.i != 0);
+        bool b = (rhs.type == Variant::BOOL) ? rhs.b : (rhs.i != 0);
+        switch (op) {
+            case Operator::Equal:          return a == b;
+            case Operator::NotEqual:       return a != b;
+            default:                       return false;
+        }
+    }
+
+    if (lhs.type == Variant::STRING || rhs.type == Variant::STRING) {
+        switch (op) {
+            case Operator::Equal:          return lhs.s == rhs.s;
+            case Operator::NotEqual:       return lhs.s != rhs.s;
+            default:                       return false;
+        }
+    }
+
+    if (lhs.type == Variant::FLOAT || rhs.type == Variant::FLOAT) {
+        float a = (lhs.type == Variant::FLOAT) ? lhs.f : static_cast<float>(lhs.i);
+        float b = (rhs.type == Variant::FLOAT) ? rhs.f : static_cast<float>(rhs.i);
+        switch (op) {
+            case Operator::Equal:          return a == b;
+            case Operator::NotEqual:       return a != b;
+            case Operator::Greater:        return a > b;
+            case Operator::Less:           return a < b;
+            case Operator::GreaterOrEqual: return a >= b;
+            case Operator::LessOrEqual:    return a <= b;
+        }
+    }
+
+    // INT 비교
+    int32_t a = lhs.i;
+    int32_t b = rhs.i;
+    switch (op) {
+        case Operator::Equal:          return a == b;
+        case Operator::NotEqual:       return a != b;
+        case Operator::Greater:        return a > b;
+        case Operator::Less:           return a < b;
+        case Operator::GreaterOrEqual: return a >= b;
+        case Operator::LessOrEqual:    return a <= b;
+    }
+    return false;
+}
+
+// --- truthiness 변환 ---
+inline bool variantToBool(const Variant& v) {
+    switch (v.type) {
+        case Variant::BOOL:   return v.b;
+        case Variant::INT:    return v.i != 0;
+        case Variant::FLOAT:  return v.f != 0.0f;
+        case Variant::STRING: return !v.s.empty();
+        case Variant::LIST:   return !v.list.empty();
+    }
+    return false;
+}
+
+// --- 산술 연산 ---
+inline Variant applyBinaryOp(const Variant& lhs, ExprOp op, const Variant& rhs) {
+    // Float 하나라도 있으면 float 연산
+    if (lhs.type == Variant::FLOAT || rhs.type == Variant::FLOAT) {
+        float a = (lhs.type == Variant::FLOAT) ? lhs.f :
+                  (lhs.type == Variant::BOOL) ? (lhs.b ? 1.0f : 0.0f) :
+                  static_cast<float>(lhs.i);
+        float b = (rhs.type == Variant::FLOAT) ? rhs.f :
+                  (rhs.type == Variant::BOOL) ? (rhs.b ? 1.0f : 0.0f) :
+                  static_cast<float>(rhs.i);
+        switch (op) {
+            case ExprOp::Add: return Variant::Float(a + b);
+            case ExprOp::Sub: return Variant::Float(a - b);
+            case ExprOp::Mul: return Variant::Float(a * b);
+            case ExprOp::Div: return (b != 0.0f) ? Variant::Float(a / b) : Variant::Float(0.0f);
+            case ExprOp::Mod: {
+                int32_t ai = static_cast<int32_t>(a);
+                int32_t bi = static_cast<int32_t>(b);
+                return (bi != 0) ? Variant::Int(ai % bi) : Variant::Int(0);
+            }
+            default: return Variant::Int(0);
+        }
+    }
+    // INT (BOOL은 INT로 변환)
+    int32_t a = (lhs.type == Variant::BOOL) ? (lhs.b ? 1 : 0) : lhs.i;
+    int32_t b = (rhs.type == Variant::BOOL) ? (rhs.b ? 1 : 0) : rhs.i;
+    switch (op) {
+        case ExprOp::Add: return Variant::Int(a + b);
+        case ExprOp::Sub: return Variant::Int(a - b);
+        case ExprOp::Mul: return Variant::Int(a * b);
+        case ExprOp::Div: return (b != 0) ? Variant::Int(a / b) : Variant::Int(0);
+        case ExprOp::Mod: return (b != 0) ? Variant::Int(a % b) : Variant::Int(0);
+        default: return Variant::Int(0);
+    }
+}
+
+// --- 단항 부호 반전 ---
+// INT는 2의 보수로 감싼다 (-INT32_MIN == INT32_MIN, -O1 상수 폴딩과 같음)
+inline Variant applyNegate(const Variant& v) {
+    if (v.type == Variant::FLOAT) return Variant::Float(-v.f);
+    const int32_t i = (v.type == Variant::BOOL) ? (v.b ? 1 : 0) : v.i;
+    return Variant::Int(static_cast<int32_t>(0u - static_cast<uint32_t>(i)));
+}
+
+// --- 문자열 변환 (보간, 리스트 항목 비교) ---
+inline std::string variantText(const Variant& v) {
+    switch (v.type) {
+        case Variant::BOOL:   return v.b ? "true" : "false";
+        case Variant::INT:    return std::to_string(v.i);
+        case Variant::FLOAT: {
+            std::ostringstream oss;
+            oss << v.f;
+            return oss.str();
+        }
+        case Variant::STRING: return v.s;
+        case Variant::LIST: {
+            std::string result;
+            for (size_t i = 0; i < v.list.size(); ++i) {
+                if (i > 0) result += ", ";
+                result += v.list[i];
+            }
+            return result;
+        }
+    }
+    return "";
+}
+
+} // namespace Gyeol
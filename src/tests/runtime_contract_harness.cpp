@@ -341,6 +341,7 @@ bool runCoreActions(const std::vector<uint8_t>& storyBuffer,
     if (!validateActionsSchema(actionsDoc, errorOut)) return false;
 
     Gyeol::Runner runner;
+    runner.setAotProgram(options.aotProgram);
     if (!runner.start(storyBuffer.data(), storyBuffer.size())) {
         if (errorOut) *errorOut = "Runner.start failed.";
         return false;
@@ -15,6 +15,7 @@ struct RunOptions {
     bool includeLocaleInState = false;
     bool includeVisitsInState = false;
     bool includeMetricsInState = false;
+    const Gyeol::AotProgram* aotProgram = nullptr; // start() 전에 Runner::setAotProgram
 };
 
 bool loadJsonFile(const std::string& path, nlohmann::json& out, std::string* errorOut = nullptr);
@@ -0,0 +1,67 @@
+#include "runtime_perf_tools.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// 세션 메모리 측정용 전역 할당 카운터.
+// 할당 크기를 헤더에 기록해 두고 해제 시 차감한다 (over-aligned new는 대상 아님).
+
+namespace {
+
+std::atomic<int64_t> g_liveBytes{0};
+constexpr std::size_t kHeaderSize = alignof(std::max_align_t);
+
+void* countedAlloc(std::size_t size) noexcept {
+    void* raw = std::malloc(size + kHeaderSize);
+    if (!raw) return nullptr;
+    *static_cast<std::size_t*>(raw) = size;
+    g_liveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+    return static_cast<unsigned char*>(raw) + kHeaderSize;
+}
+
+void countedFree(void* ptr) noexcept {
+    if (!ptr) return;
+    void* raw = static_cast<unsigned char*>(ptr) - kHeaderSize;
+    const std::size_t size = *static_cast<std::size_t*>(raw);
+    g_liveBytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+    std::free(raw);
+}
+
+} // namespace
+
+namespace RuntimePerf {
+
+int64_t liveAllocatedBytes() {
+    return g_liveBytes.load(std::memory_order_relaxed);
+}
+
+} // namespace RuntimePerf
+
+void* operator new(std::size_t size) {
+    void* p = countedAlloc(size == 0 ? 1 : size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](std::size_t size) {
+    void* p = countedAlloc(size == 0 ? 1 : size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* ptr) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr) noexcept { countedFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { countedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { countedFree(ptr); }
@@ -1,9 +1,12 @@
 #include "runtime_contract_harness.h"
 #include "runtime_perf_tools.h"
 
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <string>
+#include <thread>
 
 using json = nlohmann::json;
 
@@ -14,6 +17,24 @@ struct RunArgs {
     std::string outputPath;
 };
 
+struct ProfileArgs {
+    std::string suitePath;
+    std::string scenarioName;
+    std::string outputPath;
+    std::string collapsedPath;
+    bool weightByInstructions = false;
+};
+
+struct ParseArgs {
+    std::string inputPath;
+    int syntheticLabels = 0;
+    int projectFiles = 0;      // --project: import 병렬 파싱 비교
+    int projectLabels = 200;
+    int jobs = 0;              // 0 = hardware_concurrency
+    int iterations = 10;
+    std::string outputPath;
+};
+
 struct CompareArgs {
     std::string baselinePath;
     std::string actualPath;
@@ -26,7 +47,11 @@ void printUsage() {
         << "Usage:\n"
         << "  GyeolRuntimePerfCLI run --suite <runtime_perf_suite_core.json> --output <perf.json>\n"
         << "  GyeolRuntimePerfCLI compare --baseline <baseline.json> --actual <actual.json> "
-           "[--threshold <ratio>] [--report-out <report.json>]\n";
+           "[--threshold <ratio>] [--report-out <report.json>]\n"
+        << "  GyeolRuntimePerfCLI profile --suite <runtime_perf_suite_core.json> --scenario <name> "
+           "--output <profile.json> [--collapsed-out <stacks.folded>] [--weight ns|instructions]\n"
+        << "  GyeolRuntimePerfCLI parse (--input <story.gyeol> | --synthetic <labels> | --project <files> "
+           "[--labels <n>] [--jobs <n>]) [--iterations <n>] [--output <parse.json>]\n";
 }
 
 bool parseDoubleArg(const std::string& text, double& out, std::string& error) {
@@ -79,6 +104,85 @@ bool parseRunArgs(int argc, char** argv, RunArgs& out, std::string& error) {
     return true;
 }
 
+bool parseProfileArgs(int argc, char** argv, ProfileArgs& out, std::string& error) {
+    for (int i = 2; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if ((arg == "--suite" || arg == "--scenario" || arg == "--output" ||
+             arg == "--collapsed-out" || arg == "--weight")) {
+            if (i + 1 >= argc) {
+                error = "Missing value for argument: " + arg;
+                return false;
+            }
+            const std::string value = argv[++i];
+            if (arg == "--suite") out.suitePath = value;
+            if (arg == "--scenario") out.scenarioName = value;
+            if (arg == "--output") out.outputPath = value;
+            if (arg == "--collapsed-out") out.collapsedPath = value;
+            if (arg == "--weight") {
+                if (value != "ns" && value != "instructions") {
+                    error = "Invalid --weight value (expected ns or instructions): " + value;
+                    return false;
+                }
+                out.weightByInstructions = (value == "instructions");
+            }
+            continue;
+        }
+        error = "Unknown argument for profile: " + arg;
+        return false;
+    }
+    if (out.suitePath.empty() || out.scenarioName.empty() || out.outputPath.empty()) {
+        error = "profile requires --suite, --scenario and --output.";
+        return false;
+    }
+    return true;
+}
+
+bool parsePositiveIntArg(const std::string& text, int& out, std::string& error) {
+    try {
+        const int v = std::stoi(text);
+        if (v <= 0) {
+            error = "Value must be positive: " + text;
+            return false;
+        }
+        out = v;
+        return true;
+    } catch (...) {
+        error = "Invalid integer argument: " + text;
+        return false;
+    }
+}
+
+bool parseParseArgs(int argc, char** argv, ParseArgs& out, std::string& error) {
+    for (int i = 2; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--input" || arg == "--synthetic" || arg == "--project" || arg == "--labels" ||
+            arg == "--jobs" || arg == "--iterations" || arg == "--output") {
+            if (i + 1 >= argc) {
+                error = "Missing value for argument: " + arg;
+                return false;
+            }
+            const std::string value = argv[++i];
+            if (arg == "--input") out.inputPath = value;
+            if (arg == "--output") out.outputPath = value;
+            if (arg == "--synthetic" && !parsePositiveIntArg(value, out.syntheticLabels, error)) return false;
+            if (arg == "--project" && !parsePositiveIntArg(value, out.projectFiles, error)) return false;
+            if (arg == "--labels" && !parsePositiveIntArg(value, out.projectLabels, error)) return false;
+            if (arg == "--jobs" && !parsePositiveIntArg(value, out.jobs, error)) return false;
+            if (arg == "--iterations" && !parsePositiveIntArg(value, out.iterations, error)) return false;
+            continue;
+        }
+        error = "Unknown argument for parse: " + arg;
+        return false;
+    }
+    const int sources = (out.inputPath.empty() ? 0 : 1) + (out.syntheticLabels > 0 ? 1 : 0) +
+                        (out.projectFiles > 0 ? 1 : 0);
+    if (sources != 1) {
+        error = "parse requires exactly one of --input, --synthetic or --project.";
+        return false;
+    }
+    return true;
+}
+
 bool parseCompareArgs(int argc, char** argv, CompareArgs& out, std::string& error) {
     for (int i = 2; i < argc; ++i) {
         const std::string arg = argv[i];
@@ -132,6 +236,111 @@ int commandRun(const RunArgs& args) {
     return 0;
 }
 
+int commandProfile(const ProfileArgs& args) {
+    RuntimePerf::SuiteConfig suite;
+    std::string error;
+    if (!RuntimePerf::loadSuiteFile(args.suitePath, suite, &error)) {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    RuntimePerf::ProfileResult result;
+    if (!RuntimePerf::profileScenario(suite, args.scenarioName, result, &error)) {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    if (!ensureParentDir(args.outputPath, &error) ||
+        !RuntimeContract::writeJsonFile(args.outputPath, RuntimePerf::profileResultToJson(result), &error)) {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    if (!args.collapsedPath.empty()) {
+        if (!ensureParentDir(args.collapsedPath, &error)) {
+            std::cerr << error << "\n";
+            return 1;
+        }
+        std::ofstream ofs(args.collapsedPath, std::ios::binary);
+        if (!ofs) {
+            std::cerr << "Failed to open collapsed stack output: " << args.collapsedPath << "\n";
+            return 1;
+        }
+        ofs << (args.weightByInstructions ? result.collapsedInstructions : result.collapsedNs);
+        std::cout << "Generated collapsed stacks: " << args.collapsedPath << "\n";
+    }
+
+    std::cout << "Generated runtime profile: " << args.outputPath << "\n";
+    return 0;
+}
+
+int commandParseProject(const ParseArgs& args) {
+    std::string error;
+    const auto dir = std::filesystem::temp_directory_path() / "gyeol_import_parse_perf";
+    std::filesystem::remove_all(dir);
+    RuntimePerf::ImportProjectInfo project;
+    RuntimePerf::ImportParseBenchmarkResult result;
+    const unsigned jobs = args.jobs > 0 ? static_cast<unsigned>(args.jobs)
+                                        : std::max(2u, std::thread::hardware_concurrency());
+    const bool ok =
+        RuntimePerf::writeSyntheticImportProject(dir.string(), args.projectFiles, args.projectLabels,
+                                                 project, &error) &&
+        RuntimePerf::runImportParseBenchmark(project, jobs, args.iterations, result, &error);
+    std::filesystem::remove_all(dir);
+    if (!ok) {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    const json output = RuntimePerf::importParseBenchmarkToJson(result);
+    if (!args.outputPath.empty()) {
+        if (!ensureParentDir(args.outputPath, &error) ||
+            !RuntimeContract::writeJsonFile(args.outputPath, output, &error)) {
+            std::cerr << error << "\n";
+            return 1;
+        }
+    }
+    std::cout << output.dump(2) << "\n";
+    return 0;
+}
+
+int commandParse(const ParseArgs& args) {
+    if (args.projectFiles > 0) return commandParseProject(args);
+
+    std::string source;
+    std::string name;
+    if (!args.inputPath.empty()) {
+        std::ifstream ifs(args.inputPath, std::ios::binary);
+        if (!ifs) {
+            std::cerr << "Failed to open input: " << args.inputPath << "\n";
+            return 1;
+        }
+        source.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        name = args.inputPath;
+    } else {
+        source = RuntimePerf::makeSyntheticParseSource(args.syntheticLabels);
+        name = "synthetic_" + std::to_string(args.syntheticLabels);
+    }
+
+    std::string error;
+    RuntimePerf::ParseBenchmarkResult result;
+    if (!RuntimePerf::runParseBenchmark(name, source, args.iterations, result, &error)) {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    const json output = RuntimePerf::parseBenchmarkToJson(result);
+    if (!args.outputPath.empty()) {
+        if (!ensureParentDir(args.outputPath, &error) ||
+            !RuntimeContract::writeJsonFile(args.outputPath, output, &error)) {
+            std::cerr << error << "\n";
+            return 1;
+        }
+    }
+    std::cout << output.dump(2) << "\n";
+    return 0;
+}
+
 int commandCompare(const CompareArgs& args) {
     std::string error;
     json baselineJson;
@@ -203,6 +412,26 @@ int main(int argc, char** argv) {
         return commandRun(args);
     }
 
+    if (command == "profile") {
+        ProfileArgs args;
+        if (!parseProfileArgs(argc, argv, args, error)) {
+            std::cerr << error << "\n";
+            printUsage();
+            return 2;
+        }
+        return commandProfile(args);
+    }
+
+    if (command == "parse") {
+        ParseArgs args;
+        if (!parseParseArgs(argc, argv, args, error)) {
+            std::cerr << error << "\n";
+            printUsage();
+            return 2;
+        }
+        return commandParse(args);
+    }
+
     if (command == "compare") {
         CompareArgs args;
         if (!parseCompareArgs(argc, argv, args, error)) {
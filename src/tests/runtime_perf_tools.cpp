@@ -2,12 +2,17 @@
 
 #include "runtime_contract_harness.h"
 
+#include "gyeol_compact_tools.h"
+#include "gyeol_json_ir_reader.h"
+#include "gyeol_parser.h"
 #include "gyeol_runner.h"
 
 #include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <filesystem>
+#include <fstream>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -61,17 +66,34 @@ uint64_t median(std::vector<uint64_t> values) {
     return values[values.size() / 2];
 }
 
+// 시나리오 스토리를 런타임 버퍼로 빌드 ("encoding": "compact"면 명령 압축)
+bool buildScenarioStory(const ScenarioConfig& scenario, std::vector<uint8_t>& outBuffer, std::string* errorOut) {
+    if (!scenario.compactInstructions) {
+        return RuntimeContract::compileStoryToBuffer(scenario.storyPath, outBuffer, errorOut);
+    }
+    ICPDev::Gyeol::Schema::StoryT story;
+    std::string error;
+    if (!Gyeol::JsonIrReader::fromFile(scenario.storyPath, story, &error)) {
+        if (errorOut) *errorOut = "Failed to parse JSON IR story: " + error;
+        return false;
+    }
+    Gyeol::CompactTools::compactInstructions(story);
+    outBuffer = Gyeol::JsonIrReader::compileToBuffer(story);
+    return !outBuffer.empty();
+}
+
 struct RunSample {
     uint64_t elapsedNs = 0;
     uint64_t stepCalls = 0;
     uint64_t instructionsExecuted = 0;
 };
 
-bool runOnce(const std::vector<uint8_t>& storyBuffer,
-             const ScenarioConfig& scenario,
-             RunSample& outSample,
-             std::string* errorOut) {
-    Gyeol::Runner runner;
+bool runWithRunner(Gyeol::Runner& runner,
+                   const std::vector<uint8_t>& storyBuffer,
+                   const ScenarioConfig& scenario,
+                   RunSample& outSample,
+                   std::string* errorOut) {
+    runner.setPredecodedDispatch(scenario.predecodedDispatch);
     if (!runner.start(storyBuffer.data(), storyBuffer.size())) {
         if (errorOut) *errorOut = "Runner failed to start for scenario: " + scenario.name;
         return false;
@@ -118,7 +140,7 @@ bool runOnce(const std::vector<uint8_t>& storyBuffer,
             const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
             const auto& metrics = runner.getMetrics();
             outSample.elapsedNs = elapsed > 0 ? static_cast<uint64_t>(elapsed) : 0u;
-            outSample.stepCalls = metrics.stepCalls;
+            outSample.stepCalls = static_cast<uint64_t>(guard); // release 변형에서도 유효하도록 직접 센다
             outSample.instructionsExecuted = metrics.instructionsExecuted;
             return true;
         }
@@ -132,6 +154,81 @@ bool runOnce(const std::vector<uint8_t>& storyBuffer,
     return false;
 }
 
+bool runOnce(const std::vector<uint8_t>& storyBuffer,
+             const ScenarioConfig& scenario,
+             RunSample& outSample,
+             std::string* errorOut) {
+    Gyeol::Runner runner;
+    return runWithRunner(runner, storyBuffer, scenario, outSample, errorOut);
+}
+
+bool startLocaleSession(Gyeol::Runner& runner,
+                        const std::vector<uint8_t>& storyBuffer,
+                        const ScenarioConfig& scenario,
+                        const std::shared_ptr<const Gyeol::LocaleCatalog>& sharedCatalog,
+                        std::string* errorOut) {
+    if (!runner.start(storyBuffer.data(), storyBuffer.size())) {
+        if (errorOut) *errorOut = "Runner failed to start for scenario: " + scenario.name;
+        return false;
+    }
+    const bool attached = sharedCatalog
+        ? runner.attachLocaleCatalog(sharedCatalog)
+        : runner.loadLocaleCatalog(scenario.localeCatalogPath);
+    if (!attached) {
+        if (errorOut) *errorOut = "Failed to load locale catalog for scenario '" + scenario.name + "'";
+        return false;
+    }
+    if (!scenario.locale.empty() && !runner.setLocale(scenario.locale)) {
+        if (errorOut) *errorOut = "Failed to set locale '" + scenario.locale + "' for scenario '" + scenario.name + "'";
+        return false;
+    }
+    return true;
+}
+
+// memory_sessions개의 세션을 동시에 띄워 두고 세션당 힙 사용량을 잰다.
+bool measureSessionMemory(const std::vector<uint8_t>& storyBuffer,
+                          const ScenarioConfig& scenario,
+                          ScenarioMetrics& outMetrics,
+                          std::string* errorOut) {
+    const int sessions = scenario.memorySessions;
+
+    int64_t before = liveAllocatedBytes();
+    {
+        std::vector<std::unique_ptr<Gyeol::Runner>> runners;
+        runners.reserve(static_cast<size_t>(sessions));
+        before = liveAllocatedBytes();
+        for (int i = 0; i < sessions; ++i) {
+            runners.push_back(std::make_unique<Gyeol::Runner>());
+            if (!startLocaleSession(*runners.back(), storyBuffer, scenario, nullptr, errorOut)) return false;
+        }
+        outMetrics.perSessionBytesPrivate = (liveAllocatedBytes() - before) / sessions;
+    }
+
+    before = liveAllocatedBytes();
+    std::string error;
+    std::shared_ptr<const Gyeol::LocaleCatalog> catalog =
+        Gyeol::LocaleCatalog::load(storyBuffer.data(), storyBuffer.size(), scenario.localeCatalogPath, &error);
+    if (!catalog) {
+        if (errorOut) *errorOut = "Failed to load shared locale catalog for scenario '" + scenario.name + "': " + error;
+        return false;
+    }
+    catalog->resolve(scenario.locale.empty() ? catalog->getDefaultLocale() : scenario.locale);
+    outMetrics.sharedCatalogBytes = liveAllocatedBytes() - before;
+    {
+        std::vector<std::unique_ptr<Gyeol::Runner>> runners;
+        runners.reserve(static_cast<size_t>(sessions));
+        before = liveAllocatedBytes();
+        for (int i = 0; i < sessions; ++i) {
+            runners.push_back(std::make_unique<Gyeol::Runner>());
+            if (!startLocaleSession(*runners.back(), storyBuffer, scenario, catalog, errorOut)) return false;
+        }
+        outMetrics.perSessionBytesShared = (liveAllocatedBytes() - before) / sessions;
+    }
+
+    outMetrics.memorySessions = sessions;
+    return true;
+}
+
 } // namespace
 
 bool parseSuiteJson(const json& jsonDoc,
@@ -196,6 +293,37 @@ bool parseSuiteJson(const json& jsonDoc,
             }
             scenario.locale = item["locale"].get<std::string>();
         }
+        if (item.contains("memory_sessions")) {
+            if (!ensureInt(item, "memory_sessions", scenario.memorySessions, errorOut)) return false;
+            if (scenario.localeCatalogPath.empty()) {
+                if (errorOut) *errorOut = "memory_sessions requires locale_catalog in scenario: " + scenario.name;
+                return false;
+            }
+        }
+        if (item.contains("dispatch")) {
+            if (!item["dispatch"].is_string()) {
+                if (errorOut) *errorOut = "dispatch must be a string.";
+                return false;
+            }
+            const std::string dispatch = item["dispatch"].get<std::string>();
+            if (dispatch != "flatbuffers" && dispatch != "predecoded") {
+                if (errorOut) *errorOut = "Unsupported dispatch '" + dispatch + "' in scenario: " + scenario.name;
+                return false;
+            }
+            scenario.predecodedDispatch = dispatch == "predecoded";
+        }
+        if (item.contains("encoding")) {
+            if (!item["encoding"].is_string()) {
+                if (errorOut) *errorOut = "encoding must be a string.";
+                return false;
+            }
+            const std::string encoding = item["encoding"].get<std::string>();
+            if (encoding != "table" && encoding != "compact") {
+                if (errorOut) *errorOut = "Unsupported encoding '" + encoding + "' in scenario: " + scenario.name;
+                return false;
+            }
+            scenario.compactInstructions = encoding == "compact";
+        }
         if (!scenario.locale.empty() && scenario.localeCatalogPath.empty()) {
             if (errorOut) *errorOut = "locale requires locale_catalog in scenario: " + scenario.name;
             return false;
@@ -251,7 +379,7 @@ bool runSuite(const SuiteConfig& suite, RunReport& outReport, std::string* error
     for (const auto& scenario : suite.scenarios) {
         std::vector<uint8_t> storyBuffer;
         std::string error;
-        if (!RuntimeContract::compileStoryToBuffer(scenario.storyPath, storyBuffer, &error)) {
+        if (!buildScenarioStory(scenario, storyBuffer, &error)) {
             if (errorOut) *errorOut = error;
             return false;
         }
@@ -296,9 +424,15 @@ bool runSuite(const SuiteConfig& suite, RunReport& outReport, std::string* error
         metrics.p95Ns = percentile(elapsed, 95.0);
         metrics.medianStepCalls = median(stepCalls);
         metrics.medianInstructionsExecuted = median(instructions);
+        metrics.storyBytes = storyBuffer.size();
         metrics.throughputStepCallsPerSec = metrics.medianNs > 0
             ? static_cast<double>(metrics.medianStepCalls) * 1'000'000'000.0 / static_cast<double>(metrics.medianNs)
             : 0.0;
+        if (scenario.memorySessions > 0 &&
+            !measureSessionMemory(storyBuffer, scenario, metrics, &error)) {
+            if (errorOut) *errorOut = error;
+            return false;
+        }
         report.scenarios.push_back(std::move(metrics));
     }
 
@@ -306,10 +440,104 @@ bool runSuite(const SuiteConfig& suite, RunReport& outReport, std::string* error
     return true;
 }
 
+bool profileScenario(const SuiteConfig& suite,
+                     const std::string& scenarioName,
+                     ProfileResult& outResult,
+                     std::string* errorOut) {
+    const ScenarioConfig* scenario = nullptr;
+    for (const auto& candidate : suite.scenarios) {
+        if (candidate.name == scenarioName) {
+            scenario = &candidate;
+            break;
+        }
+    }
+    if (!scenario) {
+        if (errorOut) *errorOut = "Scenario not found in suite: " + scenarioName;
+        return false;
+    }
+    if (!Gyeol::RunnerFeatures::metrics) {
+        if (errorOut) *errorOut = "Story profiling requires GyeolCore built with GYEOL_RUNNER_METRICS=ON";
+        return false;
+    }
+
+    std::vector<uint8_t> storyBuffer;
+    std::string error;
+    if (!buildScenarioStory(*scenario, storyBuffer, &error)) {
+        if (errorOut) *errorOut = error;
+        return false;
+    }
+
+    // 같은 Runner로 반복 실행해 프로파일을 누적한다 (같은 버퍼로 start하면 유지됨)
+    Gyeol::Runner runner;
+    runner.setStoryProfilingEnabled(true);
+    for (int i = 0; i < scenario->iterations; ++i) {
+        RunSample sample;
+        if (!runWithRunner(runner, storyBuffer, *scenario, sample, &error)) {
+            if (errorOut) *errorOut = error;
+            return false;
+        }
+    }
+
+    outResult.scenario = scenario->name;
+    outResult.iterations = scenario->iterations;
+    outResult.profile = runner.getStoryProfile();
+    outResult.collapsedNs = runner.exportStoryProfileCollapsed(false);
+    outResult.collapsedInstructions = runner.exportStoryProfileCollapsed(true);
+    return true;
+}
+
+json profileResultToJson(const ProfileResult& result) {
+    json nodes = json::array();
+    for (const auto& node : result.profile.nodes) {
+        nodes.push_back({
+            {"node", node.nodeName},
+            {"instructions", node.instructions},
+            {"wall_ns", node.wallNs},
+            {"visits", node.visits},
+            {"calls", node.calls},
+        });
+    }
+
+    json instructions = json::array();
+    for (const auto& instr : result.profile.instructions) {
+        instructions.push_back({
+            {"node", instr.nodeName},
+            {"pc", instr.pc},
+            {"type", instr.instructionType},
+            {"count", instr.count},
+            {"wall_ns", instr.wallNs},
+        });
+    }
+
+    json stacks = json::array();
+    for (const auto& stack : result.profile.stacks) {
+        std::string joined;
+        for (size_t i = 0; i < stack.frames.size(); ++i) {
+            if (i) joined += ";";
+            joined += stack.frames[i];
+        }
+        stacks.push_back({
+            {"stack", joined},
+            {"instructions", stack.instructions},
+            {"wall_ns", stack.wallNs},
+        });
+    }
+
+    return {
+        {"format", "gyeol-runtime-profile"},
+        {"version", 1},
+        {"scenario", result.scenario},
+        {"iterations", result.iterations},
+        {"nodes", nodes},
+        {"instructions", instructions},
+        {"stacks", stacks},
+    };
+}
+
 json runReportToJson(const RunReport& report) {
     json scenarios = json::array();
     for (const auto& s : report.scenarios) {
-        scenarios.push_back({
+        json item = {
             {"name", s.name},
             {"warmup", s.warmup},
             {"iterations", s.iterations},
@@ -318,7 +546,17 @@ json runReportToJson(const RunReport& report) {
             {"median_step_calls", s.medianStepCalls},
             {"median_instructions_executed", s.medianInstructionsExecuted},
             {"throughput_step_calls_per_sec", s.throughputStepCallsPerSec},
-        });
+            {"story_bytes", s.storyBytes},
+        };
+        if (s.memorySessions > 0) {
+            item["memory"] = {
+                {"sessions", s.memorySessions},
+                {"per_session_bytes_private", s.perSessionBytesPrivate},
+                {"per_session_bytes_shared", s.perSessionBytesShared},
+                {"shared_catalog_bytes", s.sharedCatalogBytes},
+            };
+        }
+        scenarios.push_back(std::move(item));
     }
     return {
         {"format", report.format},
@@ -378,6 +616,14 @@ bool parseRunReportJson(const json& jsonDoc, RunReport& outReport, std::string*
         s.medianStepCalls = item.value("median_step_calls", 0u);
         s.medianInstructionsExecuted = item.value("median_instructions_executed", 0u);
         s.throughputStepCallsPerSec = item.value("throughput_step_calls_per_sec", 0.0);
+        s.storyBytes = item.value("story_bytes", uint64_t{0});
+        if (item.contains("memory") && item["memory"].is_object()) {
+            const auto& memory = item["memory"];
+            s.memorySessions = memory.value("sessions", 0);
+            s.perSessionBytesPrivate = memory.value("per_session_bytes_private", int64_t{0});
+            s.perSessionBytesShared = memory.value("per_session_bytes_shared", int64_t{0});
+            s.sharedCatalogBytes = memory.value("shared_catalog_bytes", int64_t{0});
+        }
         report.scenarios.push_back(std::move(s));
     }
     if (report.scenarios.empty()) {
@@ -471,4 +717,233 @@ json compareReportToJson(const CompareReport& report) {
     };
 }
 
+namespace {
+
+// prefix가 붙은 label 블록 labels개 (같은 파일 안에서만 점프)
+void appendSyntheticLabels(std::string& source, const std::string& prefix, int labels) {
+    for (int i = 0; i < labels; ++i) {
+        const std::string id = std::to_string(i);
+        const std::string label = prefix + "scene_" + id;
+        const std::string next = prefix + "scene_" + std::to_string((i + 1) % labels);
+        source += "label " + label + " #area=field_" + id + ":\n";
+        source += "    hero \"Scene " + id + " opens with a long line of dialogue.\" #voice=hero_" + id + "\n";
+        source += "    \"Narration for scene " + id + " with an escaped \\\"quote\\\" inside.\"\n";
+        source += "    $ gold = gold + " + id + " * 2 - 1\n";
+        source += "    @ sfx \"chime\" " + id + "\n";
+        source += "    if gold > " + id + " and gold < 100000 -> " + next + " else " + next + "\n";
+        source += "    menu:\n";
+        source += "        \"Go on (" + id + ")\" -> " + next + " if gold\n";
+        source += "        \"Stay here\" -> " + label + " #once\n";
+    }
+}
+
+uint64_t countSourceLines(const std::string& source) {
+    uint64_t lines = static_cast<uint64_t>(std::count(source.begin(), source.end(), '\n'));
+    if (!source.empty() && source.back() != '\n') lines++;
+    return lines;
+}
+
+} // namespace
+
+std::string makeSyntheticParseSource(int labels) {
+    std::string source = "$ gold = 0\n\ncharacter hero:\n    name: \"Hero\"\n\n";
+    appendSyntheticLabels(source, "", labels);
+    return source;
+}
+
+bool writeSyntheticImportProject(const std::string& dir,
+                                 int files,
+                                 int labelsPerFile,
+                                 ImportProjectInfo& outInfo,
+                                 std::string* errorOut) {
+    if (files <= 0 || labelsPerFile <= 0) {
+        if (errorOut) *errorOut = "files and labels must be positive";
+        return false;
+    }
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (ec) {
+        if (errorOut) *errorOut = "Failed to create directory: " + dir;
+        return false;
+    }
+
+    outInfo = ImportProjectInfo{};
+    auto writeSource = [&](const std::string& name, const std::string& source) {
+        const std::string path = (std::filesystem::path(dir) / name).string();
+        std::ofstream ofs(path, std::ios::binary);
+        ofs << source;
+        if (!ofs) {
+            if (errorOut) *errorOut = "Failed to write: " + path;
+            return false;
+        }
+        outInfo.files++;
+        outInfo.lines += countSourceLines(source);
+        outInfo.bytes += source.size();
+        return true;
+    };
+
+    std::string mainSource = "$ gold = 0\n\ncharacter hero:\n    name: \"Hero\"\n\n";
+    for (int f = 0; f < files; ++f) {
+        const std::string part = "part_" + std::to_string(f);
+        mainSource += "import \"" + part + ".gyeol\"\n";
+        std::string source;
+        appendSyntheticLabels(source, part + "_", labelsPerFile);
+        if (!writeSource(part + ".gyeol", source)) return false;
+    }
+    mainSource += "\nlabel start:\n    hero \"Project entry\"\n    jump part_0_scene_0\n";
+    if (!writeSource("main.gyeol", mainSource)) return false;
+    outInfo.mainPath = (std::filesystem::path(dir) / "main.gyeol").string();
+    return true;
+}
+
+bool runParseBenchmark(const std::string& name,
+                       const std::string& source,
+                       int iterations,
+                       ParseBenchmarkResult& outResult,
+                       std::string* errorOut) {
+    if (iterations <= 0) {
+        if (errorOut) *errorOut = "iterations must be positive";
+        return false;
+    }
+
+    outResult = ParseBenchmarkResult{};
+    outResult.name = name;
+    outResult.iterations = iterations;
+    outResult.bytes = source.size();
+    outResult.lines = countSourceLines(source);
+
+    std::vector<uint64_t> elapsed;
+    elapsed.reserve(static_cast<size_t>(iterations));
+    for (int i = 0; i < iterations; ++i) {
+        Gyeol::Parser parser;
+        const auto start = std::chrono::steady_clock::now();
+        const bool ok = parser.parseString(source, name);
+        const auto end = std::chrono::steady_clock::now();
+        if (!ok) {
+            if (errorOut) *errorOut = "Parse failed: " + parser.getError();
+            return false;
+        }
+        elapsed.push_back(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+    }
+
+    outResult.medianNs = median(elapsed);
+    if (outResult.medianNs > 0) {
+        const double seconds = static_cast<double>(outResult.medianNs) / 1'000'000'000.0;
+        outResult.linesPerSec = static_cast<double>(outResult.lines) / seconds;
+        outResult.megabytesPerSec = static_cast<double>(outResult.bytes) / (1024.0 * 1024.0) / seconds;
+    }
+    return true;
+}
+
+bool runImportParseBenchmark(const ImportProjectInfo& project,
+                             unsigned threads,
+                             int iterations,
+                             ImportParseBenchmarkResult& outResult,
+                             std::string* errorOut) {
+    if (iterations <= 0 || threads == 0) {
+        if (errorOut) *errorOut = "iterations and threads must be positive";
+        return false;
+    }
+
+    outResult = ImportParseBenchmarkResult{};
+    outResult.files = project.files;
+    outResult.threads = threads;
+    outResult.iterations = iterations;
+    outResult.lines = project.lines;
+    outResult.bytes = project.bytes;
+
+    // 직렬/병렬/캐시를 번갈아 재서 시스템 잡음이 한쪽에 몰리지 않게 한다.
+    // 캐시는 첫 반복 전에 한 번 채워 두므로 모든 파일이 적중하는 경우(수정 없는 재빌드)를 잰다.
+    const std::string cacheDir =
+        (std::filesystem::path(project.mainPath).parent_path() / ".gyeol-fragment-cache").string();
+    {
+        Gyeol::Parser warmup;
+        warmup.setFragmentCache(cacheDir, "perf");
+        warmup.parse(project.mainPath);
+    }
+    std::vector<uint64_t> serialNs;
+    std::vector<uint64_t> parallelNs;
+    std::vector<uint64_t> cachedNs;
+    std::vector<uint8_t> serialBuffer;
+    for (int i = 0; i < iterations; ++i) {
+        for (int pass = 0; pass < 3; ++pass) {
+            const bool serial = pass == 0;
+            const bool cached = pass == 2;
+            Gyeol::Parser parser;
+            parser.setImportThreads(pass == 1 ? threads : 1u);
+            if (cached) parser.setFragmentCache(cacheDir, "perf");
+            const auto start = std::chrono::steady_clock::now();
+            const bool ok = parser.parse(project.mainPath);
+            const auto end = std::chrono::steady_clock::now();
+            if (!ok) {
+                if (errorOut) *errorOut = "Parse failed: " + parser.getError();
+                return false;
+            }
+            const uint64_t ns = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            (serial ? serialNs : cached ? cachedNs : parallelNs).push_back(ns);
+
+            // 첫 반복에서 세 결과가 바이트 단위로 같은지 확인
+            if (i == 0 && serial) {
+                serialBuffer = parser.compileToBuffer();
+                outResult.identical = true;
+            } else if (i == 0) {
+                if (cached) {
+                    outResult.cacheHits = parser.getImportParseStats().cacheHits;
+                } else {
+                    outResult.parallel = parser.getImportParseStats().parallel;
+                }
+                outResult.identical = outResult.identical && parser.compileToBuffer() == serialBuffer;
+            }
+        }
+    }
+
+    outResult.serialMedianNs = median(serialNs);
+    outResult.parallelMedianNs = median(parallelNs);
+    outResult.cachedMedianNs = median(cachedNs);
+    if (outResult.parallelMedianNs > 0) {
+        outResult.speedup = static_cast<double>(outResult.serialMedianNs) /
+                            static_cast<double>(outResult.parallelMedianNs);
+    }
+    if (!outResult.identical) {
+        if (errorOut) *errorOut = "Parallel or cached import parse produced a different story than serial parse";
+        return false;
+    }
+    return true;
+}
+
+json parseBenchmarkToJson(const ParseBenchmarkResult& result) {
+    return json{
+        {"format", "gyeol-parse-perf"},
+        {"version", 1},
+        {"name", result.name},
+        {"iterations", result.iterations},
+        {"lines", result.lines},
+        {"bytes", result.bytes},
+        {"median_ns", result.medianNs},
+        {"lines_per_sec", result.linesPerSec},
+        {"mb_per_sec", result.megabytesPerSec},
+    };
+}
+
+json importParseBenchmarkToJson(const ImportParseBenchmarkResult& result) {
+    return json{
+        {"format", "gyeol-import-parse-perf"},
+        {"version", 1},
+        {"files", result.files},
+        {"threads", result.threads},
+        {"iterations", result.iterations},
+        {"lines", result.lines},
+        {"bytes", result.bytes},
+        {"serial_median_ns", result.serialMedianNs},
+        {"parallel_median_ns", result.parallelMedianNs},
+        {"speedup", result.speedup},
+        {"cached_median_ns", result.cachedMedianNs},
+        {"cache_hits", result.cacheHits},
+        {"parallel", result.parallel},
+        {"identical", result.identical},
+    };
+}
+
 } // namespace RuntimePerf
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "gyeol_runner.h"
+
 #include <nlohmann/json.hpp>
 
 #include <cstdint>
@@ -16,6 +18,9 @@ struct ScenarioConfig {
     int maxSteps = 200000;
     std::string localeCatalogPath;
     std::string locale;
+    int memorySessions = 0; // >0이면 세션당 메모리(카탈로그 공유/비공유)를 측정
+    bool predecodedDispatch = false; // "dispatch": "predecoded"
+    bool compactInstructions = false; // "encoding": "compact" (CompactTools로 명령 압축)
 };
 
 struct SuiteConfig {
@@ -34,6 +39,13 @@ struct ScenarioMetrics {
     uint64_t medianStepCalls = 0;
     uint64_t medianInstructionsExecuted = 0;
     double throughputStepCallsPerSec = 0.0;
+    uint64_t storyBytes = 0; // 런타임 버퍼 크기
+
+    // 세션 메모리 (memory_sessions 지정 시)
+    int memorySessions = 0;
+    int64_t perSessionBytesPrivate = 0;  // 세션마다 카탈로그를 따로 로드
+    int64_t perSessionBytesShared = 0;   // LocaleCatalog 하나를 공유
+    int64_t sharedCatalogBytes = 0;      // 공유 카탈로그 1회 로드 비용
 };
 
 struct RunReport {
@@ -70,6 +82,21 @@ bool parseSuiteJson(const nlohmann::json& jsonDoc,
 
 bool runSuite(const SuiteConfig& suite, RunReport& outReport, std::string* errorOut = nullptr);
 
+// 스토리 프로파일 (GyeolRuntimePerfCLI profile)
+struct ProfileResult {
+    std::string scenario;
+    int iterations = 0;
+    Gyeol::Runner::StoryProfileReport profile;
+    std::string collapsedNs;            // flamegraph용 collapsed stack (가중치: ns)
+    std::string collapsedInstructions;  // flamegraph용 collapsed stack (가중치: 명령어 수)
+};
+
+bool profileScenario(const SuiteConfig& suite,
+                     const std::string& scenarioName,
+                     ProfileResult& outResult,
+                     std::string* errorOut = nullptr);
+nlohmann::json profileResultToJson(const ProfileResult& result);
+
 nlohmann::json runReportToJson(const RunReport& report);
 bool parseRunReportJson(const nlohmann::json& jsonDoc, RunReport& outReport, std::string* errorOut = nullptr);
 
@@ -81,4 +108,68 @@ bool compareReports(const RunReport& baseline,
 
 nlohmann::json compareReportToJson(const CompareReport& report);
 
+// 파서 처리량 (GyeolRuntimePerfCLI parse)
+struct ParseBenchmarkResult {
+    std::string name;
+    int iterations = 0;
+    uint64_t lines = 0;
+    uint64_t bytes = 0;
+    uint64_t medianNs = 0;
+    double linesPerSec = 0.0;
+    double megabytesPerSec = 0.0;
+};
+
+// label/대사/menu/조건/명령이 섞인 합성 .gyeol 소스 (labels개 블록, 결정적)
+std::string makeSyntheticParseSource(int labels);
+
+// source를 iterations번 Parser::parseString으로 파싱하고 중앙값 기준 처리량을 잰다.
+bool runParseBenchmark(const std::string& name,
+                       const std::string& source,
+                       int iterations,
+                       ParseBenchmarkResult& outResult,
+                       std::string* errorOut = nullptr);
+nlohmann::json parseBenchmarkToJson(const ParseBenchmarkResult& result);
+
+// import 병렬 파싱 (GyeolRuntimePerfCLI parse --project)
+struct ImportProjectInfo {
+    std::string mainPath;
+    size_t files = 0;       // main 포함
+    uint64_t lines = 0;
+    uint64_t bytes = 0;
+};
+
+// dir에 main.gyeol + part_N.gyeol(files개, 각각 labelsPerFile개 label)을 쓴다 (결정적).
+bool writeSyntheticImportProject(const std::string& dir,
+                                 int files,
+                                 int labelsPerFile,
+                                 ImportProjectInfo& outInfo,
+                                 std::string* errorOut = nullptr);
+
+struct ImportParseBenchmarkResult {
+    size_t files = 0;
+    unsigned threads = 1;
+    int iterations = 0;
+    uint64_t lines = 0;
+    uint64_t bytes = 0;
+    uint64_t serialMedianNs = 0;
+    uint64_t parallelMedianNs = 0;
+    double speedup = 0.0;       // serial / parallel
+    uint64_t cachedMedianNs = 0; // 모든 파일이 fragment 캐시에 적중할 때 (1 스레드)
+    size_t cacheHits = 0;
+    bool parallel = false;      // fragment 병합 경로를 탔는지
+    bool identical = false;     // 직렬/병렬/캐시 .gyb가 같은지
+};
+
+// 같은 프로젝트를 직렬(1), threads개 스레드, 채워 둔 fragment 캐시로 번갈아 파싱해
+// 중앙값을 비교한다. 캐시는 프로젝트 디렉터리 아래에 둔다. 결과의 compileToBuffer()가 다르면 실패.
+bool runImportParseBenchmark(const ImportProjectInfo& project,
+                             unsigned threads,
+                             int iterations,
+                             ImportParseBenchmarkResult& outResult,
+                             std::string* errorOut = nullptr);
+nlohmann::json importParseBenchmarkToJson(const ImportParseBenchmarkResult& result);
+
+// 현재 살아있는 힙 할당 바이트 수 (runtime_perf_alloc.cpp의 전역 카운터)
+int64_t liveAllocatedBytes();
+
 } // namespace RuntimePerf
@@ -86,3 +86,92 @@ TEST(JsonIrReaderTest, RejectsInvalidFormatVersion) {
     EXPECT_FALSE(Gyeol::JsonIrReader::fromJson(doc, story, &error));
     EXPECT_NE(error.find("format_version"), std::string::npos);
 }
+
+TEST(JsonIrReaderTest, StreamingCompileMatchesObjectApi) {
+    const std::string script =
+        "$ gold = 3\n"
+        "character hero:\n"
+        "    name: \"Hero\"\n"
+        "label start:\n"
+        "    hero \"Hello\" #voice=v1\n"
+        "    if gold > 1 -> next else end\n"
+        "label next(a):\n"
+        "    $ gold = gold + a\n"
+        "    menu:\n"
+        "        \"End\" -> end #once\n"
+        "label end:\n"
+        "    \"End\"\n";
+
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(script));
+    const json doc = json::parse(Gyeol::JsonExport::toJsonString(parser.getStory()));
+
+    ICPDev::Gyeol::Schema::StoryT story;
+    std::string error;
+    ASSERT_TRUE(Gyeol::JsonIrReader::fromJson(doc, story, &error)) << error;
+    const auto expected = Gyeol::JsonIrReader::compileToBuffer(story);
+
+    std::vector<uint8_t> streamed;
+    ASSERT_TRUE(Gyeol::JsonIrReader::compileJsonToBuffer(doc, streamed, &error)) << error;
+    flatbuffers::Verifier verifier(streamed.data(), streamed.size());
+    ASSERT_TRUE(ICPDev::Gyeol::Schema::VerifyStoryBuffer(verifier));
+
+    // 바이트 배치는 다르지만 UnPack하면 같은 스토리
+    ICPDev::Gyeol::Schema::StoryT unpacked;
+    ICPDev::Gyeol::Schema::GetStory(streamed.data())->UnPackTo(&unpacked);
+    EXPECT_EQ(Gyeol::JsonIrReader::compileToBuffer(unpacked), expected);
+    // 스트리밍 중 채운 노드 인덱스/이름 표도 객체 API 링크 결과와 같다
+    flatbuffers::FlatBufferBuilder repacked;
+    repacked.Finish(ICPDev::Gyeol::Schema::Story::Pack(repacked, &unpacked));
+    EXPECT_EQ(std::vector<uint8_t>(repacked.GetBufferPointer(), repacked.GetBufferPointer() + repacked.GetSize()), expected);
+
+    json missingStart = doc;
+    missingStart["start_node_name"] = "nowhere";
+    EXPECT_FALSE(Gyeol::JsonIrReader::compileJsonToBuffer(missingStart, streamed, &error));
+    EXPECT_TRUE(streamed.empty());
+    EXPECT_NE(error.find("start_node_name"), std::string::npos);
+}
+
+TEST(JsonIrReaderTest, RecomputesShortCircuitSkips) {
+    const std::string script =
+        "label start:\n"
+        "    if gold > 1 and has_key == true -> next\n"
+        "    \"Stay\"\n"
+        "label next:\n"
+        "    \"Next\"\n";
+
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(script));
+    json doc = json::parse(Gyeol::JsonExport::toJsonString(parser.getStory()));
+
+    // 내보낸 JSON IR에는 skip 토큰이 없다
+    auto& tokens = doc["nodes"][0]["instructions"][0]["cond_expr"]["tokens"];
+    ASSERT_TRUE(tokens.is_array());
+    for (const auto& tok : tokens) {
+        EXPECT_NE(tok["op"], "SkipIfFalse");
+        EXPECT_NE(tok["op"], "SkipIfTrue");
+    }
+
+    // 손으로 넣은 잘못된 skip은 버리고 다시 계산한다
+    tokens.insert(tokens.begin() + 1, json{{"op", "SkipIfTrue"}});
+    ICPDev::Gyeol::Schema::StoryT story;
+    std::string error;
+    ASSERT_TRUE(Gyeol::JsonIrReader::fromJson(doc, story, &error)) << error;
+    const auto* cond = story.nodes[0]->lines[0]->data.AsCondition();
+    ASSERT_NE(cond, nullptr);
+    ASSERT_NE(cond->cond_expr, nullptr);
+    const auto& toks = cond->cond_expr->tokens;
+    ASSERT_EQ(toks.size(), 8u);
+    EXPECT_EQ(toks[3]->op, ICPDev::Gyeol::Schema::ExprOp::SkipIfFalse);
+    EXPECT_EQ(toks[3]->skip, 4);
+    EXPECT_EQ(toks[7]->op, ICPDev::Gyeol::Schema::ExprOp::And);
+
+    const auto buffer = Gyeol::JsonIrReader::compileToBuffer(story);
+    Gyeol::Runner runner;
+    ASSERT_TRUE(runner.start(buffer.data(), buffer.size()));
+    runner.setVariable("gold", Gyeol::Variant::Int(5));
+    runner.setVariable("has_key", Gyeol::Variant::Bool(true));
+    auto r = runner.step();
+    ASSERT_EQ(r.type, Gyeol::StepType::LINE);
+    EXPECT_STREQ(r.line.text, "Next");
+}
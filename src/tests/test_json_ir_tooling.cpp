@@ -105,6 +105,20 @@ TEST(JsonIrToolingTest, LintStoryDetectsMissingChoiceTarget) {
     EXPECT_TRUE(matchedLocation);
 }
 
+TEST(JsonIrToolingTest, LintStoryWarnsOnSilentLoop) {
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(
+        "label start:\n"
+        "    $ i = i + 1\n"
+        "    if i < 5000 -> start\n"
+        "    \"done\"\n"));
+
+    std::vector<Gyeol::JsonIrDiagnostic> diagnostics;
+    ASSERT_TRUE(Gyeol::JsonIrTooling::lintStory(parser.getStory(), "story.json", diagnostics));
+    EXPECT_TRUE(hasDiagnosticCode(diagnostics, "IR_SILENT_LOOP"));
+    EXPECT_FALSE(Gyeol::JsonIrTooling::hasErrors(diagnostics));
+}
+
 TEST(JsonIrToolingTest, LintFileEmitsParseDiagnosticForInvalidJsonIr) {
     const std::string path = makeTempPath("invalid.json");
     std::ofstream ofs(path);
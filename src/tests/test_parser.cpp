@@ -3,6 +3,9 @@
 #include "gyeol_parser.h"
 #include "gyeol_comp_analyzer.h"
 #include "gyeol_generated.h"
+#include "gyeol_node_names.h"
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <cstdio>
@@ -968,7 +971,7 @@ TEST(ParserTest, ConditionNotOp) {
 TEST(ParserTest, ConditionLogicalPrecedence) {
     // and가 or보다 우선순위 높음: a == 1 or b == 2 and c == 3
     // = a == 1 or (b == 2 and c == 3)
-    // RPN: [a, 1, CmpEq, b, 2, CmpEq, c, 3, CmpEq, And, Or]
+    // RPN: [a, 1, CmpEq, SkipIfTrue(9), b, 2, CmpEq, SkipIfFalse(4), c, 3, CmpEq, And, Or]
     auto buf = GyeolTest::compileScript(
         "label start:\n"
         "    if a == 1 or b == 2 and c == 3 -> target\n"
@@ -989,6 +992,72 @@ TEST(ParserTest, ConditionLogicalPrecedence) {
     EXPECT_EQ(toks->Get(toks->size() - 2)->op(), ExprOp::And);
 }
 
+TEST(ParserTest, ConditionShortCircuitSkipLayout) {
+    auto buf = GyeolTest::compileScript(
+        "label start:\n"
+        "    if a == 1 or b == 2 and c == 3 -> target\n"
+        "    \"fallthrough\"\n"
+        "\n"
+        "label target:\n"
+        "    \"hit\"\n"
+    );
+    ASSERT_FALSE(buf.empty());
+    auto* story = GetStory(buf.data());
+    auto* cond = story->nodes()->Get(0)->lines()->Get(0)->data_as_Condition();
+    ASSERT_NE(cond, nullptr);
+    ASSERT_NE(cond->cond_expr(), nullptr);
+    auto* toks = cond->cond_expr()->tokens();
+    ASSERT_EQ(toks->size(), 13u);
+    // 왼쪽 비교 뒤 SkipIfTrue가 오른쪽 전체(8개)와 Or를 건너뜀
+    EXPECT_EQ(toks->Get(3)->op(), ExprOp::SkipIfTrue);
+    EXPECT_EQ(toks->Get(3)->skip(), 9);
+    // and의 왼쪽 뒤 SkipIfFalse가 c == 3과 And를 건너뜀
+    EXPECT_EQ(toks->Get(7)->op(), ExprOp::SkipIfFalse);
+    EXPECT_EQ(toks->Get(7)->skip(), 4);
+    EXPECT_EQ(toks->Get(11)->op(), ExprOp::And);
+    EXPECT_EQ(toks->Get(12)->op(), ExprOp::Or);
+}
+
+TEST(ParserTest, LinksNodeIndicesAndNameTable) {
+    auto buf = GyeolTest::compileScript(
+        "label start:\n"
+        "    if gold > 1 -> rich else poor\n"
+        "    menu:\n"
+        "        \"Rich\" -> rich\n"
+        "        \"Poor\" -> poor\n"
+        "label poor:\n"
+        "    \"poor\"\n"
+        "    jump rich\n"
+        "label rich:\n"
+        "    \"rich\"\n"
+    );
+    ASSERT_FALSE(buf.empty());
+    auto* story = GetStory(buf.data());
+    auto* nodes = story->nodes();
+    auto nameAt = [&](int32_t index) {
+        return std::string(nodes->Get(static_cast<uint32_t>(index))->name()->c_str());
+    };
+
+    auto* start = nodes->Get(0)->lines();
+    auto* cond = start->Get(0)->data_as_Condition();
+    ASSERT_NE(cond, nullptr);
+    EXPECT_EQ(nameAt(cond->true_jump_node_index()), "rich");
+    EXPECT_EQ(nameAt(cond->false_jump_node_index()), "poor");
+    auto* choice = start->Get(1)->data_as_Choice();
+    ASSERT_NE(choice, nullptr);
+    EXPECT_EQ(nameAt(choice->target_node_index()), "rich");
+    auto* jump = nodes->Get(1)->lines()->Get(1)->data_as_Jump();
+    ASSERT_NE(jump, nullptr);
+    EXPECT_EQ(nameAt(jump->target_node_index()), "rich");
+
+    // 이름 표로 모든 노드를 찾고, 없는 이름은 nullptr
+    ASSERT_NE(story->node_names(), nullptr);
+    for (uint32_t i = 0; i < nodes->size(); ++i) {
+        EXPECT_EQ(NodeNameHash::findNode(story, nodes->Get(i)->name()->c_str()), nodes->Get(i));
+    }
+    EXPECT_EQ(NodeNameHash::findNode(story, "nowhere"), nullptr);
+}
+
 TEST(ParserTest, ConditionSimpleNoRegression) {
     // 논리 연산자 없는 단순 조건은 여전히 기존 방식 (cond_expr=null)
     auto buf = GyeolTest::compileScript(
@@ -2037,6 +2106,423 @@ TEST(ParserErrorTest, ReturnInvalidExpression) {
     EXPECT_TRUE(buf.empty());
 }
 
+// ===================================================================
+// 병렬 import 파싱 — 직렬 파싱과 결과가 같아야 한다
+// ===================================================================
+
+namespace {
+
+struct ImportParseOutcome {
+    bool ok = false;
+    std::vector<std::string> errors;
+    std::vector<std::string> warnings;
+    std::vector<std::string> sourceFiles;
+    std::vector<std::string> pool;
+    std::vector<std::string> lineIds;
+    std::vector<uint8_t> buffer;
+    Parser::ImportParseStats stats;
+};
+
+ImportParseOutcome parseWithImportThreads(const std::string& mainFile, unsigned threads) {
+    ImportParseOutcome out;
+    Parser parser;
+    parser.setImportThreads(threads);
+    out.ok = parser.parse(mainFile);
+    out.errors = parser.getErrors();
+    out.warnings = parser.getWarnings();
+    out.sourceFiles = parser.getNodeSourceFiles();
+    out.pool = parser.getStory().string_pool;
+    out.lineIds = parser.getStory().line_ids;
+    if (out.ok) out.buffer = parser.compileToBuffer();
+    out.stats = parser.getImportParseStats();
+    return out;
+}
+
+// 파일을 쓰고 직렬(1)/병렬(4) 결과를 비교한 뒤 병렬 결과를 돌려준다
+ImportParseOutcome expectSerialParallelEqual(
+    const std::vector<std::pair<std::string, std::string>>& files,
+    const std::string& mainFile) {
+    for (const auto& file : files) {
+        std::ofstream ofs(file.first);
+        ofs << file.second;
+    }
+    ImportParseOutcome serial = parseWithImportThreads(mainFile, 1);
+    ImportParseOutcome parallel = parseWithImportThreads(mainFile, 4);
+    for (const auto& file : files) {
+        std::remove(file.first.c_str());
+    }
+
+    EXPECT_EQ(serial.ok, parallel.ok);
+    EXPECT_EQ(serial.errors, parallel.errors);
+    EXPECT_EQ(serial.warnings, parallel.warnings);
+    EXPECT_EQ(serial.sourceFiles, parallel.sourceFiles);
+    EXPECT_EQ(serial.pool, parallel.pool);
+    EXPECT_EQ(serial.lineIds, parallel.lineIds);
+    EXPECT_EQ(serial.buffer, parallel.buffer);
+    EXPECT_FALSE(serial.stats.parallel);
+    EXPECT_EQ(serial.stats.files, parallel.stats.files);
+    return parallel;
+}
+
+} // namespace
+
+TEST(ParserImportParallelTest, MultiFileProjectMatchesSerial) {
+    // 메인(전역 변수/캐릭터) + 모듈 6개 + 중첩 import 1개, 파일 간 공유 문자열/점프
+    std::vector<std::pair<std::string, std::string>> files;
+    std::string mainSource =
+        "$ gold = 10\n"
+        "character hero:\n"
+        "    name: \"Hero\"\n"
+        "\n";
+    for (int m = 0; m < 6; ++m) {
+        const std::string mod = "test_pimport_mod" + std::to_string(m);
+        mainSource += "import \"" + mod + ".gyeol\"\n";
+        std::string src;
+        if (m == 0) src += "import \"test_pimport_nested.gyeol\"\n";
+        src += "label " + mod + "_a:\n"
+               "    hero \"Shared greeting\"\n"
+               "    stranger \"Line from " + mod + "\"\n"
+               "    if gold > " + std::to_string(m) + " -> " + mod + "_b\n"
+               "    menu:\n"
+               "        \"Shared choice\" -> " + mod + "_b #once\n"
+               "        \"Back\" -> start\n"
+               "label " + mod + "_b:\n"
+               "    $ gold = gold + " + std::to_string(m + 1) + "\n"
+               "    narrator \"Module " + mod + " end\" #voice=v_" + mod + "\n"
+               "    jump test_pimport_mod" + std::to_string((m + 1) % 6) + "_a\n";
+        files.push_back({mod + ".gyeol", src});
+    }
+    files.push_back({"test_pimport_nested.gyeol",
+                     "label nested:\n"
+                     "    hero \"Shared greeting\"\n"
+                     "    narrator \"Nested only\"\n"});
+    mainSource +=
+        "\n"
+        "label start:\n"
+        "    hero \"Shared greeting\"\n"
+        "    jump test_pimport_mod0_a\n";
+    files.push_back({"test_pimport_main.gyeol", mainSource});
+
+    auto result = expectSerialParallelEqual(files, "test_pimport_main.gyeol");
+    ASSERT_TRUE(result.ok) << (result.errors.empty() ? "" : result.errors.front());
+    EXPECT_TRUE(result.stats.parallel) << result.stats.fallbackReason;
+    EXPECT_EQ(result.stats.files, 8u);
+    EXPECT_EQ(result.stats.threads, 4u);
+    // 정의되지 않은 캐릭터 경고도 같은 순서로 나와야 한다
+    EXPECT_FALSE(result.warnings.empty());
+
+    auto* story = GetStory(result.buffer.data());
+    ASSERT_NE(story, nullptr);
+    EXPECT_STREQ(story->start_node_name()->c_str(), "start");
+}
+
+TEST(ParserImportParallelTest, ImportErrorsMatchSerial) {
+    // 순환 import + 다이아몬드(두 번째 import는 순환으로 보고) + 없는 파일
+    std::vector<std::pair<std::string, std::string>> files = {
+        {"test_pimport_err_a.gyeol",
+         "import \"test_pimport_err_b.gyeol\"\n"
+         "import \"test_pimport_err_shared.gyeol\"\n"
+         "label node_a:\n"
+         "    narrator \"A\"\n"},
+        {"test_pimport_err_b.gyeol",
+         "import \"test_pimport_err_main.gyeol\"\n"
+         "import \"test_pimport_err_shared.gyeol\"\n"
+         "import \"test_pimport_err_missing.gyeol\"\n"
+         "label node_b:\n"
+         "    narrator \"B\"\n"},
+        {"test_pimport_err_shared.gyeol",
+         "label shared:\n"
+         "    narrator \"shared\"\n"},
+        {"test_pimport_err_main.gyeol",
+         "import \"test_pimport_err_a.gyeol\"\n"
+         "label start:\n"
+         "    jump node_b\n"}
+    };
+
+    auto result = expectSerialParallelEqual(files, "test_pimport_err_main.gyeol");
+    EXPECT_FALSE(result.ok);
+    EXPECT_TRUE(result.stats.parallel) << result.stats.fallbackReason;
+    EXPECT_EQ(result.errors.size(), 3u);
+}
+
+TEST(ParserImportParallelTest, CrossFileStateFallsBackToSerial) {
+    // import된 파일이 label 없이 시작하면 파일 경계를 넘는 상태가 생기므로 직렬로 다시 파싱
+    std::vector<std::pair<std::string, std::string>> files = {
+        {"test_pimport_fb_mod.gyeol",
+         "$ bonus = 1\n"
+         "label mod_node:\n"
+         "    narrator \"mod\"\n"},
+        {"test_pimport_fb_main.gyeol",
+         "import \"test_pimport_fb_mod.gyeol\"\n"
+         "label start:\n"
+         "    jump mod_node\n"}
+    };
+    auto result = expectSerialParallelEqual(files, "test_pimport_fb_main.gyeol");
+    EXPECT_FALSE(result.stats.parallel);
+    EXPECT_FALSE(result.stats.fallbackReason.empty());
+
+    // 파일 간 중복 label도 직렬 에러 메시지를 그대로 낸다
+    std::vector<std::pair<std::string, std::string>> dupFiles = {
+        {"test_pimport_dup_mod.gyeol",
+         "label start:\n"
+         "    narrator \"mod\"\n"},
+        {"test_pimport_dup_main.gyeol",
+         "import \"test_pimport_dup_mod.gyeol\"\n"
+         "label start:\n"
+         "    narrator \"main\"\n"}
+    };
+    auto dup = expectSerialParallelEqual(dupFiles, "test_pimport_dup_main.gyeol");
+    EXPECT_FALSE(dup.ok);
+    EXPECT_FALSE(dup.stats.parallel);
+}
+
+// ===================================================================
+// fragment 디스크 캐시 — 바뀐 파일만 다시 파싱하고 결과는 직렬 파싱과 같아야 한다
+// ===================================================================
+
+namespace {
+
+struct FragmentCacheProject {
+    std::filesystem::path dir;
+    std::filesystem::path cacheDir;
+
+    FragmentCacheProject() {
+        dir = std::filesystem::temp_directory_path() / "gyeol_test_fragment_cache";
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        cacheDir = dir / "cache";
+    }
+    ~FragmentCacheProject() { std::filesystem::remove_all(dir); }
+
+    void write(const std::string& name, const std::string& source) const {
+        std::ofstream ofs(dir / name, std::ios::binary);
+        ofs << source;
+    }
+    std::string path(const std::string& name) const { return (dir / name).string(); }
+};
+
+ImportParseOutcome parseWithFragmentCache(const std::string& mainFile, const std::string& cacheDir,
+                                          const std::string& version = "test") {
+    ImportParseOutcome out;
+    Parser parser;
+    parser.setFragmentCache(cacheDir, version);
+    out.ok = parser.parse(mainFile);
+    out.errors = parser.getErrors();
+    out.warnings = parser.getWarnings();
+    out.sourceFiles = parser.getNodeSourceFiles();
+    out.pool = parser.getStory().string_pool;
+    out.lineIds = parser.getStory().line_ids;
+    if (out.ok) out.buffer = parser.compileToBuffer();
+    out.stats = parser.getImportParseStats();
+    return out;
+}
+
+void expectSameOutcome(const ImportParseOutcome& expected, const ImportParseOutcome& actual) {
+    EXPECT_EQ(expected.ok, actual.ok);
+    EXPECT_EQ(expected.errors, actual.errors);
+    EXPECT_EQ(expected.warnings, actual.warnings);
+    EXPECT_EQ(expected.sourceFiles, actual.sourceFiles);
+    EXPECT_EQ(expected.pool, actual.pool);
+    EXPECT_EQ(expected.lineIds, actual.lineIds);
+    EXPECT_EQ(expected.buffer, actual.buffer);
+}
+
+} // namespace
+
+TEST(ParserFragmentCacheTest, ReusesUnchangedFilesAndReparsesEdited) {
+    FragmentCacheProject project;
+    project.write("main.gyeol",
+                  "$ gold = 1\n"
+                  "character hero:\n"
+                  "    name: \"Hero\"\n"
+                  "import \"a.gyeol\"\n"
+                  "import \"b.gyeol\"\n"
+                  "label start:\n"
+                  "    hero \"Shared\"\n"
+                  "    jump a_node\n");
+    project.write("a.gyeol",
+                  "import \"c.gyeol\"\n"
+                  "label a_node:\n"
+                  "    hero \"Shared\"\n"
+                  "    ghost \"A line\"\n"
+                  "    if gold > 0 -> b_node\n"
+                  "    jump c_node\n");
+    project.write("b.gyeol",
+                  "label b_node:\n"
+                  "    \"B line\" #mood=calm\n"
+                  "    menu:\n"
+                  "        \"Again\" -> a_node #once\n");
+    project.write("c.gyeol",
+                  "label c_node:\n"
+                  "    narrator \"C line\"\n"
+                  "    jump start\n");
+    const std::string mainPath = project.path("main.gyeol");
+    const std::string cacheDir = project.cacheDir.string();
+
+    auto cold = parseWithFragmentCache(mainPath, cacheDir);
+    ASSERT_TRUE(cold.ok) << (cold.errors.empty() ? "" : cold.errors.front());
+    EXPECT_TRUE(cold.stats.parallel) << cold.stats.fallbackReason;
+    EXPECT_EQ(cold.stats.cacheHits, 0u);
+    EXPECT_EQ(cold.stats.cacheMisses, 4u);
+    expectSameOutcome(parseWithImportThreads(mainPath, 1), cold);
+
+    auto warm = parseWithFragmentCache(mainPath, cacheDir);
+    EXPECT_EQ(warm.stats.cacheHits, 4u);
+    EXPECT_EQ(warm.stats.cacheMisses, 0u);
+    expectSameOutcome(cold, warm);
+
+    // b.gyeol만 수정 → b만 다시 파싱, 결과는 수정된 프로젝트의 직렬 파싱과 같다
+    project.write("b.gyeol",
+                  "label b_node:\n"
+                  "    \"B line edited\"\n"
+                  "    hero \"Shared\"\n"
+                  "    jump c_node\n");
+    auto edited = parseWithFragmentCache(mainPath, cacheDir);
+    EXPECT_EQ(edited.stats.cacheHits, 3u);
+    EXPECT_EQ(edited.stats.cacheMisses, 1u);
+    expectSameOutcome(parseWithImportThreads(mainPath, 1), edited);
+
+    // 컴파일러 버전이 다르면 캐시를 쓰지 않는다
+    auto otherVersion = parseWithFragmentCache(mainPath, cacheDir, "other");
+    EXPECT_EQ(otherVersion.stats.cacheHits, 0u);
+    expectSameOutcome(edited, otherVersion);
+}
+
+TEST(ParserFragmentCacheTest, CachedDiagnosticsAndCorruptEntries) {
+    FragmentCacheProject project;
+    project.write("main.gyeol",
+                  "import \"bad.gyeol\"\n"
+                  "import \"missing.gyeol\"\n"
+                  "label start:\n"
+                  "    jump nowhere\n");
+    project.write("bad.gyeol",
+                  "label bad:\n"
+                  "    $ = 3\n"
+                  "    unknown_command here\n");
+    const std::string mainPath = project.path("main.gyeol");
+    const std::string cacheDir = project.cacheDir.string();
+
+    auto serial = parseWithImportThreads(mainPath, 1);
+    ASSERT_FALSE(serial.ok);
+    auto cold = parseWithFragmentCache(mainPath, cacheDir);
+    auto warm = parseWithFragmentCache(mainPath, cacheDir);
+    EXPECT_EQ(warm.stats.cacheHits, 2u);
+    expectSameOutcome(serial, cold);
+    expectSameOutcome(serial, warm);
+
+    // 깨진 캐시 파일은 무시하고 다시 파싱한다
+    for (const auto& entry : std::filesystem::directory_iterator(project.cacheDir)) {
+        std::ofstream ofs(entry.path(), std::ios::binary | std::ios::trunc);
+        ofs << "GYFC not a flatbuffer";
+    }
+    auto corrupt = parseWithFragmentCache(mainPath, cacheDir);
+    EXPECT_EQ(corrupt.stats.cacheHits, 0u);
+    expectSameOutcome(serial, corrupt);
+}
+
+// ===================================================================
+// 스트리밍 출력 (parseToBuffer) — parse() + compileToBuffer()와 같은 스토리
+// ===================================================================
+
+namespace {
+
+// 스트리밍 버퍼를 검증/UnPack한 뒤 Story::Pack으로 다시 써서 바이트 비교가 가능하게 한다
+ImportParseOutcome parseStreaming(const std::string& mainFile, size_t* streamedBytes = nullptr) {
+    ImportParseOutcome out;
+    Parser parser;
+    std::vector<uint8_t> streamed;
+    out.ok = parser.parseToBuffer(mainFile, streamed);
+    out.errors = parser.getErrors();
+    out.warnings = parser.getWarnings();
+    out.sourceFiles = parser.getNodeSourceFiles();
+    out.pool = parser.getStory().string_pool;
+    out.lineIds = parser.getStory().line_ids;
+    if (streamedBytes) *streamedBytes = streamed.size();
+    if (out.ok) {
+        flatbuffers::Verifier verifier(streamed.data(), streamed.size());
+        EXPECT_TRUE(VerifyStoryBuffer(verifier));
+        for (const auto& node : parser.getStory().nodes) {
+            EXPECT_TRUE(node->lines.empty()) << node->name;
+        }
+        StoryT unpacked;
+        GetStory(streamed.data())->UnPackTo(&unpacked);
+        flatbuffers::FlatBufferBuilder builder;
+        builder.Finish(ICPDev::Gyeol::Schema::Story::Pack(builder, &unpacked));
+        out.buffer.assign(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+    }
+    out.stats = parser.getImportParseStats();
+    return out;
+}
+
+} // namespace
+
+TEST(ParserStreamingTest, MatchesObjectApiCompile) {
+    FragmentCacheProject project;
+    project.write("main.gyeol",
+                  "$ gold = 1\n"
+                  "character hero:\n"
+                  "    name: \"Hero\"\n"
+                  "import \"a.gyeol\"\n"
+                  "label start(x) #chapter=intro:\n"
+                  "    hero \"Shared\"\n"
+                  "    $ r = call a_node(1)\n"
+                  "    random:\n"
+                  "        50 -> late\n"
+                  "        -> a_node\n"
+                  "label late:\n"
+                  "    if gold > 0 -> start\n"
+                  "    elif gold < 0 -> late\n"
+                  "    else -> a_node\n"
+                  "    ghost \"Late\"\n");
+    project.write("a.gyeol",
+                  "label a_node(n):\n"
+                  "    hero \"Shared\" #voice=v1\n"
+                  "    menu:\n"
+                  "        \"Back\" -> start #once\n"
+                  "        \"Stay\" -> a_node if has_key\n"
+                  "    return n + 1\n");
+    const std::string mainPath = project.path("main.gyeol");
+
+    auto objectApi = parseWithImportThreads(mainPath, 1);
+    ASSERT_TRUE(objectApi.ok) << (objectApi.errors.empty() ? "" : objectApi.errors.front());
+    size_t streamedBytes = 0;
+    auto streamed = parseStreaming(mainPath, &streamedBytes);
+    EXPECT_GT(streamedBytes, 0u);
+    expectSameOutcome(objectApi, streamed);
+    EXPECT_FALSE(streamed.warnings.empty()); // 정의되지 않은 ghost
+}
+
+TEST(ParserStreamingTest, ForwardAndMissingTargetsReportLikeParse) {
+    FragmentCacheProject project;
+    // 앞으로의 참조(later)는 통과, 없는 대상은 parse()와 같은 줄 번호/순서로 에러
+    project.write("main.gyeol",
+                  "label start:\n"
+                  "    jump later\n"
+                  "label middle:\n"
+                  "    menu:\n"
+                  "        \"Go\" -> nowhere\n"
+                  "    if x > 1 -> start else missing_else\n"
+                  "label later:\n"
+                  "    call ghost_call\n");
+    const std::string mainPath = project.path("main.gyeol");
+    auto objectApi = parseWithImportThreads(mainPath, 1);
+    ASSERT_FALSE(objectApi.ok);
+    ASSERT_EQ(objectApi.errors.size(), 3u);
+    expectSameOutcome(objectApi, parseStreaming(mainPath));
+
+    // 파싱 에러(중복 label)가 있으면 버퍼를 만들지 않는다
+    project.write("main.gyeol",
+                  "label start:\n"
+                  "    jump start\n"
+                  "label start:\n"
+                  "    \"dup\"\n");
+    size_t streamedBytes = 1;
+    auto dup = parseStreaming(mainPath, &streamedBytes);
+    EXPECT_FALSE(dup.ok);
+    EXPECT_EQ(streamedBytes, 0u);
+    expectSameOutcome(parseWithImportThreads(mainPath, 1), dup);
+}
+
 // ===================================================================
 // Function Parameters (함수 매개변수) 파서 테스트
 // ===================================================================
@@ -2656,6 +3142,37 @@ label start:
     EXPECT_EQ(setvar->value_type(), ValueData::ListValue);
 }
 
+TEST(ParserEdgeCaseTest, FileAndStringParsingProduceSameStory) {
+    // BOM + CRLF + 마지막 줄 개행 없음 + 이스케이프/비이스케이프 문자열 혼합
+    const std::string source =
+        "\xEF\xBB\xBF$ gold = 3\r\n"
+        "label start:\r\n"
+        "    hero \"plain line\"\r\n"
+        "    \"say \\\"hi\\\"\\n\"\r\n"
+        "    \"unterminated\r\n"
+        "    menu:\r\n"
+        "        \"Go\" -> start if gold #once\r\n"
+        "    jump start";
+
+    const std::string path = "test_file_vs_string.gyeol";
+    { std::ofstream ofs(path, std::ios::binary); ofs << source; }
+
+    Parser fromFile;
+    ASSERT_TRUE(fromFile.parse(path)) << fromFile.getError();
+    Parser fromString;
+    ASSERT_TRUE(fromString.parseString(source)) << fromString.getError();
+    std::remove(path.c_str());
+
+    EXPECT_EQ(fromFile.getStory().string_pool, fromString.getStory().string_pool);
+    EXPECT_EQ(fromFile.getStory().line_ids, fromString.getStory().line_ids);
+    ASSERT_EQ(fromFile.getStory().nodes.size(), 1u);
+    EXPECT_EQ(fromFile.getStory().nodes[0]->lines.size(), fromString.getStory().nodes[0]->lines.size());
+
+    const auto& pool = fromString.getStory().string_pool;
+    EXPECT_NE(std::find(pool.begin(), pool.end(), "say \"hi\"\n"), pool.end());
+    EXPECT_NE(std::find(pool.begin(), pool.end(), "unterminated"), pool.end());
+}
+
 // ============================================================
 // --- 캐릭터 정의 블록 테스트 ---
 // ============================================================
@@ -3029,6 +3546,524 @@ TEST(AnalyzerTest, OptimizeConstantFolding) {
     std::remove(path.c_str());
 }
 
+TEST(AnalyzerTest, OptimizeFoldsFloatAndMixedExpressions) {
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(
+        "label start:\n"
+        "    $ f = 1.5 * 2\n"
+        "    $ g = -(0.5 + 1)\n"
+        "    $ n = 7 / 0\n"
+        "    $ m = 7.5 % 2\n"
+        "    narrator \"done\"\n"));
+
+    Gyeol::CompilerAnalyzer analyzer;
+    Gyeol::AnalysisReport report;
+    analyzer.optimize(parser.getStoryMutable(), 1, &report);
+    EXPECT_EQ(report.optimizations.foldedExpressions, 4);
+
+    const auto& lines = parser.getStory().nodes[0]->lines;
+    auto* f = lines[0]->data.AsSetVar();
+    EXPECT_EQ(f->expr.get(), nullptr);
+    ASSERT_EQ(f->value.type, ValueData::FloatValue);
+    EXPECT_FLOAT_EQ(f->value.AsFloatValue()->val, 3.0f);
+    auto* g = lines[1]->data.AsSetVar();
+    ASSERT_EQ(g->value.type, ValueData::FloatValue);
+    EXPECT_FLOAT_EQ(g->value.AsFloatValue()->val, -1.5f);
+    // 런타임과 같이 0으로 나누면 0, float % 는 정수 나머지
+    auto* n = lines[2]->data.AsSetVar();
+    ASSERT_EQ(n->value.type, ValueData::IntValue);
+    EXPECT_EQ(n->value.AsIntValue()->val, 0);
+    auto* m = lines[3]->data.AsSetVar();
+    ASSERT_EQ(m->value.type, ValueData::IntValue);
+    EXPECT_EQ(m->value.AsIntValue()->val, 1);
+}
+
+TEST(AnalyzerTest, OptimizeKeepsUndefinedRuntimeCombinations) {
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(
+        "label start:\n"
+        "    $ s = \"a\" + 1\n"
+        "    $ flag = true\n"
+        "    if flag == 1.5 -> yes else no\n"
+        "\n"
+        "label yes:\n"
+        "    narrator \"yes\"\n"
+        "\n"
+        "label no:\n"
+        "    narrator \"no\"\n"));
+
+    Gyeol::CompilerAnalyzer analyzer;
+    Gyeol::AnalysisReport report;
+    analyzer.optimize(parser.getStoryMutable(), 2, &report);
+    // 문자열 산술, BOOL과 FLOAT 비교는 런타임 결과가 정해져 있지 않아 남겨 둔다
+    EXPECT_EQ(report.optimizations.foldedConditions, 0);
+    const auto& story = parser.getStory();
+    EXPECT_NE(story.nodes[0]->lines[0]->data.AsSetVar()->expr.get(), nullptr);
+    EXPECT_EQ(story.nodes[0]->lines[2]->data.type, OpData::Condition);
+    EXPECT_EQ(story.nodes.size(), 3u);
+}
+
+TEST(AnalyzerTest, OptimizeO2FoldsStringConditions) {
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(
+        "label start:\n"
+        "    $ name = \"hero\"\n"
+        "    if name == \"villain\" -> boss\n"
+        "    narrator \"hello {name}\"\n"
+        "\n"
+        "label boss:\n"
+        "    narrator \"boss\"\n"));
+
+    Gyeol::CompilerAnalyzer analyzer;
+    Gyeol::AnalysisReport report;
+    analyzer.optimize(parser.getStoryMutable(), 2, &report);
+    // 항상 거짓 + else 없음 → Condition 삭제, boss는 도달 불가
+    EXPECT_EQ(report.optimizations.foldedConditions, 1);
+    EXPECT_EQ(report.optimizations.removedUnreachableNodes, 1);
+    const auto& story = parser.getStory();
+    ASSERT_EQ(story.nodes.size(), 1u);
+    ASSERT_EQ(story.nodes[0]->lines.size(), 2u);
+    EXPECT_EQ(story.nodes[0]->lines[1]->data.type, OpData::Line);
+}
+
+TEST(AnalyzerTest, OptimizeO2PropagatesAndFoldsConditions) {
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(
+        "label start:\n"
+        "    $ hp = 10\n"
+        "    $ dmg = hp * 2\n"
+        "    if dmg > 15 -> strong else weak\n"
+        "\n"
+        "label strong:\n"
+        "    narrator \"strong {dmg}\"\n"
+        "\n"
+        "label weak:\n"
+        "    narrator \"weak\"\n"));
+
+    Gyeol::CompilerAnalyzer analyzer;
+    Gyeol::AnalysisReport report;
+    analyzer.optimize(parser.getStoryMutable(), 2, &report);
+    EXPECT_GE(report.optimizations.propagatedConstants, 2);
+    EXPECT_EQ(report.optimizations.foldedConditions, 1);
+    EXPECT_EQ(report.optimizations.removedUnreachableNodes, 1);
+
+    const auto& story = parser.getStory();
+    ASSERT_EQ(story.nodes.size(), 2u);
+    EXPECT_EQ(story.nodes[1]->name, "strong");
+    const auto& lines = story.nodes[0]->lines;
+    ASSERT_EQ(lines.size(), 3u);
+    auto* dmg = lines[1]->data.AsSetVar();
+    EXPECT_EQ(dmg->expr.get(), nullptr);
+    EXPECT_EQ(dmg->value.AsIntValue()->val, 20);
+    ASSERT_EQ(lines[2]->data.type, OpData::Jump);
+    EXPECT_FALSE(lines[2]->data.AsJump()->is_call);
+    EXPECT_EQ(story.string_pool[lines[2]->data.AsJump()->target_node_name_id], "strong");
+}
+
+TEST(AnalyzerTest, OptimizeO2StopsPropagationAtHostYield) {
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(
+        "label start:\n"
+        "    $ gold = 1\n"
+        "    narrator \"pause\"\n"
+        "    $ total = gold + 1\n"
+        "    narrator \"{total}\"\n"));
+
+    Gyeol::CompilerAnalyzer analyzer;
+    Gyeol::AnalysisReport report;
+    analyzer.optimize(parser.getStoryMutable(), 2, &report);
+    // Line 뒤에서는 호스트가 gold를 바꿀 수 있으므로 식이 남아야 한다
+    EXPECT_EQ(report.optimizations.propagatedConstants, 0);
+    EXPECT_NE(parser.getStory().nodes[0]->lines[2]->data.AsSetVar()->expr.get(), nullptr);
+}
+
+TEST(AnalyzerTest, OptimizeO2MatchesO0AtBudgetYields) {
+    const char* script =
+        "label start:\n"
+        "    $ hp = 10\n"
+        "    $ dmg = hp * 2\n"
+        "    $ c = 0\n"
+        "    if hp == 10 -> hit else miss\n"
+        "\n"
+        "label hit:\n"
+        "    $ c = 5\n"
+        "    $ c = 3\n"
+        "    $ dmg = hp * 2\n"
+        "    narrator \"{dmg} {c}\"\n"
+        "    $ total = dmg + c\n"
+        "    narrator \"{total}\"\n"
+        "\n"
+        "label miss:\n"
+        "    narrator \"miss\"\n";
+
+    // 명령 예산 1: 예산 검사 지점(노드 진입, SetVar/Condition/Jump가 아닌 명령 앞)마다 budget YIELD가 난다.
+    // -O2는 조건을 점프로 접고 c = 5를 지우지만, 모든 YIELD에서 변수 값이 -O0과 같아야 한다.
+    auto transcript = [&](int level, bool predecoded) {
+        Gyeol::Parser parser;
+        EXPECT_TRUE(parser.parseString(script));
+        if (level > 0) {
+            Gyeol::CompilerAnalyzer analyzer;
+            Gyeol::AnalysisReport report;
+            analyzer.optimize(parser.getStoryMutable(), level, &report);
+            EXPECT_GT(report.optimizations.foldedConditions, 0);
+            EXPECT_GT(report.optimizations.removedDeadStores, 0);
+        }
+        const auto buf = parser.compileToBuffer();
+        std::vector<std::string> out;
+        Runner runner;
+        runner.setPredecodedDispatch(predecoded);
+        runner.setInstructionBudget(1);
+        if (!GyeolTest::startRunner(runner, buf)) return out;
+        for (int guard = 0; guard < 100 && !runner.isFinished(); ++guard) {
+            auto r = runner.step();
+            std::string entry = std::to_string(static_cast<int>(r.type));
+            if (r.budgetExhausted) entry += "(budget)";
+            if (r.type == StepType::LINE) entry += std::string(":") + r.line.text;
+            for (const char* name : {"hp", "dmg", "c", "total"}) {
+                entry += std::string(" ") + name + "=" + std::to_string(runner.getVariable(name).i);
+            }
+            // 예산 YIELD에서 호스트가 바꾼 값도 -O2에서 이후 식에 반영된다
+            if (r.budgetExhausted && out.empty()) runner.setVariable("hp", Variant::Int(50));
+            out.push_back(entry);
+        }
+        EXPECT_EQ(runner.getVariable("total").i, 103) << level;
+        return out;
+    };
+
+    const auto o0 = transcript(0, false);
+    // hit 진입, 첫 대사 앞, 둘째 대사 앞의 budget YIELD + 대사 2개 + END
+    ASSERT_EQ(o0.size(), 6u);
+    EXPECT_EQ(o0[0], "4(budget) hp=10 dmg=20 c=0 total=0");
+    EXPECT_EQ(o0[1], "4(budget) hp=50 dmg=100 c=3 total=0");
+    for (bool predecoded : {false, true}) {
+        EXPECT_EQ(transcript(0, predecoded), o0) << predecoded;
+        EXPECT_EQ(transcript(2, predecoded), o0) << predecoded;
+    }
+}
+
+TEST(AnalyzerTest, OptimizeO2RemovesDeadStores) {
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(
+        "label start:\n"
+        "    $ a = gold\n"
+        "    $ b = a + 1\n"
+        "    $ a = 2\n"
+        "    $ c = 0\n"
+        "    $ c = 3\n"
+        "    narrator \"{a} {b} {c}\"\n"));
+
+    Gyeol::CompilerAnalyzer analyzer;
+    Gyeol::AnalysisReport report;
+    analyzer.optimize(parser.getStoryMutable(), 2, &report);
+    // 'a = gold'는 b가 읽으므로 남고, 'c = 0'만 지워진다
+    EXPECT_EQ(report.optimizations.removedDeadStores, 1);
+    const auto& story = parser.getStory();
+    const auto& lines = story.nodes[0]->lines;
+    ASSERT_EQ(lines.size(), 5u);
+    EXPECT_EQ(story.string_pool[lines[3]->data.AsSetVar()->var_name_id], "c");
+    EXPECT_EQ(lines[3]->data.AsSetVar()->value.AsIntValue()->val, 3);
+}
+
+TEST(AnalyzerTest, OptimizeO2ThreadsJumpChains) {
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(
+        "label start:\n"
+        "    if go == 1 -> hop1 else counted\n"
+        "    menu:\n"
+        "        \"again\" -> hop2\n"
+        "\n"
+        "label hop1:\n"
+        "    jump hop2\n"
+        "\n"
+        "label hop2:\n"
+        "    jump finale\n"
+        "\n"
+        "label counted:\n"
+        "    jump finale\n"
+        "\n"
+        "label finale:\n"
+        "    $ n = visit_count(\"counted\")\n"
+        "    narrator \"{n}\"\n"));
+
+    Gyeol::CompilerAnalyzer analyzer;
+    analyzer.setVisitCountsUnobserved(true);
+    Gyeol::AnalysisReport report;
+    analyzer.optimize(parser.getStoryMutable(), 2, &report);
+    // Condition의 hop1 → finale, hop1의 jump → finale.
+    // visit_count로 읽히는 counted, choose()가 멈추는 Choice 대상 hop2는 그대로 둔다.
+    EXPECT_EQ(report.optimizations.threadedJumps, 2);
+    EXPECT_EQ(report.optimizations.removedUnreachableNodes, 1);
+
+    const auto& story = parser.getStory();
+    const auto& lines = story.nodes[0]->lines;
+    auto* cond = lines[0]->data.AsCondition();
+    EXPECT_EQ(story.string_pool[cond->true_jump_node_id], "finale");
+    EXPECT_EQ(story.string_pool[cond->false_jump_node_id], "counted");
+    EXPECT_EQ(story.string_pool[lines[1]->data.AsChoice()->target_node_name_id], "hop2");
+    std::vector<std::string> names;
+    for (const auto& node : story.nodes) names.push_back(node->name);
+    EXPECT_EQ(names, (std::vector<std::string>{"start", "hop2", "counted", "finale"}));
+}
+
+TEST(AnalyzerTest, OptimizeO2InlinesSmallCalls) {
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(
+        "label start:\n"
+        "    $ r = call add(2, x)\n"
+        "    call bump\n"
+        "    $ w = call writes_param(1)\n"
+        "    narrator \"{r} {w} {count}\"\n"
+        "\n"
+        "label add(a, b):\n"
+        "    $ last = a\n"
+        "    return a + b\n"
+        "\n"
+        "label bump:\n"
+        "    $ count = count + 1\n"
+        "\n"
+        "label writes_param(p):\n"
+        "    $ p = p + 1\n"
+        "    return p\n"));
+
+    Gyeol::CompilerAnalyzer analyzer;
+    analyzer.setVisitCountsUnobserved(true);
+    Gyeol::AnalysisReport report;
+    analyzer.optimize(parser.getStoryMutable(), 2, &report);
+    // 매개변수에 쓰는 writes_param은 섀도잉을 지킬 수 없어 호출로 남는다
+    EXPECT_EQ(report.optimizations.inlinedCalls, 2);
+    EXPECT_EQ(report.optimizations.removedUnreachableNodes, 2);
+
+    const auto& story = parser.getStory();
+    const auto& lines = story.nodes[0]->lines;
+    ASSERT_EQ(lines.size(), 5u);
+    // $ last = 2 / $ r = 2 + x / $ count = count + 1 / call writes_param / Line
+    auto* last = lines[0]->data.AsSetVar();
+    EXPECT_EQ(story.string_pool[last->var_name_id], "last");
+    EXPECT_EQ(last->value.AsIntValue()->val, 2);
+    auto* r = lines[1]->data.AsSetVar();
+    EXPECT_EQ(story.string_pool[r->var_name_id], "r");
+    ASSERT_NE(r->expr.get(), nullptr);
+    ASSERT_EQ(r->expr->tokens.size(), 3u);
+    EXPECT_EQ(story.string_pool[r->expr->tokens[1]->var_name_id], "x");
+    EXPECT_EQ(story.string_pool[lines[2]->data.AsSetVar()->var_name_id], "count");
+    EXPECT_EQ(lines[3]->data.type, OpData::CallWithReturn);
+}
+
+TEST(AnalyzerTest, OptimizeO2InlinesLongerHotCallTargets) {
+    std::string source =
+        "label start:\n"
+        "    call setup\n"
+        "    narrator \"{v9}\"\n"
+        "\n"
+        "label setup:\n";
+    for (int i = 0; i < 10; ++i) source += "    $ v" + std::to_string(i) + " = x + " + std::to_string(i) + "\n";
+
+    for (bool hot : {false, true}) {
+        Gyeol::Parser parser;
+        ASSERT_TRUE(parser.parseString(source));
+        Gyeol::CompilerAnalyzer analyzer;
+        analyzer.setVisitCountsUnobserved(true);
+        if (hot) analyzer.setHotCallTargets({"setup"});
+        Gyeol::AnalysisReport report;
+        analyzer.optimize(parser.getStoryMutable(), 2, &report);
+        // 기본 한도(8)를 넘는 본문은 프로파일상 hot 대상일 때만 펼친다
+        EXPECT_EQ(report.optimizations.inlinedCalls, hot ? 1 : 0);
+        EXPECT_EQ(parser.getStory().nodes[0]->lines[0]->data.type, hot ? OpData::SetVar : OpData::Jump);
+    }
+}
+
+TEST(AnalyzerTest, SilentCostCountsInstructionsBetweenVisibleResults) {
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(
+        "label start:\n"
+        "    $ a = 1\n"
+        "    $ b = 2\n"
+        "    call helper\n"
+        "    narrator \"one\"\n"
+        "    $ c = 3\n"
+        "    if c > 2 -> tail\n"
+        "    narrator \"two\"\n"
+        "\n"
+        "label helper:\n"
+        "    $ h = 1\n"
+        "\n"
+        "label tail:\n"
+        "    $ d = 4\n"
+        "    narrator \"three\"\n"));
+
+    const auto costs = Gyeol::CompilerAnalyzer::analyzeSilentCost(parser.getStory());
+    auto find = [&](const std::string& node, uint32_t pc) -> const Gyeol::SilentPathCost* {
+        for (const auto& c : costs) {
+            if (c.nodeName == node && c.pc == pc) return &c;
+        }
+        return nullptr;
+    };
+    // a, b, call, helper의 h, 대사
+    const auto* entry = find("start", 0);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_FALSE(entry->unbounded);
+    EXPECT_EQ(entry->maxInstructions, 5u);
+    // 대사 다음: c, 조건, (tail) d, 대사
+    const auto* afterLine = find("start", 4);
+    ASSERT_NE(afterLine, nullptr);
+    EXPECT_EQ(afterLine->maxInstructions, 4u);
+    EXPECT_EQ(afterLine->path, (std::vector<std::string>{"start", "tail"}));
+    EXPECT_EQ(find("tail", 0)->maxInstructions, 2u);
+
+    Gyeol::CompilerAnalyzer analyzer;
+    auto report = analyzer.analyze(parser.getStory());
+    EXPECT_EQ(report.maxSilentInstructions, 5u);
+    EXPECT_TRUE(report.silentHotspots.empty());
+
+    analyzer.setSilentCostThreshold(4);
+    report = analyzer.analyze(parser.getStory());
+    ASSERT_EQ(report.silentHotspots.size(), 1u);
+    EXPECT_EQ(report.silentHotspots[0].nodeName, "start");
+    EXPECT_EQ(report.silentHotspots[0].pc, 0u);
+    bool warned = false;
+    for (const auto& issue : report.issues) {
+        if (issue.kind == Gyeol::AnalysisIssue::LONG_SILENT_PATH) warned = true;
+    }
+    EXPECT_TRUE(warned);
+}
+
+TEST(AnalyzerTest, SilentCostReportsLoopsWithoutVisibleResult) {
+    const std::string loop =
+        "label start:\n"
+        "    $ i = 0\n"
+        "    jump spin\n"
+        "\n"
+        "label spin:\n"
+        "    $ i = i + 1\n"
+        "    if i < 1000 -> again\n"
+        "    narrator \"done\"\n"
+        "\n"
+        "label again:\n";
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(loop + "    jump spin\n"));
+
+    Gyeol::CompilerAnalyzer analyzer;
+    auto report = analyzer.analyze(parser.getStory());
+    // start도 순환으로 들어가지만 순환마다 한 번만 보고한다
+    ASSERT_EQ(report.silentHotspots.size(), 1u);
+    const auto& hotspot = report.silentHotspots[0];
+    EXPECT_TRUE(hotspot.unbounded);
+    EXPECT_EQ(hotspot.nodeName, "spin");
+    EXPECT_EQ(hotspot.path, (std::vector<std::string>{"spin", "again"}));
+    bool warned = false;
+    for (const auto& issue : report.issues) {
+        if (issue.kind == Gyeol::AnalysisIssue::SILENT_LOOP && issue.nodeName == "spin") warned = true;
+    }
+    EXPECT_TRUE(warned);
+
+    // 순환 안에 yield가 있으면 유한
+    Gyeol::Parser withYield;
+    ASSERT_TRUE(withYield.parseString(loop + "    yield\n    jump spin\n"));
+    report = analyzer.analyze(withYield.getStory());
+    EXPECT_TRUE(report.silentHotspots.empty());
+    EXPECT_EQ(report.maxSilentInstructions, 5u); // start: i, jump, (spin) i, 조건, (again) yield
+}
+
+TEST(AnalyzerTest, OptimizeO2KeepsVisitObservedCallees) {
+    Gyeol::Parser parser;
+    ASSERT_TRUE(parser.parseString(
+        "label start:\n"
+        "    call bump\n"
+        "    $ times = visit_count(\"bump\")\n"
+        "    narrator \"{times}\"\n"
+        "\n"
+        "label bump:\n"
+        "    $ count = count + 1\n"));
+
+    Gyeol::CompilerAnalyzer analyzer;
+    analyzer.setVisitCountsUnobserved(true);
+    Gyeol::AnalysisReport report;
+    analyzer.optimize(parser.getStoryMutable(), 2, &report);
+    EXPECT_EQ(report.optimizations.inlinedCalls, 0);
+    EXPECT_EQ(parser.getStory().nodes[0]->lines[0]->data.type, OpData::Jump);
+    EXPECT_EQ(parser.getStory().nodes.size(), 2u);
+}
+
+TEST(AnalyzerTest, OptimizeO2KeepsHostVisibleVisitCounts) {
+    const char* script =
+        "label start:\n"
+        "    call bump\n"
+        "    if go == 0 -> hop\n"
+        "    narrator \"skipped\"\n"
+        "\n"
+        "label bump:\n"
+        "    $ count = count + 1\n"
+        "\n"
+        "label hop:\n"
+        "    jump finale\n"
+        "\n"
+        "label finale:\n"
+        "    narrator \"{count}\"\n";
+
+    auto visits = [&](int level, bool unobserved, Gyeol::AnalysisReport* report) {
+        Gyeol::Parser parser;
+        EXPECT_TRUE(parser.parseString(script));
+        if (level > 0) {
+            Gyeol::CompilerAnalyzer analyzer;
+            analyzer.setVisitCountsUnobserved(unobserved);
+            analyzer.optimize(parser.getStoryMutable(), level, report);
+        }
+        const auto buf = parser.compileToBuffer();
+        std::vector<int32_t> out;
+        Runner runner;
+        if (!GyeolTest::startRunner(runner, buf)) return out;
+        while (!runner.isFinished()) runner.step();
+        for (const char* node : {"start", "bump", "hop", "finale"}) out.push_back(runner.getVisitCount(node));
+        return out;
+    };
+
+    const auto o0 = visits(0, false, nullptr);
+    EXPECT_EQ(o0, (std::vector<int32_t>{1, 1, 1, 1}));
+    // 기본값은 모든 노드의 방문 수를 호스트가 본다고 가정한다
+    Gyeol::AnalysisReport report;
+    EXPECT_EQ(visits(2, false, &report), o0);
+    EXPECT_EQ(report.optimizations.inlinedCalls, 0);
+    EXPECT_EQ(report.optimizations.threadedJumps, 0);
+
+    // 켜면 펼친 bump, 건너뛴 hop의 방문 수는 늘지 않는다
+    Gyeol::AnalysisReport unobserved;
+    EXPECT_EQ(visits(2, true, &unobserved), (std::vector<int32_t>{1, 0, 0, 1}));
+    EXPECT_EQ(unobserved.optimizations.inlinedCalls, 1);
+    EXPECT_EQ(unobserved.optimizations.threadedJumps, 1);
+}
+
+TEST(AnalyzerTest, OptimizeLevelZeroAndOneLeaveO2PassesAlone) {
+    const std::string source =
+        "label start:\n"
+        "    $ a = 1\n"
+        "    $ a = 2\n"
+        "    narrator \"{a}\"\n"
+        "\n"
+        "label orphan:\n"
+        "    narrator \"never\"\n";
+
+    Gyeol::Parser p0;
+    ASSERT_TRUE(p0.parseString(source));
+    Gyeol::CompilerAnalyzer analyzer;
+    EXPECT_EQ(analyzer.optimize(p0.getStoryMutable(), 0), 0);
+
+    Gyeol::Parser p1;
+    ASSERT_TRUE(p1.parseString(source));
+    Gyeol::AnalysisReport report;
+    analyzer.optimize(p1.getStoryMutable(), 1, &report);
+    EXPECT_EQ(report.optimizations.removedDeadStores, 0);
+    EXPECT_EQ(report.optimizations.removedUnreachableNodes, 0);
+    EXPECT_EQ(p1.getStory().nodes.size(), 2u);
+
+    std::ostringstream oss;
+    Gyeol::Parser p2;
+    ASSERT_TRUE(p2.parseString(source));
+    analyzer.optimize(p2.getStoryMutable(), 2, &report);
+    Gyeol::CompilerAnalyzer::printReport(report, oss);
+    EXPECT_NE(oss.str().find("[Optimizations Applied]"), std::string::npos);
+    EXPECT_NE(oss.str().find("Removed unreachable nodes: 1"), std::string::npos);
+}
+
 TEST(AnalyzerTest, ReportOutput) {
     std::string path = "test_ana_report.gyeol";
     {
@@ -1,9 +1,19 @@
-#include <gtest/gtest.h>
+﻿#include <gtest/gtest.h>
 #include "test_helpers.h"
 #include "gyeol_runner.h"
 #include "gyeol_generated.h"
+#include "gyeol_chunk_tools.h"
+#include "gyeol_compact_tools.h"
+#include "gyeol_layout_tools.h"
+#include "gyeol_node_names.h"
+#include "gyeol_pool_codec.h"
+#include "gyeol_pool_tools.h"
+#include "gyeol_profile_tools.h"
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <set>
+#include <thread>
+#include <filesystem>
 #include <fstream>
 #include <unordered_map>
 
@@ -885,6 +895,125 @@ TEST(RunnerTest, CondOrTrue) {
     EXPECT_STREQ(r.line.text, "yes");
 }
 
+TEST(RunnerTest, CondOrSkipsRightOperand) {
+    auto buf = GyeolTest::compileScript(
+        "label start:\n"
+        "    if ready == true or hp > 0 -> yes else no\n"
+        "\n"
+        "label yes:\n"
+        "    \"yes\"\n"
+        "label no:\n"
+        "    \"no\"\n"
+    );
+    std::unique_ptr<ICPDev::Gyeol::Schema::StoryT> story(ICPDev::Gyeol::Schema::GetStory(buf.data())->UnPack());
+    auto* cond = story->nodes[0]->lines[0]->data.AsCondition();
+    ASSERT_NE(cond, nullptr);
+    ASSERT_NE(cond->cond_expr, nullptr);
+    auto& toks = cond->cond_expr->tokens;
+    ASSERT_EQ(toks.size(), 8u);
+    ASSERT_EQ(toks[3]->op, ICPDev::Gyeol::Schema::ExprOp::SkipIfTrue);
+
+    // 오른쪽 피연산자를 평가하면 스택 underflow(→ 0)가 나도록 바꾼다
+    toks.erase(toks.begin() + 4, toks.begin() + 7);
+    auto broken = std::make_unique<ICPDev::Gyeol::Schema::ExprTokenT>();
+    broken->op = ICPDev::Gyeol::Schema::ExprOp::Add;
+    toks.insert(toks.begin() + 4, std::move(broken));
+    toks[3]->skip = 2;
+    flatbuffers::FlatBufferBuilder builder;
+    builder.Finish(ICPDev::Gyeol::Schema::Story::Pack(builder, story.get()));
+    std::vector<uint8_t> patched(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+
+    // 왼쪽이 참이면 오른쪽은 실행되지 않는다
+    Runner skipped;
+    ASSERT_TRUE(GyeolTest::startRunner(skipped, patched));
+    skipped.setVariable("ready", Variant::Bool(true));
+    EXPECT_STREQ(skipped.step().line.text, "yes");
+
+    // 왼쪽이 거짓이면 오른쪽까지 평가한다
+    Runner evaluated;
+    ASSERT_TRUE(GyeolTest::startRunner(evaluated, patched));
+    evaluated.setVariable("ready", Variant::Bool(false));
+    EXPECT_STREQ(evaluated.step().line.text, "no");
+}
+
+TEST(RunnerTest, UnlinkedStoryRunsByName) {
+    const char* script =
+        "label start:\n"
+        "    \"a\"\n"
+        "    if n > 0 -> second else third\n"
+        "label second:\n"
+        "    \"b\"\n"
+        "    jump third\n"
+        "label third:\n"
+        "    \"c\"\n";
+    auto linked = GyeolTest::compileScript(script);
+    ASSERT_FALSE(linked.empty());
+
+    // 이전 형식 버퍼: 인덱스와 이름 표가 없으면 이름으로 찾는다
+    std::unique_ptr<ICPDev::Gyeol::Schema::StoryT> story(ICPDev::Gyeol::Schema::GetStory(linked.data())->UnPack());
+    auto* cond = story->nodes[0]->lines[1]->data.AsCondition();
+    ASSERT_NE(cond, nullptr);
+    cond->true_jump_node_index = -1;
+    cond->false_jump_node_index = -1;
+    auto* jump = story->nodes[1]->lines[1]->data.AsJump();
+    ASSERT_NE(jump, nullptr);
+    jump->target_node_index = -1;
+    story->node_names.reset();
+    flatbuffers::FlatBufferBuilder builder;
+    builder.Finish(ICPDev::Gyeol::Schema::Story::Pack(builder, story.get()));
+    std::vector<uint8_t> unlinked(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+
+    // 범위 밖 인덱스도 이름 경로로 돌아간다
+    jump->target_node_index = 99;
+    builder.Clear();
+    builder.Finish(ICPDev::Gyeol::Schema::Story::Pack(builder, story.get()));
+    std::vector<uint8_t> badIndex(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+
+    // 다른 노드를 가리키는 인덱스(이름 불일치)는 믿지 않고 이름 표로 찾는다
+    std::unique_ptr<ICPDev::Gyeol::Schema::StoryT> stale(ICPDev::Gyeol::Schema::GetStory(linked.data())->UnPack());
+    ASSERT_NE(stale->node_names, nullptr);
+    stale->nodes[1]->lines[1]->data.AsJump()->target_node_index = 0;
+    builder.Clear();
+    builder.Finish(ICPDev::Gyeol::Schema::Story::Pack(builder, stale.get()));
+    std::vector<uint8_t> staleIndex(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+
+    for (const auto* buf : {&linked, &unlinked, &badIndex, &staleIndex}) {
+        for (bool predecoded : {false, true}) {
+            Runner runner;
+            runner.setPredecodedDispatch(predecoded);
+            ASSERT_TRUE(GyeolTest::startRunner(runner, *buf));
+            runner.setVariable("n", Variant::Int(1));
+            EXPECT_STREQ(runner.step().line.text, "a");
+            EXPECT_STREQ(runner.step().line.text, "b");
+            EXPECT_STREQ(runner.step().line.text, "c");
+            EXPECT_EQ(runner.step().type, StepType::END);
+            EXPECT_EQ(runner.getVisitCount("third"), 1);
+        }
+    }
+}
+
+TEST(RunnerTest, CondShortCircuitTruthTable) {
+    const char* script =
+        "label start:\n"
+        "    if (a == true and b == true) or not (a == true or b == true) -> yes else no\n"
+        "\n"
+        "label yes:\n"
+        "    \"yes\"\n"
+        "label no:\n"
+        "    \"no\"\n";
+    auto buf = GyeolTest::compileScript(script);
+    for (int a = 0; a < 2; ++a) {
+        for (int b = 0; b < 2; ++b) {
+            Runner runner;
+            ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+            runner.setVariable("a", Variant::Bool(a != 0));
+            runner.setVariable("b", Variant::Bool(b != 0));
+            const bool expected = (a && b) || !(a || b);
+            EXPECT_STREQ(runner.step().line.text, expected ? "yes" : "no") << a << b;
+        }
+    }
+}
+
 TEST(RunnerTest, CondNotTrue) {
     // not game_over == true: game_over=false → false == true → false → not false → true
     auto buf = GyeolTest::compileScript(
@@ -1613,6 +1742,200 @@ TEST(RunnerTest, LocaleCatalogCharacterPropertyFallback) {
     std::remove(catalogPath.c_str());
 }
 
+TEST(RunnerTest, CompiledLocaleCatalogFallbackAndHotSwitch) {
+    auto buf = GyeolTest::compileScript(
+        "character hero:\n"
+        "    name: \"Hero Original\"\n"
+        "label start:\n"
+        "    hero \"Line A\"\n"
+        "    hero \"Line B\"\n"
+    );
+    ASSERT_FALSE(buf.empty());
+
+    std::string lineAId = findLineIdForText(buf, "Line A");
+    std::string lineBId = findLineIdForText(buf, "Line B");
+    ASSERT_FALSE(lineAId.empty());
+    ASSERT_FALSE(lineBId.empty());
+
+    auto writeLocaleV2 = [](const std::string& path, const std::string& locale, const json& lines, const json& chars) {
+        json j;
+        j["format"] = "gyeol-locale";
+        j["version"] = 2;
+        j["locale"] = locale;
+        j["line_entries"] = lines;
+        j["character_entries"] = chars;
+        std::ofstream ofs(path);
+        ofs << j.dump(2);
+    };
+    writeLocaleV2("test_compiled_en.json", "en",
+                  {{lineAId, "Hello EN"}, {lineBId, "Bye EN"}}, {{"hero", {{"name", "Hero EN"}}}});
+    writeLocaleV2("test_compiled_ko.json", "ko",
+                  {{lineAId, "안녕 KO"}}, {{"hero", {{"name", "용사"}}}});
+    writeLocaleV2("test_compiled_ko_KR.json", "ko-KR",
+                  {{lineBId, "잘가 KR"}}, {{"hero", {{"displayName", "한국 주인공"}}}});
+
+    std::unique_ptr<ICPDev::Gyeol::Schema::StoryT> story(ICPDev::Gyeol::Schema::GetStory(buf.data())->UnPack());
+    std::string catalogPath = "test_locale_catalog.gylc";
+    std::string err;
+    ASSERT_TRUE(LocaleTools::buildLocaleCatalogBinary(
+        {"test_compiled_en.json", "test_compiled_ko.json", "test_compiled_ko_KR.json"},
+        *story, catalogPath, "en", &err)) << err;
+
+    Runner runner;
+    ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+    ASSERT_TRUE(runner.loadLocaleCatalog(catalogPath)) << runner.getLastError();
+    EXPECT_EQ(runner.getResolvedLocale(), "en");
+
+    ASSERT_TRUE(runner.setLocale("ko-KR"));
+    EXPECT_EQ(runner.getResolvedLocale(), "ko-KR");
+    EXPECT_EQ(runner.getCharacterProperty("hero", "name"), "용사");
+    EXPECT_EQ(runner.getCharacterDisplayName("hero"), "한국 주인공");
+
+    auto r1 = runner.step();
+    ASSERT_EQ(r1.type, StepType::LINE);
+    EXPECT_STREQ(r1.line.text, "안녕 KO"); // exact miss -> base ko
+
+    ASSERT_TRUE(runner.setLocale("fr-FR")); // exact/base miss -> default en
+    EXPECT_EQ(runner.getResolvedLocale(), "en");
+    auto r2 = runner.step();
+    ASSERT_EQ(r2.type, StepType::LINE);
+    EXPECT_STREQ(r2.line.text, "Bye EN");
+
+    // 다른 스토리에 붙이면 string_pool 불일치로 거부
+    auto otherBuf = GyeolTest::compileScript("label start:\n    \"x\"\n");
+    Runner other;
+    ASSERT_TRUE(GyeolTest::startRunner(other, otherBuf));
+    EXPECT_FALSE(other.loadLocaleCatalog(catalogPath));
+
+    std::remove("test_compiled_en.json");
+    std::remove("test_compiled_ko.json");
+    std::remove("test_compiled_ko_KR.json");
+    std::remove(catalogPath.c_str());
+}
+
+TEST(RunnerTest, LocaleCatalogSwitchReusesResolvedTable) {
+    auto buf = GyeolTest::compileScript(
+        "label start:\n"
+        "    hero \"Line A\"\n"
+        "    jump start\n"
+    );
+    ASSERT_FALSE(buf.empty());
+
+    std::string lineAId = findLineIdForText(buf, "Line A");
+    ASSERT_FALSE(lineAId.empty());
+
+    json locales = {
+        {"en", {{"line_entries", {{lineAId, "Hello EN"}}}}},
+        {"ko", {{"line_entries", {{lineAId, "안녕 KO"}}}}}
+    };
+
+    std::string catalogPath = "test_locale_catalog_switch.json";
+    writeLocaleCatalogJSON(catalogPath, "en", locales);
+
+    Runner runner;
+    ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+    ASSERT_TRUE(runner.loadLocaleCatalog(catalogPath));
+
+    ASSERT_TRUE(runner.setLocale("ko-KR"));
+    auto r1 = runner.step();
+    ASSERT_EQ(r1.type, StepType::LINE);
+    EXPECT_STREQ(r1.line.text, "안녕 KO");
+
+    ASSERT_TRUE(runner.setLocale("en"));
+    auto r2 = runner.step();
+    ASSERT_EQ(r2.type, StepType::LINE);
+    EXPECT_STREQ(r2.line.text, "Hello EN");
+
+    // 같은 locale로 돌아오면 이전에 만든 테이블을 그대로 사용한다
+    ASSERT_TRUE(runner.setLocale("ko-KR"));
+    EXPECT_EQ(runner.getResolvedLocale(), "ko");
+    auto r3 = runner.step();
+    ASSERT_EQ(r3.type, StepType::LINE);
+    EXPECT_EQ(r3.line.text, r1.line.text);
+
+    runner.clearLocale();
+    auto r4 = runner.step();
+    ASSERT_EQ(r4.type, StepType::LINE);
+    EXPECT_STREQ(r4.line.text, "Line A");
+
+    std::remove(catalogPath.c_str());
+}
+
+TEST(RunnerTest, SharedLocaleCatalogAcrossSessions) {
+    auto buf = GyeolTest::compileScript(
+        "label start:\n"
+        "    hero \"Line A\"\n"
+        "    jump start\n"
+    );
+    ASSERT_FALSE(buf.empty());
+
+    std::string lineAId = findLineIdForText(buf, "Line A");
+    ASSERT_FALSE(lineAId.empty());
+
+    json locales = {
+        {"en", {{"line_entries", {{lineAId, "Hello EN"}}}}},
+        {"ko", {{"line_entries", {{lineAId, "안녕 KO"}}}}}
+    };
+
+    std::string catalogPath = "test_locale_catalog_shared.json";
+    writeLocaleCatalogJSON(catalogPath, "en", locales);
+
+    std::string err;
+    std::shared_ptr<const LocaleCatalog> catalog =
+        LocaleCatalog::load(buf.data(), buf.size(), catalogPath, &err);
+    ASSERT_TRUE(catalog) << err;
+    std::remove(catalogPath.c_str());
+
+    Runner a;
+    Runner b;
+    ASSERT_TRUE(GyeolTest::startRunner(a, buf));
+    ASSERT_TRUE(GyeolTest::startRunner(b, buf));
+    ASSERT_TRUE(a.attachLocaleCatalog(catalog));
+    ASSERT_TRUE(b.attachLocaleCatalog(catalog));
+    EXPECT_EQ(a.getLocaleCatalog(), catalog);
+
+    ASSERT_TRUE(a.setLocale("ko-KR"));
+    auto ra = a.step();
+    auto rb = b.step();
+    ASSERT_EQ(ra.type, StepType::LINE);
+    ASSERT_EQ(rb.type, StepType::LINE);
+    EXPECT_STREQ(ra.line.text, "안녕 KO");
+    EXPECT_STREQ(rb.line.text, "Hello EN");
+
+    // 같은 locale은 세션 사이에서도 같은 해석 테이블을 공유한다
+    ASSERT_TRUE(b.setLocale("ko"));
+    auto rb2 = b.step();
+    ASSERT_EQ(rb2.type, StepType::LINE);
+    EXPECT_EQ(rb2.line.text, ra.line.text);
+
+    // 여러 스레드에서 각자의 Runner로 동시에 해석/진행
+    std::vector<std::thread> workers;
+    std::vector<int> ok(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&, t]() {
+            Runner runner;
+            if (!runner.start(buf.data(), buf.size())) return;
+            if (!runner.attachLocaleCatalog(catalog)) return;
+            if (!runner.setLocale((t % 2) ? "ko" : "en")) return;
+            const char* expected = (t % 2) ? "안녕 KO" : "Hello EN";
+            for (int i = 0; i < 50; ++i) {
+                auto r = runner.step();
+                if (r.type != StepType::LINE || std::string(r.line.text) != expected) return;
+            }
+            ok[static_cast<size_t>(t)] = 1;
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    for (int value : ok) EXPECT_EQ(value, 1);
+
+    // string_pool 크기가 다른 스토리에는 붙일 수 없다
+    auto otherBuf = GyeolTest::compileScript("label start:\n    \"x\"\n");
+    Runner other;
+    ASSERT_TRUE(GyeolTest::startRunner(other, otherBuf));
+    EXPECT_FALSE(other.attachLocaleCatalog(catalog));
+    EXPECT_FALSE(other.attachLocaleCatalog(nullptr));
+}
+
 // ========== 인라인 조건 텍스트 테스트 ==========
 
 TEST(RunnerTest, InlineCondTrue) {
@@ -4032,6 +4355,312 @@ label start:
 // 선택지 수식어 테스트
 // =============================================================================
 
+// --- Asset prefetch ---
+
+namespace {
+bool hasAsset(const std::vector<Runner::UpcomingAsset>& assets,
+              Runner::UpcomingAsset::Kind kind, const std::string& value,
+              uint32_t* distanceOut = nullptr) {
+    for (const auto& asset : assets) {
+        if (asset.kind == kind && asset.value == value) {
+            if (distanceOut) *distanceOut = asset.distance;
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
+TEST(RunnerAssetPrefetchTest, LineExposesVoiceAsset) {
+    auto buf = GyeolTest::compileScript(
+        "label start:\n"
+        "    hero \"hello\" #voice=hero_01.wav\n"
+        "    \"plain\"\n");
+    Runner runner;
+    ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+    auto r = runner.step();
+    ASSERT_EQ(r.type, StepType::LINE);
+    EXPECT_STREQ(r.line.voiceAsset, "hero_01.wav");
+    r = runner.step();
+    ASSERT_EQ(r.type, StepType::LINE);
+    EXPECT_EQ(r.line.voiceAsset, nullptr);
+}
+
+TEST(RunnerAssetPrefetchTest, WalksAllBranchesFromCurrentPosition) {
+    auto buf = GyeolTest::compileScript(R"(
+label start:
+    @ bg "room.png"
+    hero "hi" #voice=hi.wav
+    if hp > 0 -> alive else dead
+
+label alive:
+    call helper
+    menu:
+        "Left" -> left
+        "Right" -> right
+
+label dead:
+    @ bgm "sad.ogg"
+
+label helper:
+    @ sfx "click.wav"
+
+label left:
+    random:
+        1 -> forest
+        0 -> never
+
+label right:
+    @ bg cave
+
+label forest:
+    @ bg "forest.png"
+
+label never:
+    @ bg "never.png"
+)");
+    ASSERT_FALSE(buf.empty());
+
+    Runner runner;
+    ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+
+    auto assets = runner.predictUpcomingAssets(64);
+    using Kind = Runner::UpcomingAsset::Kind;
+    uint32_t distance = 0;
+    ASSERT_TRUE(hasAsset(assets, Kind::COMMAND, "room.png", &distance));
+    EXPECT_EQ(distance, 0u);
+    ASSERT_TRUE(hasAsset(assets, Kind::VOICE, "hi.wav", &distance));
+    EXPECT_EQ(distance, 1u);
+    EXPECT_TRUE(hasAsset(assets, Kind::COMMAND, "sad.ogg"));
+    EXPECT_TRUE(hasAsset(assets, Kind::COMMAND, "click.wav"));
+    EXPECT_TRUE(hasAsset(assets, Kind::COMMAND, "cave"));
+    EXPECT_TRUE(hasAsset(assets, Kind::COMMAND, "forest.png"));
+    EXPECT_FALSE(hasAsset(assets, Kind::COMMAND, "never.png")); // weight 0
+    for (size_t i = 1; i < assets.size(); ++i) {
+        EXPECT_LE(assets[i - 1].distance, assets[i].distance);
+    }
+
+    // 예산이 작으면 가까운 에셋만
+    auto nearOnly = runner.predictUpcomingAssets(2);
+    EXPECT_TRUE(hasAsset(nearOnly, Kind::COMMAND, "room.png"));
+    EXPECT_TRUE(hasAsset(nearOnly, Kind::VOICE, "hi.wav"));
+    EXPECT_FALSE(hasAsset(nearOnly, Kind::COMMAND, "forest.png"));
+
+    // 실행이 진행되면 지나간 에셋은 빠진다
+    ASSERT_EQ(runner.step().type, StepType::COMMAND);
+    assets = runner.predictUpcomingAssets(64);
+    EXPECT_FALSE(hasAsset(assets, Kind::COMMAND, "room.png"));
+    EXPECT_TRUE(hasAsset(assets, Kind::VOICE, "hi.wav"));
+}
+
+TEST(RunnerAssetPrefetchTest, FollowsPendingChoicesAndCallStack) {
+    auto buf = GyeolTest::compileScript(R"(
+label start:
+    call scene
+    @ bg "after_call.png"
+
+label scene:
+    menu:
+        "A" -> a
+        "B" -> b
+
+label a:
+    @ bg "a.png"
+
+label b:
+    @ bg "b.png"
+)");
+    ASSERT_FALSE(buf.empty());
+
+    Runner runner;
+    ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+    ASSERT_EQ(runner.step().type, StepType::CHOICES);
+
+    using Kind = Runner::UpcomingAsset::Kind;
+    auto assets = runner.predictUpcomingAssets(64);
+    EXPECT_TRUE(hasAsset(assets, Kind::COMMAND, "a.png"));
+    EXPECT_TRUE(hasAsset(assets, Kind::COMMAND, "b.png"));
+    // a/b 노드 끝에서 call stack을 따라 호출자로 복귀
+    EXPECT_TRUE(hasAsset(assets, Kind::COMMAND, "after_call.png"));
+}
+
+// --- Lazy chunk loading ---
+
+namespace {
+// main + chapter 파일을 청크로 나눠 dir에 쓴다
+bool exportChunkFixture(const std::string& dir) {
+    std::vector<std::pair<std::string, std::string>> files = {
+        {"test_chunk_ch1.gyeol",
+         "label ch1_intro:\n"
+         "    hero \"chapter one\"\n"
+         "    $ x = call helper\n"
+         "    hero \"back in one\"\n"
+         "    jump ch2_intro\n"
+         "\n"
+         "label helper #chapter=util:\n"
+         "    return 7\n"},
+        {"test_chunk_ch2.gyeol",
+         "label ch2_intro:\n"
+         "    hero \"chapter two\"\n"},
+        {"test_chunk_main.gyeol",
+         "$ x = 0\n"
+         "import \"test_chunk_ch1.gyeol\"\n"
+         "import \"test_chunk_ch2.gyeol\"\n"
+         "label start:\n"
+         "    hero \"prologue\"\n"
+         "    call ch1_intro\n"
+         "    hero \"epilogue\"\n"},
+    };
+    for (const auto& file : files) {
+        std::ofstream ofs(file.first);
+        ofs << file.second;
+    }
+    Parser parser;
+    bool ok = parser.parse("test_chunk_main.gyeol");
+    std::string error;
+    if (ok) ok = ChunkTools::writeStoryChunks(parser.getStory(), parser.getNodeSourceFiles(), dir, &error);
+    for (const auto& file : files) std::remove(file.first.c_str());
+    return ok;
+}
+
+std::string chunkFixtureDir(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+} // namespace
+
+TEST(RunnerChunkTest, ExportsOneChunkPerModule) {
+    const std::string dir = chunkFixtureDir("gyeol_chunks_export");
+    std::filesystem::remove_all(dir);
+    ASSERT_TRUE(exportChunkFixture(dir));
+
+    std::string error;
+    auto chunks = StoryChunkSet::load(dir + "/index.gyci", 0, &error);
+    ASSERT_NE(chunks, nullptr) << error;
+    ASSERT_EQ(chunks->getChunkCount(), 4u); // main, test_chunk_ch1, util, test_chunk_ch2
+    EXPECT_EQ(chunks->getStartNodeName(), "start");
+    EXPECT_EQ(chunks->findChunkForNode("start"), 0);
+    EXPECT_EQ(chunks->getChunkName(0), "test_chunk_main");
+    EXPECT_EQ(chunks->getChunkName(static_cast<uint32_t>(chunks->findChunkForNode("helper"))), "util");
+    EXPECT_EQ(chunks->findChunkForNode("missing"), -1);
+
+    // 청크마다 자기 노드가 쓰는 문자열만 가진다
+    auto ch2 = chunks->acquire(static_cast<uint32_t>(chunks->findChunkForNode("ch2_intro")), &error);
+    ASSERT_NE(ch2, nullptr) << error;
+    auto* story = ICPDev::Gyeol::Schema::GetStory(ch2->data());
+    ASSERT_EQ(story->nodes()->size(), 1u);
+    for (flatbuffers::uoffset_t i = 0; i < story->string_pool()->size(); ++i) {
+        EXPECT_STRNE(story->string_pool()->Get(i)->c_str(), "prologue");
+    }
+    EXPECT_FALSE(StoryChunkSet::load(dir + "/missing.gyci", 0, &error));
+    std::filesystem::remove_all(dir);
+}
+
+TEST(RunnerChunkTest, RunsAcrossChunksWithinBudget) {
+    const std::string dir = chunkFixtureDir("gyeol_chunks_run");
+    std::filesystem::remove_all(dir);
+    ASSERT_TRUE(exportChunkFixture(dir));
+
+    std::string error;
+    auto chunks = StoryChunkSet::load(dir + "/index.gyci", 1, &error); // 사실상 사용 중인 청크만 유지
+    ASSERT_NE(chunks, nullptr) << error;
+
+    for (bool predecoded : {false, true}) {
+        Runner runner;
+        runner.setPredecodedDispatch(predecoded);
+        ASSERT_TRUE(runner.startChunked(chunks)) << runner.getLastError();
+        EXPECT_EQ(runner.getActiveChunk(), 0);
+
+        std::vector<std::string> texts;
+        std::set<int32_t> visitedChunks;
+        for (int guard = 0; guard < 32 && !runner.isFinished(); ++guard) {
+            auto r = runner.step();
+            visitedChunks.insert(runner.getActiveChunk());
+            if (r.type == StepType::LINE) texts.emplace_back(r.line.text);
+        }
+        EXPECT_EQ(texts, (std::vector<std::string>{
+            "prologue", "chapter one", "back in one", "chapter two", "epilogue"}));
+        EXPECT_EQ(runner.getVariable("x").i, 7);
+        // util 청크(helper)는 한 step 안에서 들어갔다 나온다
+        EXPECT_EQ(visitedChunks, (std::set<int32_t>{0, chunks->findChunkForNode("ch1_intro"),
+                                                    chunks->findChunkForNode("ch2_intro")}));
+        EXPECT_EQ(runner.getVisitCount("helper"), 1);
+    }
+
+    auto stats = chunks->getStats();
+    EXPECT_GT(stats.evictions, 0u);
+    EXPECT_LE(chunks->getResidentBytes(), chunks->getChunkSize(0) + chunks->getChunkSize(1) +
+                                          chunks->getChunkSize(2) + chunks->getChunkSize(3));
+    std::filesystem::remove_all(dir);
+}
+
+TEST(RunnerChunkTest, DoesNotRecordSeenLines) {
+    const std::string dir = chunkFixtureDir("gyeol_chunks_seen");
+    std::filesystem::remove_all(dir);
+    ASSERT_TRUE(exportChunkFixture(dir));
+    std::string error;
+    auto chunks = StoryChunkSet::load(dir + "/index.gyci", 0, &error);
+    ASSERT_NE(chunks, nullptr) << error;
+
+    // 청크마다 string_pool이 달라 읽은 대사를 기록하지 않는다
+    Runner runner;
+    for (int pass = 0; pass < 2; ++pass) {
+        ASSERT_TRUE(runner.startChunked(chunks)) << runner.getLastError();
+        int lines = 0;
+        for (int guard = 0; guard < 32 && !runner.isFinished(); ++guard) {
+            auto r = runner.step();
+            if (r.type != StepType::LINE) continue;
+            ++lines;
+            EXPECT_FALSE(r.line.seen) << r.line.text;
+        }
+        EXPECT_EQ(lines, 5);
+        EXPECT_EQ(runner.getSeenLineCount(), 0u);
+    }
+
+    // skipSeen은 첫 대사에서 멈추고, 기록 병합은 거부한다
+    ASSERT_TRUE(runner.startChunked(chunks)) << runner.getLastError();
+    uint32_t skipped = 1;
+    auto r = runner.skipSeen(&skipped);
+    ASSERT_EQ(r.type, StepType::LINE);
+    EXPECT_STREQ(r.line.text, "prologue");
+    EXPECT_EQ(skipped, 0u);
+    const auto data = runner.exportSeenLines();
+    EXPECT_FALSE(runner.mergeSeenLines(data.data(), data.size()));
+    EXPECT_NE(runner.getLastError().find("chunk mode"), std::string::npos);
+    std::filesystem::remove_all(dir);
+}
+
+TEST(RunnerChunkTest, SaveLoadRestoresChunkOfCurrentNode) {
+    const std::string dir = chunkFixtureDir("gyeol_chunks_save");
+    std::filesystem::remove_all(dir);
+    ASSERT_TRUE(exportChunkFixture(dir));
+    auto chunks = StoryChunkSet::load(dir + "/index.gyci");
+    ASSERT_NE(chunks, nullptr);
+
+    Runner runner;
+    ASSERT_TRUE(runner.startChunked(chunks));
+    ASSERT_EQ(runner.step().type, StepType::LINE); // prologue
+    auto r = runner.step();                         // chapter one (ch1 청크, call stack에 main)
+    ASSERT_EQ(r.type, StepType::LINE);
+    const int32_t ch1 = chunks->findChunkForNode("ch1_intro");
+    EXPECT_EQ(runner.getActiveChunk(), ch1);
+
+    const std::string savePath = dir + "/state.gys";
+    ASSERT_TRUE(runner.saveState(savePath));
+
+    Runner restored;
+    ASSERT_TRUE(restored.startChunked(chunks));
+    ASSERT_TRUE(restored.loadState(savePath)) << restored.getLastError();
+    EXPECT_EQ(restored.getActiveChunk(), ch1);
+
+    std::vector<std::string> texts;
+    for (int guard = 0; guard < 32 && !restored.isFinished(); ++guard) {
+        auto step = restored.step();
+        if (step.type == StepType::LINE) texts.emplace_back(step.line.text);
+    }
+    EXPECT_EQ(texts, (std::vector<std::string>{"back in one", "chapter two", "epilogue"}));
+    std::filesystem::remove_all(dir);
+}
+
 TEST(RunnerChoiceModifierTest, OnceChoiceDisappearsAfterSelection) {
     auto buf = GyeolTest::compileScript(R"(
 label start:
@@ -4317,6 +4946,355 @@ label done:
     EXPECT_TRUE(sawChoose);
 }
 
+TEST(RunnerRuntimeContractTest, ProfilingRecordsOpcodeCostsAndLatency) {
+    auto buf = GyeolTest::compileScript(R"(
+label start:
+    $ hp = 10
+    narrator "HP {hp}"
+    menu:
+        "Continue" -> done
+
+label done:
+    narrator "Bye"
+)");
+    ASSERT_FALSE(buf.empty());
+
+    Runner runner;
+    ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+
+    // 꺼져 있으면 프로파일 데이터가 쌓이지 않는다
+    EXPECT_FALSE(runner.isProfilingEnabled());
+    ASSERT_EQ(runner.step().type, StepType::LINE);
+    EXPECT_EQ(runner.getMetrics().profile.step.count, 0u);
+    EXPECT_EQ(runner.getMetrics().profile.opcodes[static_cast<size_t>(ICPDev::Gyeol::Schema::OpData::Line)].count, 0u);
+
+    runner.setProfilingEnabled(true);
+    auto snap = runner.snapshot();
+    ASSERT_EQ(runner.step().type, StepType::CHOICES);
+    runner.choose(0);
+    ASSERT_EQ(runner.step().type, StepType::LINE);
+    ASSERT_TRUE(runner.restore(snap));
+
+    const auto& profile = runner.getMetrics().profile;
+    EXPECT_EQ(profile.step.count, 2u);
+    EXPECT_EQ(profile.choose.count, 1u);
+    EXPECT_EQ(profile.snapshot.count, 1u);
+    EXPECT_EQ(profile.restore.count, 1u);
+    uint64_t bucketTotal = 0;
+    for (uint64_t bucket : profile.step.buckets) bucketTotal += bucket;
+    EXPECT_EQ(bucketTotal, profile.step.count);
+    EXPECT_GE(profile.step.maxNs, profile.step.totalNs / profile.step.count);
+    EXPECT_EQ(profile.opcodes[static_cast<size_t>(ICPDev::Gyeol::Schema::OpData::Choice)].count, 1u);
+    EXPECT_EQ(profile.opcodes[static_cast<size_t>(ICPDev::Gyeol::Schema::OpData::Line)].count, 1u);
+
+    auto metricsJson = json::parse(runner.exportMetricsJson());
+    EXPECT_EQ(metricsJson["counters"]["choices_made"], 1);
+    EXPECT_TRUE(metricsJson["profiling"].get<bool>());
+    EXPECT_EQ(metricsJson["opcodes"]["Choice"]["count"], 1);
+    EXPECT_EQ(metricsJson["latency"]["choose"]["count"], 1);
+    EXPECT_EQ(metricsJson["latency"]["step"]["buckets"].size(), Runner::LatencyHistogram::kBucketCount);
+
+    std::string prom = runner.exportMetricsPrometheus("story");
+    EXPECT_NE(prom.find("story_step_calls_total 3\n"), std::string::npos);
+    EXPECT_NE(prom.find("story_opcode_instructions_total{op=\"Choice\"} 1\n"), std::string::npos);
+    EXPECT_NE(prom.find("# TYPE story_step_latency_nanoseconds histogram\n"), std::string::npos);
+    EXPECT_NE(prom.find("story_step_latency_nanoseconds_bucket{le=\"+Inf\"} 2\n"), std::string::npos);
+    EXPECT_NE(prom.find("story_restore_latency_nanoseconds_count 1\n"), std::string::npos);
+
+    runner.resetMetrics();
+    EXPECT_EQ(runner.getMetrics().profile.step.count, 0u);
+    EXPECT_TRUE(runner.isProfilingEnabled());
+}
+
+TEST(RunnerRuntimeContractTest, StoryProfileAttributesInstructionsToNodesAndStacks) {
+    auto buf = GyeolTest::compileScript(R"(
+label start:
+    call greet
+    call greet
+    narrator "done"
+
+label greet:
+    narrator "hi"
+)");
+    ASSERT_FALSE(buf.empty());
+
+    Runner runner;
+    runner.setStoryProfilingEnabled(true);
+    ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+    int guard = 0;
+    while (!runner.isFinished() && guard++ < 20) {
+        runner.step();
+    }
+    ASSERT_TRUE(runner.isFinished());
+
+    auto profile = runner.getStoryProfile();
+    const Runner::StoryProfileReport::NodeEntry* start = nullptr;
+    const Runner::StoryProfileReport::NodeEntry* greet = nullptr;
+    for (const auto& node : profile.nodes) {
+        if (node.nodeName == "start") start = &node;
+        if (node.nodeName == "greet") greet = &node;
+    }
+    ASSERT_NE(start, nullptr);
+    ASSERT_NE(greet, nullptr);
+    EXPECT_EQ(start->instructions, 3u);
+    EXPECT_EQ(start->visits, 1u);
+    EXPECT_EQ(greet->instructions, 2u);
+    EXPECT_EQ(greet->visits, 2u);
+    EXPECT_EQ(greet->calls, 2u);
+
+    bool sawGreetLine = false;
+    for (const auto& instr : profile.instructions) {
+        if (instr.nodeName == "greet" && instr.pc == 0) {
+            sawGreetLine = true;
+            EXPECT_EQ(instr.instructionType, "Line");
+            EXPECT_EQ(instr.count, 2u);
+        }
+    }
+    EXPECT_TRUE(sawGreetLine);
+
+    // 콜스택은 callStack_ 기준: greet는 start 아래에 쌓인다
+    std::string collapsed = runner.exportStoryProfileCollapsed(true);
+    EXPECT_NE(collapsed.find("start 3\n"), std::string::npos);
+    EXPECT_NE(collapsed.find("start;greet 2\n"), std::string::npos);
+
+    // 같은 버퍼로 재시작하면 누적, reset하면 비워짐
+    ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+    runner.step();
+    EXPECT_GT(runner.getStoryProfile().nodes.size(), 0u);
+    runner.resetStoryProfile();
+    EXPECT_TRUE(runner.getStoryProfile().nodes.empty());
+    EXPECT_TRUE(runner.exportStoryProfileCollapsed().empty());
+}
+
+namespace {
+
+// step 결과를 문자열로 기록해 두 dispatch 경로의 관찰 가능한 동작을 비교한다.
+std::vector<std::string> runTranscript(Runner& runner, const std::vector<uint8_t>& buf) {
+    std::vector<std::string> out;
+    if (!GyeolTest::startRunner(runner, buf)) return out;
+    runner.setSeed(7);
+    for (int guard = 0; guard < 10000 && !runner.isFinished(); ++guard) {
+        auto r = runner.step();
+        if (r.budgetExhausted) continue; // 명령 예산 YIELD는 관찰 가능한 결과가 아니다
+        std::string entry = std::to_string(static_cast<int>(r.type));
+        switch (r.type) {
+            case StepType::LINE:
+                entry += std::string(":") + (r.line.text ? r.line.text : "");
+                break;
+            case StepType::CHOICES:
+                for (const auto& choice : r.choices) entry += std::string("|") + (choice.text ? choice.text : "");
+                runner.choose(static_cast<int>(out.size() % r.choices.size()));
+                break;
+            case StepType::COMMAND:
+                entry += std::string(":") + (r.command.type ? r.command.type : "");
+                break;
+            case StepType::WAIT:
+                entry += std::string(":") + (r.wait.tag ? r.wait.tag : "");
+                runner.resume();
+                break;
+            default:
+                break;
+        }
+        out.push_back(entry);
+        if (r.type == StepType::END) break;
+    }
+    return out;
+}
+
+} // namespace
+
+TEST(RunnerRuntimeContractTest, PredecodedDispatchMatchesReference) {
+    auto buf = GyeolTest::compileScript(R"(
+$ total = 0
+$ round = 0
+
+label start:
+    $ round = round + 1
+    $ bonus = call double(round)
+    $ total = total + bonus
+    if total % 3 == 0 -> three else other
+
+label three:
+    narrator "three {total}"
+    @ sfx "ding"
+    jump next
+
+label other:
+    random:
+        50 -> heads
+        50 -> tails
+
+label heads:
+    "heads {round}"
+    jump next
+
+label tails:
+    wait "tails"
+    yield
+    jump next
+
+label next:
+    if round < 12 -> menu_node else end
+
+label menu_node:
+    menu:
+        "again" -> start
+        "skip" -> next_round
+
+label next_round:
+    $ round = round + 1
+    jump start
+
+label double(x):
+    return x * 2
+
+label end:
+    "total {total}"
+)");
+    ASSERT_FALSE(buf.empty());
+
+    Runner reference;
+    Runner predecoded;
+    predecoded.setPredecodedDispatch(true);
+    EXPECT_TRUE(predecoded.isPredecodedDispatch());
+
+    auto expected = runTranscript(reference, buf);
+    auto actual = runTranscript(predecoded, buf);
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(actual, expected);
+    EXPECT_TRUE(predecoded.isFinished());
+
+    for (const char* node : {"start", "three", "other", "heads", "tails", "next", "menu_node", "double"}) {
+        EXPECT_EQ(predecoded.getVisitCount(node), reference.getVisitCount(node)) << node;
+    }
+    EXPECT_EQ(predecoded.getVariable("total").i, reference.getVariable("total").i);
+    EXPECT_EQ(predecoded.getMetrics().instructionsExecuted, reference.getMetrics().instructionsExecuted);
+    EXPECT_EQ(predecoded.getMetrics().jumps, reference.getMetrics().jumps);
+    EXPECT_EQ(predecoded.getMetrics().conditionsEvaluated, reference.getMetrics().conditionsEvaluated);
+
+    // 트레이스를 켜면 참조 경로로 실행되어 이벤트가 그대로 기록된다
+    Runner traced;
+    traced.setPredecodedDispatch(true);
+    traced.setTraceEnabled(true, 4096);
+    EXPECT_EQ(runTranscript(traced, buf), expected);
+    bool sawCondition = false;
+    for (const auto& event : traced.getTrace()) {
+        if (event.kind == "CONDITION") sawCondition = true;
+    }
+    EXPECT_TRUE(sawCondition);
+}
+
+TEST(RunnerRuntimeContractTest, InstructionBudgetYieldsAndResumes) {
+    auto buf = GyeolTest::compileScript(R"(
+$ n = 0
+
+label start:
+    $ n = n + 1
+    if n < 50 -> start else done
+
+label done:
+    yield
+    "n is {n}"
+)");
+    ASSERT_FALSE(buf.empty());
+
+    for (bool predecoded : {false, true}) {
+        Runner runner;
+        runner.setPredecodedDispatch(predecoded);
+        runner.setInstructionBudget(8);
+        EXPECT_EQ(runner.getInstructionBudget(), 8u);
+        ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+
+        int budgetYields = 0;
+        StepResult r;
+        for (int guard = 0; guard < 1000; ++guard) {
+            const uint64_t before = runner.getMetrics().instructionsExecuted;
+            r = runner.step();
+            EXPECT_LE(runner.getMetrics().instructionsExecuted - before, 8u);
+            if (!r.budgetExhausted) break;
+            EXPECT_EQ(r.type, StepType::YIELD);
+            EXPECT_FALSE(runner.isFinished());
+            ++budgetYields;
+        }
+        EXPECT_GT(budgetYields, 10) << predecoded;
+
+        // 스토리의 yield는 budgetExhausted가 아니다
+        EXPECT_EQ(r.type, StepType::YIELD);
+        EXPECT_FALSE(r.budgetExhausted);
+        r = runner.step();
+        ASSERT_EQ(r.type, StepType::LINE);
+        EXPECT_STREQ(r.line.text, "n is 50");
+        EXPECT_EQ(runner.getVisitCount("start"), 50);
+    }
+
+    // 예산을 끄면 한 번에 실행
+    Runner unlimited;
+    unlimited.setInstructionBudget(8);
+    unlimited.setInstructionBudget(0);
+    ASSERT_TRUE(GyeolTest::startRunner(unlimited, buf));
+    auto r = unlimited.step();
+    EXPECT_EQ(r.type, StepType::YIELD);
+    EXPECT_FALSE(r.budgetExhausted);
+}
+
+TEST(RunnerRuntimeContractTest, InstructionBudgetKeepsTranscript) {
+    auto buf = GyeolTest::compileScript(R"(
+$ total = 0
+
+label start:
+    $ bonus = call double(total)
+    $ total = total + bonus + 1
+    if total % 2 == 0 -> even else odd
+
+label even:
+    narrator "even {total}"
+    @ sfx "ding"
+    jump next
+
+label odd:
+    random:
+        50 -> heads
+        50 -> tails
+
+label heads:
+    wait "heads"
+    jump next
+
+label tails:
+    "tails {total}"
+    jump next
+
+label next:
+    if total < 40 -> menu_node else end
+
+label menu_node:
+    menu:
+        "again" -> start
+        "skip" -> start
+
+label double(x):
+    return x * 2
+
+label end:
+    "total {total}"
+)");
+    ASSERT_FALSE(buf.empty());
+
+    Runner reference;
+    auto expected = runTranscript(reference, buf);
+    ASSERT_FALSE(expected.empty());
+    for (uint32_t budget : {1u, 2u, 5u}) {
+        for (bool predecoded : {false, true}) {
+            Runner budgeted;
+            budgeted.setPredecodedDispatch(predecoded);
+            budgeted.setInstructionBudget(budget);
+            EXPECT_EQ(runTranscript(budgeted, buf), expected) << budget << " " << predecoded;
+            EXPECT_EQ(budgeted.getVariable("total").i, reference.getVariable("total").i);
+            EXPECT_EQ(budgeted.getMetrics().instructionsExecuted, reference.getMetrics().instructionsExecuted);
+        }
+    }
+}
+
 TEST(RunnerRuntimeContractTest, WaitRequiresResumeBeforeProgress) {
     auto buf = GyeolTest::compileScript(R"(
 label start:
@@ -4406,3 +5384,801 @@ label a:
     runner.clearLastError();
     EXPECT_TRUE(runner.getLastError().empty());
 }
+
+// --- Compressed string pool ---
+
+namespace {
+const char* kCompressedPoolScript = R"(
+label start:
+    $ answer = "Yes, I will go"
+    hero "The old lighthouse keeper said the storm would come before the night was over."
+    hero "The old lighthouse keeper said the sea would be calm before the night was over."
+    narrator "Nobody in the village believed the old lighthouse keeper that night."
+    menu:
+        "Yes, I will go" -> go
+        "No, I will stay in the village" -> stay
+
+label go:
+    hero "I walked to the old lighthouse before the storm would come."
+    hero "{answer}, I said to the old lighthouse keeper."
+
+label stay:
+    narrator "The storm came before the night was over, just as the keeper said."
+)";
+
+std::vector<uint8_t> compressedPoolBuffer(const std::vector<uint8_t>& buf, size_t blockBytes, size_t dictBytes) {
+    std::unique_ptr<ICPDev::Gyeol::Schema::StoryT> story(ICPDev::Gyeol::Schema::GetStory(buf.data())->UnPack());
+    PoolTools::PoolCompressionOptions options;
+    options.blockBytes = blockBytes;
+    options.dictionaryBytes = dictBytes;
+    std::string error;
+    if (!PoolTools::compressStringPool(*story, options, &error)) return {};
+    flatbuffers::FlatBufferBuilder builder;
+    builder.Finish(ICPDev::Gyeol::Schema::Story::Pack(builder, story.get()));
+    return std::vector<uint8_t>(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+}
+} // namespace
+
+TEST(RunnerCompressedPoolTest, CodecRoundTripsWithAndWithoutDictionary) {
+    std::string text;
+    for (int i = 0; i < 40; ++i) text += "the storm would come before the night was over " + std::to_string(i % 7) + '\0';
+    const auto* raw = reinterpret_cast<const uint8_t*>(text.data());
+    const std::string dictText = "the night was over the storm would come";
+    const auto* dict = reinterpret_cast<const uint8_t*>(dictText.data());
+
+    std::vector<uint8_t> packed, unpacked;
+    PoolTools::compressBlock(raw, text.size(), nullptr, 0, packed);
+    EXPECT_LT(packed.size(), text.size() / 4);
+    ASSERT_TRUE(PoolCodec::decompress(packed.data(), packed.size(), nullptr, 0, text.size(), unpacked));
+    EXPECT_EQ(std::string(unpacked.begin(), unpacked.end()), text);
+
+    std::vector<uint8_t> packedWithDict;
+    PoolTools::compressBlock(raw, 60, dict, dictText.size(), packedWithDict);
+    std::vector<uint8_t> packedNoDict;
+    PoolTools::compressBlock(raw, 60, nullptr, 0, packedNoDict);
+    EXPECT_LT(packedWithDict.size(), packedNoDict.size());
+    ASSERT_TRUE(PoolCodec::decompress(packedWithDict.data(), packedWithDict.size(),
+                                      dict, dictText.size(), 60, unpacked));
+    EXPECT_EQ(std::string(unpacked.begin(), unpacked.end()), text.substr(0, 60));
+
+    // 사전 없이 풀거나 크기가 다르면 실패 (범위 밖 참조를 읽지 않음)
+    EXPECT_FALSE(PoolCodec::decompress(packedWithDict.data(), packedWithDict.size(), nullptr, 0, 60, unpacked));
+    EXPECT_FALSE(PoolCodec::decompress(packed.data(), packed.size() / 2, nullptr, 0, text.size(), unpacked));
+}
+
+TEST(RunnerCompressedPoolTest, MatchesUncompressedTranscript) {
+    auto buf = GyeolTest::compileScript(kCompressedPoolScript);
+    ASSERT_FALSE(buf.empty());
+    auto packed = compressedPoolBuffer(buf, 96, 256);
+    ASSERT_FALSE(packed.empty());
+
+    auto* story = ICPDev::Gyeol::Schema::GetStory(packed.data());
+    ASSERT_NE(story->compressed_pool(), nullptr);
+    EXPECT_GT(story->compressed_pool()->block_first_entry()->size(), 1u);
+    EXPECT_EQ(story->string_pool()->size(), ICPDev::Gyeol::Schema::GetStory(buf.data())->string_pool()->size());
+
+    for (bool predecoded : {false, true}) {
+        Runner reference;
+        Runner compressed;
+        compressed.setPredecodedDispatch(predecoded);
+        compressed.setStringPoolCacheCapacity(1);
+        auto expected = runTranscript(reference, buf);
+        auto actual = runTranscript(compressed, packed);
+        ASSERT_FALSE(expected.empty());
+        EXPECT_EQ(actual, expected);
+        EXPECT_TRUE(compressed.hasCompressedStringPool());
+        EXPECT_FALSE(reference.hasCompressedStringPool());
+        // 문자열 리터럴과 공유되는 선택지 텍스트는 압축하지 않아 변수 값도 같다
+        EXPECT_EQ(compressed.getVariable("answer").s, "Yes, I will go");
+
+        auto stats = compressed.getStringPoolCacheStats();
+        EXPECT_GT(stats.decompressions, 1u);
+        EXPECT_LE(stats.residentBlocks, 2u); // capacity 1 + 현재 step에서 연 블록
+    }
+}
+
+TEST(RunnerCompressedPoolTest, SaveLoadRestoresPendingChoices) {
+    auto buf = GyeolTest::compileScript(kCompressedPoolScript);
+    auto packed = compressedPoolBuffer(buf, 64, 0);
+    ASSERT_FALSE(packed.empty());
+
+    Runner runner;
+    ASSERT_TRUE(GyeolTest::startRunner(runner, packed));
+    StepResult r;
+    do {
+        r = runner.step();
+    } while (r.type == StepType::LINE);
+    ASSERT_EQ(r.type, StepType::CHOICES);
+    ASSERT_EQ(r.choices.size(), 2u);
+    EXPECT_STREQ(r.choices[1].text, "No, I will stay in the village");
+
+    const std::string savePath = "test_compressed_pool_save.gys";
+    ASSERT_TRUE(runner.saveState(savePath));
+    Runner restored;
+    ASSERT_TRUE(GyeolTest::startRunner(restored, packed));
+    ASSERT_TRUE(restored.loadState(savePath)) << restored.getLastError();
+    std::remove(savePath.c_str());
+
+    restored.choose(1);
+    r = restored.step();
+    ASSERT_EQ(r.type, StepType::LINE);
+    EXPECT_STREQ(r.line.text, "The storm came before the night was over, just as the keeper said.");
+}
+
+TEST(RunnerCompressedPoolTest, ShrinksTextHeavyStory) {
+    std::string script = "label start:\n";
+    for (int i = 0; i < 200; ++i) {
+        script += "    hero \"Line " + std::to_string(i) +
+                  ": the old lighthouse keeper said the storm would come before the night was over.\"\n";
+    }
+    auto buf = GyeolTest::compileScript(script);
+    ASSERT_FALSE(buf.empty());
+    auto packed = compressedPoolBuffer(buf, 4096, 1024);
+    ASSERT_FALSE(packed.empty());
+    EXPECT_LT(packed.size(), buf.size() * 6 / 10); // 남는 건 명령어 테이블과 line_ids
+
+    auto* pool = ICPDev::Gyeol::Schema::GetStory(packed.data())->compressed_pool();
+    ASSERT_NE(pool, nullptr);
+    size_t rawBytes = 0;
+    for (auto size : *pool->block_raw_sizes()) rawBytes += size;
+    EXPECT_LT(pool->data()->size() * 5, rawBytes);
+
+    Runner runner;
+    ASSERT_TRUE(GyeolTest::startRunner(runner, packed));
+    for (int i = 0; i < 150; ++i) ASSERT_EQ(runner.step().type, StepType::LINE);
+    auto r = runner.step();
+    ASSERT_EQ(r.type, StepType::LINE);
+    EXPECT_STREQ(r.line.text, "Line 150: the old lighthouse keeper said the storm would come before the night was over.");
+}
+
+// --- 압축 명령 인코딩 ---
+
+namespace {
+const char* kCompactScript = R"(
+$ hp = 0
+
+label start:
+    hero "one"
+    "two"
+    $ hp = 5
+    $ ok = true
+    $ rate = 1.5
+    wait "gate"
+    yield
+    "three"
+    @ sfx "ding"
+    menu:
+        "go" -> mid
+        "stay" -> mid
+
+label mid:
+    "four"
+    "five"
+    "six"
+    jump finale
+
+label finale:
+    "hp {hp}"
+)";
+
+std::vector<uint8_t> packStory(const ICPDev::Gyeol::Schema::StoryT& story) {
+    flatbuffers::FlatBufferBuilder builder;
+    builder.Finish(ICPDev::Gyeol::Schema::Story::Pack(builder, &story));
+    return std::vector<uint8_t>(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+}
+
+std::vector<uint8_t> compactBuffer(const std::vector<uint8_t>& buf, size_t* compacted = nullptr) {
+    std::unique_ptr<ICPDev::Gyeol::Schema::StoryT> story(ICPDev::Gyeol::Schema::GetStory(buf.data())->UnPack());
+    const size_t count = CompactTools::compactInstructions(*story);
+    if (compacted) *compacted = count;
+    return packStory(*story);
+}
+} // namespace
+
+TEST(RunnerCompactEncodingTest, MatchesTableTranscript) {
+    auto buf = GyeolTest::compileScript(kCompactScript);
+    ASSERT_FALSE(buf.empty());
+    size_t compacted = 0;
+    auto packed = compactBuffer(buf, &compacted);
+    EXPECT_GT(compacted, 0u);
+
+    auto* story = ICPDev::Gyeol::Schema::GetStory(packed.data());
+    flatbuffers::Verifier verifier(packed.data(), packed.size());
+    ASSERT_TRUE(ICPDev::Gyeol::Schema::VerifyStoryBuffer(verifier));
+    const auto* start = NodeNameHash::findNode(story, "start");
+    ASSERT_NE(start, nullptr);
+    ASSERT_NE(start->ops(), nullptr);
+    EXPECT_LT(start->lines()->size(), start->ops()->size()); // 테이블에는 명령/선택지만 남는다
+
+    for (bool predecoded : {false, true}) {
+        Runner reference;
+        Runner compact;
+        reference.setPredecodedDispatch(predecoded);
+        compact.setPredecodedDispatch(predecoded);
+        auto expected = runTranscript(reference, buf);
+        auto actual = runTranscript(compact, packed);
+        ASSERT_FALSE(expected.empty());
+        EXPECT_EQ(actual, expected);
+
+        EXPECT_EQ(compact.getVariable("hp").i, 5);
+        EXPECT_TRUE(compact.getVariable("ok").b);
+        EXPECT_FLOAT_EQ(compact.getVariable("rate").f, 1.5f);
+        for (const char* node : {"start", "mid", "finale"}) {
+            EXPECT_EQ(compact.getVisitCount(node), reference.getVisitCount(node)) << node;
+        }
+    }
+
+    Runner reference;
+    Runner compact;
+    ASSERT_TRUE(GyeolTest::startRunner(reference, buf));
+    ASSERT_TRUE(GyeolTest::startRunner(compact, packed));
+    for (const char* node : {"start", "mid", "finale"}) {
+        const uint32_t count = reference.getNodeInstructionCount(node);
+        ASSERT_EQ(compact.getNodeInstructionCount(node), count) << node;
+        for (uint32_t pc = 0; pc < count; ++pc) {
+            EXPECT_EQ(compact.getInstructionInfo(node, pc), reference.getInstructionInfo(node, pc)) << node << ":" << pc;
+        }
+    }
+}
+
+TEST(RunnerCompactEncodingTest, ExpandRestoresTableForm) {
+    auto buf = GyeolTest::compileScript(kCompactScript);
+    ASSERT_FALSE(buf.empty());
+    std::unique_ptr<ICPDev::Gyeol::Schema::StoryT> story(ICPDev::Gyeol::Schema::GetStory(buf.data())->UnPack());
+    const auto expected = packStory(*story);
+
+    ASSERT_GT(CompactTools::compactInstructions(*story), 0u);
+    EXPECT_NE(packStory(*story), expected);
+    EXPECT_EQ(CompactTools::compactInstructions(*story), 0u); // 이미 압축된 노드는 그대로
+    CompactTools::expandInstructions(*story);
+    EXPECT_EQ(packStory(*story), expected);
+}
+
+TEST(RunnerCompactEncodingTest, ShrinksLineHeavyStory) {
+    std::string script = "label start:\n";
+    for (int i = 0; i < 200; ++i) {
+        script += "    hero \"Line " + std::to_string(i) + "\"\n";
+        if (i % 20 == 19) script += "    jump n" + std::to_string(i) + "\nlabel n" + std::to_string(i) + ":\n";
+    }
+    auto buf = GyeolTest::compileScript(script);
+    ASSERT_FALSE(buf.empty());
+    auto packed = compactBuffer(buf);
+    EXPECT_LT(packed.size(), buf.size() * 9 / 10);
+
+    Runner runner;
+    ASSERT_TRUE(GyeolTest::startRunner(runner, packed));
+    for (int i = 0; i < 150; ++i) ASSERT_EQ(runner.step().type, StepType::LINE);
+    auto r = runner.step();
+    ASSERT_EQ(r.type, StepType::LINE);
+    EXPECT_STREQ(r.line.text, "Line 150");
+    EXPECT_EQ(runner.getVisitCount("n139"), 1);
+}
+
+TEST(RunnerCompactEncodingTest, KeepsNodesThatWouldGrow) {
+    // 대사 하나에 식 대입/조건 분기뿐인 노드는 Table 레코드만큼 커지므로 건드리지 않는다
+    auto buf = GyeolTest::compileScript(R"(
+$ i = 0
+
+label start:
+    "loop"
+    $ i = i + 1
+    if i < 3 -> start else end
+
+label end:
+    "done"
+)");
+    ASSERT_FALSE(buf.empty());
+    auto packed = compactBuffer(buf);
+    auto* start = NodeNameHash::findNode(ICPDev::Gyeol::Schema::GetStory(packed.data()), "start");
+    ASSERT_NE(start, nullptr);
+    EXPECT_EQ(start->ops(), nullptr);
+}
+
+// --- 노드 배치 ---
+
+namespace {
+const char* kLayoutScript = R"(
+label start:
+    "intro"
+    menu:
+        "left" -> left
+        "right" -> right
+
+label epilogue_cold:
+    "cold ending"
+
+label side_cold:
+    "side text"
+    jump epilogue_cold
+
+label left:
+    "went left"
+    jump finale
+
+label right:
+    "went right"
+    jump finale
+
+label finale:
+    "finale"
+)";
+
+std::unique_ptr<ICPDev::Gyeol::Schema::StoryT> unpackStory(const std::vector<uint8_t>& buf) {
+    return std::unique_ptr<ICPDev::Gyeol::Schema::StoryT>(ICPDev::Gyeol::Schema::GetStory(buf.data())->UnPack());
+}
+
+std::vector<std::string> nodeNames(const ICPDev::Gyeol::Schema::StoryT& story) {
+    std::vector<std::string> names;
+    for (const auto& node : story.nodes) names.push_back(node->name);
+    return names;
+}
+
+size_t poolIndex(const ICPDev::Gyeol::Schema::StoryT& story, const std::string& text) {
+    return static_cast<size_t>(std::find(story.string_pool.begin(), story.string_pool.end(), text) -
+                               story.string_pool.begin());
+}
+} // namespace
+
+TEST(RunnerLayoutTest, BfsPlacesReachableNodesFirst) {
+    auto buf = GyeolTest::compileScript(kLayoutScript);
+    ASSERT_FALSE(buf.empty());
+    auto original = unpackStory(buf);
+    auto story = unpackStory(buf);
+    std::string error;
+    ASSERT_TRUE(LayoutTools::layoutStory(*story, {}, &error)) << error;
+
+    EXPECT_EQ(nodeNames(*story), (std::vector<std::string>{
+        "start", "left", "right", "finale", "epilogue_cold", "side_cold"}));
+    // pool은 첫 참조 순, line_ids는 같은 문자열을 따라간다
+    EXPECT_LT(poolIndex(*story, "intro"), poolIndex(*story, "went left"));
+    EXPECT_LT(poolIndex(*story, "finale"), poolIndex(*story, "cold ending"));
+    ASSERT_EQ(story->line_ids.size(), story->string_pool.size());
+    EXPECT_EQ(story->line_ids[poolIndex(*story, "went right")],
+              original->line_ids[poolIndex(*original, "went right")]);
+
+    auto packed = packStory(*story);
+    auto* linked = ICPDev::Gyeol::Schema::GetStory(packed.data());
+    EXPECT_EQ(NodeNameHash::findNode(linked, "finale"), linked->nodes()->Get(3));
+    for (bool predecoded : {false, true}) {
+        Runner reference;
+        Runner laidOut;
+        reference.setPredecodedDispatch(predecoded);
+        laidOut.setPredecodedDispatch(predecoded);
+        auto expected = runTranscript(reference, buf);
+        ASSERT_FALSE(expected.empty());
+        EXPECT_EQ(runTranscript(laidOut, packed), expected);
+    }
+}
+
+TEST(RunnerLayoutTest, DfsAndProfileWeights) {
+    auto buf = GyeolTest::compileScript(kLayoutScript);
+    ASSERT_FALSE(buf.empty());
+    auto story = unpackStory(buf);
+
+    LayoutTools::LayoutOptions options;
+    options.order = LayoutTools::NodeOrder::DFS;
+    auto order = LayoutTools::computeNodeOrder(*story, options);
+    std::vector<std::string> names;
+    for (size_t i : order) names.push_back(story->nodes[i]->name);
+    EXPECT_EQ(names, (std::vector<std::string>{
+        "start", "left", "finale", "right", "epilogue_cold", "side_cold"}));
+
+    json profile = {
+        {"format", "gyeol-runtime-profile"},
+        {"version", 1},
+        {"nodes", json::array({
+            {{"node", "right"}, {"visits", 3}},
+            {{"node", "finale"}, {"visits", 10}},
+            {{"node", "missing"}, {"visits", 50}}
+        })}
+    };
+    std::string error;
+    ASSERT_TRUE(LayoutTools::loadNodeWeights(profile, options.nodeWeights, &error)) << error;
+    options.order = LayoutTools::NodeOrder::BFS;
+    ASSERT_TRUE(LayoutTools::layoutStory(*story, options, &error)) << error;
+    EXPECT_EQ(nodeNames(*story), (std::vector<std::string>{
+        "finale", "right", "start", "left", "epilogue_cold", "side_cold"}));
+
+    Runner runner;
+    auto packed = packStory(*story);
+    ASSERT_TRUE(GyeolTest::startRunner(runner, packed));
+    auto r = runner.step();
+    ASSERT_EQ(r.type, StepType::LINE);
+    EXPECT_STREQ(r.line.text, "intro");
+
+    EXPECT_FALSE(LayoutTools::loadNodeWeights(json{{"format", "gyeol-runtime-perf"}}, options.nodeWeights, &error));
+}
+
+TEST(RunnerLayoutTest, RejectsCompressedPool) {
+    auto buf = GyeolTest::compileScript(kCompressedPoolScript);
+    ASSERT_FALSE(buf.empty());
+    auto story = unpackStory(compressedPoolBuffer(buf, 96, 0));
+    ASSERT_NE(story->compressed_pool, nullptr);
+    std::string error;
+    EXPECT_FALSE(LayoutTools::layoutStory(*story, {}, &error));
+    EXPECT_NE(error.find("compressed"), std::string::npos);
+}
+
+// --- Profile-guided optimization ---
+
+namespace {
+const char* kPlayProfileScript = R"(
+$ n = 0
+
+label start:
+    call bump
+    "n is {n}"
+    if n < 3 -> start else done
+
+label bump:
+    $ n = n + 1
+
+label done:
+    menu:
+        "a" -> fin
+        "b" -> fin
+
+label fin:
+    "end"
+)";
+
+// 끝날 때까지 진행 (선택지는 첫 번째)
+std::string playProfileSession(Runner& runner, const std::vector<uint8_t>& buf) {
+    runner.setPlayProfilingEnabled(true);
+    if (!GyeolTest::startRunner(runner, buf)) return "";
+    for (int guard = 0; guard < 100 && !runner.isFinished(); ++guard) {
+        auto r = runner.step();
+        if (r.type == StepType::CHOICES) runner.choose(0);
+        if (r.type == StepType::END) break;
+    }
+    return runner.exportPlayProfileJson();
+}
+
+const json* findProfileNode(const json& profile, const std::string& name) {
+    for (const auto& entry : profile["nodes"]) {
+        if (entry["node"] == name) return &entry;
+    }
+    return nullptr;
+}
+} // namespace
+
+TEST(RunnerPlayProfileTest, ExportsVisitsBranchesCallsAndInterpolations) {
+    auto buf = GyeolTest::compileScript(kPlayProfileScript);
+    ASSERT_FALSE(buf.empty());
+    for (bool predecoded : {false, true}) {
+        Runner runner;
+        runner.setPredecodedDispatch(predecoded);
+        const json profile = json::parse(playProfileSession(runner, buf));
+        EXPECT_EQ(profile["format"], "gyeol-play-profile");
+
+        const json* start = findProfileNode(profile, "start");
+        ASSERT_NE(start, nullptr);
+        EXPECT_EQ((*start)["visits"], 3);
+        ASSERT_EQ((*start)["calls"].size(), 1u);
+        EXPECT_EQ((*start)["calls"][0]["target"], "bump");
+        EXPECT_EQ((*start)["calls"][0]["count"], 3);
+        ASSERT_EQ((*start)["branches"].size(), 1u);
+        EXPECT_EQ((*start)["branches"][0]["kind"], "condition");
+        EXPECT_EQ((*start)["branches"][0]["taken"], json::array({2, 1}));
+        ASSERT_EQ((*start)["interpolations"].size(), 1u);
+        EXPECT_EQ((*start)["interpolations"][0]["text"], "n is {n}");
+        EXPECT_EQ((*start)["interpolations"][0]["count"], 3);
+
+        ASSERT_NE(findProfileNode(profile, "bump"), nullptr);
+        EXPECT_EQ((*findProfileNode(profile, "bump"))["visits"], 3);
+        const json* done = findProfileNode(profile, "done");
+        ASSERT_NE(done, nullptr);
+        // 선택지는 고른 선택지 명령 위치마다 한 칸
+        ASSERT_EQ((*done)["branches"].size(), 1u);
+        EXPECT_EQ((*done)["branches"][0]["kind"], "choice");
+        EXPECT_EQ((*done)["branches"][0]["taken"], json::array({1}));
+
+        runner.resetPlayProfile();
+        EXPECT_EQ(json::parse(runner.exportPlayProfileJson())["nodes"].size(), 0u);
+    }
+}
+
+TEST(RunnerPlayProfileTest, HotTemplatesRenderLikePlainLines) {
+    auto buf = GyeolTest::compileScript(kPlayProfileScript);
+    ASSERT_FALSE(buf.empty());
+
+    ProfileTools::PlayProfile profile;
+    std::string error;
+    for (int session = 0; session < 2; ++session) {
+        Runner runner;
+        ASSERT_TRUE(ProfileTools::mergePlayProfile(json::parse(playProfileSession(runner, buf)), profile, &error)) << error;
+    }
+    EXPECT_EQ(profile.sessions, 2u);
+    EXPECT_EQ(profile.nodes["start"].visits, 6u);
+    EXPECT_EQ(ProfileTools::hotCallTargets(profile), (std::unordered_set<std::string>{"bump"}));
+    EXPECT_EQ(ProfileTools::hotNodes(profile).count("fin"), 1u);
+    EXPECT_FALSE(ProfileTools::mergePlayProfile(json{{"format", "gyeol-runtime-profile"}}, profile, &error));
+
+    auto story = unpackStory(buf);
+    EXPECT_EQ(ProfileTools::markHotTemplates(*story, profile), 1u);
+    auto hot = packStory(*story);
+    auto compactHot = compactBuffer(hot);
+    for (bool predecoded : {false, true}) {
+        Runner reference;
+        Runner templated;
+        Runner compact;
+        reference.setPredecodedDispatch(predecoded);
+        templated.setPredecodedDispatch(predecoded);
+        compact.setPredecodedDispatch(predecoded);
+        auto expected = runTranscript(reference, buf);
+        ASSERT_FALSE(expected.empty());
+        EXPECT_EQ(runTranscript(templated, hot), expected);
+        EXPECT_EQ(runTranscript(compact, compactHot), expected);
+    }
+
+    // 로케일 번역문은 캐시한 원문과 달라 일반 보간으로 처리된다
+    const std::string csvPath = "test_hot_template_locale.csv";
+    writeLocaleCSV(csvPath, hot, {{findLineIdForText(hot, "n is {n}"), "n은 {n}"}});
+    Runner runner;
+    ASSERT_TRUE(GyeolTest::startRunner(runner, hot));
+    auto r = runner.step();
+    ASSERT_EQ(r.type, StepType::LINE);
+    EXPECT_STREQ(r.line.text, "n is 1");
+    ASSERT_TRUE(GyeolTest::startRunner(runner, hot));
+    ASSERT_TRUE(runner.loadLocale(csvPath));
+    r = runner.step();
+    ASSERT_EQ(r.type, StepType::LINE);
+    EXPECT_STREQ(r.line.text, "n은 1");
+    std::remove(csvPath.c_str());
+}
+
+TEST(RunnerPlayProfileTest, HotChaptersJoinRootChunk) {
+    Parser parser;
+    ASSERT_TRUE(parser.parseString(
+        "label start:\n"
+        "    \"s\"\n"
+        "    jump a1\n"
+        "\n"
+        "label a1 #chapter=busy:\n"
+        "    \"a\"\n"
+        "\n"
+        "label b1 #chapter=rare:\n"
+        "    \"b\"\n"));
+
+    auto plan = ChunkTools::planChunks(parser.getStory(), {});
+    ASSERT_EQ(plan.size(), 3u);
+
+    ProfileTools::PlayProfile profile;
+    profile.nodes["start"].visits = 10;
+    profile.nodes["a1"].visits = 10;
+    plan = ChunkTools::planChunks(parser.getStory(), {}, ProfileTools::hotNodes(profile));
+    ASSERT_EQ(plan.size(), 2u);
+    EXPECT_EQ(plan[0].nodes, (std::vector<std::string>{"start", "a1"}));
+    EXPECT_EQ(plan[1].name, "rare");
+}
+
+// --- 읽은 대사 / skipSeen ---
+
+namespace {
+const char* kSeenScript = R"(
+label start:
+    "one"
+    @ sfx "ding"
+    "two"
+    menu:
+        "A" -> a
+        "B" -> b
+
+label a:
+    "a line"
+    jump end_node
+
+label b:
+    "b line"
+    jump end_node
+
+label end_node:
+    "fin"
+)";
+
+// 처음부터 끝까지 보면서 choiceIndex를 고른다
+void playSeenScript(Runner& runner, const std::vector<uint8_t>& buf, int choiceIndex) {
+    ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+    for (int guard = 0; guard < 100; ++guard) {
+        auto r = runner.step();
+        if (r.type == StepType::CHOICES) runner.choose(choiceIndex);
+        if (r.type == StepType::END) return;
+    }
+    FAIL() << "story did not finish";
+}
+} // namespace
+
+TEST(RunnerSeenLinesTest, MarksLinesAndSkipsSeenText) {
+    auto buf = GyeolTest::compileScript(kSeenScript);
+    ASSERT_FALSE(buf.empty());
+
+    for (bool predecoded : {false, true}) {
+        Runner runner;
+        runner.setPredecodedDispatch(predecoded);
+        ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+        auto r = runner.step();
+        ASSERT_EQ(r.type, StepType::LINE);
+        EXPECT_FALSE(r.line.seen);
+        runner.clearSeenLines();
+        playSeenScript(runner, buf, 0);
+        EXPECT_EQ(runner.getSeenLineCount(), 4u); // one, two, a line, fin
+
+        // 다시 시작해도 기록 유지
+        ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+        r = runner.step();
+        ASSERT_EQ(r.type, StepType::LINE);
+        EXPECT_TRUE(r.line.seen);
+
+        // 읽은 대사를 넘기고 명령은 인자까지 채워 돌려준다
+        ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+        uint32_t skipped = 0;
+        r = runner.skipSeen(&skipped);
+        ASSERT_EQ(r.type, StepType::COMMAND) << predecoded;
+        EXPECT_EQ(skipped, 1u);
+        EXPECT_STREQ(r.command.type, "sfx");
+        ASSERT_EQ(r.command.args.size(), 1u);
+        EXPECT_EQ(r.command.args[0].text, "ding");
+
+        // 이어서 넘기고 선택지에서 멈춤
+        r = runner.skipSeen(&skipped);
+        ASSERT_EQ(r.type, StepType::CHOICES) << predecoded;
+        EXPECT_EQ(skipped, 1u);
+        ASSERT_EQ(r.choices.size(), 2u);
+
+        // 처음 보는 대사에서 멈추고 그 대사를 결과로 돌려준다
+        runner.choose(1);
+        r = runner.skipSeen(&skipped);
+        ASSERT_EQ(r.type, StepType::LINE);
+        EXPECT_STREQ(r.line.text, "b line");
+        EXPECT_FALSE(r.line.seen);
+        EXPECT_EQ(skipped, 0u);
+
+        r = runner.skipSeen(&skipped);
+        EXPECT_EQ(r.type, StepType::END);
+        EXPECT_EQ(skipped, 1u);
+        EXPECT_TRUE(runner.isFinished());
+        EXPECT_EQ(runner.getSeenLineCount(), 5u);
+    }
+}
+
+TEST(RunnerSeenLinesTest, SkipSeenStopsAtWaitAndHonorsBudget) {
+    auto buf = GyeolTest::compileScript(R"(
+$ n = 0
+
+label start:
+    "intro"
+    $ n = n + 1
+    if n < 30 -> start_loop else after
+
+label start_loop:
+    $ n = n + 1
+    if n < 30 -> start_loop else after
+
+label after:
+    wait "gate"
+    "outro"
+)");
+    ASSERT_FALSE(buf.empty());
+
+    Runner runner;
+    ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+    ASSERT_EQ(runner.step().type, StepType::LINE);
+
+    ASSERT_TRUE(GyeolTest::startRunner(runner, buf));
+    runner.setInstructionBudget(10);
+    uint32_t skipped = 0;
+    uint32_t totalSkipped = 0;
+    int budgetYields = 0;
+    StepResult r;
+    for (int guard = 0; guard < 100; ++guard) {
+        r = runner.skipSeen(&skipped);
+        totalSkipped += skipped;
+        if (!r.budgetExhausted) break;
+        ++budgetYields;
+    }
+    EXPECT_GT(budgetYields, 0);
+    EXPECT_EQ(totalSkipped, 1u);
+    ASSERT_EQ(r.type, StepType::WAIT);
+    EXPECT_STREQ(r.wait.tag, "gate");
+    EXPECT_EQ(runner.getVariable("n").i, 30);
+}
+
+TEST(RunnerSeenLinesTest, ResetsForDifferentStoryWithSamePoolSize) {
+    auto first = GyeolTest::compileScript("label start:\n    \"alpha\"\n    \"beta\"\n");
+    auto second = GyeolTest::compileScript("label start:\n    \"gamma\"\n    \"delta\"\n");
+    ASSERT_FALSE(first.empty());
+    ASSERT_FALSE(second.empty());
+
+    Runner runner;
+    ASSERT_TRUE(GyeolTest::startRunner(runner, first));
+    const size_t poolSize = runner.exportSeenLines().size();
+    while (runner.step().type != StepType::END) {}
+    EXPECT_EQ(runner.getSeenLineCount(), 2u);
+
+    // string_pool 크기가 같은 다른 스토리: 기록을 넘기지 않는다
+    ASSERT_TRUE(GyeolTest::startRunner(runner, second));
+    ASSERT_EQ(runner.exportSeenLines().size(), poolSize);
+    EXPECT_EQ(runner.getSeenLineCount(), 0u);
+    auto r = runner.step();
+    ASSERT_EQ(r.type, StepType::LINE);
+    EXPECT_FALSE(r.line.seen);
+    uint32_t skipped = 0;
+    r = runner.skipSeen(&skipped);
+    ASSERT_EQ(r.type, StepType::LINE);
+    EXPECT_STREQ(r.line.text, "delta");
+    EXPECT_EQ(skipped, 0u);
+
+    // 같은 바이트로 다시 빌드한 스토리는 같은 식별 해시라 기록이 유지된다
+    auto again = GyeolTest::compileScript("label start:\n    \"gamma\"\n    \"delta\"\n");
+    ASSERT_TRUE(GyeolTest::startRunner(runner, again));
+    EXPECT_EQ(runner.getSeenLineCount(), 2u);
+}
+
+TEST(RunnerSeenLinesTest, ExportMergesAcrossSavesAndFiles) {
+    auto buf = GyeolTest::compileScript(kSeenScript);
+    ASSERT_FALSE(buf.empty());
+
+    Runner first;
+    playSeenScript(first, buf, 0);
+    Runner second;
+    playSeenScript(second, buf, 1);
+    const auto firstData = first.exportSeenLines();
+    const auto secondData = second.exportSeenLines();
+    ASSERT_GE(firstData.size(), 12u);
+    EXPECT_EQ(std::string(firstData.begin(), firstData.begin() + 4), "GYSN");
+    EXPECT_EQ(firstData[4], 2u); // version
+
+    // 두 회차의 기록을 OR로 합친다
+    Runner merged;
+    EXPECT_FALSE(merged.mergeSeenLines(firstData.data(), firstData.size())); // 스토리 없음
+    ASSERT_TRUE(GyeolTest::startRunner(merged, buf));
+    ASSERT_TRUE(merged.mergeSeenLines(firstData.data(), firstData.size())) << merged.getLastError();
+    ASSERT_TRUE(merged.mergeSeenLines(secondData.data(), secondData.size())) << merged.getLastError();
+    EXPECT_EQ(merged.getSeenLineCount(), 5u);
+
+    const std::string path = (std::filesystem::temp_directory_path() / "gyeol_seen_lines.gyseen").string();
+    ASSERT_TRUE(merged.saveSeenLines(path)) << merged.getLastError();
+    Runner loaded;
+    ASSERT_TRUE(GyeolTest::startRunner(loaded, buf));
+    ASSERT_TRUE(loaded.loadSeenLines(path)) << loaded.getLastError();
+    std::remove(path.c_str());
+    EXPECT_EQ(loaded.exportSeenLines(), merged.exportSeenLines());
+    uint32_t skipped = 0;
+    auto r = loaded.skipSeen(&skipped);
+    EXPECT_EQ(r.type, StepType::COMMAND);
+    r = loaded.skipSeen(&skipped);
+    EXPECT_EQ(r.type, StepType::CHOICES);
+    loaded.choose(0);
+    r = loaded.skipSeen(&skipped);
+    EXPECT_EQ(r.type, StepType::END);
+    EXPECT_EQ(skipped, 2u);
+
+    // 다른 스토리 / 손상된 데이터는 거부
+    auto other = GyeolTest::compileScript("label start:\n    \"other\"\n");
+    ASSERT_FALSE(other.empty());
+    Runner mismatch;
+    ASSERT_TRUE(GyeolTest::startRunner(mismatch, other));
+    EXPECT_FALSE(mismatch.mergeSeenLines(firstData.data(), firstData.size()));
+    EXPECT_NE(mismatch.getLastError().find("different string pool"), std::string::npos);
+
+    // string_pool 크기가 같아도 다른 스토리(또는 다시 빌드한 스토리)의 기록은 거부
+    std::string edited = kSeenScript;
+    edited.replace(edited.find("\"fin\""), 5, "\"end\"");
+    auto sameSize = GyeolTest::compileScript(edited);
+    ASSERT_FALSE(sameSize.empty());
+    Runner rebuilt;
+    ASSERT_TRUE(GyeolTest::startRunner(rebuilt, sameSize));
+    EXPECT_FALSE(rebuilt.mergeSeenLines(firstData.data(), firstData.size()));
+    EXPECT_NE(rebuilt.getLastError().find("different story build"), std::string::npos);
+    EXPECT_EQ(rebuilt.getSeenLineCount(), 0u);
+    // 식별 해시가 없는 v1 파일(magic + version + 비트 수 + 비트셋)은 거부
+    std::vector<uint8_t> v1(firstData.begin(), firstData.begin() + 12);
+    v1[4] = 1;
+    v1.insert(v1.end(), firstData.begin() + 20, firstData.end());
+    EXPECT_FALSE(merged.mergeSeenLines(v1.data(), v1.size()));
+    EXPECT_NE(merged.getLastError().find("Unsupported seen-lines version: 1"), std::string::npos);
+    auto truncated = firstData;
+    truncated.pop_back();
+    EXPECT_FALSE(merged.mergeSeenLines(truncated.data(), truncated.size()));
+    EXPECT_EQ(merged.getSeenLineCount(), 5u);
+}
@@ -1,12 +1,20 @@
 #include <gtest/gtest.h>
 
 #include "runtime_contract_harness.h"
+#include "gyeol_aot.h"
+#include "gyeol_comp_analyzer.h"
 #include "gyeol_json_ir_reader.h"
+#include "gyeol_parser.h"
 
 #include <filesystem>
+#include <set>
 
 using json = nlohmann::json;
 
+// GyeolCompiler --emit-cpp로 빌드 시 생성 (src/tests/CMakeLists.txt)
+const Gyeol::AotProgram* gyeolAot_contract_story();
+const Gyeol::AotProgram* gyeolAot_optimizer_story();
+
 namespace {
 
 std::string sourcePath(const std::string& relPath) {
@@ -24,6 +32,33 @@ bool getCheckpoint(const json& transcript, const std::string& label, json& outCh
     return false;
 }
 
+// .gyeol을 파싱해 level로 최적화한 뒤 .gyb 버퍼로 만든다
+bool compileOptimizedScript(const std::string& path, int level, std::vector<uint8_t>& outBuffer,
+                            Gyeol::AnalysisReport* report = nullptr, bool unobservedVisits = false) {
+    Gyeol::Parser parser;
+    if (!parser.parse(path)) return false;
+    Gyeol::CompilerAnalyzer analyzer;
+    analyzer.setVisitCountsUnobserved(unobservedVisits);
+    analyzer.optimize(parser.getStoryMutable(), level, report);
+    outBuffer = Gyeol::JsonIrReader::compileToBuffer(parser.getStory());
+    return !outBuffer.empty();
+}
+
+// setVisitCountsUnobserved(true)인 -O2는 스토리가 visit_count/visited로 읽지 않는 노드
+// (점프만 있는 노드, 인라인된 call)의 방문 횟수를 바꿀 수 있다. 스토리가 읽는 노드의 방문 횟수만 비교에 남긴다.
+void keepVisits(json& transcript, const std::set<std::string>& nodes) {
+    for (const char* section : {"steps", "checkpoints"}) {
+        for (auto& record : transcript[section]) {
+            if (!record.contains("state") || !record["state"].contains("visits")) continue;
+            json kept = json::object();
+            for (const auto& [name, count] : record["state"]["visits"].items()) {
+                if (nodes.count(name)) kept[name] = count;
+            }
+            record["state"]["visits"] = std::move(kept);
+        }
+    }
+}
+
 } // namespace
 
 TEST(RuntimeContractCoreTest, CrossScenarioMatchesGolden) {
@@ -250,3 +285,229 @@ TEST(RuntimeContractCoreTest, LocaleOverlayKeepsStepFlowStable) {
     std::filesystem::remove(localePath, ec);
 }
 
+
+TEST(RuntimeContractCoreTest, OptimizedStoryMatchesGolden) {
+    ICPDev::Gyeol::Schema::StoryT story;
+    std::string error;
+    ASSERT_TRUE(Gyeol::JsonIrReader::fromFile(
+        sourcePath("src/tests/conformance/runtime_contract_v1_story.json"),
+        story,
+        &error)) << error;
+    Gyeol::CompilerAnalyzer analyzer;
+    analyzer.optimize(story, 2);
+    const auto storyBuffer = Gyeol::JsonIrReader::compileToBuffer(story);
+
+    json actionsDoc;
+    ASSERT_TRUE(RuntimeContract::loadJsonFile(
+        sourcePath("src/tests/conformance/runtime_contract_v1_actions_cross.json"),
+        actionsDoc,
+        &error)) << error;
+
+    RuntimeContract::RunOptions options;
+    options.engine = "core";
+
+    json actual;
+    ASSERT_TRUE(RuntimeContract::runCoreActions(storyBuffer, actionsDoc, options, actual, &error)) << error;
+
+    json golden;
+    ASSERT_TRUE(RuntimeContract::loadJsonFile(
+        sourcePath("src/tests/conformance/runtime_contract_v1_golden_core_cross.json"),
+        golden,
+        &error)) << error;
+
+    EXPECT_TRUE(RuntimeContract::jsonEquals(golden, actual, &error)) << error;
+}
+
+TEST(RuntimeContractCoreTest, OptimizationLevelsProduceSameTranscript) {
+    const std::string storyPath = sourcePath("src/tests/conformance/runtime_contract_v1_optimizer_story.gyeol");
+    std::string error;
+    json actionsDoc;
+    ASSERT_TRUE(RuntimeContract::loadJsonFile(
+        sourcePath("src/tests/conformance/runtime_contract_v1_actions_optimizer.json"),
+        actionsDoc,
+        &error)) << error;
+
+    RuntimeContract::RunOptions options;
+    options.engine = "core";
+    options.includeVisitsInState = true;
+
+    std::vector<uint8_t> baseBuffer;
+    ASSERT_TRUE(compileOptimizedScript(storyPath, 0, baseBuffer));
+    json expected;
+    ASSERT_TRUE(RuntimeContract::runCoreActions(baseBuffer, actionsDoc, options, expected, &error)) << error;
+
+    json finished;
+    ASSERT_TRUE(getCheckpoint(expected, "finished", finished));
+    ASSERT_TRUE(finished["state"].value("finished", false));
+    json expectedObserved = expected;
+    keepVisits(expectedObserved, {"loop"});
+
+    // 기본 -O1/-O2는 모든 노드의 방문 수까지, --unobserved-visits -O2는 스토리가 읽는 노드만 같아야 한다
+    for (int level : {1, 2, 3}) {
+        const bool unobserved = level == 3;
+        const int optimizeLevel = unobserved ? 2 : level;
+        std::vector<uint8_t> buffer;
+        Gyeol::AnalysisReport report;
+        ASSERT_TRUE(compileOptimizedScript(storyPath, optimizeLevel, buffer, &report, unobserved));
+        if (optimizeLevel == 2) {
+            // 모든 -O2 패스가 실제로 무언가를 바꾼 상태에서 비교한다
+            const auto& opt = report.optimizations;
+            EXPECT_GT(opt.foldedExpressions, 0);
+            EXPECT_GT(opt.propagatedConstants, 0);
+            EXPECT_GT(opt.foldedConditions, 0);
+            EXPECT_EQ(opt.threadedJumps > 0, unobserved);
+            EXPECT_EQ(opt.inlinedCalls > 0, unobserved);
+            EXPECT_GT(opt.removedDeadStores, 0);
+            EXPECT_GT(opt.removedUnreachableNodes, 0);
+        }
+
+        json actual;
+        ASSERT_TRUE(RuntimeContract::runCoreActions(buffer, actionsDoc, options, actual, &error)) << error;
+        if (unobserved) keepVisits(actual, {"loop"});
+        EXPECT_TRUE(RuntimeContract::jsonEquals(unobserved ? expectedObserved : expected, actual, &error))
+            << "-O" << optimizeLevel << (unobserved ? " --unobserved-visits" : "") << ": " << error;
+    }
+}
+
+TEST(RuntimeContractCoreTest, AotProgramMatchesGolden) {
+    std::vector<uint8_t> storyBuffer;
+    std::string error;
+    ASSERT_TRUE(RuntimeContract::compileStoryToBuffer(
+        sourcePath("src/tests/conformance/runtime_contract_v1_story.json"),
+        storyBuffer,
+        &error)) << error;
+
+    json actionsDoc;
+    ASSERT_TRUE(RuntimeContract::loadJsonFile(
+        sourcePath("src/tests/conformance/runtime_contract_v1_actions_cross.json"),
+        actionsDoc,
+        &error)) << error;
+
+    RuntimeContract::RunOptions options;
+    options.engine = "core";
+    options.aotProgram = gyeolAot_contract_story();
+
+    json actual;
+    ASSERT_TRUE(RuntimeContract::runCoreActions(storyBuffer, actionsDoc, options, actual, &error)) << error;
+
+    json golden;
+    ASSERT_TRUE(RuntimeContract::loadJsonFile(
+        sourcePath("src/tests/conformance/runtime_contract_v1_golden_core_cross.json"),
+        golden,
+        &error)) << error;
+
+    EXPECT_TRUE(RuntimeContract::jsonEquals(golden, actual, &error)) << error;
+}
+
+TEST(RuntimeContractCoreTest, AotProgramMatchesInterpreterTranscript) {
+    struct Case {
+        std::string storyPath;
+        std::string actionsPath;
+        const Gyeol::AotProgram* program;
+        bool seeded; // actions가 시드를 고정하는지
+        const char* expectedText; // 기대 transcript에 있어야 하는 값 (nullptr이면 생략)
+    };
+    const Case cases[] = {
+        {sourcePath("src/tests/conformance/runtime_contract_v1_story.json"),
+         sourcePath("src/tests/conformance/runtime_contract_v1_actions_core_extended.json"),
+         gyeolAot_contract_story(), true, nullptr},
+        {std::string(GYEOL_TEST_AOT_DIR) + "/optimizer_story.json",
+         sourcePath("src/tests/conformance/runtime_contract_v1_actions_optimizer.json"),
+         // -INT32_MIN은 인터프리터/AOT 모두 INT32_MIN으로 감싼다
+         gyeolAot_optimizer_story(), false, "-2147483648"},
+    };
+    for (const auto& c : cases) {
+        std::vector<uint8_t> storyBuffer;
+        std::string error;
+        ASSERT_TRUE(RuntimeContract::compileStoryToBuffer(c.storyPath, storyBuffer, &error)) << error;
+        json actionsDoc;
+        ASSERT_TRUE(RuntimeContract::loadJsonFile(c.actionsPath, actionsDoc, &error)) << error;
+
+        RuntimeContract::RunOptions options;
+        options.engine = "core";
+        options.includeSeedInState = c.seeded;
+        options.includeLastErrorInState = true;
+        options.includeVisitsInState = true;
+
+        json expected;
+        ASSERT_TRUE(RuntimeContract::runCoreActions(storyBuffer, actionsDoc, options, expected, &error)) << error;
+        if (c.expectedText) EXPECT_NE(expected.dump().find(c.expectedText), std::string::npos) << c.storyPath;
+        options.aotProgram = c.program;
+        json actual;
+        ASSERT_TRUE(RuntimeContract::runCoreActions(storyBuffer, actionsDoc, options, actual, &error)) << error;
+        EXPECT_TRUE(RuntimeContract::jsonEquals(expected, actual, &error)) << c.storyPath << ": " << error;
+    }
+}
+
+TEST(RuntimeContractCoreTest, AotProgramHonorsInstructionBudget) {
+    std::vector<uint8_t> storyBuffer;
+    std::string error;
+    ASSERT_TRUE(RuntimeContract::compileStoryToBuffer(
+        sourcePath("src/tests/conformance/runtime_contract_v1_story.json"),
+        storyBuffer,
+        &error)) << error;
+
+    // 보이는 결과만 기록 (선택지는 항상 첫 번째, WAIT는 바로 resume)
+    auto transcript = [&](uint32_t budget, uint64_t& budgetYields) {
+        Gyeol::Runner runner;
+        runner.setAotProgram(gyeolAot_contract_story());
+        runner.setInstructionBudget(budget);
+        std::vector<std::string> out;
+        budgetYields = 0;
+        if (!runner.start(storyBuffer.data(), storyBuffer.size())) return out;
+        EXPECT_TRUE(runner.isAotActive());
+        runner.setSeed(11);
+        for (int guard = 0; guard < 10000 && !runner.isFinished(); ++guard) {
+            const uint64_t before = runner.getMetrics().instructionsExecuted;
+            auto r = runner.step();
+            if (budget != 0) {
+                EXPECT_LE(runner.getMetrics().instructionsExecuted - before, budget);
+            }
+            if (r.budgetExhausted) {
+                ++budgetYields;
+                continue;
+            }
+            std::string entry = std::to_string(static_cast<int>(r.type));
+            if (r.type == Gyeol::StepType::LINE) entry += std::string(":") + (r.line.text ? r.line.text : "");
+            if (r.type == Gyeol::StepType::CHOICES && !r.choices.empty()) runner.choose(0);
+            if (r.type == Gyeol::StepType::WAIT) runner.resume();
+            out.push_back(entry);
+        }
+        return out;
+    };
+
+    uint64_t yields = 0;
+    const auto expected = transcript(0, yields);
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(yields, 0u);
+    EXPECT_EQ(transcript(1, yields), expected);
+    EXPECT_GT(yields, 0u);
+}
+
+TEST(RuntimeContractCoreTest, AotProgramOnlyBindsToMatchingBuffer) {
+    std::vector<uint8_t> storyBuffer;
+    std::string error;
+    ASSERT_TRUE(RuntimeContract::compileStoryToBuffer(
+        sourcePath("src/tests/conformance/runtime_contract_v1_story.json"),
+        storyBuffer,
+        &error)) << error;
+
+    Gyeol::Runner runner;
+    runner.setAotProgram(gyeolAot_contract_story());
+    ASSERT_TRUE(runner.start(storyBuffer.data(), storyBuffer.size()));
+    EXPECT_TRUE(runner.isAotActive());
+    EXPECT_EQ(runner.step().type, Gyeol::StepType::LINE);
+
+    // 다른 .gyb는 인터프리터로 실행
+    std::vector<uint8_t> otherBuffer;
+    ASSERT_TRUE(RuntimeContract::compileStoryToBuffer(
+        std::string(GYEOL_TEST_AOT_DIR) + "/optimizer_story.json", otherBuffer, &error)) << error;
+    ASSERT_TRUE(runner.start(otherBuffer.data(), otherBuffer.size()));
+    EXPECT_FALSE(runner.isAotActive());
+    ASSERT_TRUE(runner.start(storyBuffer.data(), storyBuffer.size()));
+    EXPECT_TRUE(runner.isAotActive());
+
+    runner.setAotProgram(nullptr);
+    ASSERT_TRUE(runner.start(storyBuffer.data(), storyBuffer.size()));
+    EXPECT_FALSE(runner.isAotActive());
+}
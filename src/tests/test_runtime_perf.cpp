@@ -32,7 +32,7 @@ TEST(RuntimePerfSuiteTest, LoadsCoreSuiteFile) {
         sourcePath("src/tests/perf/runtime_perf_suite_core.json"), suite, &error))
         << error;
 
-    ASSERT_EQ(suite.scenarios.size(), 4u);
+    ASSERT_EQ(suite.scenarios.size(), 8u);
     EXPECT_EQ(suite.scenarios[0].name, "line_loop");
     EXPECT_TRUE(std::filesystem::path(suite.scenarios[0].storyPath).is_absolute());
     EXPECT_EQ(std::filesystem::path(suite.scenarios[0].storyPath).extension(), ".json");
@@ -41,6 +41,14 @@ TEST(RuntimePerfSuiteTest, LoadsCoreSuiteFile) {
     EXPECT_EQ(localeScenario.name, "locale_overlay");
     EXPECT_FALSE(localeScenario.localeCatalogPath.empty());
     EXPECT_EQ(localeScenario.locale, "ko-KR");
+    EXPECT_GT(localeScenario.memorySessions, 0);
+
+    EXPECT_FALSE(suite.scenarios[0].predecodedDispatch);
+    EXPECT_EQ(suite.scenarios[4].name, "line_loop_predecoded");
+    EXPECT_TRUE(suite.scenarios[4].predecodedDispatch);
+    EXPECT_FALSE(suite.scenarios[0].compactInstructions);
+    EXPECT_EQ(suite.scenarios[5].name, "line_loop_compact");
+    EXPECT_TRUE(suite.scenarios[5].compactInstructions);
 }
 
 TEST(RuntimePerfSuiteTest, RejectsDuplicateScenarioName) {
@@ -74,6 +82,47 @@ TEST(RuntimePerfSuiteTest, RejectsLocaleWithoutCatalog) {
     EXPECT_NE(error.find("locale requires locale_catalog"), std::string::npos);
 }
 
+TEST(RuntimePerfSuiteTest, RejectsUnknownDispatch) {
+    json doc = {
+        {"format", "gyeol-runtime-perf-suite"},
+        {"version", 1},
+        {"scenarios", json::array({
+            {{"name", "jit"}, {"story_path", "a.json"}, {"warmup", 1}, {"iterations", 1}, {"max_steps", 10}, {"dispatch", "jit"}}
+        })}
+    };
+
+    RuntimePerf::SuiteConfig suite;
+    std::string error;
+    EXPECT_FALSE(RuntimePerf::parseSuiteJson(doc, "<mem>", suite, &error));
+    EXPECT_NE(error.find("Unsupported dispatch"), std::string::npos);
+}
+
+TEST(RuntimePerfSuiteTest, PredecodedDispatchMatchesInstructionCounts) {
+    RuntimePerf::SuiteConfig suite;
+    std::string error;
+    ASSERT_TRUE(RuntimePerf::loadSuiteFile(
+        sourcePath("src/tests/perf/runtime_perf_suite_core.json"), suite, &error))
+        << error;
+
+    RuntimePerf::SuiteConfig branchOnly;
+    branchOnly.sourcePath = suite.sourcePath;
+    for (const auto& scenario : suite.scenarios) {
+        if (scenario.name.rfind("branch_heavy", 0) == 0) {
+            branchOnly.scenarios.push_back(scenario);
+            branchOnly.scenarios.back().warmup = 0;
+            branchOnly.scenarios.back().iterations = 1;
+        }
+    }
+    ASSERT_EQ(branchOnly.scenarios.size(), 2u);
+
+    RuntimePerf::RunReport report;
+    ASSERT_TRUE(RuntimePerf::runSuite(branchOnly, report, &error)) << error;
+    ASSERT_EQ(report.scenarios.size(), 2u);
+    EXPECT_EQ(report.scenarios[0].medianStepCalls, report.scenarios[1].medianStepCalls);
+    EXPECT_EQ(report.scenarios[0].medianInstructionsExecuted, report.scenarios[1].medianInstructionsExecuted);
+    EXPECT_GT(report.scenarios[1].medianInstructionsExecuted, 0u);
+}
+
 TEST(RuntimePerfSuiteTest, RunsSingleScenarioFromJsonIrSource) {
     RuntimePerf::SuiteConfig suite;
     suite.sourcePath = sourcePath("src/tests/perf/runtime_perf_suite_core.json");
@@ -103,6 +152,68 @@ TEST(RuntimePerfSuiteTest, RunsSingleScenarioFromJsonIrSource) {
     EXPECT_GT(scenario.throughputStepCallsPerSec, 0.0);
 }
 
+TEST(RuntimePerfSuiteTest, MeasuresSharedLocaleCatalogSessionMemory) {
+    RuntimePerf::SuiteConfig suite;
+    std::string error;
+    ASSERT_TRUE(RuntimePerf::loadSuiteFile(
+        sourcePath("src/tests/perf/runtime_perf_suite_core.json"), suite, &error))
+        << error;
+
+    RuntimePerf::SuiteConfig localeOnly;
+    localeOnly.sourcePath = suite.sourcePath;
+    localeOnly.scenarios.push_back(suite.scenarios[3]);
+    localeOnly.scenarios[0].warmup = 1;
+    localeOnly.scenarios[0].iterations = 1;
+    localeOnly.scenarios[0].memorySessions = 4;
+
+    RuntimePerf::RunReport report;
+    ASSERT_TRUE(RuntimePerf::runSuite(localeOnly, report, &error)) << error;
+    ASSERT_EQ(report.scenarios.size(), 1u);
+
+    const auto& scenario = report.scenarios[0];
+    EXPECT_EQ(scenario.memorySessions, 4);
+    EXPECT_GT(scenario.perSessionBytesPrivate, 0);
+    EXPECT_GT(scenario.sharedCatalogBytes, 0);
+    EXPECT_LT(scenario.perSessionBytesShared, scenario.perSessionBytesPrivate);
+
+    RuntimePerf::RunReport roundTrip;
+    ASSERT_TRUE(RuntimePerf::parseRunReportJson(RuntimePerf::runReportToJson(report), roundTrip, &error)) << error;
+    ASSERT_EQ(roundTrip.scenarios.size(), 1u);
+    EXPECT_EQ(roundTrip.scenarios[0].perSessionBytesShared, scenario.perSessionBytesShared);
+    EXPECT_EQ(roundTrip.scenarios[0].sharedCatalogBytes, scenario.sharedCatalogBytes);
+}
+
+TEST(RuntimePerfSuiteTest, ProfilesScenarioPerNode) {
+    RuntimePerf::SuiteConfig suite;
+    std::string error;
+    ASSERT_TRUE(RuntimePerf::loadSuiteFile(
+        sourcePath("src/tests/perf/runtime_perf_suite_core.json"), suite, &error))
+        << error;
+    suite.scenarios[0].iterations = 2;
+
+    RuntimePerf::ProfileResult result;
+    ASSERT_TRUE(RuntimePerf::profileScenario(suite, "line_loop", result, &error)) << error;
+    EXPECT_EQ(result.scenario, "line_loop");
+    ASSERT_FALSE(result.profile.nodes.empty());
+    ASSERT_FALSE(result.profile.instructions.empty());
+    EXPECT_FALSE(result.collapsedNs.empty());
+    EXPECT_FALSE(result.collapsedInstructions.empty());
+
+    uint64_t nodeInstructions = 0;
+    for (const auto& node : result.profile.nodes) nodeInstructions += node.instructions;
+    uint64_t stackInstructions = 0;
+    for (const auto& stack : result.profile.stacks) stackInstructions += stack.instructions;
+    EXPECT_EQ(nodeInstructions, stackInstructions);
+
+    const json doc = RuntimePerf::profileResultToJson(result);
+    EXPECT_EQ(doc["format"], "gyeol-runtime-profile");
+    EXPECT_EQ(doc["iterations"], 2);
+    EXPECT_EQ(doc["nodes"].size(), result.profile.nodes.size());
+
+    EXPECT_FALSE(RuntimePerf::profileScenario(suite, "missing", result, &error));
+    EXPECT_NE(error.find("Scenario not found"), std::string::npos);
+}
+
 TEST(RuntimePerfCompareTest, PassesWithinThreshold) {
     const auto baseline = makeRunReport({
         {"line_loop", 100},
@@ -185,3 +296,52 @@ TEST(RuntimePerfCompareTest, FailsWhenScenarioIsExtra) {
     EXPECT_FALSE(RuntimePerf::compareReports(baseline, actual, 0.15, report, &error));
     EXPECT_NE(error.find("extra scenario"), std::string::npos);
 }
+
+TEST(RuntimePerfParseTest, SyntheticSourceReportsThroughput) {
+    const std::string source = RuntimePerf::makeSyntheticParseSource(50);
+
+    RuntimePerf::ParseBenchmarkResult result;
+    std::string error;
+    ASSERT_TRUE(RuntimePerf::runParseBenchmark("synthetic_50", source, 2, result, &error)) << error;
+    EXPECT_EQ(result.iterations, 2);
+    EXPECT_EQ(result.bytes, source.size());
+    EXPECT_EQ(result.lines, 5u + 50u * 9u);
+    EXPECT_GT(result.linesPerSec, 0.0);
+    EXPECT_GT(result.megabytesPerSec, 0.0);
+
+    const json doc = RuntimePerf::parseBenchmarkToJson(result);
+    EXPECT_EQ(doc["format"], "gyeol-parse-perf");
+    EXPECT_EQ(doc["lines"], result.lines);
+}
+
+TEST(RuntimePerfParseTest, ReportsParseErrors) {
+    RuntimePerf::ParseBenchmarkResult result;
+    std::string error;
+    EXPECT_FALSE(RuntimePerf::runParseBenchmark("broken", "label start:\n    jump\n", 1, result, &error));
+    EXPECT_NE(error.find("Parse failed"), std::string::npos);
+}
+
+TEST(RuntimePerfParseTest, SyntheticImportProjectParsesIdentically) {
+    const auto dir = std::filesystem::temp_directory_path() / "gyeol_test_import_project";
+    std::filesystem::remove_all(dir);
+
+    RuntimePerf::ImportProjectInfo project;
+    std::string error;
+    ASSERT_TRUE(RuntimePerf::writeSyntheticImportProject(dir.string(), 4, 10, project, &error)) << error;
+    EXPECT_EQ(project.files, 5u);
+
+    RuntimePerf::ImportParseBenchmarkResult result;
+    const bool ok = RuntimePerf::runImportParseBenchmark(project, 3, 1, result, &error);
+    std::filesystem::remove_all(dir);
+    ASSERT_TRUE(ok) << error;
+    EXPECT_TRUE(result.parallel);
+    EXPECT_TRUE(result.identical);
+    EXPECT_EQ(result.threads, 3u);
+    EXPECT_GT(result.serialMedianNs, 0u);
+    EXPECT_GT(result.parallelMedianNs, 0u);
+    EXPECT_EQ(result.cacheHits, 5u);
+
+    const json doc = RuntimePerf::importParseBenchmarkToJson(result);
+    EXPECT_EQ(doc["format"], "gyeol-import-parse-perf");
+    EXPECT_EQ(doc["files"], 5u);
+}
@@ -37,7 +37,16 @@ def validate_baseline(path: Path) -> None:
     scenarios = data.get("scenarios")
     if not isinstance(scenarios, list) or not scenarios:
         raise RuntimeError("Baseline scenarios must be a non-empty array.")
-    required_names = {"line_loop", "choice_filter", "typed_command", "locale_overlay"}
+    required_names = {
+        "line_loop",
+        "choice_filter",
+        "typed_command",
+        "locale_overlay",
+        "line_loop_predecoded",
+        "line_loop_compact",
+        "branch_heavy",
+        "branch_heavy_predecoded",
+    }
     actual_names = {s.get("name") for s in scenarios if isinstance(s, dict)}
     if actual_names != required_names:
         raise RuntimeError(